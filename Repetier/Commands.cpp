@@ -47,6 +47,10 @@ void Commands::commandLoop() {
             state = Paused;
         }
 
+#if FEATURE_SEGMENT_MERGING
+        Printer::flushMergedSegment(); // no next move to merge with
+#endif // FEATURE_SEGMENT_MERGING
+
         Commands::checkForPeriodicalActions(state); //check heater and other stuff every n milliseconds
     }
 } // commandLoop
@@ -91,6 +95,10 @@ void Commands::checkForPeriodicalActions(enum FirmwareState state) {
         loopFeatures();
     }
 
+#if FEATURE_SEGMENT_TRACE
+    PrintLine::flushSegmentTrace();
+#endif // FEATURE_SEGMENT_TRACE
+
     DEBUG_MEMORY;
 } // checkForPeriodicalActions
 
@@ -101,8 +109,16 @@ void Commands::checkForPeriodicalActions(enum FirmwareState state) {
 void Commands::waitUntilEndOfAllMoves() {
     bool bWait = false;
 
+#if FEATURE_SEGMENT_MERGING
+    Printer::flushMergedSegment();
+#endif // FEATURE_SEGMENT_MERGING
+
     if (PrintLine::hasLines())
         bWait = true;
+#if FEATURE_INPUT_SHAPING
+    if (PrintLine::shaperX.isBusy() || PrintLine::shaperY.isBusy())
+        bWait = true;
+#endif // FEATURE_INPUT_SHAPING
 #if FEATURE_FIND_Z_ORIGIN
     if (g_nFindZOriginStatus)
         bWait = true;
@@ -118,6 +134,10 @@ void Commands::waitUntilEndOfAllMoves() {
         bWait = false;
         if (PrintLine::hasLines())
             bWait = true;
+#if FEATURE_INPUT_SHAPING
+        if (PrintLine::shaperX.isBusy() || PrintLine::shaperY.isBusy())
+            bWait = true;
+#endif // FEATURE_INPUT_SHAPING
 
 #if FEATURE_FIND_Z_ORIGIN
         if (g_nFindZOriginStatus)
@@ -528,6 +548,12 @@ void Commands::executeGCode(GCode* com) {
     GCodeSource::activeSource = com->source;
     Com::writeToAll = true;
 
+#if FEATURE_SEGMENT_MERGING
+    // only G0/G1 can be merged, everything else expects the held move in the queue
+    if (!com->hasG() || com->G > 1)
+        Printer::flushMergedSegment();
+#endif // FEATURE_SEGMENT_MERGING
+
     if (com->hasG()) {
         Commands::processGCode(com);
     } else if (com->hasM()) // Process M Code
@@ -1180,6 +1206,9 @@ void Commands::processMCode(GCode* com) {
         if (Printer::debugInfo()) {
             Com::printFLN(Com::tFirmware);
         }
+#if FEATURE_BINARY_BATCH
+        Com::cap(PSTR("BINARY_BATCH:1")); // bit 14 of the first bitfield marks a batch frame instead of an internal command
+#endif // FEATURE_BINARY_BATCH
         //#if EEPROM_MODE != 0
         //		Com::cap(PSTR("EEPROM:1"));
         //#else
@@ -1447,9 +1476,11 @@ void Commands::processMCode(GCode* com) {
         if (Printer::debugInfo()) {
             Com::printF(Com::tLinearStepsColon, maxadv2);
             Com::printFLN(Com::tCommaSpeedEqual, maxadvspeed);
+            Com::printFLN(PSTR("Extruder direction changes:"), (int32_t)Printer::advanceDirectionChanges);
         }
         maxadv2 = 0;
         maxadvspeed = 0;
+        Printer::advanceDirectionChanges = 0;
         break;
     }
     case 233: // M233
@@ -1457,6 +1488,15 @@ void Commands::processMCode(GCode* com) {
         if (com->hasY())
             Extruder::current->advanceL = com->Y;
         Com::printF(Com::tLinearLColon, Extruder::current->advanceL);
+#if FEATURE_SEGMENT_ADVANCE
+        // M233 X[K] Y[L] S[smoothing time in ms], new values are used for the moves planned afterwards
+        if (com->hasX())
+            Extruder::current->advanceK = constrain(com->X, 0.0f, ADVANCE_K_MAX);
+        if (com->hasS())
+            Printer::advanceSmoothingTime = constrain(com->S, 0, ADVANCE_SMOOTHING_TIME_MAX);
+        Com::printF(Com::tQuadraticKColon, Extruder::current->advanceK);
+        Com::printF(PSTR(" smoothing [ms]:"), Printer::advanceSmoothingTime, 0);
+#endif // FEATURE_SEGMENT_ADVANCE
         Com::println();
         Printer::updateAdvanceActivated();
         break;
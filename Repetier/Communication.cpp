@@ -211,6 +211,26 @@ FSTRINGVALUE(Com::tEPRYBacklash, "Y backlash [mm]")
 FSTRINGVALUE(Com::tEPRZBacklash, "Z backlash [mm]")
 FSTRINGVALUE(Com::tEPRMaxXYJerk, "Max. XY-jerk [mm/s]")
 FSTRINGVALUE(Com::tEPRMaxZJerk, "Max. Z-jerk [mm/s]")
+#if FEATURE_JUNCTION_DEVIATION
+FSTRINGVALUE(Com::tEPRJunctionMode, "Junction mode [0=jerk,1=deviation]")
+FSTRINGVALUE(Com::tEPRJunctionDeviation, "Junction deviation [mm]")
+#endif // FEATURE_JUNCTION_DEVIATION
+#if FEATURE_S_CURVE_ACCELERATION
+FSTRINGVALUE(Com::tEPRSCurveMode, "Acceleration profile [0=trapezoid,1=S-curve]")
+FSTRINGVALUE(Com::tEPRSCurveAcceleration, "S-curve X/Y print acceleration [mm/s^2]")
+#endif // FEATURE_S_CURVE_ACCELERATION
+#if FEATURE_INPUT_SHAPING
+FSTRINGVALUE(Com::tEPRShaperXFrequency, "Input shaping X frequency [Hz,0=off]")
+FSTRINGVALUE(Com::tEPRShaperXDamping, "Input shaping X damping")
+FSTRINGVALUE(Com::tEPRShaperYFrequency, "Input shaping Y frequency [Hz,0=off]")
+FSTRINGVALUE(Com::tEPRShaperYDamping, "Input shaping Y damping")
+#endif // FEATURE_INPUT_SHAPING
+#if FEATURE_SEGMENT_ADVANCE
+FSTRINGVALUE(Com::tEPRAdvanceSmoothing, "Advance smoothing time [ms]")
+#endif // FEATURE_SEGMENT_ADVANCE
+#if FEATURE_Z_MATRIX_SPLINE
+FSTRINGVALUE(Com::tEPRZMatrixInterpolation, "Z-matrix interpolation [0=bilinear,1=Catmull-Rom]")
+#endif // FEATURE_Z_MATRIX_SPLINE
 FSTRINGVALUE(Com::tEPRXStepsPerMM, "X-axis resolution [steps/mm]")
 FSTRINGVALUE(Com::tEPRYStepsPerMM, "Y-axis resolution [steps/mm]")
 FSTRINGVALUE(Com::tEPRZStepsPerMM, "Z-axis resolution [steps/mm]")
@@ -362,10 +382,12 @@ void Com::config(FSTRINGPARAM(text)) {
     printF(tConfig);
     printFLN(text);
 }
+#ifndef SIMULATOR // the host has a 32 bit int, which is int32_t
 void Com::config(FSTRINGPARAM(text), int value) {
     printF(tConfig);
     printFLN(text, value);
 }
+#endif // SIMULATOR
 void Com::config(FSTRINGPARAM(text), const char* msg) {
     printF(tConfig);
     printF(text);
@@ -436,10 +458,12 @@ void Com::printF(FSTRINGPARAM(text), const char* msg) {
     print(msg);
 } // printF
 
+#ifndef SIMULATOR // the host has a 32 bit int, which is int32_t
 void Com::printF(FSTRINGPARAM(text), int value) {
     printF(text);
     print(value);
 } // printF
+#endif // SIMULATOR
 
 void Com::printF(FSTRINGPARAM(text), int32_t value) {
     printF(text);
@@ -451,11 +475,13 @@ void Com::printF(FSTRINGPARAM(text), uint32_t value) {
     printNumber(value);
 } // printF
 
+#ifndef SIMULATOR // the host has a 32 bit int, which is int32_t
 void Com::printFLN(FSTRINGPARAM(text), int value) {
     printF(text);
     print(value);
     println();
 } // printFLN
+#endif // SIMULATOR
 
 void Com::printFLN(FSTRINGPARAM(text), int32_t value) {
     printF(text);
@@ -225,6 +225,26 @@ public:
     FSTRINGVAR(tEPRZMaxFeedrate)
     FSTRINGVAR(tEPRZHomingFeedrate)
     FSTRINGVAR(tEPRMaxZJerk)
+#if FEATURE_JUNCTION_DEVIATION
+    FSTRINGVAR(tEPRJunctionMode)
+    FSTRINGVAR(tEPRJunctionDeviation)
+#endif // FEATURE_JUNCTION_DEVIATION
+#if FEATURE_S_CURVE_ACCELERATION
+    FSTRINGVAR(tEPRSCurveMode)
+    FSTRINGVAR(tEPRSCurveAcceleration)
+#endif // FEATURE_S_CURVE_ACCELERATION
+#if FEATURE_INPUT_SHAPING
+    FSTRINGVAR(tEPRShaperXFrequency)
+    FSTRINGVAR(tEPRShaperXDamping)
+    FSTRINGVAR(tEPRShaperYFrequency)
+    FSTRINGVAR(tEPRShaperYDamping)
+#endif // FEATURE_INPUT_SHAPING
+#if FEATURE_SEGMENT_ADVANCE
+    FSTRINGVAR(tEPRAdvanceSmoothing)
+#endif // FEATURE_SEGMENT_ADVANCE
+#if FEATURE_Z_MATRIX_SPLINE
+    FSTRINGVAR(tEPRZMatrixInterpolation)
+#endif // FEATURE_Z_MATRIX_SPLINE
     FSTRINGVAR(tEPRXStepsPerMM)
     FSTRINGVAR(tEPRYStepsPerMM)
     FSTRINGVAR(tEPRXMaxFeedrate)
@@ -350,7 +370,9 @@ public:
 
     static void cap(FSTRINGPARAM(text));
     static void config(FSTRINGPARAM(text));
+#ifndef SIMULATOR // the host has a 32 bit int, which is int32_t
     static void config(FSTRINGPARAM(text), int value);
+#endif // SIMULATOR
     static void config(FSTRINGPARAM(text), const char* msg);
     static void config(FSTRINGPARAM(text), int32_t value);
     static void config(FSTRINGPARAM(text), uint32_t value);
@@ -364,12 +386,16 @@ public:
     static void printErrorFLN(FSTRINGPARAM(text));
     static void printFLN(FSTRINGPARAM(text));
     static void printF(FSTRINGPARAM(ptr));
+#ifndef SIMULATOR // the host has a 32 bit int, which is int32_t
     static void printF(FSTRINGPARAM(text), int value);
+#endif // SIMULATOR
     static void printF(FSTRINGPARAM(text), const char* msg);
     static void printF(FSTRINGPARAM(text), int32_t value);
     static void printF(FSTRINGPARAM(text), uint32_t value);
     static void printF(FSTRINGPARAM(text), float value, uint8_t digits = 2, bool komma_as_dot = false);
+#ifndef SIMULATOR // the host has a 32 bit int, which is int32_t
     static void printFLN(FSTRINGPARAM(text), int value);
+#endif // SIMULATOR
     static void printFLN(FSTRINGPARAM(text), int32_t value);
     static void printFLN(FSTRINGPARAM(text), uint32_t value);
     static void printFLN(FSTRINGPARAM(text), const char* msg);
@@ -379,8 +405,20 @@ public:
     static void printSharpLine();
     static void print(int32_t value);
     static inline void print(uint32_t value) { printNumber(value); }
+#ifndef SIMULATOR // the host has a 32 bit int, which is int32_t
     static inline void print(int value) { print((int32_t)value); }
+#endif // SIMULATOR
     static void print(const char* text);
+#ifdef SIMULATOR // long has 64 bit on the host
+    static inline void config(FSTRINGPARAM(text), long value) { config(text, (int32_t)value); }
+    static inline void config(FSTRINGPARAM(text), unsigned long value) { config(text, (uint32_t)value); }
+    static inline void printF(FSTRINGPARAM(text), long value) { printF(text, (int32_t)value); }
+    static inline void printF(FSTRINGPARAM(text), unsigned long value) { printF(text, (uint32_t)value); }
+    static inline void printFLN(FSTRINGPARAM(text), long value) { printFLN(text, (int32_t)value); }
+    static inline void printFLN(FSTRINGPARAM(text), unsigned long value) { printFLN(text, (uint32_t)value); }
+    static inline void print(long value) { print((int32_t)value); }
+    static inline void print(unsigned long value) { printNumber((uint32_t)value); }
+#endif // SIMULATOR
     static inline void print(char c) {
         GCodeSource::writeToAll(c);
     }
@@ -101,6 +101,55 @@
   #define DEBUG_HEAT_BED_SCAN               0                                                    // 0 = off, 1 = on, 2 = on with more debug outputs
 #endif // FEATURE_HEAT_BED_Z_COMPENSATION
 
+/** \brief Remembers the matrix cell of the last z-compensation lookup with its borders in steps and its interpolation coefficients.
+ * The next lookup only walks to the neighbour cells, so no full scan with float conversions is needed every 16 ms. */
+#define FEATURE_Z_MATRIX_CACHE              0                                                    // 1 = on, 0 = off
+
+/** \brief The path planner computes the z-matrix depth at the start and the end of every queued move and the stepper interrupt
+ * moves the z-compensation target along the move. The 16 ms update only provides the layer dependent scale and the offsets then.
+ * Long moves are split into parts which are not longer than one matrix cell. */
+#define FEATURE_SEGMENT_Z_COMPENSATION      0                                                    // 1 = on, 0 = off
+
+#if FEATURE_SEGMENT_Z_COMPENSATION && !FEATURE_HEAT_BED_Z_COMPENSATION
+    #error FEATURE_SEGMENT_Z_COMPENSATION can not be used without FEATURE_HEAT_BED_Z_COMPENSATION
+#endif // FEATURE_SEGMENT_Z_COMPENSATION && !FEATURE_HEAT_BED_Z_COMPENSATION
+
+/** \brief Allows a bicubic interpolation of the z-matrix: cubic Hermite curves with Catmull-Rom tangents instead of straight lines between the scan points.
+ * It has no creases at the cell borders, so a coarser scan grid gives the same surface. Select the mode with M3210, it is stored in the EEPROM. */
+#define FEATURE_Z_MATRIX_SPLINE             0                                                    // 1 = on, 0 = off
+
+#if FEATURE_Z_MATRIX_SPLINE
+  #if !FEATURE_Z_MATRIX_CACHE
+    #error FEATURE_Z_MATRIX_SPLINE can not be used without FEATURE_Z_MATRIX_CACHE
+  #endif // !FEATURE_Z_MATRIX_CACHE
+
+  #define Z_MATRIX_INTERPOLATION_BILINEAR       0
+  #define Z_MATRIX_INTERPOLATION_CATMULL_ROM    1
+  #define Z_MATRIX_INTERPOLATION_DEFAULT        Z_MATRIX_INTERPOLATION_BILINEAR
+#endif // FEATURE_Z_MATRIX_SPLINE
+
+/** \brief Allows an adaptive heat bed scan: a coarse grid is scanned first and only the cells of it which are not planar are scanned with the full resolution.
+ * The other points of the matrix are interpolated. The coarse grid and the tolerance are configured with M3211, the defaults are in the printer header. */
+#define FEATURE_ADAPTIVE_HEAT_BED_SCAN      0                                                    // 1 = on, 0 = off
+
+#if FEATURE_ADAPTIVE_HEAT_BED_SCAN && !FEATURE_HEAT_BED_Z_COMPENSATION
+    #error FEATURE_ADAPTIVE_HEAT_BED_SCAN can not be used without FEATURE_HEAT_BED_Z_COMPENSATION
+#endif // FEATURE_ADAPTIVE_HEAT_BED_SCAN && !FEATURE_HEAT_BED_Z_COMPENSATION
+
+/** \brief Allows a pipelined heat bed scan: the travel to the next point is not awaited, the idle delay (M3042) runs while the bed travels and the idle pressure
+ * is sampled without blocking as soon as the travel has ended. The point is probed once the samples are stable, the scan parameters are used as they are. */
+#define FEATURE_PIPELINED_HEAT_BED_SCAN     0                                                    // 1 = on, 0 = off
+
+#if FEATURE_PIPELINED_HEAT_BED_SCAN
+  #if !FEATURE_HEAT_BED_Z_COMPENSATION
+    #error FEATURE_PIPELINED_HEAT_BED_SCAN can not be used without FEATURE_HEAT_BED_Z_COMPENSATION
+  #endif // !FEATURE_HEAT_BED_Z_COMPENSATION
+
+  #define HEAT_BED_SCAN_WAIT_FOR_TRAVEL         false
+#else
+  #define HEAT_BED_SCAN_WAIT_FOR_TRAVEL         true
+#endif // FEATURE_PIPELINED_HEAT_BED_SCAN
+
 /**
  * \brief The Firmwares disalowes movement before you at least: pressed a printers button, set a temperature, homed once
  * If you did not do this, a previous watchdog reset is assumed and fail-drive against some border without homing is blocked thatway.
@@ -297,6 +346,14 @@ Overridden if EEPROM activated. */
 #define MAX_TRAVEL_ACCELERATION_UNITS_PER_SQ_SECOND_Y           1500
 #define MAX_TRAVEL_ACCELERATION_UNITS_PER_SQ_SECOND_Z           100
 
+/** \brief S-curve acceleration for queued moves. The speed follows v = vStart + dv * (3 t² - 2 t³) over the ramp instead of a straight line, so the
+acceleration rises and falls smoothly and the jerk at the start and end of each ramp is limited. The ramps keep their length and duration, the average
+acceleration is S_CURVE_ACCELERATION_XY and the peak acceleration is 1.5 times of it. The print acceleration of M201 / EEPROM stays the upper limit of the
+average. Select it with M3205, the settings are stored in EEPROM. */
+#define FEATURE_S_CURVE_ACCELERATION                            0
+#define S_CURVE_MODE_DEFAULT                                    0                       // 0 = trapezoid, 1 = S-curve
+#define S_CURVE_ACCELERATION_XY                                 2000                    // average X/Y acceleration for printing moves in mm/s^2 while the S-curve is active
+
 /** \brief X, Y, Z acceleration limits */
 #define ACCELERATION_MAX_XY										6000
 #define ACCELERATION_MIN_XY										100
@@ -360,6 +417,50 @@ Overridden if EEPROM activated. */
 #define MAX_JERK_DISTANCE                   0.6
 //for a more logical jerk computation.
 #define ALTERNATIVE_JERK                    1
+//keeps the junction speeds of the path planner squared in fixed point, so backwardPlanner()/forwardPlanner() need no sqrt() and no division.
+#define FIXED_POINT_PLANNER                 0
+
+/**
+ * \brief Junction deviation (centripetal) corner speeds as alternative to the jerk computation. The corner is passed on a virtual arc
+ * which deviates JUNCTION_DEVIATION mm from the sharp corner, so the allowed speed depends on the angle and the acceleration and not on the
+ * length of the segments. Curves made of many small segments keep their speed. Select the mode with M3203, it is stored in EEPROM.
+ */
+#define FEATURE_JUNCTION_DEVIATION          0                                                   // 1 = on, 0 = off
+#define JUNCTION_MODE_DEFAULT               JUNCTION_MODE_JERK                                  // JUNCTION_MODE_JERK or JUNCTION_MODE_DEVIATION
+#define JUNCTION_DEVIATION                  0.02                                                // [mm]
+#define JUNCTION_DEVIATION_MIN              0.001
+#define JUNCTION_DEVIATION_MAX              0.5
+
+/**
+ * \brief Merges consecutive nearly collinear G0/G1 moves into one queued move before they reach the path planner. A move is held back until the
+ * next one shows that every joint of the chain lies within SEGMENT_MERGE_TOLERANCE mm of the merged line and the extrusion per mm stays within SEGMENT_MERGE_E_TOLERANCE.
+ * The joints are kept for this check, so at most SEGMENT_MERGE_MAX_JOINTS + 1 moves become one.
+ * Any other command or an empty command buffer sends the held move. M3204 shows the merge ratio and sets the tolerance (D0 = off).
+ */
+#define FEATURE_SEGMENT_MERGING             0                                                   // 1 = on, 0 = off
+#define SEGMENT_MERGE_TOLERANCE             0.01                                                // [mm]
+#define SEGMENT_MERGE_E_TOLERANCE           0.02                                                // relative difference of the extrusion per mm
+#define SEGMENT_MERGE_MAX_LENGTH            5.0                                                 // [mm] longer moves would weaken the look-ahead
+#define SEGMENT_MERGE_MAX_JOINTS            8                                                   // 12 bytes of RAM per joint
+
+/**
+ * \brief ZV input shaping for X and Y. Every step of a queued move is split into two impulses: A1 is done at once, A2 = 1 - A1 is done half a damped
+ * period later. The two impulses cancel the ringing at the configured frequency. The output is rounded to full steps, so more microsteps
+ * give a finer shaping. Frequency and damping per axis are set with M3206 and stored in EEPROM, frequency 0 = off.
+ * One queue entry collects the delayed impulses of 1/16 of the delay, so about 17 entries are in use at any step rate.
+ */
+#define FEATURE_INPUT_SHAPING               0                                                   // 1 = on, 0 = off
+#define INPUT_SHAPING_FREQUENCY_X           0                                                   // [Hz] 0 = off
+#define INPUT_SHAPING_FREQUENCY_Y           0                                                   // [Hz] 0 = off
+#define INPUT_SHAPING_DAMPING_X             0.1
+#define INPUT_SHAPING_DAMPING_Y             0.1
+#define INPUT_SHAPING_MIN_FREQUENCY         20                                                  // [Hz] the delay must stay below 32 ms
+#define INPUT_SHAPING_MAX_FREQUENCY         200                                                 // [Hz]
+#define INPUT_SHAPING_MAX_DAMPING           0.5
+#define INPUT_SHAPING_QUEUE_SIZE            32                                                  // entries per axis, power of 2. 3 bytes RAM each. If full, the delayed part is done at once.
+#define INPUT_SHAPING_PULSE_US              2                                                   // [us] high and low time of a step pulse from the shaper
+#define INPUT_SHAPING_DIR_SETUP_US          1                                                   // [us] time from a change of the direction pin to the step, see the driver datasheet
+#define INPUT_SHAPING_MAX_STEPS_PER_CALL    8                                                   // steps per axis and stepper interrupt, the rest follows with the next one
 
 // ##########################################################################################
 // ##   debugging
@@ -378,6 +479,39 @@ Overridden if EEPROM activated. */
  #define DEBUG_MEMORY
 #endif // DEBUG_FREE_MEMORY
 
+/**
+ * \brief Collects a checksum over the step count and the interval of every stepper timer call. Printing the same G-Code twice with unchanged
+ * step timing gives the same checksum, so two firmware versions can be compared without a scope. Use M3201 to read/reset it. Costs execution time.
+ */
+#define FEATURE_STEP_TRACE                  0                                                   // 1 = on, 0 = off
+
+/**
+ * \brief Measures the time spent in updateTrapezoids(), computeMaxJunctionSpeed(), backwardPlanner(), forwardPlanner() and updateStepsParameter().
+ * Send a recorded or synthetic G-Code stream (curves, arcs, 0.1 mm segments) and read the results per segment with M3202. Costs execution time.
+ */
+#define FEATURE_PLANNER_TIMING              0                                                   // 1 = on, 0 = off
+
+/**
+ * \brief Counts the queued moves which were slowed down because less than MOVE_CACHE_LOW moves were cached, the time this added and a histogram of the
+ * cached moves at the start of every move. A slow USB host or SD card shows up as many slowed moves. Use M3208 to read/reset it or to output it periodically.
+ */
+#define FEATURE_QUEUE_TELEMETRY             0                                                   // 1 = on, 0 = off
+
+/**
+ * \brief Records the planned trapezoid (vStart, vMax, vEnd, acceleration and deceleration steps) and the executed peak speed and stepper timer calls of every
+ * finished queued move into a ring buffer, which is sent as CSV lines "ST:..." whenever the serial output buffer has room. Gaps in the sequence show dropped
+ * records, M3209 outputs their number. Use M3209 S1 to start and M3209 S0 to stop it. Costs RAM.
+ */
+#define FEATURE_SEGMENT_TRACE               0                                                   // 1 = on, 0 = off
+
+/**
+ * \brief Measures min/avg/max duration in CPU cycles and the overruns of the stepper, the PWM and the extruder interrupt with timer 1.
+ * The stepper interrupt is measured from its compare match, so the entry latency and nested interrupts are part of it. A PWM or extruder
+ * interrupt during which timer 1 restarted is only counted as skipped. An overrun is a call which took longer than the time until its next
+ * call. Use M3207 to read/reset it. Costs execution time in every interrupt.
+ */
+#define FEATURE_ISR_TIMING                  0                                                   // 1 = on, 0 = off
+
 // ##########################################################################################
 // ##   configuration of the extended buttons
 // ##########################################################################################
@@ -1002,9 +1136,21 @@ we use blocks of 2 kByte size for the structure of our EEPROM
 /** \brief After this count of steps a new SIN / COS caluclation is startet to correct the circle interpolation */
 #define N_ARC_CORRECTION                    25
 
-/** \brief Communication speed. Overridden if EEPROM activated. */
+/** \brief Communication speed. Overridden if EEPROM activated.
+ * At 16 MHz, 250000, 500000 and 1000000 are exact. 115200 has an error of about 2 %, M3212 shows the speed which is used actually. */
 #define BAUDRATE                            115200
 
+/** \brief Largest difference between the wanted and the actual speed of the serial port in 0.1 %. A slower or faster rate, e.g. 230400, 460800
+ * or 1500000 at 16 MHz, is replaced by BAUDRATE at the start and skipped in the menu, because the receiver would misread the bytes. */
+#define SERIAL_MAX_BAUD_ERROR               25                                                  // [0.1 %]
+
+/** \brief Size of the receive ring of the serial port: 64, 128 or 256 bytes. At high baud rates a bigger ring survives longer main loop stalls. */
+#define SERIAL_RX_BUFFER_SIZE               128
+
+/** \brief Decodes the numbers of ASCII commands with an integer mantissa and one final float conversion instead of strtod()/strtol().
+ * The parser continues behind each number, so the digits are not scanned twice. */
+#define FEATURE_FAST_ASCII_PARSER           0                                                   // 1 = on, 0 = off
+
 /**
  * \brief Cache size for incoming commands.
  * There should be no reason to increase this cache. Commands are nearly immediately sent to
@@ -1012,12 +1158,47 @@ we use blocks of 2 kByte size for the structure of our EEPROM
  */
 #define GCODE_BUFFER_SIZE                   2
 
+/**
+ * \brief Stores the received commands packed in a ring of COMMAND_BUFFER_BYTES bytes instead of GCODE_BUFFER_SIZE complete commands.
+ * Only the parameters which are present are stored, a G1 with X, Y, E and F needs about 30 bytes instead of about 90. A new command is
+ * accepted as long as a command with all parameters would still fit, so the host gets its ok without waiting for the execution.
+ */
+#define FEATURE_COMPACT_COMMAND_BUFFER      0                                                   // 1 = on, 0 = off
+
+#if FEATURE_COMPACT_COMMAND_BUFFER
+  #define COMMAND_BUFFER_BYTES              256                                                 // [bytes]
+
+  #if COMMAND_BUFFER_BYTES < 192 || COMMAND_BUFFER_BYTES > 2048
+    #error COMMAND_BUFFER_BYTES must hold at least two commands with all parameters and can not be bigger than 2048
+  #endif // COMMAND_BUFFER_BYTES < 192 || COMMAND_BUFFER_BYTES > 2048
+#endif // FEATURE_COMPACT_COMMAND_BUFFER
+
 /**
  * \brief Appends the linenumber after every ok send, to acknowledge the received command.
  * Uncomment for plain ok ACK if your host has problems with this
  */
 #define ACK_WITH_LINENUMBER                 1
 
+/**
+ * \brief Appends the free space to every ok: "ok <line> P<free moves> B<free commands>", so that the host can keep the buffers full.
+ */
+#define ACK_WITH_BUFFER_STATE               0
+
+/**
+ * \brief Accepts binary batch frames: a header with bit 14 set in the first bitfield, the number of commands and the length of the payload,
+ * followed by up to 186 bytes of binary commands without their own checksums and one Fletcher-16 checksum for the whole frame.
+ * The commands of a batch are acknowledged by one ok with the line number of the last command. Commands with a text can not be batched.
+ * M115 announces the batches with "Cap:BINARY_BATCH:1", hosts should only send them then.
+ */
+#define FEATURE_BINARY_BATCH                0                                                   // 1 = on, 0 = off
+
+/**
+ * \brief Accepts binary commands with delta coded coordinates: if bit 14 of the second bitfield is set, the byte behind it holds the widths of X, Y, Z and E
+ * (2 bits each, 1 to 4 bytes), and these are signed differences in microns to the previous command. Binary files which are written to the SD card use
+ * this coding, too. A G1 with X, Y and E usually needs 2 bytes per coordinate instead of 4.
+ */
+#define FEATURE_BINARY_DELTA_COORDINATES    0                                                   // 1 = on, 0 = off
+
 /**
  * \brief Communication errors can swollow part of the ok, which tells the host software to send
  * the next command. Not receiving it will cause your printer to stop. Sending this string every
@@ -85,6 +85,9 @@ void EEPROM::restoreEEPROMExtruderSettingsFromConfiguration(uint8_t extruderId)
         e->coolerSpeed = EXT0_EXTRUDER_COOLER_SPEED;
 #if USE_ADVANCE
         e->advanceL = EXT0_ADVANCE_L;
+#if FEATURE_SEGMENT_ADVANCE
+        e->advanceK = EXT0_ADVANCE_K;
+#endif // FEATURE_SEGMENT_ADVANCE
 #endif // USE_ADVANCE
     }
 #endif // NUM_EXTRUDER>0
@@ -118,6 +121,9 @@ void EEPROM::restoreEEPROMExtruderSettingsFromConfiguration(uint8_t extruderId)
 
 #if USE_ADVANCE
         e->advanceL = EXT1_ADVANCE_L;
+#if FEATURE_SEGMENT_ADVANCE
+        e->advanceK = EXT1_ADVANCE_K;
+#endif // FEATURE_SEGMENT_ADVANCE
 #endif // USE_ADVANCE
     }
 #endif // NUM_EXTRUDER > 1
@@ -217,6 +223,24 @@ void EEPROM::restoreEEPROMSettingsFromConfiguration() {
     */
 
     Printer::stepsPackingMinInterval = STEP_PACKING_MIN_INTERVAL;
+#if FEATURE_JUNCTION_DEVIATION
+    Printer::junctionMode = JUNCTION_MODE_DEFAULT;
+    Printer::junctionDeviation = JUNCTION_DEVIATION;
+#endif // FEATURE_JUNCTION_DEVIATION
+#if FEATURE_S_CURVE_ACCELERATION
+    Printer::sCurveMode = S_CURVE_MODE_DEFAULT;
+    Printer::sCurveAccelerationXY = S_CURVE_ACCELERATION_XY;
+#endif // FEATURE_S_CURVE_ACCELERATION
+#if FEATURE_INPUT_SHAPING
+    PrintLine::shaperX.configure(INPUT_SHAPING_FREQUENCY_X, INPUT_SHAPING_DAMPING_X);
+    PrintLine::shaperY.configure(INPUT_SHAPING_FREQUENCY_Y, INPUT_SHAPING_DAMPING_Y);
+#endif // FEATURE_INPUT_SHAPING
+#if FEATURE_SEGMENT_ADVANCE
+    Printer::advanceSmoothingTime = ADVANCE_SMOOTHING_TIME;
+#endif // FEATURE_SEGMENT_ADVANCE
+#if FEATURE_Z_MATRIX_SPLINE
+    g_nZMatrixInterpolation = Z_MATRIX_INTERPOLATION_DEFAULT;
+#endif // FEATURE_Z_MATRIX_SPLINE
 
     Printer::ZMode = DEFAULT_Z_SCALE_MODE; //wichtig, weils im Mod einen dritten Mode gibt. Für Zurückmigration
 
@@ -405,6 +429,26 @@ void EEPROM::storeDataIntoEEPROM(uint8_t corrupted) {
         storeExtruderDataIntoEEPROM(i);
     }
     HAL::eprSetInt16(EPR_RF_STEP_PACKING_MIN_INTERVAL, Printer::stepsPackingMinInterval);
+#if FEATURE_JUNCTION_DEVIATION
+    HAL::eprSetByte(EPR_RF_JUNCTION_MODE, Printer::junctionMode);
+    HAL::eprSetFloat(EPR_RF_JUNCTION_DEVIATION, Printer::junctionDeviation);
+#endif // FEATURE_JUNCTION_DEVIATION
+#if FEATURE_S_CURVE_ACCELERATION
+    HAL::eprSetByte(EPR_RF_S_CURVE_MODE, Printer::sCurveMode);
+    HAL::eprSetFloat(EPR_RF_S_CURVE_ACCELERATION, Printer::sCurveAccelerationXY);
+#endif // FEATURE_S_CURVE_ACCELERATION
+#if FEATURE_INPUT_SHAPING
+    HAL::eprSetFloat(EPR_RF_SHAPER_X_FREQUENCY, PrintLine::shaperX.frequency);
+    HAL::eprSetFloat(EPR_RF_SHAPER_Y_FREQUENCY, PrintLine::shaperY.frequency);
+    HAL::eprSetFloat(EPR_RF_SHAPER_X_DAMPING, PrintLine::shaperX.damping);
+    HAL::eprSetFloat(EPR_RF_SHAPER_Y_DAMPING, PrintLine::shaperY.damping);
+#endif // FEATURE_INPUT_SHAPING
+#if FEATURE_SEGMENT_ADVANCE
+    HAL::eprSetFloat(EPR_RF_ADVANCE_SMOOTHING, Printer::advanceSmoothingTime);
+#endif // FEATURE_SEGMENT_ADVANCE
+#if FEATURE_Z_MATRIX_SPLINE
+    HAL::eprSetByte(EPR_RF_Z_MATRIX_INTERPOLATION, g_nZMatrixInterpolation);
+#endif // FEATURE_Z_MATRIX_SPLINE
 
 #if FAN_PIN > -1 && FEATURE_FAN_CONTROL
     HAL::eprSetByte(EPR_RF_FAN_MODE, part_fan_frequency_modulation);
@@ -555,6 +599,9 @@ void EEPROM::storeExtruderDataIntoEEPROM(uint8_t extruderId) {
 
 #if USE_ADVANCE
     HAL::eprSetFloat(o + EPR_EXTRUDER_ADVANCE_L, e->advanceL);
+#if FEATURE_SEGMENT_ADVANCE
+    HAL::eprSetFloat(o + EPR_EXTRUDER_ADVANCE_K, e->advanceK);
+#endif // FEATURE_SEGMENT_ADVANCE
 #else
     HAL::eprSetFloat(o + EPR_EXTRUDER_ADVANCE_L, 0);
 #endif // USE_ADVANCE
@@ -586,6 +633,23 @@ void EEPROM::initializeAllOperatingModes() {
 #endif // FEATURE_MILLING_MODE
 } // initializeAllOperatingModes
 
+#if FEATURE_INPUT_SHAPING
+/** \brief Reads frequency and damping of one input shaper. Invalid values are replaced by the defaults, then true is returned. */
+bool EEPROM::readInputShaper(InputShaper& shaper, unsigned int frequencyPos, unsigned int dampingPos, float defaultFrequency, float defaultDamping) {
+    float frequency = HAL::eprGetFloat(frequencyPos);
+    float damping = HAL::eprGetFloat(dampingPos);
+    // the negated comparisons also catch an empty EEPROM (NaN)
+    if ((frequency != 0 && !(frequency >= INPUT_SHAPING_MIN_FREQUENCY && frequency <= INPUT_SHAPING_MAX_FREQUENCY)) || !(damping >= 0 && damping <= INPUT_SHAPING_MAX_DAMPING)) {
+        shaper.configure(defaultFrequency, defaultDamping);
+        HAL::eprSetFloat(frequencyPos, defaultFrequency);
+        HAL::eprSetFloat(dampingPos, defaultDamping);
+        return true;
+    }
+    shaper.configure(frequency, damping);
+    return false;
+} // readInputShaper
+#endif // FEATURE_INPUT_SHAPING
+
 void EEPROM::readDataFromEEPROM() {
     bool change = false;
 
@@ -792,6 +856,13 @@ void EEPROM::readDataFromEEPROM() {
         if (e->advanceL > 0 && e->advanceL < 20) {
             e->advanceL = 20;
         }
+#if FEATURE_SEGMENT_ADVANCE
+        e->advanceK = HAL::eprGetFloat(o + EPR_EXTRUDER_ADVANCE_K);
+        if (!(e->advanceK >= 0 && e->advanceK <= ADVANCE_K_MAX)) {
+            // the old firmware did not use this position
+            e->advanceK = 0;
+        }
+#endif // FEATURE_SEGMENT_ADVANCE
 #endif // USE_ADVANCE
 
         if (version > 1)
@@ -1012,6 +1083,63 @@ void EEPROM::readDataFromEEPROM() {
         Printer::stepsPackingMinInterval = constrain(HAL::eprGetInt16(EPR_RF_STEP_PACKING_MIN_INTERVAL), MIN_STEP_PACKING_MIN_INTERVAL, MAX_STEP_PACKING_MIN_INTERVAL);
     }
 
+#if FEATURE_JUNCTION_DEVIATION
+    float junctionDeviation = HAL::eprGetFloat(EPR_RF_JUNCTION_DEVIATION);
+    if (!(junctionDeviation >= JUNCTION_DEVIATION_MIN && junctionDeviation <= JUNCTION_DEVIATION_MAX)) { // also catches an empty EEPROM (NaN)
+        Printer::junctionMode = JUNCTION_MODE_DEFAULT;
+        Printer::junctionDeviation = JUNCTION_DEVIATION;
+        HAL::eprSetByte(EPR_RF_JUNCTION_MODE, Printer::junctionMode);
+        HAL::eprSetFloat(EPR_RF_JUNCTION_DEVIATION, Printer::junctionDeviation);
+        change = true;
+    } else {
+        Printer::junctionMode = (HAL::eprGetByte(EPR_RF_JUNCTION_MODE) == JUNCTION_MODE_DEVIATION ? JUNCTION_MODE_DEVIATION : JUNCTION_MODE_JERK);
+        Printer::junctionDeviation = junctionDeviation;
+    }
+#endif // FEATURE_JUNCTION_DEVIATION
+
+#if FEATURE_S_CURVE_ACCELERATION
+    float sCurveAcceleration = HAL::eprGetFloat(EPR_RF_S_CURVE_ACCELERATION);
+    if (!(sCurveAcceleration >= ACCELERATION_MIN_XY && sCurveAcceleration <= ACCELERATION_MAX_XY)) { // also catches an empty EEPROM (NaN)
+        Printer::sCurveMode = S_CURVE_MODE_DEFAULT;
+        Printer::sCurveAccelerationXY = S_CURVE_ACCELERATION_XY;
+        HAL::eprSetByte(EPR_RF_S_CURVE_MODE, Printer::sCurveMode);
+        HAL::eprSetFloat(EPR_RF_S_CURVE_ACCELERATION, Printer::sCurveAccelerationXY);
+        change = true;
+    } else {
+        Printer::sCurveMode = (HAL::eprGetByte(EPR_RF_S_CURVE_MODE) ? 1 : 0);
+        Printer::sCurveAccelerationXY = sCurveAcceleration;
+    }
+#endif // FEATURE_S_CURVE_ACCELERATION
+
+#if FEATURE_INPUT_SHAPING
+    if (readInputShaper(PrintLine::shaperX, EPR_RF_SHAPER_X_FREQUENCY, EPR_RF_SHAPER_X_DAMPING, INPUT_SHAPING_FREQUENCY_X, INPUT_SHAPING_DAMPING_X))
+        change = true;
+    if (readInputShaper(PrintLine::shaperY, EPR_RF_SHAPER_Y_FREQUENCY, EPR_RF_SHAPER_Y_DAMPING, INPUT_SHAPING_FREQUENCY_Y, INPUT_SHAPING_DAMPING_Y))
+        change = true;
+#endif // FEATURE_INPUT_SHAPING
+
+#if FEATURE_SEGMENT_ADVANCE
+    float advanceSmoothing = HAL::eprGetFloat(EPR_RF_ADVANCE_SMOOTHING);
+    if (!(advanceSmoothing >= 0 && advanceSmoothing <= ADVANCE_SMOOTHING_TIME_MAX)) { // also catches an empty EEPROM (NaN)
+        Printer::advanceSmoothingTime = ADVANCE_SMOOTHING_TIME;
+        HAL::eprSetFloat(EPR_RF_ADVANCE_SMOOTHING, Printer::advanceSmoothingTime);
+        change = true;
+    } else {
+        Printer::advanceSmoothingTime = advanceSmoothing;
+    }
+#endif // FEATURE_SEGMENT_ADVANCE
+
+#if FEATURE_Z_MATRIX_SPLINE
+    uint8_t zMatrixInterpolation = HAL::eprGetByte(EPR_RF_Z_MATRIX_INTERPOLATION);
+    if (zMatrixInterpolation > Z_MATRIX_INTERPOLATION_CATMULL_ROM) { // also catches an empty EEPROM (255)
+        g_nZMatrixInterpolation = Z_MATRIX_INTERPOLATION_DEFAULT;
+        HAL::eprSetByte(EPR_RF_Z_MATRIX_INTERPOLATION, g_nZMatrixInterpolation);
+        change = true;
+    } else {
+        g_nZMatrixInterpolation = zMatrixInterpolation;
+    }
+#endif // FEATURE_Z_MATRIX_SPLINE
+
 #if FAN_PIN > -1 && FEATURE_FAN_CONTROL
     uint8_t temp_min = HAL::eprGetByte(EPR_RF_PART_FAN_PWM_MIN);
     uint8_t temp_max = HAL::eprGetByte(EPR_RF_PART_FAN_PWM_MAX);
@@ -1223,6 +1351,26 @@ void EEPROM::writeSettings() {
 
     writeFloat(EPR_MAX_XYJERK, Com::tEPRMaxXYJerk);
     writeFloat(EPR_MAX_ZJERK, Com::tEPRMaxZJerk);
+#if FEATURE_JUNCTION_DEVIATION
+    writeByte(EPR_RF_JUNCTION_MODE, Com::tEPRJunctionMode);
+    writeFloat(EPR_RF_JUNCTION_DEVIATION, Com::tEPRJunctionDeviation, 3);
+#endif // FEATURE_JUNCTION_DEVIATION
+#if FEATURE_S_CURVE_ACCELERATION
+    writeByte(EPR_RF_S_CURVE_MODE, Com::tEPRSCurveMode);
+    writeFloat(EPR_RF_S_CURVE_ACCELERATION, Com::tEPRSCurveAcceleration, 0);
+#endif // FEATURE_S_CURVE_ACCELERATION
+#if FEATURE_INPUT_SHAPING
+    writeFloat(EPR_RF_SHAPER_X_FREQUENCY, Com::tEPRShaperXFrequency, 1);
+    writeFloat(EPR_RF_SHAPER_X_DAMPING, Com::tEPRShaperXDamping, 3);
+    writeFloat(EPR_RF_SHAPER_Y_FREQUENCY, Com::tEPRShaperYFrequency, 1);
+    writeFloat(EPR_RF_SHAPER_Y_DAMPING, Com::tEPRShaperYDamping, 3);
+#endif // FEATURE_INPUT_SHAPING
+#if FEATURE_SEGMENT_ADVANCE
+    writeFloat(EPR_RF_ADVANCE_SMOOTHING, Com::tEPRAdvanceSmoothing, 0);
+#endif // FEATURE_SEGMENT_ADVANCE
+#if FEATURE_Z_MATRIX_SPLINE
+    writeByte(EPR_RF_Z_MATRIX_INTERPOLATION, Com::tEPRZMatrixInterpolation);
+#endif // FEATURE_Z_MATRIX_SPLINE
 
     writeByte(EPR_RF_MOTOR_CURRENT + X_AXIS, Com::tEPRPrinter_STEPPER_X);
     writeByte(EPR_RF_MOTOR_CURRENT + Y_AXIS, Com::tEPRPrinter_STEPPER_Y);
@@ -1304,6 +1452,9 @@ void EEPROM::writeSettings() {
 
 #if USE_ADVANCE
         writeFloat(o + EPR_EXTRUDER_ADVANCE_L, Com::tEPRAdvanceL);
+#if FEATURE_SEGMENT_ADVANCE
+        writeFloat(o + EPR_EXTRUDER_ADVANCE_K, Com::tEPRAdvanceK);
+#endif // FEATURE_SEGMENT_ADVANCE
 #endif // USE_ADVANCE
 
         writeByte(o + EPR_EXTRUDER_SENSOR_TYPE, Com::tEPRsensorType);
@@ -165,6 +165,21 @@ have problems with other modules using the eeprom */
 
 #define EPR_RF_STEP_PACKING_MIN_INTERVAL 1964 //1965 2byte für uint16 -> StepPackingMinInterval
 
+#define EPR_RF_JUNCTION_MODE 1966      //[1byte] JUNCTION_MODE_JERK / JUNCTION_MODE_DEVIATION
+#define EPR_RF_JUNCTION_DEVIATION 1967 //[+1968 +1969 +1970 4byte float] junction deviation in mm
+
+#define EPR_RF_S_CURVE_MODE 1971         //[1byte] 0 = trapezoid, 1 = S-curve
+#define EPR_RF_S_CURVE_ACCELERATION 1972 //[+1973 +1974 +1975 4byte float] average X/Y print acceleration of the S-curve in mm/s^2
+
+#define EPR_RF_SHAPER_X_FREQUENCY 1976 //[+1977 +1978 +1979 4byte float] input shaping frequency X in Hz, 0 = off
+#define EPR_RF_SHAPER_Y_FREQUENCY 1980 //[+1981 +1982 +1983 4byte float] input shaping frequency Y in Hz, 0 = off
+#define EPR_RF_SHAPER_X_DAMPING 1984   //[+1985 +1986 +1987 4byte float] input shaping damping ratio X
+#define EPR_RF_SHAPER_Y_DAMPING 1988   //[+1989 +1990 +1991 4byte float] input shaping damping ratio Y
+
+#define EPR_RF_ADVANCE_SMOOTHING 1992 //[+1993 +1994 +1995 4byte float] shortest time for a change of the segment advance in ms
+
+#define EPR_RF_Z_MATRIX_INTERPOLATION 1996 //[1byte] Z_MATRIX_INTERPOLATION_BILINEAR / Z_MATRIX_INTERPOLATION_CATMULL_ROM
+
 //Nibbels: Computechecksum geht bis 2047
 
 #define EEPROM_EXTRUDER_OFFSET 200
@@ -208,6 +223,9 @@ class EEPROM {
     static void writeInt(uint pos, PGM_P text);
     static void writeByte(uint pos, PGM_P text);
 #endif // EEPROM_MODE!=0
+#if FEATURE_INPUT_SHAPING
+    static bool readInputShaper(InputShaper& shaper, unsigned int frequencyPos, unsigned int dampingPos, float defaultFrequency, float defaultDamping);
+#endif // FEATURE_INPUT_SHAPING
 
 public:
     static void init();
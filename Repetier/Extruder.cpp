@@ -1248,6 +1248,9 @@ Extruder extruder[NUM_EXTRUDER] = {
       0,
 #if USE_ADVANCE
       EXT0_ADVANCE_L,
+#if FEATURE_SEGMENT_ADVANCE
+      EXT0_ADVANCE_K,
+#endif // FEATURE_SEGMENT_ADVANCE
 #endif // USE_ADVANCE
       {
           0, EXT0_TEMPSENSOR_TYPE, EXT0_SENSOR_INDEX, 0, 0, 0,
@@ -1298,6 +1301,9 @@ Extruder extruder[NUM_EXTRUDER] = {
       0,
 #if USE_ADVANCE
       EXT1_ADVANCE_L,
+#if FEATURE_SEGMENT_ADVANCE
+      EXT1_ADVANCE_K,
+#endif // FEATURE_SEGMENT_ADVANCE
 #endif // USE_ADVANCE
       {
           1, EXT1_TEMPSENSOR_TYPE, EXT1_SENSOR_INDEX, 0, 0, 0,
@@ -189,6 +189,9 @@ public:
 
 #if USE_ADVANCE
     float advanceL;
+#if FEATURE_SEGMENT_ADVANCE
+    float advanceK;
+#endif // FEATURE_SEGMENT_ADVANCE
 #endif // USE_ADVANCE
 
     TemperatureController tempControl;
@@ -365,5 +368,7 @@ extern TemperatureController optTempController;
 
 extern TemperatureController* tempController[NUM_TEMPERATURE_LOOPS];
 extern uint8_t autotuneIndex;
+extern const short* const temptables[15] PROGMEM; // the host simulation converts its temperatures back into ADC values with these tables
+extern const uint8_t temptables_num[15] PROGMEM;
 
 #endif // EXTRUDER_H
@@ -41,6 +41,12 @@ uint16_t HAL::integerSqrt(int32_t a) {
     // Stack incl call = 2-3
     //-----------------------------------------------------------
 
+#ifdef SIMULATOR
+    uint16_t b = integerSqrt((uint32_t)a); // rounded down
+    if ((uint32_t)a - (uint32_t)b * b > b)
+        b++;
+    return b;
+#else
     uint16_t b;
 
     __asm volatile(
@@ -88,6 +94,7 @@ uint16_t HAL::integerSqrt(int32_t a) {
         : "r"(a)
         : "r18", "r19", "r27", "r26");
     return b;
+#endif // SIMULATOR
 } // integerSqrt
 
 const uint16_t fast_div_lut[17] PROGMEM = { 0, F_CPU / 4096, F_CPU / 8192, F_CPU / 12288, F_CPU / 16384, F_CPU / 20480, F_CPU / 24576, F_CPU / 28672, F_CPU / 32768, F_CPU / 36864, F_CPU / 40960, F_CPU / 45056, F_CPU / 49152, F_CPU / 53248, F_CPU / 57344, F_CPU / 61440, F_CPU / 65536 };
@@ -100,8 +107,10 @@ The result is used for timer calculation where small errors are ok. This
 function uses lookup tables to find a fast approximation of the result.
 */
 int32_t HAL::CPUDivU2(unsigned int divisor) {
+#ifndef SIMULATOR
     int32_t res;
     unsigned short table;
+#endif // SIMULATOR
 
     if (divisor < 8192) {
         if (divisor < 512) {
@@ -109,6 +118,11 @@ int32_t HAL::CPUDivU2(unsigned int divisor) {
                 divisor = 10;
             return Div4U2U(F_CPU, divisor); // These entries have overflows in lookuptable!
         }
+#ifdef SIMULATOR
+        uint16_t y0 = pgm_read_word(&slow_div_lut[divisor >> 5]);
+        uint16_t gain = y0 - pgm_read_word(&slow_div_lut[(divisor >> 5) + 1]);
+        return (uint16_t)(y0 - (((uint32_t)gain * (divisor & 31)) >> 5));
+#else
         table = (unsigned short)&slow_div_lut[0];
         __asm volatile( // needs 64 ticks neu 49 Ticks
             "mov r18,%A1 \n\t"
@@ -154,11 +168,17 @@ int32_t HAL::CPUDivU2(unsigned int divisor) {
             : "1"(divisor), "2"(table)
             : "r18", "r4", "r5");
         return res;
+#endif // SIMULATOR
         /*unsigned short adr0 = (unsigned short)&slow_div_lut+(divisor>>4)&1022;
         long y0=    pgm_read_dword_near(adr0);
         long gain = y0-pgm_read_dword_near(adr0+2);
         return y0-((gain*(divisor & 31))>>5);*/
     } else {
+#ifdef SIMULATOR
+        uint16_t y0 = pgm_read_word(&fast_div_lut[divisor >> 12]);
+        uint16_t gain = y0 - pgm_read_word(&fast_div_lut[(divisor >> 12) + 1]);
+        return (uint16_t)(y0 - (((uint32_t)gain * (divisor & 4095)) >> 12));
+#else
         table = (unsigned short)&fast_div_lut[0];
         __asm volatile( // needs 49 ticks
             "movw r18,%A1 \n\t"
@@ -202,6 +222,7 @@ int32_t HAL::CPUDivU2(unsigned int divisor) {
             : "1"(divisor), "2"(table)
             : "r18", "r19", "r4", "r5");
         return res;
+#endif // SIMULATOR
         /*
         // The asm mimics the following code
         unsigned short adr0 = (unsigned short)&fast_div_lut+(divisor>>11)&254;
@@ -212,7 +233,30 @@ int32_t HAL::CPUDivU2(unsigned int divisor) {
 
 } // CPUDivU2
 
+/** \brief Integer square root, rounded down. Used by the fixed point planner to get the start and end speed from their squares. */
+speed_t HAL::integerSqrt(uint32_t val) {
+    uint32_t res = 0;
+    uint32_t bit = 1UL << 30;
+
+    while (bit > val)
+        bit >>= 2;
+
+    while (bit) {
+        if (val >= res + bit) {
+            val -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (speed_t)res;
+} // integerSqrt
+
 void HAL::setupTimer() {
+#if FEATURE_ISR_TIMING
+    resetIsrTiming();
+#endif // FEATURE_ISR_TIMING
 #if USE_ADVANCE
     EXTRUDER_TCCR = 0;                      // need Normal not fastPWM set by arduino init
     EXTRUDER_TIMSK |= (1 << EXTRUDER_OCIE); // Activate compa interrupt on timer 0
@@ -325,6 +369,9 @@ void HAL::showStartReason() {
 } // showStartReason
 
 int HAL::getFreeRam() {
+#ifdef SIMULATOR
+    return MAX_RAM; // the host has no stack below the heap
+#else
     int freeram = 0;
     InterruptProtectedBlock noInts; //BEGIN_INTERRUPT_PROTECTED
     uint8_t *heapptr, *stackptr;
@@ -334,13 +381,17 @@ int HAL::getFreeRam() {
     freeram = (int)stackptr - (int)heapptr;
     //END_INTERRUPT_PROTECTED
     return freeram;
-
+#endif // SIMULATOR
 } // getFreeRam
 
 void (*resetFunc)(void) = 0; // declare reset function @ address 0
 
 void HAL::resetHardware() {
+#ifdef SIMULATOR
+    simReset();
+#else
     resetFunc();
+#endif // SIMULATOR
 } // resetHardware
 
 void HAL::analogStart() {
@@ -677,10 +728,26 @@ void HAL::tellWatchdogOk() {
 } // pingWatchdog
 
 // ================== Interrupt handling ======================
+volatile long __attribute__((used)) stepperWait = 0;
+
 /** \brief Sets the timer 1 compare value to delay ticks.
 This function sets the OCR1A compare counter to get the next interrupt
 at delay ticks measured from the last interrupt. delay must be << 2^24 */
 inline void setTimer(uint32_t delay) {
+#ifdef SIMULATOR
+    cli();
+    if (delay < 65280) {
+        stepperWait = 0;
+        uint16_t count = TCNT1 + 100;
+        if ((uint16_t)delay < count)
+            OCR1A = count;
+        else
+            OCR1A = delay;
+    } else {
+        stepperWait = delay - 32768;
+        OCR1A = 32768;
+    }
+#else
     __asm volatile(
         "cli \n\t"
         "tst %C[delay] \n\t" //if(delay<65536) {
@@ -716,6 +783,7 @@ inline void setTimer(uint32_t delay) {
         : [ delay ] "=&d"(delay)                                                            // Output
         : "0"(delay), [ ocr ] "i"(_SFR_MEM_ADDR(OCR1A)), [ time ] "i"(_SFR_MEM_ADDR(TCNT1)) // Input
         : "r18");                                                                           // Clobber
+#endif // SIMULATOR
 
     /* // Assembler above replaced this code
       if(delay<65280) {
@@ -732,11 +800,73 @@ inline void setTimer(uint32_t delay) {
 
 } // setTimer
 
-volatile long __attribute__((used)) stepperWait = 0;
+#if FEATURE_INPUT_SHAPING
+uint32_t shapingPeriod = 0; ///< Ticks from this to the next stepper interrupt
+
+/** \brief Remembers the time until the next stepper interrupt for PrintLine::shapingClock. setTimer() moves a short delay behind TCNT1
+and splits a long one into parts of 32768 ticks, so OCR1A resp. delay is the time it really set up. */
+inline void setShapingPeriod(uint32_t delay) {
+    shapingPeriod = (delay < 65280 ? OCR1A : delay);
+} // setShapingPeriod
+#endif // FEATURE_INPUT_SHAPING
+
+#if FEATURE_ISR_TIMING
+IsrTimingSlot HAL::isrTiming[ISR_TIMING_SLOTS];
+volatile uint8_t HAL::isrTimingStepperCalls = 0;
+
+void HAL::resetIsrTiming() {
+    InterruptProtectedBlock noInts;
+    for (uint8_t i = 0; i < ISR_TIMING_SLOTS; i++) {
+        isrTiming[i].calls = 0;
+        isrTiming[i].sumCycles = 0;
+        isrTiming[i].minCycles = 0xFFFF;
+        isrTiming[i].maxCycles = 0;
+        isrTiming[i].overruns = 0;
+        isrTiming[i].skipped = 0;
+    }
+} // resetIsrTiming
+
+/** \brief Outputs the duration of the stepper, the PWM and the extruder interrupt in CPU cycles and microseconds. */
+void HAL::printIsrTiming() {
+    for (uint8_t i = 0; i < ISR_TIMING_SLOTS; i++) {
+        InterruptProtectedBlock noInts;
+        IsrTimingSlot timing = isrTiming[i];
+        noInts.unprotect();
+
+        if (i == ISR_TIMING_STEPPER)
+            Com::printF(PSTR("ISR timing stepper"));
+        else if (i == ISR_TIMING_PWM)
+            Com::printF(PSTR("ISR timing pwm"));
+        else
+            Com::printF(PSTR("ISR timing extruder"));
+        Com::printF(PSTR(": calls = "), timing.calls);
+        if (timing.calls) {
+            Com::printF(PSTR(", min = "), (uint32_t)timing.minCycles);
+            Com::printF(PSTR(", avg = "), timing.sumCycles / timing.calls);
+            Com::printF(PSTR(", max = "), (uint32_t)timing.maxCycles);
+            Com::printF(PSTR(" [cycles], max = "), (float)timing.maxCycles / (F_CPU / 1000000UL), 1);
+            Com::printF(PSTR(" [us]"));
+        }
+        Com::printF(PSTR(", overruns = "), (uint32_t)timing.overruns);
+        Com::printFLN(PSTR(", skipped = "), (uint32_t)timing.skipped);
+    }
+} // printIsrTiming
+#endif // FEATURE_ISR_TIMING
 
 /** \brief Timer interrupt routine to drive the stepper motors.
 */
 ISR(TIMER1_COMPA_vect) {
+#ifdef SIMULATOR
+    if (stepperWait >= 65536) {
+        stepperWait -= 32768; // OCR1A stays 32768
+        return;
+    }
+    if (stepperWait >= 256) {
+        OCR1A = stepperWait;
+        stepperWait = 0;
+        return;
+    }
+#else
     uint8_t doExit;
     __asm volatile(
         "ldi %[ex],0 \n\t"
@@ -766,9 +896,16 @@ ISR(TIMER1_COMPA_vect) {
         : "r22", "r23");
     if (doExit)
         return;
+#endif // SIMULATOR
 
     cbi(TIMSK1, OCIE1A); // prevent retrigger timer by disabling timer interrupt. Should be faster than guarding with insideTimer1.
 
+#if FEATURE_INPUT_SHAPING
+    PrintLine::shapingClock += shapingPeriod; // time since the last stepper interrupt
+#endif // FEATURE_INPUT_SHAPING
+#if FEATURE_ISR_TIMING
+    HAL::isrTimingStepperCalls++; // timer 1 restarted, the measurement of an interrupt nested into this one is not exact anymore
+#endif // FEATURE_ISR_TIMING
     OCR1A = 61000;
 
 #if FEATURE_HEAT_BED_Z_COMPENSATION || FEATURE_WORK_PART_Z_COMPENSATION
@@ -778,6 +915,12 @@ ISR(TIMER1_COMPA_vect) {
         if (PrintLine::needCmpWait()) {
             HAL::forbidInterrupts();
             setTimer(3000);
+#if FEATURE_INPUT_SHAPING
+            setShapingPeriod(3000);
+#endif // FEATURE_INPUT_SHAPING
+#if FEATURE_ISR_TIMING
+            HAL::isrTimingEnd(ISR_TIMING_STEPPER, 0, 3000);
+#endif // FEATURE_ISR_TIMING
             DEBUG_MEMORY;
             sbi(TIMSK1, OCIE1A);
 
@@ -787,7 +930,14 @@ ISR(TIMER1_COMPA_vect) {
 #endif // FEATURE_HEAT_BED_Z_COMPENSATION || FEATURE_WORK_PART_Z_COMPENSATION
 
     if (PrintLine::direct.task) {
-        setTimer(PrintLine::performDirectMove());
+        unsigned long delay = PrintLine::performDirectMove();
+        setTimer(delay);
+#if FEATURE_INPUT_SHAPING
+        setShapingPeriod(delay);
+#endif // FEATURE_INPUT_SHAPING
+#if FEATURE_ISR_TIMING
+        HAL::isrTimingEnd(ISR_TIMING_STEPPER, 0, delay);
+#endif // FEATURE_ISR_TIMING
         DEBUG_MEMORY;
         sbi(TIMSK1, OCIE1A);
 
@@ -795,13 +945,26 @@ ISR(TIMER1_COMPA_vect) {
     }
 
     if (PrintLine::hasLines() && !g_pauseMode) {
-        setTimer(PrintLine::performQueueMove());
+        unsigned long delay = PrintLine::performQueueMove();
+        setTimer(delay);
+#if FEATURE_INPUT_SHAPING
+        setShapingPeriod(delay);
+#endif // FEATURE_INPUT_SHAPING
+#if FEATURE_ISR_TIMING
+        HAL::isrTimingEnd(ISR_TIMING_STEPPER, 0, delay);
+#endif // FEATURE_ISR_TIMING
         DEBUG_MEMORY;
         sbi(TIMSK1, OCIE1A);
 
         return;
     }
 
+#if FEATURE_INPUT_SHAPING
+    PrintLine::processInputShaping(); // the delayed impulses of the last move are still running out
+    PrintLine::outputInputShaping();
+    shapingPeriod = 3000;
+#endif // FEATURE_INPUT_SHAPING
+
 #if USE_ADVANCE
     if (waitRelax == 0) {
         if (Printer::advanceStepsSet) {
@@ -814,6 +977,9 @@ ISR(TIMER1_COMPA_vect) {
 
     stepperWait = 0; // Important because of optimization in asm at begin
     OCR1A = 3000;
+#if FEATURE_ISR_TIMING
+    HAL::isrTimingEnd(ISR_TIMING_STEPPER, 0, 3000);
+#endif // FEATURE_ISR_TIMING
 
     DEBUG_MEMORY;
     sbi(TIMSK1, OCIE1A);
@@ -890,6 +1056,10 @@ uint8_t part_fan_pwm_min = PART_FAN_PWM_MIN; //this is calculated as 1%
 This timer is called 3906 times per second. It is used to update pwm values for heater and some other frequent jobs.
 */
 ISR(PWM_TIMER_VECTOR) {
+#if FEATURE_ISR_TIMING
+    IsrTimingMark isrStart;
+    HAL::isrTimingStart(isrStart);
+#endif // FEATURE_ISR_TIMING
     static uint8_t pwm_count_heater = 0;
     static uint8_t pwm_count_cooler = 0;
     static uint8_t pwm_count_part_fan = 0;
@@ -1106,6 +1276,9 @@ ISR(PWM_TIMER_VECTOR) {
         }
     }
 #endif // FEATURE_RGB_LIGHT_EFFECTS
+#if FEATURE_ISR_TIMING
+    HAL::isrTimingEnd(ISR_TIMING_PWM, isrStart, 64 * 64); // called every 64 timer 0 ticks with prescaler 64
+#endif                                                    // FEATURE_ISR_TIMING
 } // ISR(PWM_TIMER_VECTOR)
 
 #if USE_ADVANCE
@@ -1126,18 +1299,26 @@ wanted movement is achieved. This will be done with the maximum
 allowable speed for the extruder.
 */
 ISR(EXTRUDER_TIMER_VECTOR) {
+#if FEATURE_ISR_TIMING
+    IsrTimingMark isrStart;
+    HAL::isrTimingStart(isrStart);
+#endif // FEATURE_ISR_TIMING
     uint8_t timer = EXTRUDER_OCR;
     if (!Printer::isAdvanceActivated())
         return; // currently no need
 
     if (Printer::extruderStepsNeeded > 0 && extruderLastDirection != 1) {
         if (Printer::extruderStepsNeeded >= ADVANCE_DIR_FILTER_STEPS) {
+            if (extruderLastDirection)
+                Printer::advanceDirectionChanges++;
             Extruder::setDirection(true);
             extruderLastDirection = 1;
             timer += 40; // Add some more wait time to prevent blocking
         }
     } else if (Printer::extruderStepsNeeded < 0 && extruderLastDirection != -1) {
         if (-Printer::extruderStepsNeeded >= ADVANCE_DIR_FILTER_STEPS) {
+            if (extruderLastDirection)
+                Printer::advanceDirectionChanges++;
             Extruder::setDirection(false);
             extruderLastDirection = -1;
             timer += 40; // Add some more wait time to prevent blocking
@@ -1151,6 +1332,9 @@ ISR(EXTRUDER_TIMER_VECTOR) {
         Extruder::unstep();
     }
     EXTRUDER_OCR = timer + Printer::maxExtruderSpeed;
+#if FEATURE_ISR_TIMING
+    HAL::isrTimingEnd(ISR_TIMING_EXTRUDER, isrStart, (uint32_t)Printer::maxExtruderSpeed * 64);
+#endif // FEATURE_ISR_TIMING
 }
 #endif // USE_ADVANCE
 
@@ -1252,7 +1436,7 @@ void FEATURE_READ_CALIPER_HOOK() {
   Modified to use only 1 queue with fixed length by Repetier
 */
 
-ring_buffer_rx rx_buffer = { { 0 }, 0, 0 };
+ring_buffer_rx rx_buffer = { { 0 }, 0, 0, 0 };
 ring_buffer_tx tx_buffer = { { 0 }, 0, 0 };
 
 inline void rf_store_char(unsigned char c, ring_buffer_rx* buffer) {
@@ -1265,7 +1449,8 @@ inline void rf_store_char(unsigned char c, ring_buffer_rx* buffer) {
     if (i != buffer->tail) {
         buffer->buffer[buffer->head] = c;
         buffer->head = i;
-    }
+    } else
+        buffer->overruns++;
 } // rf_store_char
 
 #if !defined(USART0_RX_vect) && defined(USART1_RX_vect)
@@ -1290,6 +1475,14 @@ SIGNAL(SIG_UART_RECV)
 #endif // defined(SIG_USART0_RECV)
 #endif // defined(USART_RX_vect)
 {
+    // the data overrun flag is valid until the data register is read
+#if defined(UCSR0A) && defined(DOR0)
+    if (UCSR0A & (1 << DOR0))
+        rx_buffer.overruns++;
+#elif defined(UCSRA) && defined(DOR)
+    if (UCSRA & (1 << DOR))
+        rx_buffer.overruns++;
+#endif // defined(UCSR0A) && defined(DOR0)
 #if defined(UDR0)
     unsigned char c = UDR0;
 #elif defined(UDR)
@@ -1446,33 +1639,52 @@ RFHardwareSerial::RFHardwareSerial(ring_buffer_rx* rx_buffer, ring_buffer_tx* tx
 
 // Public Methods //////////////////////////////////////////////////////////////
 
-void RFHardwareSerial::begin(unsigned long baud) {
-    uint16_t baud_setting;
-    bool use_u2x = true;
+/** \brief Computes the rounded UBRR setting of both modes and takes the one with the smaller error. Returns the speed which the UART really uses. */
+unsigned long RFHardwareSerial::computeBaudSetting(unsigned long baud, uint16_t& setting, bool& u2x) {
+    if (baud > F_CPU / 8)
+        baud = F_CPU / 8; // the fastest rate of the UART
+
+    unsigned long setting_u2x = (F_CPU / 4 / baud - 1) / 2;
+    unsigned long setting_1x = (F_CPU / 8 / baud - 1) / 2;
+    unsigned long actual_u2x = F_CPU / 8 / (setting_u2x + 1);
+    unsigned long actual_1x = F_CPU / 16 / (setting_1x + 1);
+    unsigned long error_u2x = (actual_u2x > baud ? actual_u2x - baud : baud - actual_u2x);
+    unsigned long error_1x = (actual_1x > baud ? actual_1x - baud : baud - actual_1x);
+
+    u2x = (setting_u2x <= 4095 && error_1x >= error_u2x);
 
 #if F_CPU == 16000000UL
     // hardcoded exception for compatibility with the bootloader shipped
     // with the Duemilanove and previous boards and the firmware on the 8U2
     // on the Uno and Mega 2560.
     if (baud == 57600) {
-        use_u2x = false;
+        u2x = false;
     }
 #endif // F_CPU == 16000000UL
 
-try_again:
-
-    if (use_u2x) {
-        *_ucsra = 1 << _u2x;
-        baud_setting = (F_CPU / 4 / baud - 1) / 2;
-    } else {
-        *_ucsra = 0;
-        baud_setting = (F_CPU / 8 / baud - 1) / 2;
+    if (u2x) {
+        setting = setting_u2x;
+        return actual_u2x;
     }
+    setting = (setting_1x > 4095 ? 4095 : setting_1x);
+    return F_CPU / 16 / (setting + 1);
+} // computeBaudSetting
+
+/** \brief Checks if the UART reaches baud within SERIAL_MAX_BAUD_ERROR. */
+bool RFHardwareSerial::isUsableBaudrate(unsigned long baud) {
+    uint16_t setting;
+    bool u2x;
+    unsigned long actual = computeBaudSetting(baud, setting, u2x);
+    unsigned long error = (actual > baud ? actual - baud : baud - actual);
+    return error * 1000 <= baud * SERIAL_MAX_BAUD_ERROR;
+} // isUsableBaudrate
 
-    if ((baud_setting > 4095) && use_u2x) {
-        use_u2x = false;
-        goto try_again;
-    }
+void RFHardwareSerial::begin(unsigned long baud) {
+    uint16_t baud_setting;
+    bool use_u2x;
+
+    _baudActual = computeBaudSetting(baud, baud_setting, use_u2x);
+    *_ucsra = (use_u2x ? 1 << _u2x : 0);
 
     // assign the baud_setting, a.k.a. ubbr (USART Baud Rate Register)
     *_ubrrh = baud_setting >> 8;
@@ -1516,6 +1728,16 @@ int RFHardwareSerial::available(void) {
     return (unsigned int)(SERIAL_BUFFER_SIZE + _rx_buffer->head - _rx_buffer->tail) & SERIAL_BUFFER_MASK;
 } // available
 
+uint16_t RFHardwareSerial::getOverruns(void) {
+    InterruptProtectedBlock noInts;
+    return _rx_buffer->overruns;
+} // getOverruns
+
+void RFHardwareSerial::resetOverruns(void) {
+    InterruptProtectedBlock noInts;
+    _rx_buffer->overruns = 0;
+} // resetOverruns
+
 int RFHardwareSerial::outputUnused(void) {
     return SERIAL_TX_BUFFER_SIZE - (unsigned int)((SERIAL_TX_BUFFER_SIZE + _tx_buffer->head - _tx_buffer->tail) & SERIAL_TX_BUFFER_MASK);
 } // outputUnused
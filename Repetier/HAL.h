@@ -178,8 +178,16 @@ void FEATURE_READ_CALIPER_HOOK(); //read in calipers 48bit protocol bitwise!
   Modified to use only 1 queue with fixed length by Repetier
 */
 
-#define SERIAL_BUFFER_SIZE 128
-#define SERIAL_BUFFER_MASK 127
+#ifndef SERIAL_RX_BUFFER_SIZE
+#define SERIAL_RX_BUFFER_SIZE 128
+#endif // SERIAL_RX_BUFFER_SIZE
+
+#if SERIAL_RX_BUFFER_SIZE != 64 && SERIAL_RX_BUFFER_SIZE != 128 && SERIAL_RX_BUFFER_SIZE != 256
+#error SERIAL_RX_BUFFER_SIZE must be 64, 128 or 256
+#endif // SERIAL_RX_BUFFER_SIZE != 64 && SERIAL_RX_BUFFER_SIZE != 128 && SERIAL_RX_BUFFER_SIZE != 256
+
+#define SERIAL_BUFFER_SIZE SERIAL_RX_BUFFER_SIZE
+#define SERIAL_BUFFER_MASK (SERIAL_RX_BUFFER_SIZE - 1)
 
 #undef SERIAL_TX_BUFFER_SIZE
 #undef SERIAL_TX_BUFFER_MASK
@@ -195,6 +203,7 @@ struct ring_buffer_rx {
     unsigned char buffer[SERIAL_BUFFER_SIZE];
     volatile uint8_t head;
     volatile uint8_t tail;
+    volatile uint16_t overruns; // lost bytes: the ring was full or the UART was not read in time
 };
 
 struct ring_buffer_tx {
@@ -217,6 +226,7 @@ public:
     uint8_t _rxcie;
     uint8_t _udrie;
     uint8_t _u2x;
+    unsigned long _baudActual;
 
 public:
     RFHardwareSerial(ring_buffer_rx* rx_buffer, ring_buffer_tx* tx_buffer,
@@ -225,6 +235,7 @@ public:
                      volatile uint8_t* udr,
                      uint8_t rxen, uint8_t txen, uint8_t rxcie, uint8_t udrie, uint8_t u2x);
     void begin(unsigned long);
+    static bool isUsableBaudrate(unsigned long baud);
     void end();
     virtual int available(void);
     virtual int peek(void);
@@ -234,6 +245,14 @@ public:
     using Print::write; // pull in write(str) and write(buf, size) from Print
     operator bool();
     int outputUnused(void); // Used for output in interrupts
+    unsigned long getActualBaudrate(void) {
+        return _baudActual;
+    }
+    uint16_t getOverruns(void);
+    void resetOverruns(void);
+
+private:
+    static unsigned long computeBaudSetting(unsigned long baud, uint16_t& setting, bool& u2x);
 };
 
 extern RFHardwareSerial RFSerial;
@@ -276,6 +295,30 @@ extern RFHardwareSerial RFSerial;
 #define OUT(v) Com::print(v)
 #define OUT_LN Com::println()
 
+#if FEATURE_ISR_TIMING
+#define ISR_TIMING_STEPPER 0
+#define ISR_TIMING_PWM 1
+#define ISR_TIMING_EXTRUDER 2
+#define ISR_TIMING_SLOTS 3
+
+/** \brief Duration statistics of one interrupt routine in CPU cycles. */
+struct IsrTimingSlot {
+    uint32_t calls;
+    uint32_t sumCycles;
+    uint16_t minCycles;
+    uint16_t maxCycles;
+    uint16_t overruns; ///< Calls which took longer than the time until their next call
+    uint16_t skipped;  ///< Calls which were not measured because timer 1 restarted during them
+};
+
+/** \brief Start of a measured interrupt which does not belong to timer 1. */
+struct IsrTimingMark {
+    uint16_t ticks;
+    uint8_t stepperCalls;
+    uint8_t matchPending;
+};
+#endif // FEATURE_ISR_TIMING
+
 class HAL {
 public:
     HAL();
@@ -291,6 +334,9 @@ public:
     interval.
     */
     static inline int32_t Div4U2U(uint32_t a, uint16_t b) {
+#ifdef SIMULATOR
+        return a / b;
+#else
         // r14/r15 remainder
         // r16 counter
         __asm volatile(
@@ -378,10 +424,13 @@ public:
             : "0"(a), "r"(b)
             : "r14", "r15", "r16");
         return a;
-
+#endif // SIMULATOR
     } // Div4U2U
 
     static inline unsigned long U16SquaredToU32(unsigned int val) {
+#ifdef SIMULATOR
+        return (uint32_t)(uint16_t)val * (uint16_t)val;
+#else
         long res;
 
         __asm volatile( // 15 Ticks
@@ -401,10 +450,13 @@ public:
             : "=&r"(res), "=r"(val)
             : "1"(val));
         return res;
-
+#endif // SIMULATOR
     } // U16SquaredToU32
 
     static inline speed_t ComputeV(long timer, long accel) {
+#ifdef SIMULATOR
+        return (speed_t)(((uint64_t)(uint32_t)(timer >> 8) * (uint32_t)accel) >> 10);
+#else
         unsigned int res;
 
         // 38 Ticks
@@ -445,7 +497,7 @@ public:
             :);
         // unsigned int v = ((timer>>8)*cur->accel)>>10;
         return res;
-
+#endif // SIMULATOR
     } // ComputeV
 
     static inline void digitalWrite(uint8_t pin, uint8_t value) {
@@ -464,6 +516,7 @@ public:
     } // pinMode
 
     static int32_t CPUDivU2(unsigned int divisor);
+    static speed_t integerSqrt(uint32_t val);
 
     static inline void delayMicroseconds(unsigned int delayUs) //see https://www.arduino.cc/en/Reference/AttachInterrupt for interrupt-warning.
     {
@@ -553,6 +606,62 @@ public:
         return micros();
     } // timeInMicroseconds
 
+#if FEATURE_PLANNER_TIMING
+    /** \brief Time base of the planner timing in PLANNER_TIMING_UNIT. The simulation measures the host, because the firmware takes no simulated time there. */
+    static inline unsigned long plannerTimingNow() {
+#ifdef SIMULATOR
+        return simHostNanoseconds();
+#else
+        return micros();
+#endif // SIMULATOR
+    } // plannerTimingNow
+#endif // FEATURE_PLANNER_TIMING
+
+#if FEATURE_ISR_TIMING
+    static IsrTimingSlot isrTiming[ISR_TIMING_SLOTS];
+
+    static volatile uint8_t isrTimingStepperCalls; ///< Counts the stepper interrupts, which restart timer 1
+
+    /** \brief Start of a measured interrupt. Timer 1 runs with the CPU clock, but it restarts at every compare match of the stepper interrupt. */
+    static INLINE void isrTimingStart(IsrTimingMark& mark) {
+        mark.ticks = TCNT1;
+        mark.stepperCalls = isrTimingStepperCalls;
+        mark.matchPending = TIFR1 & _BV(OCF1A);
+    } // isrTimingStart
+
+    /** \brief Adds one call of the stepper interrupt, which is measured from its compare match. Called with interrupts disabled. */
+    static INLINE void isrTimingEnd(uint8_t slot, uint16_t start, uint32_t budgetCycles) {
+        addIsrTiming(slot, TCNT1 - start, budgetCycles);
+    } // isrTimingEnd
+
+    /** \brief Adds one call of an interrupt which does not belong to timer 1. If timer 1 restarted during the call, there is no exact
+    duration, so the call is only counted as skipped. Called with interrupts disabled from the measured interrupt only. */
+    static INLINE void isrTimingEnd(uint8_t slot, IsrTimingMark& start, uint32_t budgetCycles) {
+        uint16_t now = TCNT1;
+        if (now < start.ticks || start.stepperCalls != isrTimingStepperCalls || (!start.matchPending && (TIFR1 & _BV(OCF1A)))) {
+            if (isrTiming[slot].skipped < 0xFFFF)
+                isrTiming[slot].skipped++;
+            return;
+        }
+        addIsrTiming(slot, now - start.ticks, budgetCycles);
+    } // isrTimingEnd
+
+    static INLINE void addIsrTiming(uint8_t slot, uint16_t cycles, uint32_t budgetCycles) {
+        IsrTimingSlot& timing = isrTiming[slot];
+        timing.calls++;
+        timing.sumCycles += cycles;
+        if (cycles < timing.minCycles)
+            timing.minCycles = cycles;
+        if (cycles > timing.maxCycles)
+            timing.maxCycles = cycles;
+        if (cycles > budgetCycles && timing.overruns < 0xFFFF)
+            timing.overruns++;
+    } // addIsrTiming
+
+    static void resetIsrTiming();
+    static void printIsrTiming();
+#endif // FEATURE_ISR_TIMING
+
     static inline char readFlashByte(PGM_P ptr) {
         return pgm_read_byte(ptr);
 
@@ -563,6 +672,15 @@ public:
 
     } // serialSetBaudrate
 
+    /** \brief Checks if the serial port reaches baud within SERIAL_MAX_BAUD_ERROR. */
+    static inline bool serialBaudrateUsable(long baud) {
+#ifndef EXTERNALSERIAL
+        return RFHardwareSerial::isUsableBaudrate(baud);
+#else
+        return true;
+#endif // EXTERNALSERIAL
+    } // serialBaudrateUsable
+
     static inline bool serialByteAvailable() {
         return RFSERIAL.available() > 0;
 
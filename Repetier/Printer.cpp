@@ -22,6 +22,10 @@
 uint8_t Printer::maxExtruderSpeed;         // Timer delay for end extruder speed
 volatile int Printer::extruderStepsNeeded; // This many extruder steps are still needed, <0 = reverse steps needed.
 volatile int Printer::advanceStepsSet;
+volatile uint16_t Printer::advanceDirectionChanges = 0;
+#if FEATURE_SEGMENT_ADVANCE
+float Printer::advanceSmoothingTime = ADVANCE_SMOOTHING_TIME;
+#endif // FEATURE_SEGMENT_ADVANCE
 #endif // USE_ADVANCE
 
 uint8_t Printer::unitIsInches = 0; // 0 = Units are mm, 1 = units are inches.
@@ -72,6 +76,12 @@ unsigned long Printer::stepNumber[2] = { 0 };     // Step number in current move
 unsigned short Printer::interval_mod = 0; // additional step duration in ticks to slow the printer down live
 #endif                                    // FEATURE_DIGIT_FLOW_COMPENSATION
 int8_t Printer::lastDirectionSovereignty = 0;
+#if FEATURE_STEP_TRACE
+volatile uint32_t Printer::stepTraceCalls = 0;
+volatile uint32_t Printer::stepTraceSteps = 0;
+volatile uint32_t Printer::stepTraceTicks = 0;
+volatile uint32_t Printer::stepTraceChecksum = 0;
+#endif // FEATURE_STEP_TRACE
 
 long Printer::maxSoftEndstopSteps[3] = { 0 }; // For software endstops, limit of move in positive direction. (=Homing-Offset + Achsenlänge)
 float Printer::axisLengthMM[3] = { 0 };       // Länge des überfahrbaren Bereichs im positiven Homing. (=Schienen-Fahrweg - Homing-Offset - 2x ExtruderOffset)
@@ -83,7 +93,24 @@ float Printer::dynamicExtrusionFactor = 1.0;  // Flow multiplier factor for digi
 float Printer::extrudeMultiplyErrorSteps = 0;
 float Printer::maxXYJerk;                                         // Maximum allowed jerk in mm/s
 float Printer::maxZJerk;                                          // Maximum allowed jerk in z direction in mm/s
-unsigned int Printer::vMaxReached[2];                             // Maximum reached speed [FOR_DIRECT, FOR_QUEUE]
+#if FEATURE_SEGMENT_MERGING
+bool Printer::segmentMergePending = false;
+float Printer::segmentMergeFeedrate = 0;
+float Printer::segmentMergeTolerance = SEGMENT_MERGE_TOLERANCE;
+float Printer::segmentMergeJoints[SEGMENT_MERGE_MAX_JOINTS][3];
+uint8_t Printer::segmentMergeJointCount = 0;
+uint32_t Printer::segmentMergeInput = 0;
+uint32_t Printer::segmentMergeQueued = 0;
+#endif // FEATURE_SEGMENT_MERGING
+#if FEATURE_S_CURVE_ACCELERATION
+uint8_t Printer::sCurveMode = S_CURVE_MODE_DEFAULT;
+float Printer::sCurveAccelerationXY = S_CURVE_ACCELERATION_XY;
+#endif // FEATURE_S_CURVE_ACCELERATION
+#if FEATURE_JUNCTION_DEVIATION
+uint8_t Printer::junctionMode = JUNCTION_MODE_DEFAULT;            // JUNCTION_MODE_JERK or JUNCTION_MODE_DEVIATION
+float Printer::junctionDeviation = JUNCTION_DEVIATION;            // Junction deviation in mm
+#endif                                                            // FEATURE_JUNCTION_DEVIATION
+speed_t Printer::vMaxReached[2];                                  // Maximum reached speed [FOR_DIRECT, FOR_QUEUE]
 unsigned long Printer::msecondsPrinting = 0;                      // Milliseconds of printing time (means time with heated extruder)
 unsigned long Printer::msecondsMilling = 0;                       // Milliseconds of milling time
 float Printer::filamentPrinted = 0.0f;                            // mm of filament printed since counting started
@@ -128,6 +155,11 @@ volatile long Printer::compensatedPositionCurrentStepsZ = 0;
 
 volatile float Printer::compensatedPositionOverPercE = 0.0f;
 volatile float Printer::compensatedPositionCollectTinyE = 0.0f;
+#if FEATURE_SEGMENT_Z_COMPENSATION
+volatile long Printer::compensationDepthScale = 0;
+volatile long Printer::compensationDepthOffset = 0;
+volatile bool Printer::compensationFollowsSegment = false;
+#endif // FEATURE_SEGMENT_Z_COMPENSATION
 
 long Printer::queuePositionZLayerGuessNew = 0;
 volatile long Printer::queuePositionZLayerCurrent = 0;
@@ -247,6 +279,11 @@ void Printer::updateDerivedParameter() {
 #endif // FEATURE_MILLING_MODE
             /** Acceleration in steps/s^2 in printing mode.*/
             maxPrintAccelerationStepsPerSquareSecond[axis] = uint32_t(maxAccelerationMMPerSquareSecond[axis] * axisStepsPerMM[axis]);
+#if FEATURE_S_CURVE_ACCELERATION
+            // M201 / EEPROM stays the upper limit, the S-curve can only ask for less
+            if (sCurveMode && axis <= Y_AXIS)
+                maxPrintAccelerationStepsPerSquareSecond[axis] = uint32_t(RMath::min(sCurveAccelerationXY, maxAccelerationMMPerSquareSecond[axis]) * axisStepsPerMM[axis]);
+#endif // FEATURE_S_CURVE_ACCELERATION
             /** Acceleration in steps/s^2 in movement mode.*/
             maxTravelAccelerationStepsPerSquareSecond[axis] = uint32_t(maxTravelAccelerationMMPerSquareSecond[axis] * axisStepsPerMM[axis]);
 #if FEATURE_MILLING_MODE
@@ -335,10 +372,18 @@ void Printer::switchEverythingOff() {
 void Printer::updateAdvanceActivated() {
     Printer::setAdvanceActivated(false);
 #if USE_ADVANCE
+#if SEPARATE_EXTRUDER_INTERRUPT
+    Printer::setAdvanceActivated(true); // the extruder interrupt does all extruder steps
+#endif                                  // SEPARATE_EXTRUDER_INTERRUPT
     for (uint8_t i = 0; i < NUM_EXTRUDER; i++) {
         if (extruder[i].advanceL != 0) {
             Printer::setAdvanceActivated(true);
         }
+#if FEATURE_SEGMENT_ADVANCE
+        if (extruder[i].advanceK != 0) {
+            Printer::setAdvanceActivated(true);
+        }
+#endif // FEATURE_SEGMENT_ADVANCE
     }
 #endif // USE_ADVANCE
 } // updateAdvanceActivated
@@ -457,6 +502,11 @@ For the computation of the destination, the following facts are considered:
 */
 bool Printer::queueGCodeCoordinates(GCode* com, bool noDriving) {
     InterruptProtectedBlock noInts;
+#if FEATURE_SEGMENT_MERGING
+    float jointMM[4]; // end of the previous move = start of this one
+    for (uint8_t axis = 0; axis < 4; axis++)
+        jointMM[axis] = destinationMM[axis];
+#endif // FEATURE_SEGMENT_MERGING
     bool isXYZMove = !com->hasNoXYZ();
     if (relativeCoordinateMode) {
         if (com->hasX())
@@ -504,6 +554,10 @@ bool Printer::queueGCodeCoordinates(GCode* com, bool noDriving) {
     }
 
     if (isXYZMove || isEMove) {
+#if FEATURE_SEGMENT_MERGING
+        if (mergeSegment(jointMM, isXYZMove))
+            return true;
+#endif // FEATURE_SEGMENT_MERGING
         PrintLine::prepareQueueMove(false, true, Printer::feedrate);
 
         return true;
@@ -513,6 +567,93 @@ bool Printer::queueGCodeCoordinates(GCode* com, bool noDriving) {
     return false;
 } // queueGCodeCoordinates
 
+#if FEATURE_SEGMENT_MERGING
+/** \brief Collinear segment merging in front of prepareQueueMove().
+Returns true if the move in destinationMM is held back or was merged into the held move. jointMM is the end of the previous move. */
+bool Printer::mergeSegment(float* jointMM, bool isXYZMove) {
+    segmentMergeInput++;
+    if (segmentMergePending) {
+        if (isXYZMove && canMergeSegment(jointMM)) {
+            // destinationMM already is the new end of the merged move, keep the joint for the next checks
+            for (uint8_t axis = 0; axis < 3; axis++)
+                segmentMergeJoints[segmentMergeJointCount][axis] = jointMM[axis];
+            segmentMergeJointCount++;
+            return true;
+        }
+
+        // send the held move up to the joint and continue with the new one
+        float endMM[4];
+        for (uint8_t axis = 0; axis < 4; axis++) {
+            endMM[axis] = destinationMM[axis];
+            destinationMM[axis] = jointMM[axis];
+        }
+        flushMergedSegment();
+        for (uint8_t axis = 0; axis < 4; axis++)
+            destinationMM[axis] = endMM[axis];
+    }
+
+    if (!isXYZMove || segmentMergeTolerance <= 0) {
+        segmentMergeQueued++;
+        return false;
+    }
+    segmentMergePending = true;
+    segmentMergeFeedrate = feedrate;
+    segmentMergeJointCount = 0;
+    return true;
+} // mergeSegment
+
+/** \brief Checks if the held move (destinationMMLast -> jointMM) and the new move (jointMM -> destinationMM) can be one move.
+The joints inside the held move are checked against the new line again, so the error does not grow with the length of the chain. */
+bool Printer::canMergeSegment(float* jointMM) {
+    if (feedrate != segmentMergeFeedrate || segmentMergeJointCount >= SEGMENT_MERGE_MAX_JOINTS)
+        return false;
+
+    float a[3], b[3], c[3];
+    float lengthA2 = 0, lengthB2 = 0, lengthC2 = 0, dot = 0;
+    for (uint8_t axis = 0; axis < 3; axis++) {
+        a[axis] = jointMM[axis] - destinationMMLast[axis];
+        b[axis] = destinationMM[axis] - jointMM[axis];
+        c[axis] = a[axis] + b[axis];
+        lengthA2 += a[axis] * a[axis];
+        lengthB2 += b[axis] * b[axis];
+        lengthC2 += c[axis] * c[axis];
+        dot += a[axis] * b[axis];
+    }
+    if (dot <= 0 || lengthC2 > SEGMENT_MERGE_MAX_LENGTH * SEGMENT_MERGE_MAX_LENGTH)
+        return false;
+
+    // distance of every joint from the merged line: |p x c| / |c| with p = joint - start
+    float maxCross2 = segmentMergeTolerance * segmentMergeTolerance * lengthC2;
+    for (uint8_t joint = 0; joint <= segmentMergeJointCount; joint++) {
+        float* p = (joint < segmentMergeJointCount ? segmentMergeJoints[joint] : jointMM);
+        float pX = p[X_AXIS] - destinationMMLast[X_AXIS];
+        float pY = p[Y_AXIS] - destinationMMLast[Y_AXIS];
+        float pZ = p[Z_AXIS] - destinationMMLast[Z_AXIS];
+        float crossX = pY * c[Z_AXIS] - pZ * c[Y_AXIS];
+        float crossY = pZ * c[X_AXIS] - pX * c[Z_AXIS];
+        float crossZ = pX * c[Y_AXIS] - pY * c[X_AXIS];
+        if (crossX * crossX + crossY * crossY + crossZ * crossZ > maxCross2)
+            return false;
+    }
+
+    // the merged move extrudes evenly, so both parts need the same extrusion per mm: eA / |a| = eB / |b|
+    float eA = jointMM[E_AXIS] - destinationMMLast[E_AXIS];
+    float eB = destinationMM[E_AXIS] - jointMM[E_AXIS];
+    float lengthA = sqrt(lengthA2);
+    float lengthB = sqrt(lengthB2);
+    return fabs(eA * lengthB - eB * lengthA) <= SEGMENT_MERGE_E_TOLERANCE * fabs(eA) * lengthB;
+} // canMergeSegment
+
+/** \brief Sends a held back move to the path planner. Must be called before anything else uses destinationMM or waits for the queue. */
+void Printer::flushMergedSegment() {
+    if (!segmentMergePending)
+        return;
+    segmentMergePending = false;
+    segmentMergeQueued++;
+    PrintLine::prepareQueueMove(false, true, segmentMergeFeedrate);
+} // flushMergedSegment
+#endif // FEATURE_SEGMENT_MERGING
+
 /**
  * Move to Cartesian coordinates
  *
@@ -520,6 +661,9 @@ bool Printer::queueGCodeCoordinates(GCode* com, bool noDriving) {
  * Does ignore wobble fix
  */
 void Printer::queueFloatCoordinates(float x, float y, float z, float e, float feedrate) {
+#if FEATURE_SEGMENT_MERGING
+    flushMergedSegment();
+#endif // FEATURE_SEGMENT_MERGING
     InterruptProtectedBlock noInts;
     if (x == IGNORE_COORDINATE)
         x = destinationMM[X_AXIS];
@@ -545,6 +689,9 @@ void Printer::queueFloatCoordinates(float x, float y, float z, float e, float fe
 
 /** \brief Move printer the given number of steps. Puts the move into the queue. Used by e.g. homing commands. */
 void Printer::queueRelativeStepsCoordinates(long dx, long dy, long dz, long de, float feedrate, bool waitEnd, bool abortAtEndstops) {
+#if FEATURE_SEGMENT_MERGING
+    flushMergedSegment();
+#endif // FEATURE_SEGMENT_MERGING
     InterruptProtectedBlock noInts;
     destinationMM[X_AXIS] += dx * axisMMPerSteps[X_AXIS];
     destinationMM[Y_AXIS] += dy * axisMMPerSteps[Y_AXIS];
@@ -562,6 +709,9 @@ void Printer::queueRelativeStepsCoordinates(long dx, long dy, long dz, long de,
 
 /** \brief Move printer the given number of mm. Puts the move into the queue. */
 void Printer::queueRelativeMMCoordinates(float dx, float dy, float dz, float de, float feedrate, bool waitEnd, bool abortAtEndstops) {
+#if FEATURE_SEGMENT_MERGING
+    flushMergedSegment();
+#endif // FEATURE_SEGMENT_MERGING
     InterruptProtectedBlock noInts;
     destinationMM[X_AXIS] += dx;
     destinationMM[Y_AXIS] += dy;
@@ -900,6 +1050,20 @@ void Printer::setup() {
 
     maxXYJerk = MAX_JERK;
     maxZJerk = MAX_ZJERK;
+#if FEATURE_JUNCTION_DEVIATION
+    junctionMode = JUNCTION_MODE_DEFAULT;
+    junctionDeviation = JUNCTION_DEVIATION;
+#endif // FEATURE_JUNCTION_DEVIATION
+#if FEATURE_S_CURVE_ACCELERATION
+    sCurveMode = S_CURVE_MODE_DEFAULT;
+    sCurveAccelerationXY = S_CURVE_ACCELERATION_XY;
+#endif // FEATURE_S_CURVE_ACCELERATION
+#if FEATURE_INPUT_SHAPING
+    PrintLine::shaperX.axis = X_AXIS;
+    PrintLine::shaperY.axis = Y_AXIS;
+    PrintLine::shaperX.configure(INPUT_SHAPING_FREQUENCY_X, INPUT_SHAPING_DAMPING_X);
+    PrintLine::shaperY.configure(INPUT_SHAPING_FREQUENCY_Y, INPUT_SHAPING_DAMPING_Y);
+#endif // FEATURE_INPUT_SHAPING
 
     flag0 = PRINTER_FLAG0_STEPPER_DISABLED;
 
@@ -974,11 +1138,21 @@ void Printer::setup() {
     UI_INITIALIZE;
 
     EEPROM::initBaudrate();
+    long unusableBaudrate = 0;
+    if (!HAL::serialBaudrateUsable(baudrate)) {
+        unusableBaudrate = baudrate; // the receiver would misread the bytes
+        baudrate = BAUDRATE;
+    }
     HAL::serialSetBaudrate(baudrate);
 
     // sending of this information tells the Repetier-Host that the firmware has restarted - never delete or change this to-be-sent information
     Com::println();
     Com::printFLN(Com::tStart); //http://forum.repetier.com/discussion/comment/16949/#Comment_16949
+    if (unusableBaudrate) {
+        Com::printF(Com::tError);
+        Com::printF(PSTR("the serial port can not reach the baudrate "), (int32_t)unusableBaudrate);
+        Com::printFLN(PSTR(", using "), (int32_t)baudrate);
+    }
 
     HAL::showStartReason();
     Extruder::initExtruder();
@@ -1189,6 +1363,12 @@ void Printer::disableCMPnow(bool wait) {
     }
 #endif                                            // FEATURE_WORK_PART_Z_COMPENSATION
 #endif                                            // FEATURE_MILLING_MODE
+#if FEATURE_SEGMENT_Z_COMPENSATION
+    InterruptProtectedBlock noInts;
+    Printer::compensationDepthScale = 0;
+    Printer::compensationDepthOffset = 0;
+    noInts.unprotect();
+#endif // FEATURE_SEGMENT_Z_COMPENSATION
     Printer::compensatedPositionTargetStepsZ = 0; //tell CMP to move to 0. TODO: Care for positive matrix beds.
 
     while (wait && compensatedPositionCurrentStepsZ - compensatedPositionTargetStepsZ) //warte auf queue befehlsende
@@ -1823,6 +2003,13 @@ void Printer::stopPrint() //function for aborting USB and SD-Prints
     //erase the coordinates and kill the current taskplaner:
     PrintLine::resetPathPlanner();
     PrintLine::cur = NULL;
+#if FEATURE_SEGMENT_MERGING
+    Printer::segmentMergePending = false; // the held move belongs to the stopped print
+#endif // FEATURE_SEGMENT_MERGING
+#if FEATURE_INPUT_SHAPING
+    PrintLine::shaperX.flush(); // the delayed impulses belong to the stopped print as well
+    PrintLine::shaperY.flush();
+#endif // FEATURE_INPUT_SHAPING
 
     Printer::setXAxisSteps(Printer::currentSteps[X_AXIS]);
     Printer::setYAxisSteps(Printer::currentSteps[Y_AXIS]);
@@ -1867,6 +2054,12 @@ void Printer::showConfiguration() {
     Com::config(PSTR("PrintlineCache:"), MOVE_CACHE_SIZE);
     Com::config(PSTR("JerkXY:"), Printer::maxXYJerk);
     Com::config(PSTR("JerkZ:"), Printer::maxZJerk);
+#if FEATURE_S_CURVE_ACCELERATION
+    Com::config(PSTR("SCurveAccelerationXY:"), (Printer::sCurveMode ? Printer::sCurveAccelerationXY : 0), 0);
+#endif // FEATURE_S_CURVE_ACCELERATION
+#if FEATURE_JUNCTION_DEVIATION
+    Com::config(PSTR("JunctionDeviation:"), (Printer::junctionMode == JUNCTION_MODE_DEVIATION ? Printer::junctionDeviation : 0), 3);
+#endif // FEATURE_JUNCTION_DEVIATION
     Com::config(PSTR("KeepAliveInterval:"), KEEP_ALIVE_INTERVAL);
 
     Com::config(PSTR("XMin:"), 0);
@@ -1904,7 +2097,7 @@ void Printer::showConfiguration() {
 extern void ui_check_keys(int& action);
 
 bool Printer::checkAbortKeys(void) {
-    int16_t activeKeys = 0;
+    int activeKeys = 0;
     uid.ui_check_keys(activeKeys);
     if (activeKeys == UI_ACTION_OK || activeKeys == UI_ACTION_BACK) {
         return true;
@@ -1914,7 +2107,7 @@ bool Printer::checkAbortKeys(void) {
 
 bool Printer::checkPlayKey(void) {
     if (g_pauseMode == PAUSE_MODE_NONE) {
-        int16_t activeKeys = 0;
+        int activeKeys = 0;
         uid.ui_check_keys(activeKeys);
         if (activeKeys == UI_ACTION_RF_CONTINUE) {
             return true;
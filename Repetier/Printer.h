@@ -54,12 +54,19 @@
 #define DIR_QUEUE 1
 #define DIR_DIRECT -1
 
+#define JUNCTION_MODE_JERK 0
+#define JUNCTION_MODE_DEVIATION 1
+
 class Printer {
 public:
 #if USE_ADVANCE
     static volatile int extruderStepsNeeded; // This many extruder steps are still needed, <0 = reverse steps needed.
     static uint8_t maxExtruderSpeed;         // Timer delay for end extruder speed
     static volatile int advanceStepsSet;
+    static volatile uint16_t advanceDirectionChanges; // Direction changes of the extruder interrupt, reported and cleared by M232
+#if FEATURE_SEGMENT_ADVANCE
+    static float advanceSmoothingTime; // Shortest time in ms for a change of the advance
+#endif                                 // FEATURE_SEGMENT_ADVANCE
 #endif // USE_ADVANCE
 
     static uint8_t menuMode;
@@ -92,6 +99,12 @@ public:
     static unsigned short interval_mod; // additional step duration in ticks to slow the printer down live
 #endif                                  // FEATURE_DIGIT_FLOW_COMPENSATION
     static int8_t lastDirectionSovereignty;
+#if FEATURE_STEP_TRACE
+    static volatile uint32_t stepTraceCalls;    // Number of stepper timer calls which did output steps
+    static volatile uint32_t stepTraceSteps;    // Number of primary axis steps
+    static volatile uint32_t stepTraceTicks;    // Sum of all intervals in ticks
+    static volatile uint32_t stepTraceChecksum; // Order dependent checksum over steps and intervals
+#endif                                          // FEATURE_STEP_TRACE
     static float originOffsetMM[3];
     static volatile float destinationMM[4]; // Target in mm from origin.
     static float destinationMMLast[4];      // Position in mm from origin.
@@ -106,6 +119,23 @@ public:
     static float extrudeMultiplyErrorSteps; // collects the extrusion error.
     static float maxXYJerk;                 // Maximum allowed jerk in mm/s
     static float maxZJerk;                  // Maximum allowed jerk in z direction in mm/s
+#if FEATURE_SEGMENT_MERGING
+    static bool segmentMergePending;        // destinationMM holds a move which is not queued yet
+    static float segmentMergeFeedrate;      // Feedrate of the held move
+    static float segmentMergeTolerance;     // Max. distance of a joint from the merged line in mm, 0 = off
+    static float segmentMergeJoints[SEGMENT_MERGE_MAX_JOINTS][3]; // Joints inside the held move
+    static uint8_t segmentMergeJointCount;  // Number of joints inside the held move
+    static uint32_t segmentMergeInput;      // Number of G0/G1 moves
+    static uint32_t segmentMergeQueued;     // Number of moves sent to the path planner for them
+#endif                                      // FEATURE_SEGMENT_MERGING
+#if FEATURE_S_CURVE_ACCELERATION
+    static uint8_t sCurveMode;              // 0 = trapezoid, 1 = S-curve ramps
+    static float sCurveAccelerationXY;      // Average X/Y print acceleration in mm/s^2 while the S-curve is active
+#endif                                      // FEATURE_S_CURVE_ACCELERATION
+#if FEATURE_JUNCTION_DEVIATION
+    static uint8_t junctionMode;            // JUNCTION_MODE_JERK or JUNCTION_MODE_DEVIATION
+    static float junctionDeviation;         // Junction deviation in mm
+#endif                                      // FEATURE_JUNCTION_DEVIATION
     static speed_t vMaxReached[2];          // Maximumu reached speed
     static unsigned long msecondsPrinting;  // Milliseconds of printing time (means time with heated extruder)
     static unsigned long msecondsMilling;   // Milliseconds of milling time
@@ -150,6 +180,11 @@ public:
     static volatile long compensatedPositionCurrentStepsZ;
     static volatile float compensatedPositionOverPercE;
     static volatile float compensatedPositionCollectTinyE;
+#if FEATURE_SEGMENT_Z_COMPENSATION
+    static volatile long compensationDepthScale;   ///< Part of the matrix depth which is compensated in the current layer, 16.16 fixed point
+    static volatile long compensationDepthOffset;  ///< Compensation target without the matrix depth part
+    static volatile bool compensationFollowsSegment; ///< The stepper interrupt sets the compensation target from the depth of the current move
+#endif // FEATURE_SEGMENT_Z_COMPENSATION
 
     static long queuePositionZLayerGuessNew;
     static volatile long queuePositionZLayerCurrent;
@@ -270,6 +305,25 @@ public:
         return ((debugLevel & 8) != 0);
     } // debugDryrun
 
+#if FEATURE_STEP_TRACE
+    /** \brief Adds one stepper timer call to the step trace. Called from the stepper interrupt only. */
+    static INLINE void traceSteps(uint8_t steps, unsigned long interval) {
+        stepTraceCalls++;
+        stepTraceSteps += steps;
+        stepTraceTicks += interval;
+        // rotate by one bit so that the same intervals in a different order give a different checksum
+        stepTraceChecksum = ((stepTraceChecksum << 1) | (stepTraceChecksum >> 31)) ^ (interval + ((uint32_t)steps << 24));
+    } // traceSteps
+
+    static INLINE void resetStepTrace() {
+        InterruptProtectedBlock noInts;
+        stepTraceCalls = 0;
+        stepTraceSteps = 0;
+        stepTraceTicks = 0;
+        stepTraceChecksum = 0;
+    } // resetStepTrace
+#endif // FEATURE_STEP_TRACE
+
     /** \brief Disable stepper motor for x direction. */
     static INLINE void disableXStepper() {
 #if (X_ENABLE_PIN > -1)
@@ -1059,6 +1113,11 @@ public:
     static void setup();
     static void setFeedrate(float feedrate);
     static bool queueGCodeCoordinates(GCode* com, bool noDriving = false);
+#if FEATURE_SEGMENT_MERGING
+    static bool mergeSegment(float* jointMM, bool isXYZMove);
+    static bool canMergeSegment(float* jointMM);
+    static void flushMergedSegment();
+#endif // FEATURE_SEGMENT_MERGING
     static void queueFloatCoordinates(float x, float y, float z, float e, float feedrate);
     static void queueRelativeStepsCoordinates(long x, long y, long z, long e, float feedrate, bool waitEnd, bool abortAtEndstops = false);
     static void queueRelativeMMCoordinates(float x, float y, float z, float e, float feedrate, bool waitEnd, bool abortAtEndstops = false);
@@ -110,6 +110,9 @@ char g_nHeatBedScanMode = 0;
 char g_abortZScan = 0;
 short g_ZCompensationMatrix[COMPENSATION_MATRIX_MAX_X][COMPENSATION_MATRIX_MAX_Y];
 unsigned char g_uZMatrixMax[2] = { 0, 0 };
+#if FEATURE_Z_MATRIX_SPLINE
+char g_nZMatrixInterpolation = Z_MATRIX_INTERPOLATION_DEFAULT;
+#endif // FEATURE_Z_MATRIX_SPLINE
 long g_nZScanZPosition = 0;
 long g_nLastZScanZPosition = 0;
 
@@ -150,6 +153,10 @@ char g_nScanPressureReads = 0;
 unsigned short g_nScanPressureReadDelay = 0;
 short g_nScanPressureTolerance = 0;
 #endif // FEATURE_HEAT_BED_Z_COMPENSATION || FEATURE_WORK_PART_Z_COMPENSATION
+#if FEATURE_ADAPTIVE_HEAT_BED_SCAN
+unsigned char g_nScanAdaptiveStride = HEAT_BED_SCAN_ADAPTIVE_STRIDE;
+short g_nScanAdaptiveToleranceUM = HEAT_BED_SCAN_ADAPTIVE_TOLERANCE_UM;
+#endif // FEATURE_ADAPTIVE_HEAT_BED_SCAN
 
 long g_staticZSteps = 0;
 char g_debugLevel = 0;
@@ -453,6 +460,141 @@ void startHeatBedScan(void) {
     return;
 } // startHeatBedScan
 
+#if FEATURE_ADAPTIVE_HEAT_BED_SCAN
+// markers for the points of the matrix during the adaptive scan, the scanned z-positions never reach them
+#define ADAPTIVE_SCAN_UNSCANNED -32768
+#define ADAPTIVE_SCAN_REQUESTED -32767
+
+static inline bool isAdaptiveScanCoarse(unsigned char index, unsigned char maxIndex) {
+    return ((index - 2) % g_nScanAdaptiveStride) == 0 || index == maxIndex;
+} // isAdaptiveScanCoarse
+
+static inline unsigned char nextAdaptiveScanCoarse(unsigned char index, unsigned char maxIndex) {
+    return (index + g_nScanAdaptiveStride <= maxIndex ? index + g_nScanAdaptiveStride : maxIndex);
+} // nextAdaptiveScanCoarse
+
+static inline unsigned char prevAdaptiveScanCoarse(unsigned char index) {
+    return 2 + ((index - 3) / g_nScanAdaptiveStride) * g_nScanAdaptiveStride;
+} // prevAdaptiveScanCoarse
+
+/** \brief Fills the borders of the whole grid and requests the points of the coarse grid. Returns false if the matrix would become too big. */
+static bool prepareAdaptiveHeatBedScan(void) {
+    long nMaxIndexX = 2 + (g_nScanXMaxPositionSteps - g_nScanXStartSteps) / g_nScanXStepSizeSteps;
+    long nMaxIndexY = 2 + (g_nScanYMaxPositionSteps - g_nScanYStartSteps) / g_nScanYStepSizeSteps;
+    if (nMaxIndexX >= COMPENSATION_MATRIX_MAX_X || nMaxIndexY >= COMPENSATION_MATRIX_MAX_Y)
+        return false;
+
+    g_uZMatrixMax[X_AXIS] = (unsigned char)nMaxIndexX;
+    g_uZMatrixMax[Y_AXIS] = (unsigned char)nMaxIndexY;
+    for (unsigned char x = 2; x <= g_uZMatrixMax[X_AXIS]; x++)
+        g_ZCompensationMatrix[x][0] = (short)((float)(g_nScanXStartSteps + (x - 2) * g_nScanXStepSizeSteps) / Printer::axisStepsPerMM[X_AXIS] + 0.5); // convert to mm
+    for (unsigned char y = 2; y <= g_uZMatrixMax[Y_AXIS]; y++)
+        g_ZCompensationMatrix[0][y] = (short)((float)(g_nScanYStartSteps + (y - 2) * g_nScanYStepSizeSteps) / Printer::axisStepsPerMM[Y_AXIS] + 0.5); // convert to mm
+
+    for (unsigned char x = 2; x <= g_uZMatrixMax[X_AXIS]; x++) {
+        for (unsigned char y = 2; y <= g_uZMatrixMax[Y_AXIS]; y++) {
+            bool coarse = isAdaptiveScanCoarse(x, g_uZMatrixMax[X_AXIS]) && isAdaptiveScanCoarse(y, g_uZMatrixMax[Y_AXIS]);
+            g_ZCompensationMatrix[x][y] = (coarse ? ADAPTIVE_SCAN_REQUESTED : ADAPTIVE_SCAN_UNSCANNED);
+        }
+    }
+    return true;
+} // prepareAdaptiveHeatBedScan
+
+/** \brief Deviation of the middle point from the straight line through its coarse neighbours, divided by 4. This is about the error of the linear interpolation within the neighbour cells. */
+static long adaptiveScanCurvature(short z0, short z1, short z2, unsigned char i0, unsigned char i1, unsigned char i2) {
+    long predicted = z0 + (long)(z2 - z0) * (i1 - i0) / (i2 - i0);
+    return labs(z1 - predicted) / 4;
+} // adaptiveScanCurvature
+
+/** \brief Requests all points of the coarse cells whose surface is not bilinear within the tolerance. Returns the number of these cells. */
+static short markAdaptiveHeatBedScan(void) {
+    unsigned char nMaxX = g_uZMatrixMax[X_AXIS];
+    unsigned char nMaxY = g_uZMatrixMax[Y_AXIS];
+    long nToleranceSteps = RMath::max((long)((float)g_nScanAdaptiveToleranceUM * Printer::axisStepsPerMM[Z_AXIS] / 1000), 1L);
+    short nCells = 0;
+
+    for (unsigned char x0 = 2; x0 < nMaxX; x0 = nextAdaptiveScanCoarse(x0, nMaxX)) {
+        unsigned char x1 = nextAdaptiveScanCoarse(x0, nMaxX);
+        for (unsigned char y0 = 2; y0 < nMaxY; y0 = nextAdaptiveScanCoarse(y0, nMaxY)) {
+            unsigned char y1 = nextAdaptiveScanCoarse(y0, nMaxY);
+
+            // the twist of the corners is the deviation from a plane
+            long nResidual = labs((long)g_ZCompensationMatrix[x0][y0] - g_ZCompensationMatrix[x1][y0] - g_ZCompensationMatrix[x0][y1] + g_ZCompensationMatrix[x1][y1]) / 4;
+
+            // the bending along the edges is seen with the neighbour points of the coarse grid
+            for (uint8_t i = 0; i < 2; i++) {
+                unsigned char x = (i ? x1 : x0);
+                unsigned char y = (i ? y1 : y0);
+                if (x0 > 2) {
+                    unsigned char xp = prevAdaptiveScanCoarse(x0);
+                    nResidual = RMath::max(nResidual, adaptiveScanCurvature(g_ZCompensationMatrix[xp][y], g_ZCompensationMatrix[x0][y], g_ZCompensationMatrix[x1][y], xp, x0, x1));
+                }
+                if (x1 < nMaxX) {
+                    unsigned char xn = nextAdaptiveScanCoarse(x1, nMaxX);
+                    nResidual = RMath::max(nResidual, adaptiveScanCurvature(g_ZCompensationMatrix[x0][y], g_ZCompensationMatrix[x1][y], g_ZCompensationMatrix[xn][y], x0, x1, xn));
+                }
+                if (y0 > 2) {
+                    unsigned char yp = prevAdaptiveScanCoarse(y0);
+                    nResidual = RMath::max(nResidual, adaptiveScanCurvature(g_ZCompensationMatrix[x][yp], g_ZCompensationMatrix[x][y0], g_ZCompensationMatrix[x][y1], yp, y0, y1));
+                }
+                if (y1 < nMaxY) {
+                    unsigned char yn = nextAdaptiveScanCoarse(y1, nMaxY);
+                    nResidual = RMath::max(nResidual, adaptiveScanCurvature(g_ZCompensationMatrix[x][y0], g_ZCompensationMatrix[x][y1], g_ZCompensationMatrix[x][yn], y0, y1, yn));
+                }
+            }
+            if (nResidual <= nToleranceSteps)
+                continue;
+
+            nCells++;
+            for (unsigned char x = x0; x <= x1; x++)
+                for (unsigned char y = y0; y <= y1; y++)
+                    if (g_ZCompensationMatrix[x][y] == ADAPTIVE_SCAN_UNSCANNED)
+                        g_ZCompensationMatrix[x][y] = ADAPTIVE_SCAN_REQUESTED;
+        }
+    }
+    return nCells;
+} // markAdaptiveHeatBedScan
+
+/** \brief Interpolates the points which were not scanned bilinear from the corners of their coarse cell. */
+static void fillAdaptiveHeatBedScan(void) {
+    unsigned char nMaxX = g_uZMatrixMax[X_AXIS];
+    unsigned char nMaxY = g_uZMatrixMax[Y_AXIS];
+
+    for (unsigned char x0 = 2; x0 < nMaxX; x0 = nextAdaptiveScanCoarse(x0, nMaxX)) {
+        unsigned char x1 = nextAdaptiveScanCoarse(x0, nMaxX);
+        for (unsigned char y0 = 2; y0 < nMaxY; y0 = nextAdaptiveScanCoarse(y0, nMaxY)) {
+            unsigned char y1 = nextAdaptiveScanCoarse(y0, nMaxY);
+            for (unsigned char x = x0; x <= x1; x++) {
+                long nFront = g_ZCompensationMatrix[x0][y0] + (long)(g_ZCompensationMatrix[x1][y0] - g_ZCompensationMatrix[x0][y0]) * (x - x0) / (x1 - x0);
+                long nBack = g_ZCompensationMatrix[x0][y1] + (long)(g_ZCompensationMatrix[x1][y1] - g_ZCompensationMatrix[x0][y1]) * (x - x0) / (x1 - x0);
+                for (unsigned char y = y0; y <= y1; y++)
+                    if (g_ZCompensationMatrix[x][y] == ADAPTIVE_SCAN_UNSCANNED)
+                        g_ZCompensationMatrix[x][y] = (short)(nFront + (nBack - nFront) * (y - y0) / (y1 - y0));
+            }
+        }
+    }
+} // fillAdaptiveHeatBedScan
+
+/** \brief Searches the next requested point after nIndexX/nIndexY. The columns are walked in nDirectionX and every column in the opposite direction of the previous one. */
+static bool findAdaptiveScanPoint(unsigned char& nIndexX, unsigned char& nIndexY, char& nDirectionY, char nDirectionX) {
+    short x = nIndexX;
+    short y = nIndexY;
+    while (x >= 2 && x <= g_uZMatrixMax[X_AXIS]) {
+        for (y += nDirectionY; y >= 2 && y <= g_uZMatrixMax[Y_AXIS]; y += nDirectionY) {
+            if (g_ZCompensationMatrix[x][y] == ADAPTIVE_SCAN_REQUESTED) {
+                nIndexX = (unsigned char)x;
+                nIndexY = (unsigned char)y;
+                return true;
+            }
+        }
+        x += nDirectionX;
+        nDirectionY = -nDirectionY;
+        y = (nDirectionY > 0 ? 1 : g_uZMatrixMax[Y_AXIS] + 1);
+    }
+    return false;
+} // findAdaptiveScanPoint
+#endif // FEATURE_ADAPTIVE_HEAT_BED_SCAN
+
 void scanHeatBed(void) {
 #if FEATURE_ALIGN_EXTRUDERS
     if (g_nAlignExtrudersStatus)
@@ -478,6 +620,10 @@ void scanHeatBed(void) {
     static long nX;
     static long nY;
     static long nYDirection;
+#if FEATURE_ADAPTIVE_HEAT_BED_SCAN
+    static char nAdaptivePass; // 0 = scan all points, 1 = scan the coarse grid, 2 = scan the refined cells
+    static char nIndexXDirection;
+#endif // FEATURE_ADAPTIVE_HEAT_BED_SCAN
 #if DEBUG_HEAT_BED_SCAN
     static short nContactPressure;
 #endif // DEBUG_HEAT_BED_SCAN
@@ -748,6 +894,29 @@ void scanHeatBed(void) {
             // store also the version of this heat bed compensation matrix
             g_ZCompensationMatrix[0][0] = EEPROM_FORMAT;
 
+#if FEATURE_ADAPTIVE_HEAT_BED_SCAN
+            nAdaptivePass = 0;
+            nIndexXDirection = 1;
+            if (g_nScanAdaptiveStride > 1) {
+                if (!prepareAdaptiveHeatBedScan()) {
+                    g_abortZScan = SCAN_ABORT_REASON_MATRIX_DIMENSION;
+                    break;
+                }
+                if (g_uZMatrixMax[X_AXIS] > 2 && g_uZMatrixMax[Y_AXIS] > 2) {
+                    nAdaptivePass = 1;
+                    if (Printer::debugInfo()) {
+                        Com::printF(Com::tscanHeatBed);
+                        Com::printFLN(PSTR("adaptive, coarse grid = "), (int)g_nScanAdaptiveStride);
+                    }
+                } else {
+                    // a single row or column has no cells to refine, so all points are scanned
+                    initCompensationMatrix();
+                    g_uZMatrixMax[X_AXIS] = g_uZMatrixMax[Y_AXIS] = 0;
+                    g_ZCompensationMatrix[0][0] = EEPROM_FORMAT;
+                }
+            }
+#endif // FEATURE_ADAPTIVE_HEAT_BED_SCAN
+
             g_nHeatBedScanStatus = 40;
 
 #if DEBUG_HEAT_BED_SCAN == 2
@@ -774,7 +943,7 @@ void scanHeatBed(void) {
             }
 
             // move to the next x-position
-            Printer::queueRelativeStepsCoordinates(g_nScanXStepSizeSteps, 0, 0, 0, Printer::homingFeedrate[X_AXIS], true, true);
+            Printer::queueRelativeStepsCoordinates(g_nScanXStepSizeSteps, 0, 0, 0, Printer::homingFeedrate[X_AXIS], HEAT_BED_SCAN_WAIT_FOR_TRAVEL, true);
             nX += g_nScanXStepSizeSteps;
             nIndexX++;
 
@@ -895,6 +1064,9 @@ void scanHeatBed(void) {
             }
             g_nHeatBedScanStatus = 50;
             g_lastScanTime = HAL::timeInMilliseconds();
+#if FEATURE_PIPELINED_HEAT_BED_SCAN
+            startPipelinedIdlePressure();
+#endif // FEATURE_PIPELINED_HEAT_BED_SCAN
 
             break;
         }
@@ -903,6 +1075,9 @@ void scanHeatBed(void) {
             g_scanRetries = HEAT_BED_SCAN_RETRIES;
             g_retryStatus = 45;
             g_nHeatBedScanStatus = 50;
+#if FEATURE_PIPELINED_HEAT_BED_SCAN
+            startPipelinedIdlePressure();
+#endif // FEATURE_PIPELINED_HEAT_BED_SCAN
 
 #if DEBUG_HEAT_BED_SCAN == 2
             if (Printer::debugInfo()) {
@@ -913,6 +1088,41 @@ void scanHeatBed(void) {
             break;
         }
         case 50: {
+#if FEATURE_PIPELINED_HEAT_BED_SCAN
+            if (PrintLine::linesCount) {
+                // the bed is still travelling to this point, the idle delay is running already
+                break;
+            }
+
+            char nPipelined = samplePipelinedIdlePressure();
+            if (nPipelined > 0) {
+                // we need more samples
+                break;
+            }
+
+            if (!nPipelined) {
+                if ((HAL::timeInMilliseconds() - g_lastScanTime) < g_nScanIdleDelay) {
+                    // the pressure is stable, but do not check too early - keep sampling
+                    break;
+                }
+
+                // we should consider that the idle presse can change slightly
+                adjustPressureLimits(g_nCurrentIdlePressure);
+
+                g_nHeatBedScanStatus = 51;
+
+#if DEBUG_HEAT_BED_SCAN == 2
+                if (Printer::debugInfo()) {
+                    Com::printF(Com::tscanHeatBed);
+                    Com::printFLN(PSTR("50->51"));
+                }
+#endif // DEBUG_HEAT_BED_SCAN == 2
+                break;
+            }
+
+            // the pressure did not settle while it was sampled on the fly, use the regular test
+#endif // FEATURE_PIPELINED_HEAT_BED_SCAN
+
             if ((HAL::timeInMilliseconds() - g_lastScanTime) < g_nScanIdleDelay) {
                 // do not check too early
                 break;
@@ -1011,7 +1221,63 @@ void scanHeatBed(void) {
         }
         case 55: {
             // move away from the surface
+#if FEATURE_PIPELINED_HEAT_BED_SCAN
+            moveZPlusDownFast(false); // the idle pressure is sampled in state 50 anyway
+#else
             moveZPlusDownFast();
+#endif // FEATURE_PIPELINED_HEAT_BED_SCAN
+
+#if FEATURE_ADAPTIVE_HEAT_BED_SCAN
+            if (nAdaptivePass) {
+                unsigned char nNextIndexX = nIndexX;
+                unsigned char nNextIndexY = nIndexY;
+                if (!findAdaptiveScanPoint(nNextIndexX, nNextIndexY, nIndexYDirection, nIndexXDirection)) {
+                    short nCells = 0;
+                    if (nAdaptivePass == 1) {
+                        nCells = markAdaptiveHeatBedScan();
+                        nAdaptivePass = 2;
+                        if (Printer::debugInfo()) {
+                            Com::printF(Com::tscanHeatBed);
+                            Com::printFLN(PSTR("adaptive, cells to refine = "), nCells);
+                        }
+                    }
+                    if (!nCells) {
+                        // we end up here when the scan is complete
+                        fillAdaptiveHeatBedScan();
+                        g_nHeatBedScanStatus = 60;
+                        break;
+                    }
+
+                    // walk back over the columns, starting with the current one
+                    nIndexXDirection = -nIndexXDirection;
+                    nIndexYDirection = -nIndexYDirection;
+                    nNextIndexX = nIndexX;
+                    nNextIndexY = (nIndexYDirection > 0 ? 1 : g_uZMatrixMax[Y_AXIS] + 1);
+                    findAdaptiveScanPoint(nNextIndexX, nNextIndexY, nIndexYDirection, nIndexXDirection);
+                }
+
+                // move to the next requested position
+                long nMoveX = (long)(nNextIndexX - nIndexX) * g_nScanXStepSizeSteps;
+                long nMoveY = (long)(nNextIndexY - nIndexY) * g_nScanYStepSizeSteps;
+                Printer::queueRelativeStepsCoordinates(nMoveX, 0, 0, 0, Printer::homingFeedrate[X_AXIS], false, true);
+                Printer::queueRelativeStepsCoordinates(0, nMoveY, 0, 0, Printer::homingFeedrate[Y_AXIS], HEAT_BED_SCAN_WAIT_FOR_TRAVEL, true);
+                nX += nMoveX;
+                nY += nMoveY;
+                nIndexX = nNextIndexX;
+                nIndexY = nNextIndexY;
+
+                g_nHeatBedScanStatus = 49;
+                g_lastScanTime = HAL::timeInMilliseconds();
+
+#if DEBUG_HEAT_BED_SCAN == 2
+                if (Printer::debugInfo()) {
+                    Com::printF(Com::tscanHeatBed);
+                    Com::printFLN(PSTR("55->49"));
+                }
+#endif // DEBUG_HEAT_BED_SCAN == 2
+                break;
+            }
+#endif // FEATURE_ADAPTIVE_HEAT_BED_SCAN
 
             if (nYDirection > 0) {
                 nTempPosition = nY + nYDirection;
@@ -1046,7 +1312,7 @@ void scanHeatBed(void) {
             }
 
             // move to the next y-position
-            Printer::queueRelativeStepsCoordinates(0, nYDirection, 0, 0, Printer::homingFeedrate[Y_AXIS], true, true);
+            Printer::queueRelativeStepsCoordinates(0, nYDirection, 0, 0, Printer::homingFeedrate[Y_AXIS], HEAT_BED_SCAN_WAIT_FOR_TRAVEL, true);
             nY += nYDirection;
             nIndexY += nIndexYDirection;
 
@@ -3106,7 +3372,248 @@ short testHeatBedTemperature(void) //Funktion ist speziell für HBS Scan.
     return 0;
 } // testHeatBedTemperature
 
+#if FEATURE_Z_MATRIX_CACHE
+/** \brief The last used cell of g_ZCompensationMatrix. The raw values of the cell are kept, so any change of the matrix or of the
+resolution invalidates the coefficients. Positions outside the matrix use the value at its border. */
+struct ZMatrixCache {
+    float stepsPerMM[2];    ///< Resolution of X and Y used for the borders
+    long matrixStepsX[COMPENSATION_MATRIX_MAX_X]; ///< All X borders of the matrix in steps, same index as g_ZCompensationMatrix
+    long matrixStepsY[COMPENSATION_MATRIX_MAX_Y]; ///< All Y borders of the matrix in steps, same index as g_ZCompensationMatrix
+    bool matrixValid;       ///< matrixSteps and steep belong to the current matrix and resolution
+    bool steep;             ///< A difference of the matrix does not fit into the 16.16 slopes, so the whole matrix is left to the full scan
+    unsigned char left[2];  ///< Index of the left/front border of the cell, the right/back border is left + 1, 0 = no cell
+    short border[2][2];     ///< Raw matrix values of the borders [axis][left/right]
+    long borderSteps[2][2]; ///< Borders in steps [axis][left/right]
+    short corner[2][2];     ///< Raw matrix values of the corners [x][y]
+    long slopeFront;        ///< Change of the front edge per X step, 16.16 fixed point
+    long slopeBack;         ///< Change of the back edge per X step, 16.16 fixed point
+    unsigned long invStepSizeY; ///< 2^30 / cell size in Y steps
+    bool coefficientsValid;
+#if FEATURE_Z_MATRIX_SPLINE
+    short splinePoints[4][4]; ///< Raw matrix values around the cell [x][y], the corners are [1..2][1..2]
+    float splineRows[4][4];   ///< Cubic of every row in the X fraction of the cell: [row][0] + [row][1] * u + [row][2] * u^2 + [row][3] * u^3
+    float splineScaleY[2];    ///< Cell size in Y / distance of the neighbour rows of the front and the back border, converts differences to tangents
+    bool splineValid;
+#endif // FEATURE_Z_MATRIX_SPLINE
+};
+
+static ZMatrixCache g_ZMatrixCache = {};
+
+static inline short zMatrixBorder(uint8_t axis, unsigned char index) {
+    return (axis == X_AXIS ? g_ZCompensationMatrix[index][0] : g_ZCompensationMatrix[0][index]);
+} // zMatrixBorder
+
+static inline long zMatrixBorderSteps(uint8_t axis, unsigned char index) {
+    return (axis == X_AXIS ? g_ZMatrixCache.matrixStepsX[index] : g_ZMatrixCache.matrixStepsY[index]);
+} // zMatrixBorderSteps
+
+/** \brief Walks from the cached cell to the neighbour cells until border[left] < position <= border[left + 1]. Positions outside the matrix
+stay in its first or last cell. Returns false if the matrix has no cell. */
+static bool findZMatrixCell(uint8_t axis, long position) {
+    ZMatrixCache& cache = g_ZMatrixCache;
+    unsigned char left = cache.left[axis];
+    if (left < 1 || left + 1 > g_uZMatrixMax[axis])
+        left = 1;
+    if (left + 1 > g_uZMatrixMax[axis])
+        return false;
+
+    long leftSteps = zMatrixBorderSteps(axis, left);
+    long rightSteps = zMatrixBorderSteps(axis, left + 1);
+    while (position > rightSteps && left + 2 <= g_uZMatrixMax[axis]) {
+        left++;
+        leftSteps = rightSteps;
+        rightSteps = zMatrixBorderSteps(axis, left + 1);
+    }
+    while (position <= leftSteps && left > 1) {
+        left--;
+        rightSteps = leftSteps;
+        leftSteps = zMatrixBorderSteps(axis, left);
+    }
+    if (rightSteps <= leftSteps)
+        return false;
+
+    if (left != cache.left[axis])
+        cache.coefficientsValid = false;
+    cache.left[axis] = left;
+    cache.border[axis][0] = zMatrixBorder(axis, left);
+    cache.border[axis][1] = zMatrixBorder(axis, left + 1);
+    cache.borderSteps[axis][0] = leftSteps;
+    cache.borderSteps[axis][1] = rightSteps;
+    return true;
+} // findZMatrixCell
+
+/** \brief Returns true if a neighbour difference of the matrix does not fit into the 16.16 slopes of the bilinear interpolation.
+Switching to the full scan for single cells would make steps at their edges, so this is checked for the whole matrix. */
+static bool isZMatrixSteep() {
+    for (unsigned char x = 1; x <= g_uZMatrixMax[X_AXIS]; x++) {
+        for (unsigned char y = 1; y <= g_uZMatrixMax[Y_AXIS]; y++) {
+            long depth = g_ZCompensationMatrix[x][y];
+            if (x < g_uZMatrixMax[X_AXIS] && labs(g_ZCompensationMatrix[x + 1][y] - depth) >= 16384)
+                return true;
+            if (y < g_uZMatrixMax[Y_AXIS] && labs(g_ZCompensationMatrix[x][y + 1] - depth) >= 16384)
+                return true;
+        }
+    }
+    return false;
+} // isZMatrixSteep
+
+/** \brief Converts all borders of the matrix to steps and checks its steepness. Called whenever the matrix was changed, so the cell search
+and the cell changes do not need a float multiply or a scan of the matrix. */
+static void updateZMatrixCache() {
+    ZMatrixCache& cache = g_ZMatrixCache;
+    cache.stepsPerMM[X_AXIS] = Printer::axisStepsPerMM[X_AXIS];
+    cache.stepsPerMM[Y_AXIS] = Printer::axisStepsPerMM[Y_AXIS];
+    for (unsigned char x = 1; x <= g_uZMatrixMax[X_AXIS] && x < COMPENSATION_MATRIX_MAX_X; x++)
+        cache.matrixStepsX[x] = (long)((float)g_ZCompensationMatrix[x][0] * Printer::axisStepsPerMM[X_AXIS]);
+    for (unsigned char y = 1; y <= g_uZMatrixMax[Y_AXIS] && y < COMPENSATION_MATRIX_MAX_Y; y++)
+        cache.matrixStepsY[y] = (long)((float)g_ZCompensationMatrix[0][y] * Printer::axisStepsPerMM[Y_AXIS]);
+    cache.steep = isZMatrixSteep();
+    cache.matrixValid = true;
+    cache.coefficientsValid = false;
+} // updateZMatrixCache
+
+static bool isZMatrixCacheValid() {
+    ZMatrixCache& cache = g_ZMatrixCache;
+    if (!cache.coefficientsValid)
+        return false;
+    unsigned char x = cache.left[X_AXIS];
+    unsigned char y = cache.left[Y_AXIS];
+    if (x + 1 > g_uZMatrixMax[X_AXIS] || y + 1 > g_uZMatrixMax[Y_AXIS])
+        return false;
+    return cache.border[X_AXIS][0] == g_ZCompensationMatrix[x][0] && cache.border[X_AXIS][1] == g_ZCompensationMatrix[x + 1][0] && cache.border[Y_AXIS][0] == g_ZCompensationMatrix[0][y] && cache.border[Y_AXIS][1] == g_ZCompensationMatrix[0][y + 1] && cache.corner[0][0] == g_ZCompensationMatrix[x][y] && cache.corner[1][0] == g_ZCompensationMatrix[x + 1][y] && cache.corner[0][1] == g_ZCompensationMatrix[x][y + 1] && cache.corner[1][1] == g_ZCompensationMatrix[x + 1][y + 1];
+} // isZMatrixCacheValid
+
+#if FEATURE_Z_MATRIX_SPLINE
+/** \brief Fills the indices of the neighbour scan points of the cached cell. The border of the matrix is repeated, so the tangent there is one-sided. */
+static void getZMatrixSplineIndices(uint8_t axis, unsigned char* index) {
+    unsigned char left = g_ZMatrixCache.left[axis];
+    index[0] = (left > 1 ? left - 1 : left);
+    index[1] = left;
+    index[2] = left + 1;
+    index[3] = (left + 2 <= g_uZMatrixMax[axis] ? left + 2 : left + 1);
+} // getZMatrixSplineIndices
+
+/** \brief Cell size / distance of the neighbour scan points at both borders of the cached cell. Multiplied with the difference of the neighbour values this is the tangent in units of the cell. */
+static void getZMatrixSplineScale(uint8_t axis, const unsigned char* index, float* scale) {
+    float cellSize = (float)(zMatrixBorder(axis, index[2]) - zMatrixBorder(axis, index[1]));
+    scale[0] = cellSize / (float)(zMatrixBorder(axis, index[2]) - zMatrixBorder(axis, index[0]));
+    scale[1] = cellSize / (float)(zMatrixBorder(axis, index[3]) - zMatrixBorder(axis, index[1]));
+} // getZMatrixSplineScale
+
+/** \brief Cubic Hermite interpolation between p1 and p2 at t = 0..1 with the Catmull-Rom tangents m1 and m2. */
+static inline float hermiteZMatrix(float p1, float p2, float m1, float m2, float t) {
+    return p1 + t * (m1 + t * (3 * (p2 - p1) - 2 * m1 - m2 + t * (2 * (p1 - p2) + m1 + m2)));
+} // hermiteZMatrix
+
+/** \brief Bicubic interpolation within the cached cell. The rows are cubics in X, which are precomputed per cell, only the Y direction is interpolated per call. */
+static long getZMatrixDepthSpline(long x, long y) {
+    ZMatrixCache& cache = g_ZMatrixCache;
+    unsigned char indexX[4], indexY[4];
+    getZMatrixSplineIndices(X_AXIS, indexX);
+    getZMatrixSplineIndices(Y_AXIS, indexY);
+
+    if (cache.splineValid) {
+        for (uint8_t i = 0; i < 4 && cache.splineValid; i++)
+            for (uint8_t j = 0; j < 4; j++)
+                if (cache.splinePoints[i][j] != g_ZCompensationMatrix[indexX[i]][indexY[j]]) {
+                    cache.splineValid = false;
+                    break;
+                }
+    }
+    if (!cache.splineValid) {
+        float scaleX[2];
+        getZMatrixSplineScale(X_AXIS, indexX, scaleX);
+        getZMatrixSplineScale(Y_AXIS, indexY, cache.splineScaleY);
+        for (uint8_t i = 0; i < 4; i++)
+            for (uint8_t j = 0; j < 4; j++)
+                cache.splinePoints[i][j] = g_ZCompensationMatrix[indexX[i]][indexY[j]];
+        for (uint8_t j = 0; j < 4; j++) {
+            float p1 = cache.splinePoints[1][j];
+            float p2 = cache.splinePoints[2][j];
+            float m1 = (p2 - cache.splinePoints[0][j]) * scaleX[0];
+            float m2 = (cache.splinePoints[3][j] - p1) * scaleX[1];
+            cache.splineRows[j][0] = p1;
+            cache.splineRows[j][1] = m1;
+            cache.splineRows[j][2] = 3 * (p2 - p1) - 2 * m1 - m2;
+            cache.splineRows[j][3] = 2 * (p1 - p2) + m1 + m2;
+        }
+        cache.splineValid = true;
+    }
+
+    float u = (float)(x - cache.borderSteps[X_AXIS][0]) / (float)(cache.borderSteps[X_AXIS][1] - cache.borderSteps[X_AXIS][0]);
+    float v = (float)(y - cache.borderSteps[Y_AXIS][0]) / (float)(cache.borderSteps[Y_AXIS][1] - cache.borderSteps[Y_AXIS][0]);
+    float row[4];
+    for (uint8_t j = 0; j < 4; j++) {
+        float* c = cache.splineRows[j];
+        row[j] = c[0] + u * (c[1] + u * (c[2] + u * c[3]));
+    }
+    float depth = hermiteZMatrix(row[1], row[2], (row[2] - row[0]) * cache.splineScaleY[0], (row[3] - row[1]) * cache.splineScaleY[1], v);
+    return lroundf(depth);
+} // getZMatrixDepthSpline
+#endif // FEATURE_Z_MATRIX_SPLINE
+
+/** \brief Bilinear interpolation within the cached cell with integer multiply-adds. Returns false if the matrix is left to the full scan. */
+static bool getZMatrixDepthCached(long x, long y, long& depth) {
+    ZMatrixCache& cache = g_ZMatrixCache;
+    if (!cache.matrixValid || cache.stepsPerMM[X_AXIS] != Printer::axisStepsPerMM[X_AXIS] || cache.stepsPerMM[Y_AXIS] != Printer::axisStepsPerMM[Y_AXIS])
+        updateZMatrixCache();
+    else if (cache.coefficientsValid && !isZMatrixCacheValid())
+        updateZMatrixCache(); // the cell was changed without determineCompensationOffsetZ()
+    if (!cache.coefficientsValid || x <= cache.borderSteps[X_AXIS][0] || x > cache.borderSteps[X_AXIS][1] || y <= cache.borderSteps[Y_AXIS][0] || y > cache.borderSteps[Y_AXIS][1]) {
+        if (!findZMatrixCell(X_AXIS, x) || !findZMatrixCell(Y_AXIS, y))
+            return false;
+    }
+    if (!cache.coefficientsValid) {
+        unsigned char xl = cache.left[X_AXIS];
+        unsigned char yf = cache.left[Y_AXIS];
+        cache.corner[0][0] = g_ZCompensationMatrix[xl][yf];
+        cache.corner[1][0] = g_ZCompensationMatrix[xl + 1][yf];
+        cache.corner[0][1] = g_ZCompensationMatrix[xl][yf + 1];
+        cache.corner[1][1] = g_ZCompensationMatrix[xl + 1][yf + 1];
+        // the 16.16 products must not overflow, unusual matrices are left to the full scan
+        if (!cache.steep) {
+            long stepSizeX = cache.borderSteps[X_AXIS][1] - cache.borderSteps[X_AXIS][0];
+            long stepSizeY = cache.borderSteps[Y_AXIS][1] - cache.borderSteps[Y_AXIS][0];
+            cache.slopeFront = (((long)cache.corner[1][0] - cache.corner[0][0]) << 16) / stepSizeX;
+            cache.slopeBack = (((long)cache.corner[1][1] - cache.corner[0][1]) << 16) / stepSizeX;
+            cache.invStepSizeY = (1UL << 30) / stepSizeY;
+        }
+        cache.coefficientsValid = true;
+#if FEATURE_Z_MATRIX_SPLINE
+        cache.splineValid = false;
+#endif // FEATURE_Z_MATRIX_SPLINE
+    }
+    if (cache.steep)
+        return false;
+
+    // outside the matrix the value at its border is used, the spline has one-sided tangents there
+    x = constrain(x, cache.borderSteps[X_AXIS][0], cache.borderSteps[X_AXIS][1]);
+    y = constrain(y, cache.borderSteps[Y_AXIS][0], cache.borderSteps[Y_AXIS][1]);
+
+#if FEATURE_Z_MATRIX_SPLINE
+    if (g_nZMatrixInterpolation == Z_MATRIX_INTERPOLATION_CATMULL_ROM) {
+        depth = getZMatrixDepthSpline(x, y);
+        return true;
+    }
+#endif // FEATURE_Z_MATRIX_SPLINE
+
+    long deltaX = x - cache.borderSteps[X_AXIS][0];
+    unsigned long deltaY = y - cache.borderSteps[Y_AXIS][0];
+    long fractionY = (deltaY * cache.invStepSizeY) >> 14; // 0 <= deltaY <= cell size, so this is the position within the cell in 1/65536
+    long front = cache.corner[0][0] + ((cache.slopeFront * deltaX) >> 16);
+    long back = cache.corner[0][1] + ((cache.slopeBack * deltaX) >> 16);
+    depth = front + (((back - front) * fractionY) >> 16);
+    return true;
+} // getZMatrixDepthCached
+#endif // FEATURE_Z_MATRIX_CACHE
+
 long getZMatrixDepth(long x, long y) {
+#if FEATURE_Z_MATRIX_CACHE
+    long cachedDepth;
+    if (getZMatrixDepthCached(x, y, cachedDepth))
+        return cachedDepth;
+#endif // FEATURE_Z_MATRIX_CACHE
+
     // find the rectangle which covers the current position of the extruder
     unsigned char nXLeftIndex = 1;
     long nXLeftSteps = (long)((float)g_ZCompensationMatrix[1][0] * Printer::axisStepsPerMM[X_AXIS]);
@@ -3180,6 +3687,11 @@ long getZMatrixDepth_CurrentXY(void) {
 void recalculateHeatBedZCompensation(void) {
     long nNeededZCompensation = 0;
     float nNeededZEPerc = 0.0f;
+#if FEATURE_SEGMENT_Z_COMPENSATION
+    // the target is nDepthScale * depth + offset, so the stepper interrupt can use the depth of the current move instead of this one
+    long nDepth = 0;
+    long nDepthScale = 0;
+#endif // FEATURE_SEGMENT_Z_COMPENSATION
 
     if (Printer::doHeatBedZCompensation) {
         long nCurrentPositionStepsZ = Printer::currentSteps[Z_AXIS]; //direct muss hier egal sein, das ist nur das extruder und sonstige manual-offset.
@@ -3190,6 +3702,10 @@ void recalculateHeatBedZCompensation(void) {
             // check whether we have to perform a compensation in z-direction
             if (nCurrentPositionStepsZ < g_maxZCompensationSteps) {
                 nNeededZCompensation = getZMatrixDepth_CurrentXY(); //Das ist hier der Zeiger auf den interpolierten Z-Matrix-Wert.
+#if FEATURE_SEGMENT_Z_COMPENSATION
+                nDepth = nNeededZCompensation;
+                nDepthScale = 65536;
+#endif // FEATURE_SEGMENT_Z_COMPENSATION
 
                 if (nCurrentPositionStepsZ <= g_minZCompensationSteps) {
                     // the printer is very close to the surface - we shall print a layer of exactly the desired thickness
@@ -3217,6 +3733,9 @@ void recalculateHeatBedZCompensation(void) {
                     // the printer is already a bit away from the surface - do the actual compensation -> Hier ist nNeededZCompensation dann nicht mehr der Zeiger auf die Oberfläche, sondern der Zeiger auf die kompensationshöhe:
                     nNeededZCompensation = ((nNeededZCompensation - g_offsetZCompensationSteps) * (g_maxZCompensationSteps - nCurrentPositionStepsZ))
                         / (g_maxZCompensationSteps - g_minZCompensationSteps);
+#if FEATURE_SEGMENT_Z_COMPENSATION
+                    nDepthScale = (long)(65536.0f * (float)(g_maxZCompensationSteps - nCurrentPositionStepsZ) / (float)(g_maxZCompensationSteps - g_minZCompensationSteps));
+#endif // FEATURE_SEGMENT_Z_COMPENSATION
                     nNeededZCompensation += g_offsetZCompensationSteps;
                 }
             } else {
@@ -3273,6 +3792,9 @@ void recalculateHeatBedZCompensation(void) {
     //nachprüfung wegen override des schalterdruckpunktes
     if (Printer::isAxisHomed(Z_AXIS) && Printer::currentZSteps <= -1 * long(Printer::maxZOverrideSteps)) {
         if (nNeededZCompensation < Printer::compensatedPositionCurrentStepsZ) {
+#if FEATURE_SEGMENT_Z_COMPENSATION
+            nDepthScale = 0;
+#endif // FEATURE_SEGMENT_Z_COMPENSATION
             nNeededZCompensation = Printer::compensatedPositionCurrentStepsZ; //nicht 100% sauber, aber schalterdruckpunkt ist auch nicht perfekt auf den step definiert. Einfach nicht näher rankompensieren, wie wir waren, bis wir aus der eingestellten schalter-todeszone raus sind, dann weiter wie bisher.
         }
         //nNeededZEPerc = 0.0; //-> ist hier generell völlig egal. Hmm, eigentlich könnte man in diesem fall automatisch raften,
@@ -3280,10 +3802,29 @@ void recalculateHeatBedZCompensation(void) {
     }
 
     InterruptProtectedBlock noInts;
-    Printer::compensatedPositionTargetStepsZ = nNeededZCompensation;
+#if FEATURE_SEGMENT_Z_COMPENSATION
+    Printer::compensationDepthScale = nDepthScale;
+    Printer::compensationDepthOffset = nNeededZCompensation - ((nDepthScale * nDepth) >> 16);
+    // while a move with a depth is executed, the stepper interrupt sets the target
+    if (!Printer::compensationFollowsSegment)
+#endif // FEATURE_SEGMENT_Z_COMPENSATION
+        Printer::compensatedPositionTargetStepsZ = nNeededZCompensation;
     Printer::compensatedPositionOverPercE = nNeededZEPerc;
     noInts.unprotect();
 } // recalculateHeatBedZCompensation
+
+#if FEATURE_SEGMENT_Z_COMPENSATION
+/** \brief Returns the distance of the inner scan points of the z-matrix in mm, 0 if no matrix is loaded. */
+float getZMatrixCellPitchMM(void) {
+    if (g_uZMatrixMax[X_AXIS] < 4 || g_uZMatrixMax[Y_AXIS] < 4)
+        return 0;
+
+    // index 1 is the border at 0 mm, the scan points start at index 2
+    int nPitchX = g_ZCompensationMatrix[3][0] - g_ZCompensationMatrix[2][0];
+    int nPitchY = g_ZCompensationMatrix[0][3] - g_ZCompensationMatrix[0][2];
+    return (float)RMath::max(RMath::min(nPitchX, nPitchY), 1);
+} // getZMatrixCellPitchMM
+#endif // FEATURE_SEGMENT_Z_COMPENSATION
 #endif // FEATURE_HEAT_BED_Z_COMPENSATION
 
 void showAbortScanReason(const void* scanName, char abortScanIdentifier) {
@@ -4571,8 +5112,67 @@ short readAveragePressure(short* pnAveragePressure) {
 
 } // readAveragePressure
 
+#if FEATURE_PIPELINED_HEAT_BED_SCAN
+static char g_nPipelinedReads = 0;
+static char g_nPipelinedRetries = 0;
+static long g_nPipelinedSum = 0;
+static short g_nPipelinedMin = 0;
+static short g_nPipelinedMax = 0;
+static unsigned long g_uPipelinedReadTime = 0;
+
+void startPipelinedIdlePressure(void) {
+    g_nPipelinedReads = 0;
+    g_nPipelinedRetries = 0;
+    g_uPipelinedReadTime = HAL::timeInMilliseconds();
+} // startPipelinedIdlePressure
+
+char samplePipelinedIdlePressure(void) {
+    short nTempPressure;
+
+    // this is the non-blocking variant of readAveragePressure(): every call takes at most one sample, the samples are evaluated in windows of g_nScanPressureReads
+    // return values: 1 = not yet, 0 = g_nCurrentIdlePressure has been updated, -1 = the pressure did not settle
+    if (g_nPipelinedRetries >= 5) {
+        return -1;
+    }
+
+    if ((HAL::timeInMilliseconds() - g_uPipelinedReadTime) < g_nScanPressureReadDelay) {
+        // do not sample too early
+        return 1;
+    }
+    g_uPipelinedReadTime = HAL::timeInMilliseconds();
+
+    if (!g_nPipelinedReads) {
+        g_nPipelinedSum = 0;
+        g_nPipelinedMin = 32000;
+        g_nPipelinedMax = -32000;
+    }
+
+    nTempPressure = readStrainGauge(ACTIVE_STRAIN_GAUGE);
+    g_nPipelinedSum += nTempPressure;
+    if (nTempPressure < g_nPipelinedMin)
+        g_nPipelinedMin = nTempPressure;
+    if (nTempPressure > g_nPipelinedMax)
+        g_nPipelinedMax = nTempPressure;
+
+    g_nPipelinedReads++;
+    if (g_nPipelinedReads < g_nScanPressureReads) {
+        return 1;
+    }
+    g_nPipelinedReads = 0;
+
+    if ((g_nPipelinedMax - g_nPipelinedMin) >= g_nScanPressureTolerance) {
+        // the bed is still swinging - start a new window
+        g_nPipelinedRetries++;
+        return (g_nPipelinedRetries >= 5 ? -1 : 1);
+    }
+
+    g_nCurrentIdlePressure = (short)(g_nPipelinedSum / g_nScanPressureReads);
+    return 0;
+} // samplePipelinedIdlePressure
+#endif // FEATURE_PIPELINED_HEAT_BED_SCAN
+
 //Spacing Schnell:
-void moveZPlusDownFast() {
+void moveZPlusDownFast(bool bReadPressure) {
     short nTempPressure;
 
     // move the heat bed down so that we won't hit it when we move to the next position
@@ -4583,6 +5183,11 @@ void moveZPlusDownFast() {
 
     Commands::checkForPeriodicalActions(Processing);
 
+    if (!bReadPressure) {
+        // the caller checks the idle pressure on its own before the next contact
+        return;
+    }
+
     if (readAveragePressure(&nTempPressure)) {
         // some error has occurred
         g_abortZScan = SCAN_ABORT_REASON_AVERAGE_PRESSURE;
@@ -4834,6 +5439,11 @@ void restoreDefaultScanParameters(void) {
         g_nScanPressureReads = HEAT_BED_SCAN_PRESSURE_READS;
         g_nScanPressureTolerance = HEAT_BED_SCAN_PRESSURE_TOLERANCE;
         g_nScanPressureReadDelay = HEAT_BED_SCAN_PRESSURE_READ_DELAY_MS;
+
+#if FEATURE_ADAPTIVE_HEAT_BED_SCAN
+        g_nScanAdaptiveStride = HEAT_BED_SCAN_ADAPTIVE_STRIDE;
+        g_nScanAdaptiveToleranceUM = HEAT_BED_SCAN_ADAPTIVE_TOLERANCE_UM;
+#endif // FEATURE_ADAPTIVE_HEAT_BED_SCAN
 #endif // FEATURE_HEAT_BED_Z_COMPENSATION
 #if FEATURE_MILLING_MODE
     } else {
@@ -4950,6 +5560,9 @@ void outputScanParameters(void) {
 void initCompensationMatrix(void) {
     // clear all fields of the compensation matrix
     memset(g_ZCompensationMatrix, 0, COMPENSATION_MATRIX_MAX_X * COMPENSATION_MATRIX_MAX_Y * 2);
+#if FEATURE_Z_MATRIX_CACHE
+    g_ZMatrixCache.matrixValid = false;
+#endif // FEATURE_Z_MATRIX_CACHE
 } // initCompensationMatrix
 
 void outputCompensationMatrix(char format) {
@@ -5138,6 +5751,11 @@ void determineCompensationOffsetZ(void) {
     g_ZCompensationMax = uMin;
     g_offsetZCompensationSteps = uMax;
 #endif // FEATURE_HEAT_BED_Z_COMPENSATION
+
+#if FEATURE_Z_MATRIX_CACHE
+    // all changes of the matrix end here
+    updateZMatrixCache();
+#endif // FEATURE_Z_MATRIX_CACHE
 } // determineCompensationOffsetZ
 
 void adjustCompensationMatrix(short nZ) {
@@ -6241,6 +6859,9 @@ void loopFeatures() //wird so aufgerufen, dass es ein ~100ms Takt sein sollte.
 #if FEATURE_RGB_LIGHT_EFFECTS
         updateRGBLightStatus();
 #endif // FEATURE_RGB_LIGHT_EFFECTS
+#if FEATURE_QUEUE_TELEMETRY
+        PrintLine::reportQueueTelemetry(uTime);
+#endif // FEATURE_QUEUE_TELEMETRY
         if (!g_pauseMode) {
             handleScanWorkTasks();
         }
@@ -8149,6 +8770,246 @@ void processSpecialGCode(GCode* pCommand) {
             break;
         }
 
+#if FEATURE_STEP_TRACE
+        case 3201: // M3201 [S] - output the step trace, S1 resets it afterwards
+        {
+            InterruptProtectedBlock noInts;
+            uint32_t calls = Printer::stepTraceCalls;
+            uint32_t steps = Printer::stepTraceSteps;
+            uint32_t ticks = Printer::stepTraceTicks;
+            uint32_t checksum = Printer::stepTraceChecksum;
+            noInts.unprotect();
+
+            Com::printF(PSTR("M3201: calls = "), calls);
+            Com::printF(PSTR(", steps = "), steps);
+            Com::printF(PSTR(", ticks = "), ticks);
+            Com::printFLN(PSTR(", checksum = "), checksum);
+#if FEATURE_ISR_TIMING
+            // the longest call comes from the interrupt timing, M3207 S1 resets it
+            uint16_t maxIsrTicks = HAL::isrTiming[ISR_TIMING_STEPPER].maxCycles;
+            Com::printF(PSTR("M3201: longest call [ticks] = "), (uint32_t)maxIsrTicks);
+            Com::printFLN(PSTR(", [us] = "), (uint32_t)(maxIsrTicks / (F_CPU / 1000000UL)));
+#endif // FEATURE_ISR_TIMING
+
+            if (pCommand->hasS() && pCommand->S == 1) {
+                Printer::resetStepTrace();
+                if (Printer::debugInfo())
+                    Com::printFLN(PSTR("M3201: step trace reset"));
+            }
+            break;
+        }
+#endif // FEATURE_STEP_TRACE
+
+#if FEATURE_PLANNER_TIMING
+        case 3202: // M3202 [S] - output the path planner timing, S1 resets it afterwards
+        {
+            PrintLine::printPlannerTiming();
+            if (pCommand->hasS() && pCommand->S == 1) {
+                PrintLine::resetPlannerTiming();
+                if (Printer::debugInfo())
+                    Com::printFLN(PSTR("M3202: planner timing reset"));
+            }
+            break;
+        }
+#endif // FEATURE_PLANNER_TIMING
+
+#if FEATURE_JUNCTION_DEVIATION
+        case 3203: // M3203 [S] [D] - select the corner speed computation ( S0 = jerk, S1 = junction deviation ), D = junction deviation in mm
+        {
+            if (pCommand->hasS()) {
+                Printer::junctionMode = (pCommand->S == JUNCTION_MODE_DEVIATION ? JUNCTION_MODE_DEVIATION : JUNCTION_MODE_JERK);
+            }
+            if (pCommand->hasD()) {
+                Printer::junctionDeviation = constrain(pCommand->D, JUNCTION_DEVIATION_MIN, JUNCTION_DEVIATION_MAX);
+            }
+            if (pCommand->hasS() || pCommand->hasD()) {
+                HAL::eprSetByte(EPR_RF_JUNCTION_MODE, Printer::junctionMode);
+                HAL::eprSetFloat(EPR_RF_JUNCTION_DEVIATION, Printer::junctionDeviation);
+                EEPROM::updateChecksum();
+            }
+            Com::printF(PSTR("M3203: junction mode = "), (int)Printer::junctionMode);
+            Com::printFLN(PSTR(", deviation = "), Printer::junctionDeviation, 3);
+            break;
+        }
+#endif // FEATURE_JUNCTION_DEVIATION
+
+#if FEATURE_SEGMENT_MERGING
+        case 3204: // M3204 [D] [S] - output the segment merge ratio, D = merge tolerance in mm ( 0 = off ), S1 resets the counters afterwards
+        {
+            if (pCommand->hasD()) {
+                Printer::segmentMergeTolerance = constrain(pCommand->D, 0.0f, 1.0f);
+            }
+            Com::printF(PSTR("M3204: tolerance = "), Printer::segmentMergeTolerance, 3);
+            Com::printF(PSTR(", moves = "), Printer::segmentMergeInput);
+            Com::printF(PSTR(", queued = "), Printer::segmentMergeQueued);
+            Com::printFLN(PSTR(", ratio = "), (Printer::segmentMergeQueued ? (float)Printer::segmentMergeInput / (float)Printer::segmentMergeQueued : 1.0f));
+
+            if (pCommand->hasS() && pCommand->S == 1) {
+                Printer::segmentMergeInput = 0;
+                Printer::segmentMergeQueued = 0;
+                if (Printer::debugInfo())
+                    Com::printFLN(PSTR("M3204: merge counters reset"));
+            }
+            break;
+        }
+#endif // FEATURE_SEGMENT_MERGING
+
+#if FEATURE_S_CURVE_ACCELERATION
+        case 3205: // M3205 [S] [A] - select the acceleration profile ( S0 = trapezoid, S1 = S-curve ), A = average X/Y print acceleration of the S-curve in mm/s^2
+        {
+            if (pCommand->hasS()) {
+                Printer::sCurveMode = (pCommand->S ? 1 : 0);
+            }
+            if (pCommand->hasA()) {
+                Printer::sCurveAccelerationXY = constrain(pCommand->A, ACCELERATION_MIN_XY, ACCELERATION_MAX_XY);
+            }
+            if (pCommand->hasS() || pCommand->hasA()) {
+                HAL::eprSetByte(EPR_RF_S_CURVE_MODE, Printer::sCurveMode);
+                HAL::eprSetFloat(EPR_RF_S_CURVE_ACCELERATION, Printer::sCurveAccelerationXY);
+                EEPROM::updateChecksum();
+                Printer::updateDerivedParameter();
+            }
+            Com::printF(PSTR("M3205: S-curve = "), (int)Printer::sCurveMode);
+            Com::printF(PSTR(", acceleration XY = "), Printer::sCurveAccelerationXY, 0);
+            // the print acceleration of M201 limits the S-curve, show what the moves really get
+            Com::printF(PSTR(", in effect X = "), Printer::maxPrintAccelerationStepsPerSquareSecond[X_AXIS] * Printer::axisMMPerSteps[X_AXIS], 0);
+            Com::printFLN(PSTR(" Y = "), Printer::maxPrintAccelerationStepsPerSquareSecond[Y_AXIS] * Printer::axisMMPerSteps[Y_AXIS], 0);
+            break;
+        }
+#endif // FEATURE_S_CURVE_ACCELERATION
+
+#if FEATURE_INPUT_SHAPING
+        case 3206: // M3206 [X] [Y] [I] [J] - configure the input shaping, X/Y = frequency in Hz ( 0 = off ), I/J = damping ratio of X/Y
+        {
+            InputShaper* shapers[2] = { &PrintLine::shaperX, &PrintLine::shaperY };
+            bool hasFrequency[2] = { pCommand->hasX(), pCommand->hasY() };
+            float frequency[2] = { pCommand->X, pCommand->Y };
+            bool hasDamping[2] = { pCommand->hasI(), pCommand->hasJ() };
+            float damping[2] = { pCommand->I, pCommand->J };
+
+            if (hasFrequency[0] || hasFrequency[1] || hasDamping[0] || hasDamping[1])
+                Commands::waitUntilEndOfAllMoves(); // the queued impulses were computed with the old settings
+
+            for (uint8_t i = 0; i < 2; i++) {
+                InputShaper* shaper = shapers[i];
+                if (hasFrequency[i] || hasDamping[i]) {
+                    float newFrequency = shaper->frequency;
+                    if (hasFrequency[i])
+                        newFrequency = (frequency[i] <= 0 ? 0 : constrain(frequency[i], INPUT_SHAPING_MIN_FREQUENCY, INPUT_SHAPING_MAX_FREQUENCY));
+                    float newDamping = (hasDamping[i] ? constrain(damping[i], 0.0f, INPUT_SHAPING_MAX_DAMPING) : shaper->damping);
+                    shaper->configure(newFrequency, newDamping);
+                    HAL::eprSetFloat((i ? EPR_RF_SHAPER_Y_FREQUENCY : EPR_RF_SHAPER_X_FREQUENCY), shaper->frequency);
+                    HAL::eprSetFloat((i ? EPR_RF_SHAPER_Y_DAMPING : EPR_RF_SHAPER_X_DAMPING), shaper->damping);
+                    EEPROM::updateChecksum();
+                }
+                Com::printF((i ? PSTR("M3206: Y frequency = ") : PSTR("M3206: X frequency = ")), shaper->frequency, 1);
+                Com::printF(PSTR(", damping = "), shaper->damping, 3);
+                Com::printF(PSTR(", A1 = "), (int)shaper->firstAmplitude);
+                Com::printF(PSTR("/128, delay [us] = "), (int)shaper->delayUs);
+                Com::printFLN(PSTR(", overflows = "), (int)shaper->overflows);
+            }
+            break;
+        }
+#endif // FEATURE_INPUT_SHAPING
+
+#if FEATURE_ISR_TIMING
+        case 3207: // M3207 [S] - output the duration of the stepper, PWM and extruder interrupt, S1 resets it afterwards
+        {
+            HAL::printIsrTiming();
+            if (pCommand->hasS() && pCommand->S == 1) {
+                HAL::resetIsrTiming();
+                if (Printer::debugInfo())
+                    Com::printFLN(PSTR("M3207: isr timing reset"));
+            }
+            break;
+        }
+#endif // FEATURE_ISR_TIMING
+
+#if FEATURE_QUEUE_TELEMETRY
+        case 3208: // M3208 [S] [I] - output the queue telemetry, S1 resets it afterwards, I = seconds between outputs while moving ( 0 = off )
+        {
+            if (pCommand->hasI())
+                PrintLine::queueTelemetryReportInterval = (uint16_t)constrain(pCommand->I, 0, 3600);
+            PrintLine::printQueueTelemetry();
+            if (pCommand->hasS() && pCommand->S == 1) {
+                PrintLine::resetQueueTelemetry();
+                if (Printer::debugInfo())
+                    Com::printFLN(PSTR("M3208: queue telemetry reset"));
+            }
+            break;
+        }
+#endif // FEATURE_QUEUE_TELEMETRY
+
+#if FEATURE_SEGMENT_TRACE
+        case 3209: // M3209 [S] - S1 = start the segment trace, S0 = stop it, without S = output the number of dropped records
+        {
+            if (pCommand->hasS()) {
+                PrintLine::startSegmentTrace(pCommand->S ? 1 : 0);
+            } else {
+                Com::printF(PSTR("M3209: active = "), (int)PrintLine::segmentTraceActive);
+                Com::printFLN(PSTR(", dropped = "), (uint32_t)PrintLine::segmentTraceDropped);
+            }
+            break;
+        }
+#endif // FEATURE_SEGMENT_TRACE
+
+#if FEATURE_Z_MATRIX_SPLINE
+        case 3210: // M3210 [S] - select the interpolation of the z-matrix, S0 = bilinear, S1 = Catmull-Rom
+        {
+            if (pCommand->hasS()) {
+                g_nZMatrixInterpolation = (pCommand->S == Z_MATRIX_INTERPOLATION_CATMULL_ROM ? Z_MATRIX_INTERPOLATION_CATMULL_ROM : Z_MATRIX_INTERPOLATION_BILINEAR);
+                HAL::eprSetByte(EPR_RF_Z_MATRIX_INTERPOLATION, g_nZMatrixInterpolation);
+                EEPROM::updateChecksum();
+            }
+            Com::printFLN((g_nZMatrixInterpolation == Z_MATRIX_INTERPOLATION_CATMULL_ROM ? PSTR("M3210: z-matrix interpolation = Catmull-Rom") : PSTR("M3210: z-matrix interpolation = bilinear")));
+            break;
+        }
+#endif // FEATURE_Z_MATRIX_SPLINE
+
+#if FEATURE_ADAPTIVE_HEAT_BED_SCAN
+        case 3211: // M3211 [S] [P] - configure the adaptive heat bed scan, S = every S-th point is scanned first ( 0 = scan all points ), P = tolerance of the coarse cells ( units are [um] )
+        {
+            if (isSupportedMCommand(pCommand->M, OPERATING_MODE_PRINT)) {
+                if (pCommand->hasS()) {
+                    nTemp = pCommand->S;
+                    if (nTemp < 0)
+                        nTemp = 0;
+                    if (nTemp > HEAT_BED_SCAN_ADAPTIVE_STRIDE_MAX)
+                        nTemp = HEAT_BED_SCAN_ADAPTIVE_STRIDE_MAX;
+                    g_nScanAdaptiveStride = (unsigned char)nTemp;
+                }
+                if (pCommand->hasP()) {
+                    nTemp = pCommand->P;
+                    if (nTemp < 1)
+                        nTemp = 1;
+                    if (nTemp > 1000)
+                        nTemp = 1000;
+                    g_nScanAdaptiveToleranceUM = (short)nTemp;
+                }
+                Com::printF(PSTR("M3211: coarse grid = "), (int)g_nScanAdaptiveStride);
+                Com::printF(PSTR(", tolerance = "), (int)g_nScanAdaptiveToleranceUM);
+                Com::printFLN(PSTR(" [um]"));
+            }
+            break;
+        }
+#endif // FEATURE_ADAPTIVE_HEAT_BED_SCAN
+
+#ifndef EXTERNALSERIAL
+        case 3212: // M3212 [S] - show the speed and the lost bytes of the serial port, S1 = reset the counter of the lost bytes
+        {
+            Com::printF(PSTR("M3212: baudrate = "), (int32_t)baudrate);
+            Com::printF(PSTR(", actual = "), (uint32_t)RFSERIAL.getActualBaudrate());
+            Com::printF(PSTR(", error = "), ((float)RFSERIAL.getActualBaudrate() - (float)baudrate) * 100.0f / (float)baudrate);
+            Com::printF(PSTR(" [%]"));
+            Com::printF(PSTR(", rx buffer = "), (int)SERIAL_BUFFER_SIZE);
+            Com::printFLN(PSTR(", overruns = "), (uint32_t)RFSERIAL.getOverruns());
+            if (pCommand->hasS() && pCommand->S == 1) {
+                RFSERIAL.resetOverruns();
+            }
+            break;
+        }
+#endif // EXTERNALSERIAL
+
 #if FEATURE_24V_FET_OUTPUTS
         case 3300: // M3300 [P] [S] - configure the 24V FET outputs ( on/off )
         {
@@ -601,6 +601,9 @@ extern float g_scanStartZLiftMM;
 extern char g_abortZScan;
 extern short g_ZCompensationMatrix[COMPENSATION_MATRIX_MAX_X][COMPENSATION_MATRIX_MAX_Y];
 extern unsigned char g_uZMatrixMax[2];
+#if FEATURE_Z_MATRIX_SPLINE
+extern char g_nZMatrixInterpolation;
+#endif // FEATURE_Z_MATRIX_SPLINE
 extern long g_nZScanZPosition;
 
 extern char g_nHeatBedScanMode; // 0 = oldScan, 1 = PLA, 2 = ABS
@@ -723,6 +726,9 @@ extern short testHeatBedTemperature(void);
 extern long getZMatrixDepth(long x, long y);
 extern long getZMatrixDepth_CurrentXY(void);
 extern void recalculateHeatBedZCompensation(void);
+#if FEATURE_SEGMENT_Z_COMPENSATION
+extern float getZMatrixCellPitchMM(void);
+#endif // FEATURE_SEGMENT_Z_COMPENSATION
 
 extern void switchActiveHeatBed(char newActiveHeatBed);
 #endif // FEATURE_HEAT_BED_Z_COMPENSATION
@@ -743,11 +749,15 @@ extern long getWorkPartOffset(void);
 extern short readIdlePressure(short* pnIdlePressure);
 extern short testIdlePressure(void);
 extern short readAveragePressure(short* pnAveragePressure);
+#if FEATURE_PIPELINED_HEAT_BED_SCAN
+extern void startPipelinedIdlePressure(void);
+extern char samplePipelinedIdlePressure(void);
+#endif // FEATURE_PIPELINED_HEAT_BED_SCAN
 
 extern void moveZMinusUpFast();
 extern void moveZPlusDownSlow(uint8_t acuteness = 1);
 extern void moveZMinusUpSlow(short* pnContactPressure, uint8_t acuteness = 1);
-extern void moveZPlusDownFast();
+extern void moveZPlusDownFast(bool bReadPressure = true);
 extern void moveZ(int nSteps);
 extern void restoreDefaultScanParameters(void);
 extern void outputScanParameters(void);
@@ -267,6 +267,9 @@ Overridden if EEPROM activated. */
 L is the linear factor and seems to be working better then the quadratic dependency. */
 #define EXT0_ADVANCE_L 0.0f
 
+/** \brief Quadratic faktor for the segment advance algorithm, see FEATURE_SEGMENT_ADVANCE. Overridden if EEPROM activated. */
+#define EXT0_ADVANCE_K 0.0f
+
 /** \brief Temperature to retract filament when extruder is heating up. Overridden if EEPROM activated. */
 #define EXT0_WAIT_RETRACT_TEMP 150
 
@@ -423,6 +426,9 @@ Overridden if EEPROM activated. */
 L is the linear factor and seems to be working better then the quadratic dependency. */
 #define EXT1_ADVANCE_L 0.0f
 
+/** \brief Quadratic faktor for the segment advance algorithm, see FEATURE_SEGMENT_ADVANCE. Overridden if EEPROM activated. */
+#define EXT1_ADVANCE_K 0.0f
+
 /** \brief Motor steps to remove backlash for advance alorithm. These are the steps
 needed to move the motor cog in reverse direction until it hits the driving
 cog. Direct drive extruder need 0. */
@@ -723,14 +729,36 @@ STEP_PACKING_MIN_INTERVAL can be changed in Menu-> Configuration->Stepper->DblFq
 #define MIN_STEP_PACKING_MIN_INTERVAL 3300
 #define MAX_STEP_PACKING_MIN_INTERVAL 5000
 
+/** \brief Adaptive step packing
+If enabled, the path planner computes the number of steps per interrupt call which the move needs at its
+maximum speed vMax. The stepper interrupt still follows the current speed through 1, 2, 3, ... steps per call,
+so the slow parts of the ramps keep single steps, but it never packs more steps than planned for vMax.
+Advance gets 64 more ticks per interrupt call in this mode. "steptrace histogram" of the simulation shows
+the packing and the changes of the step interval. */
+#define ADAPTIVE_STEP_PACKING 0
+
+/** \brief Packed move cache
+If enabled, PrintLine does not store values which can be derived from others: the axis speeds
+are computed from the steps, fullSpeed and distance, and 1/fullSpeed is computed when needed. This saves 20 bytes
+per cached move, so the same RAM holds some more moves for the look-ahead. Costs two divisions per junction in the path planner. */
+#define PACKED_PRINTLINE 0
+
 /** \brief Number of moves we can cache in advance.
 This number of moves can be cached in advance. If you wan't to cache more, increase this. Especially on
 many very short moves the cache may go empty. The minimum value is 5. */
+#if PACKED_PRINTLINE
+#if SDSUPPORT
+#define MOVE_CACHE_SIZE 20
+#else
+#define MOVE_CACHE_SIZE 28
+#endif
+#else
 #if SDSUPPORT
 #define MOVE_CACHE_SIZE 17
 #else
 #define MOVE_CACHE_SIZE 24
 #endif
+#endif // PACKED_PRINTLINE
 
 /** \brief Low filled cache size.
 If the cache contains less then MOVE_CACHE_LOW segments, the time per segment is limited to LOW_TICKS_PER_MOVE clock cycles.
@@ -743,6 +771,13 @@ This value must be high enough, that the buffer has time to fill up. The problem
 if you are printing many very short segments at high speed.*/
 #define LOW_TICKS_PER_MOVE 250000
 
+/** \brief Precomputed step intervals.
+If enabled, every cached move gets a table of STEP_INTERVAL_TABLE_SIZE+1 intervals for its acceleration and deceleration ramp.
+The tables are filled by the path planner, so the stepper interrupt only interpolates between two entries instead of calling
+HAL::ComputeV() and HAL::CPUDivU2(). This costs (STEP_INTERVAL_TABLE_SIZE+1)*4+2 bytes of RAM per cached move. */
+#define STEP_INTERVAL_TABLES 0
+#define STEP_INTERVAL_TABLE_SIZE 8
+
 //For configuration of speed vs. cpu RF_MICRO_STEPS_ @ CONFIGURATION.h as well!
 
 // ##########################################################################################
@@ -755,6 +790,32 @@ effect increases with speed and acceleration difference. Using the advance metho
 For more informations, read the wiki. */
 #define USE_ADVANCE 1
 
+/** \brief Compute the advance once per move instead of in every stepper interrupt.
+The path planner derives the advance steps at the start, full and end speed of each move from the linear (L) and
+the quadratic (K) faktor of the extruder: steps = (L * vE + K * vE^2) * 0.001 * stepsPerMM. The stepper interrupt only
+interpolates between these targets and spreads every change of the advance over at least the smoothing time, which
+gives less direction changes of the extruder at high speeds with bowden extruders. */
+#define FEATURE_SEGMENT_ADVANCE 0
+
+#if FEATURE_SEGMENT_ADVANCE
+/** \brief Shortest time in ms for a change of the advance. Overridden if EEPROM activated. */
+#define ADVANCE_SMOOTHING_TIME 20
+
+/** \brief Upper limits for the quadratic faktor and the smoothing time. */
+#define ADVANCE_K_MAX 1000
+#define ADVANCE_SMOOTHING_TIME_MAX 200
+#endif // FEATURE_SEGMENT_ADVANCE
+
+/** \brief Move the extruder always from its own timer interrupt, also when advance is off.
+performMove() only adds the E steps of the Bresenham algorithm and of the z-compensation to extruderStepsNeeded, so the
+stepper interrupt never sets the extruder pins itself and its loop stays shorter. Needs USE_ADVANCE.
+FEATURE_ISR_TIMING shows the duration of the stepper interrupt with M3207 and M3201. */
+#define SEPARATE_EXTRUDER_INTERRUPT 0
+
+#if SEPARATE_EXTRUDER_INTERRUPT && !USE_ADVANCE
+#error SEPARATE_EXTRUDER_INTERRUPT needs the extruder interrupt of USE_ADVANCE
+#endif // SEPARATE_EXTRUDER_INTERRUPT && !USE_ADVANCE
+
 // ##########################################################################################
 // ##   Configuration of the heat bed z compensation
 // ##########################################################################################
@@ -819,6 +880,13 @@ Above this value the z compensation will distribute the roughness of the surface
 #define HEAT_BED_SCAN_SLOW_STEP_DELAY_MS 100 // [ms]
 #define HEAT_BED_SCAN_IDLE_DELAY_MS 250      // [ms]
 
+/** \brief Configuration of the adaptive heat bed scan
+Only every HEAT_BED_SCAN_ADAPTIVE_STRIDE-th point in X and Y is scanned first. The points within a cell of this coarse grid are only scanned
+if the surface deviates by more than HEAT_BED_SCAN_ADAPTIVE_TOLERANCE_UM from a bilinear surface there, otherwise they are interpolated. 0 = scan all points */
+#define HEAT_BED_SCAN_ADAPTIVE_STRIDE 0           // [-]
+#define HEAT_BED_SCAN_ADAPTIVE_STRIDE_MAX 8       // [-]
+#define HEAT_BED_SCAN_ADAPTIVE_TOLERANCE_UM 10    // [um]
+
 #define HEAT_BED_SCAN_RETRIES 5                                       // [-]
 #define HEAT_BED_SCAN_PRESSURE_READS 15                               // [-]
 #define HEAT_BED_SCAN_PRESSURE_TOLERANCE 15                           // [digits]
@@ -98,6 +98,18 @@ public:
         return a;
     } // max
 
+    static inline unsigned long min(unsigned long a, unsigned long b) {
+        if (a < b)
+            return a;
+        return b;
+    } // min
+
+    static inline unsigned long max(unsigned long a, unsigned long b) {
+        if (a < b)
+            return b;
+        return a;
+    } // max
+
     static inline long sqr(long a) {
         return a * a;
     } // sqr
@@ -172,6 +184,10 @@ public:
     uint8_t sdmode;  // 1 if we are printing from sd card, 2 = stop accepting new commands
     bool sdactive;
     bool savetosd;
+#if FEATURE_BINARY_DELTA_COORDINATES
+    int32_t deltaBase[4];   // X, Y, Z and E of the last written command in microns
+    uint8_t deltaBaseValid; // bit i is set if deltaBase[i] has been written to the file
+#endif // FEATURE_BINARY_DELTA_COORDINATES
 
     SDCard();
     void initsd(bool silent = false);
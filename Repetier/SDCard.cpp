@@ -178,14 +178,45 @@ void SDCard::writeCommand(GCode* code) {
     uint8_t p = 2;
     file.clearWriteError();
     uint16_t params = 128 | (code->params & ~1);
+#if FEATURE_BINARY_DELTA_COORDINATES
+    uint16_t params2 = code->params2 & ~BINARY_DELTA_MARKER;
+    uint8_t axes = (params >> 3) & 15; // X, Y, Z and E
+    uint8_t deltaWidths = 0;
+    int32_t deltas[4];
+
+    if (axes && !code->hasString() && (deltaBaseValid & axes) == axes) {
+        // all coordinates of this command can be written as differences to the previous ones
+        params |= 4096;
+        params2 |= BINARY_DELTA_MARKER;
+    }
+    float coordinates[4] = { code->X, code->Y, code->Z, code->E };
+    for (uint8_t i = 0; i < 4; i++) {
+        if (!(axes & (1 << i)))
+            continue;
+        int32_t microns = lroundf(coordinates[i] * 1000.0f);
+        deltas[i] = microns - deltaBase[i];
+        deltaWidths |= GCode::getDeltaWidth(deltas[i]) << (i << 1);
+        deltaBase[i] = microns;
+    }
+    deltaBaseValid |= axes;
+#endif // FEATURE_BINARY_DELTA_COORDINATES
     memcopy2(buf, &params);
 
+#if FEATURE_BINARY_DELTA_COORDINATES
+    if (params & 4096) // Read G,M as 16 bit value
+    {
+        memcopy2(&buf[p], &params2);
+        p += 2;
+        if (params2 & BINARY_DELTA_MARKER)
+            buf[p++] = deltaWidths;
+#else
     if (code->isV2()) // Read G,M as 16 bit value
     {
         memcopy2(&buf[p], &code->params2);
         //*(int*)&buf[p] = code->params2;
 
         p += 2;
+#endif // FEATURE_BINARY_DELTA_COORDINATES
         if (code->hasString())
             buf[p++] = strlen(code->text);
         if (code->hasM()) {
@@ -206,25 +237,38 @@ void SDCard::writeCommand(GCode* code) {
             buf[p++] = (uint8_t)code->G;
         }
     }
-    if (code->hasX()) {
-        memcopy4(&buf[p], &code->X);
-        //*(float*)&buf[p] = code->X;
-        p += 4;
-    }
-    if (code->hasY()) {
-        memcopy4(&buf[p], &code->Y);
-        //*(float*)&buf[p] = code->Y;
-        p += 4;
-    }
-    if (code->hasZ()) {
-        memcopy4(&buf[p], &code->Z);
-        //*(float*)&buf[p] = code->Z;
-        p += 4;
-    }
-    if (code->hasE()) {
-        memcopy4(&buf[p], &code->E);
-        //*(float*)&buf[p] = code->E;
-        p += 4;
+#if FEATURE_BINARY_DELTA_COORDINATES
+    if (params2 & BINARY_DELTA_MARKER) {
+        for (uint8_t i = 0; i < 4; i++) {
+            if (!(axes & (1 << i)))
+                continue;
+            uint8_t width = ((deltaWidths >> (i << 1)) & 3) + 1;
+            for (uint8_t b = 0; b < width; b++)
+                buf[p++] = (uint8_t)(deltas[i] >> (b << 3)); // little endian
+        }
+    } else
+#endif // FEATURE_BINARY_DELTA_COORDINATES
+    {
+        if (code->hasX()) {
+            memcopy4(&buf[p], &code->X);
+            //*(float*)&buf[p] = code->X;
+            p += 4;
+        }
+        if (code->hasY()) {
+            memcopy4(&buf[p], &code->Y);
+            //*(float*)&buf[p] = code->Y;
+            p += 4;
+        }
+        if (code->hasZ()) {
+            memcopy4(&buf[p], &code->Z);
+            //*(float*)&buf[p] = code->Z;
+            p += 4;
+        }
+        if (code->hasE()) {
+            memcopy4(&buf[p], &code->E);
+            //*(float*)&buf[p] = code->E;
+            p += 4;
+        }
     }
     if (code->hasF()) {
         memcopy4(&buf[p], &code->F);
@@ -409,6 +453,9 @@ void SDCard::startWrite(char* filename) {
     } else {
         UI_STATUS(UI_TEXT_UPLOADING);
         savetosd = true;
+#if FEATURE_BINARY_DELTA_COORDINATES
+        deltaBaseValid = 0; // the first coordinates of the file are written completely
+#endif // FEATURE_BINARY_DELTA_COORDINATES
         Com::printFLN(Com::tWritingToFile, filename);
     }
 }
@@ -1014,7 +1014,7 @@ bool SdBaseFile::openParentReturnFile(SdBaseFile* dirFile, const char* path, uin
     SdBaseFile dir1, dir2;
     SdBaseFile* parent = dirFile;
     SdBaseFile* sub = &dir1;
-    char* p;
+    const char* p;
 
     *dname = 0;
 
@@ -4322,6 +4322,9 @@ void SdFile::writeFloat(float number, uint8_t digits, bool komma_as_dot) {
  * \return The number of free bytes.
  */
 int SdFatUtil::FreeRam() {
+#ifdef SIMULATOR
+    return HAL::getFreeRam(); // the host has no stack below the heap
+#else
     extern int __bss_end;
     extern int* __brkval;
     int free_memory;
@@ -4335,6 +4338,7 @@ int SdFatUtil::FreeRam() {
             - reinterpret_cast<int>(__brkval);
     }
     return free_memory;
+#endif // SIMULATOR
 }
 //------------------------------------------------------------------------------
 
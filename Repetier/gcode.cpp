@@ -17,14 +17,35 @@
 
 #include "Repetier.h"
 
+#if FEATURE_COMPACT_COMMAND_BUFFER
+GCode GCode::commandReceived;                         ///< Command which is received right now.
+GCode GCode::commandUnpacked;                         ///< Oldest buffered command, unpacked for the execution.
+bool GCode::isCommandUnpacked = false;                ///< True if commandUnpacked holds the oldest buffered command.
+uint8_t GCode::commandBuffer[COMMAND_BUFFER_BYTES];   ///< Buffer for received commands, packed.
+uint16_t GCode::commandBufferReadPosition = 0;        ///< Read position in commandBuffer.
+uint16_t GCode::commandBufferWritePosition = 0;       ///< Write position in commandBuffer.
+uint16_t GCode::commandBufferUsed = 0;                ///< Number of used bytes in commandBuffer.
+
+// length byte, params, params2, source, internalCommand, N, M, G, X, Y, Z, E, F, T, S, P, I, J, R, D, C, H, A, B, K, L, O and text
+#define COMMAND_RECORD_MAX_SIZE (1 + 2 + 2 + sizeof(GCodeSource*) + 1 + 3 * 2 + 5 * 4 + 1 + 2 * 4 + 11 * 4 + sizeof(char*))
+#else
 GCode GCode::commandsBuffered[GCODE_BUFFER_SIZE];  ///< Buffer for received commands.
 uint8_t GCode::bufferReadIndex = 0;                ///< Read position in gcode_buffer.
 uint8_t GCode::bufferWriteIndex = 0;               ///< Write position in gcode_buffer.
+#endif // FEATURE_COMPACT_COMMAND_BUFFER
 uint8_t GCode::commandReceiving[MAX_CMD_SIZE];     ///< Current received command.
 uint8_t GCode::commandsReceivingWritePosition = 0; ///< Writing position in gcode_transbuffer.
 uint8_t GCode::sendAsBinary;                       ///< Flags the command as binary input.
 uint8_t GCode::commentDetected = false;            ///< Flags true if we are reading the comment part of a command.
 uint8_t GCode::binaryCommandSize;                  ///< Expected size of the incoming binary command.
+#if FEATURE_BINARY_DELTA_COORDINATES
+int32_t GCode::deltaBase[4] = { 0, 0, 0, 0 };     ///< X, Y, Z and E of the last received command in microns, the base of the delta coordinates.
+int32_t GCode::deltaReceived[4] = { 0, 0, 0, 0 }; ///< Delta coded X, Y, Z and E of the command which is received right now, in microns.
+#endif // FEATURE_BINARY_DELTA_COORDINATES
+#if FEATURE_BINARY_BATCH
+uint8_t GCode::binaryBatchPosition = 0;            ///< Position of the next command of the batch in commandReceiving.
+uint8_t GCode::binaryBatchRemaining = 0;           ///< Number of commands of the batch which have not been pushed yet.
+#endif // FEATURE_BINARY_BATCH
 bool GCode::waitUntilAllCommandsAreParsed = false; ///< Don't read until all commands are parsed. Needed if gcode_buffer is misused as storage for strings.
 uint32_t GCode::actLineNumber;                     ///< Line number of current command.
 volatile uint8_t GCode::bufferLength = 0;          ///< Number of commands stored in gcode_buffer
@@ -78,6 +99,10 @@ Gcode Letter to Bit and Datatype:
 - V2 : Bit 12 : Version 2 command for additional commands/sizes
 - Ext : Bit 13 : There are 2 more uint8_ts following with Bits, only for future versions
 - Int : Bit 14 : Marks it as internal command,
+  with FEATURE_BINARY_BATCH it marks a batch frame instead, which M115 announces with "Cap:BINARY_BATCH:1":
+  bitfield, number of commands (1 uint8_t), length of the payload (1 uint8_t, at most MAX_CMD_SIZE - 6),
+  the binary commands without their checksums and one Fletcher checksum over the whole frame.
+  The commands must not have a text and are acknowledged with one ok for the last command.
 - Text : Bit 15 : 16 Byte ASCII String terminated with 0
 Second word if V2:
 - I : Bit 0 : 32-Bit float
@@ -91,11 +116,16 @@ Second word if V2:
 - K : Bit 8 : 32-Bit float
 - L : Bit 9 : 32-Bit float
 - O : Bit 0 : 32-Bit float
+- Delta : Bit 14 : with FEATURE_BINARY_DELTA_COORDINATES, X, Y, Z and E are delta coded, see parseDeltaCoordinates()
 */
 uint8_t GCode::computeBinarySize(char* ptr) // unsigned int bitfield) {
 {
     uint8_t s = 4; // include checksum and bitfield
     uint16_t bitfield = *(uint16_t*)ptr;
+#if FEATURE_BINARY_BATCH
+    if (bitfield & BINARY_BATCH_MARKER)
+        return 6 + (uint8_t)ptr[3]; // bitfield, count, payload length, payload and checksum, readFromSerial() refuses a payload longer than MAX_CMD_SIZE - 6
+#endif // FEATURE_BINARY_BATCH
     if (bitfield & 1)
         s += 2;
     if (bitfield & 8)
@@ -157,6 +187,17 @@ uint8_t GCode::computeBinarySize(char* ptr) // unsigned int bitfield) {
         if (bitfield2 & 32768)
             s += 4;
         // ENDE ich rechne len nach dem aktuellsten Stand aus aber nutze diesen nicht.
+#if FEATURE_BINARY_DELTA_COORDINATES
+        if (bitfield2 & BINARY_DELTA_MARKER) {
+            // the width byte was counted with 4 bytes above, X, Y, Z and E have 1 to 4 bytes instead of 4
+            uint8_t widths = ptr[4];
+            s -= 3;
+            for (uint8_t i = 0; i < 4; i++) {
+                if (bitfield & (8 << i))
+                    s -= 3 - ((widths >> (i << 1)) & 3);
+            }
+        }
+#endif // FEATURE_BINARY_DELTA_COORDINATES
         if (bitfield & 32768)
             s += RMath::min((uint8_t)80, (uint8_t)ptr[4] + 1);
     } else {
@@ -209,14 +250,15 @@ void GCode::requestResend() {
 Check if result is plausible. If it is, an ok is send and the command is stored in queue.
 If not, a resend and ok is send.
 */
-void GCode::checkAndPushCommand() {
+bool GCode::checkAndPushCommand(bool acknowledge) {
     if (hasM()) {
         if (M == 110) // Reset line number
         {
             GCodeSource::activeSource->lastLineNumber = actLineNumber;
-            Com::printFLN(Com::tOk);
+            if (acknowledge)
+                Com::printFLN(Com::tOk);
             GCodeSource::activeSource->waitingForResend = -1;
-            return;
+            return true;
         }
         if (M == 112) // Emergency kill - freeze/reset printer
         {
@@ -229,7 +271,8 @@ void GCode::checkAndPushCommand() {
                 // we have seen that line already. So we assume it is a repeated resend and we ignore it
                 commandsReceivingWritePosition = 0;
                 Com::printFLN(Com::tSkip, actLineNumber);
-                Com::printFLN(Com::tOk);
+                if (acknowledge)
+                    Com::printFLN(Com::tOk);
             } else if (GCodeSource::activeSource->waitingForResend < 0) // after a resend, we have to skip the garbage in buffers, no message for this
             {
                 if (Printer::debugErrors()) {
@@ -237,42 +280,67 @@ void GCode::checkAndPushCommand() {
                     Com::printFLN(Com::tGot, actLineNumber);
                 }
                 requestResend(); // Line missing, force resend
+                return false;
             } else {
                 --GCodeSource::activeSource->waitingForResend;
                 commandsReceivingWritePosition = 0;
                 Com::printFLN(Com::tSkip, actLineNumber);
-                Com::printFLN(Com::tOk);
+                if (acknowledge)
+                    Com::printFLN(Com::tOk);
             }
-            return;
+            return true;
         }
         GCodeSource::activeSource->lastLineNumber = actLineNumber;
     }
     if (GCode::hasFatalError()) {
         GCode::reportFatalError();
     } else {
+#if FEATURE_BINARY_DELTA_COORDINATES
+        updateDeltaBase();
+#endif // FEATURE_BINARY_DELTA_COORDINATES
         pushCommand();
     }
 
-#if ACK_WITH_LINENUMBER
-    Com::printFLN(Com::tOkSpace, actLineNumber);
-#else
-    Com::printFLN(Com::tOk);
-#endif // ACK_WITH_LINENUMBER
+    if (acknowledge)
+        acknowledgeCommand();
 
     GCodeSource::activeSource->wasLastCommandReceivedAsBinary = sendAsBinary;
     keepAlive(NotBusy);
     GCodeSource::activeSource->waitingForResend = -1; // everything is ok.
+    return true;
 } // checkAndPushCommand
 
+void GCode::acknowledgeCommand() {
+#if ACK_WITH_BUFFER_STATE
+#if ACK_WITH_LINENUMBER
+    Com::printF(Com::tOkSpace, actLineNumber);
+#else
+    Com::printF(Com::tOk);
+#endif // ACK_WITH_LINENUMBER
+    Com::printF(PSTR(" P"), (int)(MOVE_CACHE_SIZE - PrintLine::linesCount));
+    Com::printFLN(PSTR(" B"), (int)getFreeCommandSlots());
+#else
+#if ACK_WITH_LINENUMBER
+    Com::printFLN(Com::tOkSpace, actLineNumber);
+#else
+    Com::printFLN(Com::tOk);
+#endif // ACK_WITH_LINENUMBER
+#endif // ACK_WITH_BUFFER_STATE
+} // acknowledgeCommand
+
 void GCode::pushCommand() {
     if (g_uBlockCommands)
         return; // no further commands from the SD card/Host shall be processed
 
 #if !ECHO_ON_EXECUTE
-    commandsBuffered[bufferWriteIndex].echoCommand();
+    getReceivingCommand()->echoCommand();
 #endif
+#if FEATURE_COMPACT_COMMAND_BUFFER
+    commandReceived.packCommand();
+#else
     if (++bufferWriteIndex >= GCODE_BUFFER_SIZE)
         bufferWriteIndex = 0;
+#endif // FEATURE_COMPACT_COMMAND_BUFFER
     bufferLength++;
 } // pushCommand
 
@@ -283,7 +351,15 @@ returned command, the popCurrentCommand() function must be called.
 GCode* GCode::peekCurrentCommand() {
     if (bufferLength == 0)
         return NULL; // No more data
+#if FEATURE_COMPACT_COMMAND_BUFFER
+    if (!isCommandUnpacked) {
+        commandUnpacked.unpackCommand();
+        isCommandUnpacked = true;
+    }
+    return &commandUnpacked;
+#else
     return &commandsBuffered[bufferReadIndex];
+#endif // FEATURE_COMPACT_COMMAND_BUFFER
 } // peekCurrentCommand
 
 /** \brief Removes the last returned command from cache. */
@@ -293,11 +369,170 @@ void GCode::popCurrentCommand() {
 #ifdef ECHO_ON_EXECUTE
     echoCommand();
 #endif // ECHO_ON_EXECUTE
+#if FEATURE_COMPACT_COMMAND_BUFFER
+    uint8_t length = commandBuffer[commandBufferReadPosition];
+    commandBufferReadPosition += length;
+    if (commandBufferReadPosition >= COMMAND_BUFFER_BYTES)
+        commandBufferReadPosition -= COMMAND_BUFFER_BYTES;
+    commandBufferUsed -= length;
+    isCommandUnpacked = false;
+#else
     if (++bufferReadIndex == GCODE_BUFFER_SIZE)
         bufferReadIndex = 0;
+#endif // FEATURE_COMPACT_COMMAND_BUFFER
     bufferLength--;
 } // popCurrentCommand
 
+/** \brief Returns how many further commands can be received at the moment. */
+uint8_t GCode::getFreeCommandSlots() {
+#if FEATURE_COMPACT_COMMAND_BUFFER
+    // every slot is counted with the size of a command with all parameters, most commands need much less
+    return (uint8_t)((COMMAND_BUFFER_BYTES - commandBufferUsed) / COMMAND_RECORD_MAX_SIZE);
+#else
+    return GCODE_BUFFER_SIZE - bufferLength;
+#endif // FEATURE_COMPACT_COMMAND_BUFFER
+} // getFreeCommandSlots
+
+#if FEATURE_COMPACT_COMMAND_BUFFER
+void GCode::storeCommandBytes(const void* data, uint8_t length) {
+    const uint8_t* p = (const uint8_t*)data;
+    while (length--) {
+        commandBuffer[commandBufferWritePosition] = *p++;
+        if (++commandBufferWritePosition == COMMAND_BUFFER_BYTES)
+            commandBufferWritePosition = 0;
+        commandBufferUsed++;
+    }
+} // storeCommandBytes
+
+void GCode::loadCommandBytes(uint16_t& position, void* data, uint8_t length) {
+    uint8_t* p = (uint8_t*)data;
+    while (length--) {
+        *p++ = commandBuffer[position];
+        if (++position == COMMAND_BUFFER_BYTES)
+            position = 0;
+    }
+} // loadCommandBytes
+
+/** \brief Appends the command to commandBuffer. Only the parameters which are present are stored, in the order of the binary protocol. */
+void GCode::packCommand() {
+    uint16_t start = commandBufferWritePosition;
+    uint16_t used = commandBufferUsed;
+    uint8_t length = 0;
+
+    storeCommandBytes(&length, 1); // the length byte is written at the end
+    storeCommandBytes(&params, 2);
+    storeCommandBytes(&params2, 2);
+    storeCommandBytes(&source, sizeof(source));
+    storeCommandBytes(&internalCommand, 1);
+    if (hasN())
+        storeCommandBytes(&N, 2);
+    if (hasM())
+        storeCommandBytes(&M, 2);
+    if (hasG())
+        storeCommandBytes(&G, 2);
+    if (hasX())
+        storeCommandBytes(&X, 4);
+    if (hasY())
+        storeCommandBytes(&Y, 4);
+    if (hasZ())
+        storeCommandBytes(&Z, 4);
+    if (hasE())
+        storeCommandBytes(&E, 4);
+    if (hasF())
+        storeCommandBytes(&F, 4);
+    if (hasT())
+        storeCommandBytes(&T, 1);
+    if (hasS())
+        storeCommandBytes(&S, 4);
+    if (hasP())
+        storeCommandBytes(&P, 4);
+    if (hasI())
+        storeCommandBytes(&I, 4);
+    if (hasJ())
+        storeCommandBytes(&J, 4);
+    if (hasR())
+        storeCommandBytes(&R, 4);
+    if (hasD())
+        storeCommandBytes(&D, 4);
+    if (hasC())
+        storeCommandBytes(&C, 4);
+    if (hasH())
+        storeCommandBytes(&H, 4);
+    if (hasA())
+        storeCommandBytes(&A, 4);
+    if (hasB())
+        storeCommandBytes(&B, 4);
+    if (hasK())
+        storeCommandBytes(&K, 4);
+    if (hasL())
+        storeCommandBytes(&L, 4);
+    if (hasO())
+        storeCommandBytes(&O, 4);
+    if (hasString())
+        storeCommandBytes(&text, sizeof(text)); // the text stays in commandReceiving, see waitUntilAllCommandsAreParsed
+
+    commandBuffer[start] = (uint8_t)(commandBufferUsed - used);
+} // packCommand
+
+/** \brief Restores the oldest command of commandBuffer without removing it. */
+void GCode::unpackCommand() {
+    uint16_t position = commandBufferReadPosition + 1; // skip the length byte
+    if (position == COMMAND_BUFFER_BYTES)
+        position = 0;
+
+    loadCommandBytes(position, &params, 2);
+    loadCommandBytes(position, &params2, 2);
+    loadCommandBytes(position, &source, sizeof(source));
+    loadCommandBytes(position, &internalCommand, 1);
+    if (hasN())
+        loadCommandBytes(position, &N, 2);
+    if (hasM())
+        loadCommandBytes(position, &M, 2);
+    if (hasG())
+        loadCommandBytes(position, &G, 2);
+    if (hasX())
+        loadCommandBytes(position, &X, 4);
+    if (hasY())
+        loadCommandBytes(position, &Y, 4);
+    if (hasZ())
+        loadCommandBytes(position, &Z, 4);
+    if (hasE())
+        loadCommandBytes(position, &E, 4);
+    if (hasF())
+        loadCommandBytes(position, &F, 4);
+    if (hasT())
+        loadCommandBytes(position, &T, 1);
+    if (hasS())
+        loadCommandBytes(position, &S, 4);
+    if (hasP())
+        loadCommandBytes(position, &P, 4);
+    if (hasI())
+        loadCommandBytes(position, &I, 4);
+    if (hasJ())
+        loadCommandBytes(position, &J, 4);
+    if (hasR())
+        loadCommandBytes(position, &R, 4);
+    if (hasD())
+        loadCommandBytes(position, &D, 4);
+    if (hasC())
+        loadCommandBytes(position, &C, 4);
+    if (hasH())
+        loadCommandBytes(position, &H, 4);
+    if (hasA())
+        loadCommandBytes(position, &A, 4);
+    if (hasB())
+        loadCommandBytes(position, &B, 4);
+    if (hasK())
+        loadCommandBytes(position, &K, 4);
+    if (hasL())
+        loadCommandBytes(position, &L, 4);
+    if (hasO())
+        loadCommandBytes(position, &O, 4);
+    if (hasString())
+        loadCommandBytes(position, &text, sizeof(text));
+} // unpackCommand
+#endif // FEATURE_COMPACT_COMMAND_BUFFER
+
 void GCode::echoCommand() {
     if (Printer::debugEcho()) {
         Com::printF(Com::tEcho);
@@ -388,12 +623,19 @@ void GCode::executeString(char* cmd) {
     This function is the main function to read the commands from serial console.
     It must be called frequently to empty the incoming buffer. */
 void GCode::readFromSerial() {
-    if (bufferLength >= GCODE_BUFFER_SIZE || (waitUntilAllCommandsAreParsed && bufferLength)) {
+    if (!getFreeCommandSlots() || (waitUntilAllCommandsAreParsed && bufferLength)) {
         keepAlive(Processing);
         // all buffers full
         return;
     }
     waitUntilAllCommandsAreParsed = false;
+#if FEATURE_BINARY_BATCH
+    if (binaryBatchRemaining) {
+        // do not read further data until all commands of the current batch are in the buffer
+        processBinaryBatch();
+        return;
+    }
+#endif // FEATURE_BINARY_BATCH
     millis_t time = HAL::timeInMilliseconds();
 
     bool lastWTA = Com::writeToAll;
@@ -450,10 +692,46 @@ void GCode::readFromSerial() {
         if (sendAsBinary) {
             if (commandsReceivingWritePosition < 2)
                 continue;
-            if (commandsReceivingWritePosition == 5 || commandsReceivingWritePosition == 4)
+            if (commandsReceivingWritePosition == 5 || commandsReceivingWritePosition == 4) {
+#if FEATURE_BINARY_BATCH
+                if ((*(uint16_t*)commandReceiving & BINARY_BATCH_MARKER) && commandReceiving[3] > MAX_CMD_SIZE - 6) {
+                    // the payload does not fit into commandReceiving, so the frame is refused as soon as its header is read
+                    if (Printer::debugErrors()) {
+                        Com::printErrorFLN(PSTR("Binary batch too long"));
+                    }
+                    if (GCodeSource::activeSource->closeOnError()) { // this device does not support resends so all errors are final!
+                        GCodeSource::activeSource->close();
+                        commandsReceivingWritePosition = 0;
+                    } else {
+                        requestResend();
+                    }
+                    GCodeSource::rotateSource();
+                    Com::writeToAll = lastWTA;
+                    return;
+                }
+#endif // FEATURE_BINARY_BATCH
                 binaryCommandSize = computeBinarySize((char*)commandReceiving);
+            }
             if (commandsReceivingWritePosition == binaryCommandSize) {
-                GCode* act = &commandsBuffered[bufferWriteIndex];
+#if FEATURE_BINARY_BATCH
+                if (*(uint16_t*)commandReceiving & BINARY_BATCH_MARKER) {
+                    if (startBinaryBatch()) {
+                        // the source is not rotated before the batch is complete, commandReceiving still holds its commands
+                        Com::writeToAll = lastWTA;
+                        processBinaryBatch();
+                        return;
+                    }
+                    if (GCodeSource::activeSource->closeOnError()) { // this device does not support resends so all errors are final!
+                        GCodeSource::activeSource->close();
+                    } else {
+                        requestResend();
+                    }
+                    GCodeSource::rotateSource();
+                    Com::writeToAll = lastWTA;
+                    return;
+                }
+#endif // FEATURE_BINARY_BATCH
+                GCode* act = getReceivingCommand();
                 act->source = GCodeSource::activeSource;                           // we need to know where to write answers to
                 if (act->parseBinary(commandReceiving, binaryCommandSize, true)) { // Success
                     act->checkAndPushCommand();
@@ -485,7 +763,7 @@ void GCode::readFromSerial() {
                     commandsReceivingWritePosition = 0;
                     continue;
                 }
-                GCode* act = &commandsBuffered[bufferWriteIndex];
+                GCode* act = getReceivingCommand();
                 act->source = GCodeSource::activeSource;              // we need to know where to write answers to
                 if (act->parseAscii((char*)commandReceiving, true)) { // Success
                     act->checkAndPushCommand();
@@ -519,11 +797,8 @@ void GCode::readFromSerial() {
     Com::writeToAll = lastWTA;
 } // readFromSerial
 
-/** \brief Converts a binary uint8_tfield containing one GCode line into a GCode structure.
-    Returns true if checksum was correct. */
-
-bool GCode::parseBinary(uint8_t* buffer, fast8_t length, bool fromSerial) {
-    internalCommand = !fromSerial;
+/** \brief Tests the fletcher-16 checksum in the last two bytes of a binary frame. */
+bool GCode::checkBinaryChecksum(uint8_t* buffer, fast8_t length) {
     unsigned int sum1 = 0, sum2 = 0; // for fletcher-16 checksum
     // first do fletcher-16 checksum tests see
     // http://en.wikipedia.org/wiki/Fletcher's_checksum
@@ -549,14 +824,39 @@ bool GCode::parseBinary(uint8_t* buffer, fast8_t length, bool fromSerial) {
         }
         return false;
     }
+    return true;
+} // checkBinaryChecksum
+
+/** \brief Converts a binary uint8_tfield containing one GCode line into a GCode structure.
+    Returns true if checksum was correct. */
+
+bool GCode::parseBinary(uint8_t* buffer, fast8_t length, bool fromSerial, bool withChecksum) {
+    internalCommand = !fromSerial;
+    if (withChecksum && !checkBinaryChecksum(buffer, length))
+        return false;
 
-    p = buffer;
+    uint8_t* p = buffer;
     params = *(unsigned int*)p;
     p += 2;
     uint8_t textlen = 16;
+#if FEATURE_BINARY_DELTA_COORDINATES
+    uint8_t deltaWidths = 0;
+#endif // FEATURE_BINARY_DELTA_COORDINATES
     if (isV2()) {
         params2 = *(unsigned int*)p;
         p += 2;
+#if FEATURE_BINARY_DELTA_COORDINATES
+        if (params2 & BINARY_DELTA_MARKER) {
+            if (hasString()) {
+                // the width byte is where the length of the text would be
+                if (Printer::debugErrors()) {
+                    Com::printErrorFLN(PSTR("Delta coordinates with text"));
+                }
+                return false;
+            }
+            deltaWidths = *p++;
+        } else
+#endif // FEATURE_BINARY_DELTA_COORDINATES
         if (hasString())
             textlen = *p++;
     } else
@@ -597,21 +897,28 @@ bool GCode::parseBinary(uint8_t* buffer, fast8_t length, bool fromSerial) {
         return true;
     }
 
-    if (hasX()) {
-        X = *(float*)p;
-        p += 4;
-    }
-    if (hasY()) {
-        Y = *(float*)p;
-        p += 4;
-    }
-    if (hasZ()) {
-        Z = *(float*)p;
-        p += 4;
-    }
-    if (hasE()) {
-        E = *(float*)p;
-        p += 4;
+#if FEATURE_BINARY_DELTA_COORDINATES
+    if (params2 & BINARY_DELTA_MARKER)
+        p = parseDeltaCoordinates(p, deltaWidths);
+    else
+#endif // FEATURE_BINARY_DELTA_COORDINATES
+    {
+        if (hasX()) {
+            X = *(float*)p;
+            p += 4;
+        }
+        if (hasY()) {
+            Y = *(float*)p;
+            p += 4;
+        }
+        if (hasZ()) {
+            Z = *(float*)p;
+            p += 4;
+        }
+        if (hasE()) {
+            E = *(float*)p;
+            p += 4;
+        }
     }
     if (hasF()) {
         F = *(float*)p;
@@ -682,6 +989,232 @@ bool GCode::parseBinary(uint8_t* buffer, fast8_t length, bool fromSerial) {
     return true;
 } // parseBinary
 
+#if FEATURE_FAST_ASCII_PARSER
+const float decimalPowers[] PROGMEM = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+const uint32_t decimalDivisors[] PROGMEM = { 1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL };
+
+/**
+  Divides mantissa by 10^decimals and rounds only once, like strtod(). Converting the mantissa to float and dividing it by the power of ten
+  would round twice, which misses the nearest float for about 8 % of the numbers of a slicer. The quotient is divided out bit by bit
+  until it has 25 bits, the last bit and the remainder round it to the 24 bits of a float.
+*/
+static float decimalQuotient(uint32_t mantissa, uint8_t decimals) {
+    uint32_t divisor = pgm_read_dword(&decimalDivisors[decimals]);
+    uint32_t quotient = mantissa / divisor;
+    uint32_t remainder = mantissa % divisor;
+    if (quotient >= (1UL << 24))
+        return (float)mantissa / pgm_read_float(&decimalPowers[decimals]); // more than 16777216 with decimals does not appear in G-Code
+    int8_t shift = 0;
+    while (quotient < (1UL << 24)) {
+        remainder <<= 1; // below 2^31, as the divisor is below 2^30
+        quotient <<= 1;
+        if (remainder >= divisor) {
+            remainder -= divisor;
+            quotient |= 1;
+        }
+        shift++;
+    }
+    uint32_t rounded = quotient >> 1;
+    if ((quotient & 1) && (remainder || (rounded & 1)))
+        rounded++; // round half to even
+    return ldexp((float)rounded, 1 - shift);
+} // decimalQuotient
+
+/**
+  Decodes a decimal number without exponent. Up to 9 significant digits are collected in an integer,
+  the result is converted and scaled only once. s is moved behind the number.
+*/
+float GCode::parseFloatValue(char*& s) {
+    uint32_t mantissa = 0;
+    int8_t exponent = 0;
+    uint8_t digits = 0;
+    bool negative = false;
+    float f;
+
+    while (*s == ' ')
+        s++; // skip spaces
+    if (*s == '-') {
+        negative = true;
+        s++;
+    } else if (*s == '+')
+        s++;
+
+    while (*s >= '0' && *s <= '9') {
+        if (digits < 9) {
+            mantissa = mantissa * 10 + (*s - '0');
+            if (mantissa)
+                digits++;
+        } else
+            exponent++; // the digit does not fit, it only scales the value
+        s++;
+    }
+    if (*s == '.') {
+        s++;
+        while (*s >= '0' && *s <= '9') {
+            if (digits < 9) {
+                mantissa = mantissa * 10 + (*s - '0');
+                if (mantissa)
+                    digits++;
+                exponent--;
+            }
+            s++;
+        }
+    }
+
+    // an empty string "x " is treated as "x0"
+    f = (float)mantissa;
+    if (mantissa && exponent < 0 && exponent >= -9) {
+        f = decimalQuotient(mantissa, -exponent);
+    } else if (mantissa) {
+        while (exponent > 10) {
+            f *= 1e10f;
+            exponent -= 10;
+        }
+        while (exponent < -10) {
+            f /= 1e10f;
+            exponent += 10;
+        }
+        if (exponent > 0)
+            f *= pgm_read_float(&decimalPowers[exponent]);
+        else if (exponent < 0)
+            f /= pgm_read_float(&decimalPowers[-exponent]); // only numbers with more than 9 decimals get here
+    }
+    return negative ? -f : f;
+} // parseFloatValue
+
+long GCode::parseLongValue(char*& s) {
+    long l = 0;
+    bool negative = false;
+
+    while (*s == ' ')
+        s++; // skip spaces
+    if (*s == '-') {
+        negative = true;
+        s++;
+    } else if (*s == '+')
+        s++;
+
+    // an empty string argument "p " is treated as "p0"
+    while (*s >= '0' && *s <= '9') {
+        l = l * 10 + (*s - '0');
+        s++;
+    }
+    return negative ? -l : l;
+} // parseLongValue
+#endif // FEATURE_FAST_ASCII_PARSER
+
+#if FEATURE_BINARY_DELTA_COORDINATES
+/** \brief Reads the delta coded X, Y, Z and E. The differences are little endian and signed, in microns to the last received command. */
+uint8_t* GCode::parseDeltaCoordinates(uint8_t* p, uint8_t widths) {
+    float* coordinates[4] = { &X, &Y, &Z, &E };
+
+    for (uint8_t i = 0; i < 4; i++) {
+        if (!(params & (8 << i)))
+            continue;
+
+        uint8_t width = ((widths >> (i << 1)) & 3) + 1;
+        int32_t delta = (int8_t)p[width - 1]; // the highest byte carries the sign
+        for (int8_t b = width - 2; b >= 0; b--)
+            delta = (int32_t)(((uint32_t)delta << 8) | p[b]);
+        p += width;
+
+        // the base is updated only when the command is pushed, a skipped or resent line must not count twice
+        deltaReceived[i] = deltaBase[i] + delta;
+        *coordinates[i] = deltaReceived[i] / 1000.0f;
+    }
+    return p;
+} // parseDeltaCoordinates
+
+void GCode::updateDeltaBase() {
+    float coordinates[4] = { X, Y, Z, E };
+
+    for (uint8_t i = 0; i < 4; i++) {
+        if (!(params & (8 << i)))
+            continue;
+        if (params2 & BINARY_DELTA_MARKER)
+            deltaBase[i] = deltaReceived[i];
+        else
+            deltaBase[i] = lroundf(coordinates[i] * 1000.0f);
+    }
+} // updateDeltaBase
+
+/** \brief Returns the width code (0 = 1 byte ... 3 = 4 bytes) which is needed to store the difference. */
+uint8_t GCode::getDeltaWidth(int32_t delta) {
+    if (delta >= -128 && delta <= 127)
+        return 0;
+    if (delta >= -32768L && delta <= 32767L)
+        return 1;
+    if (delta >= -8388608L && delta <= 8388607L)
+        return 2;
+    return 3;
+} // getDeltaWidth
+#endif // FEATURE_BINARY_DELTA_COORDINATES
+
+#if FEATURE_BINARY_BATCH
+/** \brief Checks the batch frame in commandReceiving. Returns true if the checksum is correct and the commands fill the payload exactly. */
+bool GCode::startBinaryBatch() {
+    uint8_t count = commandReceiving[2];
+    uint8_t end = 4 + commandReceiving[3];
+    uint8_t position = 4;
+
+    if (commandReceiving[3] > MAX_CMD_SIZE - 6 || !checkBinaryChecksum(commandReceiving, binaryCommandSize))
+        return false; // a longer payload can not be received at all
+
+    for (uint8_t i = 0; i < count; i++) {
+        uint16_t bitfield = *(uint16_t*)(commandReceiving + position);
+        if (position + 4 > end || !(bitfield & 128) || (bitfield & (BINARY_BATCH_MARKER | 32768))) {
+            // no binary command, a nested batch or a text - the text would be terminated inside of the next command
+            if (Printer::debugErrors()) {
+                Com::printErrorFLN(PSTR("Invalid binary batch"));
+            }
+            return false;
+        }
+        position += computeBinarySize((char*)commandReceiving + position) - 2; // the commands have no checksum of their own
+    }
+    if (position != end || !count) {
+        if (Printer::debugErrors()) {
+            Com::printErrorFLN(PSTR("Invalid binary batch"));
+        }
+        return false;
+    }
+
+    binaryBatchPosition = 4;
+    binaryBatchRemaining = count;
+    return true;
+} // startBinaryBatch
+
+/** \brief Pushes the commands of the current batch as long as there is space in the command buffer. The batch is acknowledged after its last command. */
+void GCode::processBinaryBatch() {
+    bool lastWTA = Com::writeToAll;
+    Com::writeToAll = false;
+
+    while (binaryBatchRemaining && getFreeCommandSlots()) {
+        uint8_t* p = commandReceiving + binaryBatchPosition;
+        uint8_t size = computeBinarySize((char*)p) - 2;
+        GCode* act = getReceivingCommand();
+
+        binaryBatchPosition += size;
+        binaryBatchRemaining--;
+
+        act->source = GCodeSource::activeSource; // we need to know where to write answers to
+        act->parseBinary(p, size, true, false);
+        if (!act->checkAndPushCommand(false)) {
+            // a resend has been requested, the rest of the batch is dropped
+            binaryBatchRemaining = 0;
+            GCodeSource::rotateSource();
+            Com::writeToAll = lastWTA;
+            return;
+        }
+    }
+
+    if (!binaryBatchRemaining) {
+        acknowledgeCommand();
+        GCodeSource::rotateSource();
+    }
+    Com::writeToAll = lastWTA;
+} // processBinaryBatch
+#endif // FEATURE_BINARY_BATCH
+
 /**
   Converts a ASCII GCode line into a GCode structure.
 */
@@ -871,9 +1404,10 @@ bool GCode::parseAscii(char* line, bool fromSerial) {
         }
         case '*': //checksum
         {
+            char* checksumEnd = pos - 1;
             uint8_t checksum_given = parseLongValue(pos);
             uint8_t checksum = 0;
-            while (line != (pos - 1))
+            while (line != checksumEnd)
                 checksum ^= *line++;
 #if FEATURE_CHECKSUM_FORCED
             Printer::flag0 |= PRINTER_FLAG0_FORCE_CHECKSUM;
@@ -18,7 +18,16 @@
 #ifndef GCODE_H
 #define GCODE_H
 
+#if FEATURE_BINARY_BATCH
+#define MAX_CMD_SIZE 192 // a batch frame is received like one command
+#define BINARY_BATCH_MARKER 16384
+#else
 #define MAX_CMD_SIZE 96
+#endif // FEATURE_BINARY_BATCH
+
+#if FEATURE_BINARY_DELTA_COORDINATES
+#define BINARY_DELTA_MARKER 16384 // in the second bitfield
+#endif // FEATURE_BINARY_DELTA_COORDINATES
 
 enum FirmwareState { NotBusy = 0,
                      Processing,
@@ -283,12 +292,13 @@ public:
         return ((params2 & 32768) != 0);
     }
     void printCommand();
-    bool parseBinary(uint8_t* buffer, fast8_t length, bool fromSerial);
+    bool parseBinary(uint8_t* buffer, fast8_t length, bool fromSerial, bool withChecksum = true);
     bool parseAscii(char* line, bool fromSerial);
     void popCurrentCommand();
     void echoCommand();
     static GCode* peekCurrentCommand();
     static void readFromSerial();
+    static uint8_t getFreeCommandSlots();
     static void pushCommand();
     static void executeFString(FSTRINGPARAM(cmd));
     static void executeString(char* cmd);
@@ -313,8 +323,27 @@ public:
 
 protected:
     void outputGCommand();
-    void checkAndPushCommand();
+    bool checkAndPushCommand(bool acknowledge = true);
+    static void acknowledgeCommand();
+    static bool checkBinaryChecksum(uint8_t* buffer, fast8_t length);
+#if FEATURE_BINARY_DELTA_COORDINATES
+    uint8_t* parseDeltaCoordinates(uint8_t* p, uint8_t widths);
+    void updateDeltaBase();
+    static uint8_t getDeltaWidth(int32_t delta);
+    static int32_t deltaBase[4];     ///< X, Y, Z and E of the last received command in microns, the base of the delta coordinates.
+    static int32_t deltaReceived[4]; ///< Delta coded X, Y, Z and E of the command which is received right now, in microns.
+#endif // FEATURE_BINARY_DELTA_COORDINATES
+#if FEATURE_BINARY_BATCH
+    static bool startBinaryBatch();
+    static void processBinaryBatch();
+    static uint8_t binaryBatchPosition;  ///< Position of the next command of the batch in commandReceiving.
+    static uint8_t binaryBatchRemaining; ///< Number of commands of the batch which have not been pushed yet.
+#endif // FEATURE_BINARY_BATCH
     static void requestResend();
+#if FEATURE_FAST_ASCII_PARSER
+    float parseFloatValue(char*& s);
+    long parseLongValue(char*& s);
+#else
     inline float parseFloatValue(char* s) {
         char* endPtr;
         while (*s == 32)
@@ -333,10 +362,33 @@ protected:
             l = 0; // treat empty string argument "p " as "p0"
         return l;
     }
+#endif // FEATURE_FAST_ASCII_PARSER
+
+#if FEATURE_COMPACT_COMMAND_BUFFER
+    void packCommand();
+    void unpackCommand();
+    static void storeCommandBytes(const void* data, uint8_t length);
+    static void loadCommandBytes(uint16_t& position, void* data, uint8_t length);
+    static inline GCode* getReceivingCommand() {
+        return &commandReceived;
+    } // getReceivingCommand
+
+    static GCode commandReceived;                       ///< Command which is received right now.
+    static GCode commandUnpacked;                       ///< Oldest buffered command, unpacked for the execution.
+    static bool isCommandUnpacked;                      ///< True if commandUnpacked holds the oldest buffered command.
+    static uint8_t commandBuffer[COMMAND_BUFFER_BYTES]; ///< Buffer for received commands, packed.
+    static uint16_t commandBufferReadPosition;          ///< Read position in commandBuffer.
+    static uint16_t commandBufferWritePosition;         ///< Write position in commandBuffer.
+    static uint16_t commandBufferUsed;                  ///< Number of used bytes in commandBuffer.
+#else
+    static inline GCode* getReceivingCommand() {
+        return &commandsBuffered[bufferWriteIndex];
+    } // getReceivingCommand
 
     static GCode commandsBuffered[GCODE_BUFFER_SIZE]; ///< Buffer for received commands.
     static uint8_t bufferReadIndex;                   ///< Read position in gcode_buffer.
     static uint8_t bufferWriteIndex;                  ///< Write position in gcode_buffer.
+#endif // FEATURE_COMPACT_COMMAND_BUFFER
     static uint8_t commandReceiving[MAX_CMD_SIZE];    ///< Current received command.
     static uint8_t commandsReceivingWritePosition;    ///< Writing position in gcode_transbuffer.
     static uint8_t sendAsBinary;                      ///< Flags the command as binary input.
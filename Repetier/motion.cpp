@@ -76,11 +76,162 @@ uint8_t fanSpeed = 0;
 PrintLine PrintLine::lines[MOVE_CACHE_SIZE]; // Cache for print moves.
 PrintLine* PrintLine::cur = 0;               // Current printing line
 PrintLine PrintLine::direct;                 // direct movement
+#if FEATURE_INPUT_SHAPING
+InputShaper PrintLine::shaperX;
+InputShaper PrintLine::shaperY;
+uint32_t PrintLine::shapingClock = 0;
+#endif // FEATURE_INPUT_SHAPING
 
 uint8_t PrintLine::linesWritePos = 0;       // Position where we write the next cached line move.
 volatile uint8_t PrintLine::linesCount = 0; // Number of lines cached 0 = nothing to do.
 uint8_t PrintLine::linesPos = 0;            // Position for executing line movement.
 
+#if FEATURE_PLANNER_TIMING
+unsigned long PrintLine::plannerTimingCalls[PLANNER_TIMING_COUNT] = { 0 };
+unsigned long PrintLine::plannerTimingSum[PLANNER_TIMING_COUNT] = { 0 };
+unsigned long PrintLine::plannerTimingMax[PLANNER_TIMING_COUNT] = { 0 };
+
+void PrintLine::resetPlannerTiming() {
+    InterruptProtectedBlock noInts;
+    for (uint8_t i = 0; i < PLANNER_TIMING_COUNT; i++) {
+        plannerTimingCalls[i] = 0;
+        plannerTimingSum[i] = 0;
+        plannerTimingMax[i] = 0;
+    }
+} // resetPlannerTiming
+
+static void printPlannerTimingSlot(FSTRINGPARAM(name), uint8_t slot, unsigned long segments) {
+    InterruptProtectedBlock noInts;
+    unsigned long calls = PrintLine::plannerTimingCalls[slot];
+    unsigned long sum = PrintLine::plannerTimingSum[slot];
+    unsigned long max = PrintLine::plannerTimingMax[slot];
+    noInts.unprotect();
+
+    Com::printF(name);
+    Com::printF(PSTR(": calls = "), calls);
+    Com::printF(PSTR(", total = "), sum);
+    Com::printF(PSTR(PLANNER_TIMING_UNIT ", max = "), max);
+    Com::printF(PSTR(PLANNER_TIMING_UNIT ", per segment = "), segments ? (float)sum / (float)segments : 0.0f);
+    Com::printFLN(PSTR(PLANNER_TIMING_UNIT));
+} // printPlannerTimingSlot
+
+/** \brief Outputs the time spent in the path planner. A segment is one call of updateTrapezoids(), which is one queued move. */
+void PrintLine::printPlannerTiming() {
+    unsigned long segments = plannerTimingCalls[PLANNER_TIMING_TRAPEZOIDS];
+    Com::printF(PSTR("Planner timing: segments = "), segments);
+    Com::printFLN(PSTR(", MOVE_CACHE_SIZE = "), (int)MOVE_CACHE_SIZE);
+    printPlannerTimingSlot(PSTR("updateTrapezoids"), PLANNER_TIMING_TRAPEZOIDS, segments);
+    printPlannerTimingSlot(PSTR("computeMaxJunctionSpeed"), PLANNER_TIMING_JUNCTION, segments);
+    printPlannerTimingSlot(PSTR("backwardPlanner"), PLANNER_TIMING_BACKWARD, segments);
+    printPlannerTimingSlot(PSTR("forwardPlanner"), PLANNER_TIMING_FORWARD, segments);
+    printPlannerTimingSlot(PSTR("updateStepsParameter"), PLANNER_TIMING_STEPS_PARAMETER, segments);
+} // printPlannerTiming
+#endif // FEATURE_PLANNER_TIMING
+
+#if FEATURE_SEGMENT_TRACE
+SegmentTraceRecord PrintLine::segmentTrace[SEGMENT_TRACE_SIZE];
+volatile uint8_t PrintLine::segmentTraceHead = 0;
+volatile uint8_t PrintLine::segmentTraceTail = 0;
+uint8_t PrintLine::segmentTraceSequence = 0;
+uint8_t PrintLine::segmentTraceActive = 0;
+uint16_t PrintLine::segmentTraceCalls = 0;
+volatile uint16_t PrintLine::segmentTraceDropped = 0;
+
+void PrintLine::startSegmentTrace(uint8_t active) {
+    InterruptProtectedBlock noInts;
+    segmentTraceActive = active;
+    segmentTraceHead = segmentTraceTail = 0;
+    segmentTraceSequence = 0;
+    segmentTraceCalls = 0;
+    segmentTraceDropped = 0;
+    noInts.unprotect();
+
+    if (active)
+        Com::printFLN(PSTR("ST:seq,steps,vStart,vMax,vEnd,vReached,accelSteps,decelSteps,stepsLeft,calls"));
+} // startSegmentTrace
+
+/** \brief Sends the recorded moves as CSV lines while the serial output buffer has room, so the output never blocks the command processing for long.
+Called from every pass of the main loop. */
+void PrintLine::flushSegmentTrace() {
+#ifndef EXTERNALSERIAL
+    for (uint8_t i = 0; i < SEGMENT_TRACE_SIZE && segmentTraceTail != segmentTraceHead && RFSERIAL.outputUnused() >= SEGMENT_TRACE_LINE_SIZE; i++) {
+#else
+    for (uint8_t i = 0; i < SEGMENT_TRACE_FLUSH_LINES && segmentTraceTail != segmentTraceHead; i++) {
+#endif // EXTERNALSERIAL
+        SegmentTraceRecord record = segmentTrace[segmentTraceTail]; // the stepper interrupt does not write this record until the tail moved on
+        segmentTraceTail = (segmentTraceTail + 1) & (SEGMENT_TRACE_SIZE - 1);
+
+        Com::printF(PSTR("ST:"), (int)record.sequence);
+        Com::printF(PSTR(","), record.steps);
+        Com::printF(PSTR(","), (uint32_t)record.vStart);
+        Com::printF(PSTR(","), (uint32_t)record.vMax);
+        Com::printF(PSTR(","), (uint32_t)record.vEnd);
+        Com::printF(PSTR(","), (uint32_t)record.vReached);
+        Com::printF(PSTR(","), (uint32_t)record.accelSteps);
+        Com::printF(PSTR(","), (uint32_t)record.decelSteps);
+        Com::printF(PSTR(","), (uint32_t)record.stepsLeft);
+        Com::printFLN(PSTR(","), (uint32_t)record.calls);
+    }
+} // flushSegmentTrace
+#endif // FEATURE_SEGMENT_TRACE
+
+#if FEATURE_QUEUE_TELEMETRY
+unsigned long PrintLine::queueTelemetrySegments = 0;
+unsigned long PrintLine::queueTelemetrySlowed = 0;
+unsigned long PrintLine::queueTelemetryAddedTime = 0;
+uint8_t PrintLine::queueTelemetryLowWater = 255;
+unsigned long PrintLine::queueTelemetryHistogram[QUEUE_TELEMETRY_SLOTS] = { 0 };
+uint16_t PrintLine::queueTelemetryReportInterval = 0;
+
+void PrintLine::addQueueTelemetry(uint8_t lines, float addedTicks) {
+    queueTelemetrySegments++;
+    if (addedTicks > 0) {
+        queueTelemetrySlowed++;
+        queueTelemetryAddedTime += (unsigned long)(addedTicks * (1000000.0f / F_CPU));
+    }
+    if (lines < queueTelemetryLowWater)
+        queueTelemetryLowWater = lines;
+    uint8_t slot = lines / QUEUE_TELEMETRY_SLOT_WIDTH;
+    queueTelemetryHistogram[slot < QUEUE_TELEMETRY_SLOTS ? slot : QUEUE_TELEMETRY_SLOTS - 1]++;
+} // addQueueTelemetry
+
+void PrintLine::resetQueueTelemetry() {
+    queueTelemetrySegments = 0;
+    queueTelemetrySlowed = 0;
+    queueTelemetryAddedTime = 0;
+    queueTelemetryLowWater = 255;
+    for (uint8_t i = 0; i < QUEUE_TELEMETRY_SLOTS; i++)
+        queueTelemetryHistogram[i] = 0;
+} // resetQueueTelemetry
+
+/** \brief Outputs the counters of the small element limiter and the histogram of the cached moves at the start of a move. */
+void PrintLine::printQueueTelemetry() {
+    Com::printF(PSTR("Queue telemetry: segments = "), queueTelemetrySegments);
+    Com::printF(PSTR(", slowed = "), queueTelemetrySlowed);
+    Com::printF(PSTR(", added = "), queueTelemetryAddedTime / 1000);
+    Com::printF(PSTR(" [ms], low water = "), (int)(queueTelemetrySegments ? queueTelemetryLowWater : 0));
+    Com::printFLN(PSTR(", MOVE_CACHE_LOW = "), (int)MOVE_CACHE_LOW);
+    Com::printF(PSTR("Queue telemetry: cached moves"));
+    for (uint8_t i = 0; i < QUEUE_TELEMETRY_SLOTS; i++) {
+        Com::printF(PSTR(" "), (int)(i * QUEUE_TELEMETRY_SLOT_WIDTH));
+        Com::printF(PSTR("-"), (int)((i + 1) * QUEUE_TELEMETRY_SLOT_WIDTH - 1));
+        Com::printF(PSTR(":"), queueTelemetryHistogram[i]);
+    }
+    Com::println();
+} // printQueueTelemetry
+
+/** \brief Outputs the telemetry every queueTelemetryReportInterval seconds as long as moves are cached. */
+void PrintLine::reportQueueTelemetry(millis_t now) {
+    static millis_t lastReport = 0;
+    if (!queueTelemetryReportInterval || !hasLines())
+        return;
+    if (now - lastReport < (millis_t)queueTelemetryReportInterval * 1000)
+        return;
+    lastReport = now;
+    printQueueTelemetry();
+} // reportQueueTelemetry
+#endif // FEATURE_QUEUE_TELEMETRY
+
 /** \brief Put a move to the current destination coordinates into the movement cache.
   If the cache is full, the method will wait, until a place gets free. During
   wait communication and temperature control is enabled.
@@ -89,6 +240,11 @@ uint8_t PrintLine::linesPos = 0;            // Position for executing line movem
    Otherwise the endstop causes an ignore of moving that axis but coordinates will move
  */
 void PrintLine::prepareQueueMove(uint8_t abortAtEndstops, uint8_t pathOptimize, float feedrate) {
+#if FEATURE_SEGMENT_Z_COMPENSATION
+    if (!abortAtEndstops && splitForSegmentDepth(pathOptimize, feedrate))
+        return;
+#endif // FEATURE_SEGMENT_Z_COMPENSATION
+
     Printer::unmarkAllSteppersDisabled(); // ??? hier wird nichts enabled. Nur markiert, auch wenn später oder früher "enablestepper" passiert.
     //evtl. weil dadurch in jedem fall gleich ein stepper aktiviert werden würde -> darum hier schon als aktiv markieren, weil umumgänglich ist.
     // Aber dann müsste man das (timingsicher) auch schon in den Funktionen über prepareDirectMove erledigt haben.
@@ -114,6 +270,11 @@ void PrintLine::prepareQueueMove(uint8_t abortAtEndstops, uint8_t pathOptimize,
         }
     }
 
+#if FEATURE_SEGMENT_Z_COMPENSATION
+    long xStartSteps = lroundf(Printer::destinationMMLast[X_AXIS] * Printer::axisStepsPerMM[X_AXIS]);
+    long yStartSteps = lroundf(Printer::destinationMMLast[Y_AXIS] * Printer::axisStepsPerMM[Y_AXIS]);
+#endif // FEATURE_SEGMENT_Z_COMPENSATION
+
     float axisDistanceMM[4]; // Axis movement in mm
     // Find direction
     bool isNoStepsMove = true;
@@ -230,6 +391,12 @@ void PrintLine::prepareQueueMove(uint8_t abortAtEndstops, uint8_t pathOptimize,
         p->primaryAxis = E_AXIS;
     p->stepsRemaining = p->delta[p->primaryAxis];
 
+#if FEATURE_SEGMENT_Z_COMPENSATION
+    p->computeSegmentDepth(xStartSteps, yStartSteps,
+        lroundf(Printer::destinationMMLast[X_AXIS] * Printer::axisStepsPerMM[X_AXIS]),
+        lroundf(Printer::destinationMMLast[Y_AXIS] * Printer::axisStepsPerMM[Y_AXIS]));
+#endif // FEATURE_SEGMENT_Z_COMPENSATION
+
     if (p->isXYZMove()) {
         float xydist2 = axisDistanceMM[X_AXIS] * axisDistanceMM[X_AXIS] + axisDistanceMM[Y_AXIS] * axisDistanceMM[Y_AXIS];
         if (p->isZMove())
@@ -252,6 +419,71 @@ void PrintLine::prepareQueueMove(uint8_t abortAtEndstops, uint8_t pathOptimize,
     pushLine();
 } // prepareQueueMove
 
+#if FEATURE_SEGMENT_Z_COMPENSATION
+/** \brief Splits the move to destinationMM into parts which are not longer than one cell of the z-matrix.
+The depth is interpolated linearly along every move, so this keeps the error of the bilinear matrix small. Returns true if the parts were queued. */
+bool PrintLine::splitForSegmentDepth(uint8_t pathOptimize, float feedrate) {
+    if (!Printer::doHeatBedZCompensation)
+        return false;
+#if FEATURE_MILLING_MODE
+    if (Printer::operatingMode != OPERATING_MODE_PRINT)
+        return false;
+#endif // FEATURE_MILLING_MODE
+
+    // above g_maxZCompensationSteps the compensation does not follow the matrix, so the parts would only fill the queue
+    float zMM = RMath::min(Printer::destinationMM[Z_AXIS], Printer::destinationMMLast[Z_AXIS]);
+    if (zMM * Printer::axisStepsPerMM[Z_AXIS] >= (float)g_maxZCompensationSteps)
+        return false;
+
+    float pitch = getZMatrixCellPitchMM();
+    if (pitch <= 0)
+        return false;
+
+    float dx = Printer::destinationMM[X_AXIS] - Printer::destinationMMLast[X_AXIS];
+    float dy = Printer::destinationMM[Y_AXIS] - Printer::destinationMMLast[Y_AXIS];
+    float length = sqrt(dx * dx + dy * dy);
+    if (length <= pitch)
+        return false;
+
+    uint16_t parts = (uint16_t)(length / pitch) + 1;
+    float startMM[4], endMM[4];
+    for (uint8_t axis = 0; axis < 4; axis++) {
+        startMM[axis] = Printer::destinationMMLast[axis];
+        endMM[axis] = Printer::destinationMM[axis];
+    }
+    for (uint16_t part = 1; part < parts; part++) {
+        float factor = (float)part / (float)parts;
+        for (uint8_t axis = 0; axis < 4; axis++)
+            Printer::destinationMM[axis] = startMM[axis] + (endMM[axis] - startMM[axis]) * factor;
+        prepareQueueMove(false, pathOptimize, feedrate);
+    }
+    for (uint8_t axis = 0; axis < 4; axis++)
+        Printer::destinationMM[axis] = endMM[axis];
+    prepareQueueMove(false, pathOptimize, feedrate);
+    return true;
+} // splitForSegmentDepth
+
+/** \brief Computes the z-matrix depth at the start of the move and its change per primary axis step. Positions are queue steps. */
+void PrintLine::computeSegmentDepth(long xStart, long yStart, long xEnd, long yEnd) {
+    depthValid = false;
+    if (!Printer::doHeatBedZCompensation || !isXOrYMove() || !stepsRemaining)
+        return;
+#if FEATURE_MILLING_MODE
+    if (Printer::operatingMode != OPERATING_MODE_PRINT)
+        return;
+#endif // FEATURE_MILLING_MODE
+
+    long start = getZMatrixDepth(xStart, yStart);
+    long change = getZMatrixDepth(xEnd, yEnd) - start;
+    if (labs(change) >= 32768)
+        return; // the 16.16 interpolation in the stepper interrupt would overflow
+
+    depthStart = (int16_t)start;
+    depthSlope = (change << 16) / stepsRemaining;
+    depthValid = true;
+} // computeSegmentDepth
+#endif // FEATURE_SEGMENT_Z_COMPENSATION
+
 void PrintLine::prepareDirectMove(bool stoppable, bool feedrateSource) {
     if (direct.task) {
         // Do not overwrite a running directstep process.
@@ -338,11 +570,22 @@ void PrintLine::calculateMove(float axisDistanceMM[], fast8_t drivingAxis, float
         return;
     }
     float timeForMove = (float)(F_CPU)*distance / feedrate; // time is in ticks
+#if FEATURE_QUEUE_TELEMETRY
+    float addedTicks = 0;
+#endif // FEATURE_QUEUE_TELEMETRY
     // Small element limiter: This was not present in directmove but is not harmfull.
     if (linesCount < MOVE_CACHE_LOW && timeForMove < LOW_TICKS_PER_MOVE) // Limit speed to keep cache full.
     {
-        timeForMove += ((LOW_TICKS_PER_MOVE - timeForMove)) * 3 / (linesCount + 1); // Increase time if queue gets empty. Add more time if queue gets smaller.
+        float extraTime = ((LOW_TICKS_PER_MOVE - timeForMove)) * 3 / (linesCount + 1); // Increase time if queue gets empty. Add more time if queue gets smaller.
+        timeForMove += extraTime;
+#if FEATURE_QUEUE_TELEMETRY
+        addedTicks = extraTime;
+#endif // FEATURE_QUEUE_TELEMETRY
     }
+#if FEATURE_QUEUE_TELEMETRY
+    if (this != &direct)
+        addQueueTelemetry(linesCount, addedTicks);
+#endif // FEATURE_QUEUE_TELEMETRY
     timeInTicks = timeForMove;
 
     // Compute the solwest allowed interval (ticks/step), so maximum feedrate is not violated
@@ -382,6 +625,9 @@ void PrintLine::calculateMove(float axisDistanceMM[], fast8_t drivingAxis, float
         timeForMove = (float)limitInterval * (float)stepsRemaining; // for large z-distance this overflows with long computation
     }
     float inverseTimeS = static_cast<float>(F_CPU) / timeForMove;
+#if PACKED_PRINTLINE
+    float speedX, speedY, speedZ, speedE; // not stored, axisSpeed() derives them from the steps
+#endif // PACKED_PRINTLINE
     if (isXMove()) {
         axisInterval[X_AXIS] = static_cast<int32_t>(timeForMove / (axisDistanceMM[X_AXIS] * Printer::axisStepsPerMM[X_AXIS]));
         speedX = axisDistanceMM[X_AXIS] * inverseTimeS;
@@ -429,12 +675,26 @@ void PrintLine::calculateMove(float axisDistanceMM[], fast8_t drivingAxis, float
     // Errors for delta move are initialized in timer (except extruder)
     error[X_AXIS] = error[Y_AXIS] = error[Z_AXIS] = delta[primaryAxis] >> 1;
 
+#if !PACKED_PRINTLINE
     invFullSpeed = 1.0 / fullSpeed;
+#endif // !PACKED_PRINTLINE
     accelerationPrim = slowestAxisPlateauTimeRepro / axisInterval[primaryAxis]; // a = v/t = F_CPU/(c*t): Steps/s^2
 
     // Now we can calculate the new primary axis acceleration, so that the slowest axis max acceleration is not violated
     // Im Interrupt steht quasi die Formel v = a * t / 2^18, darum hier die 262144
-    fAcceleration = 262144.0 * (float)accelerationPrim / F_CPU;                                        // will overflow without float!
+    fAcceleration = 262144.0 * (float)accelerationPrim / F_CPU; // will overflow without float!
+#if FIXED_POINT_PLANNER
+    float safe = safeSpeed(drivingAxis);
+    if (safe > feedrate) {
+        safe = feedrate;
+    }
+    fullSpeed2 = toSpeed2(fullSpeed * fullSpeed);
+    accelerationDistance2 = toSpeed2(2.0 * distance * slowestAxisPlateauTimeRepro * fullSpeed / ((float)F_CPU));
+    startSpeed2 = endSpeed2 = minSpeed2 = toSpeed2(safe * safe);
+    // Can accelerate to full speed within the line
+    if (addSpeed2(startSpeed2, accelerationDistance2) >= fullSpeed2)
+        setNominalMove();
+#else
     accelerationDistance2 = 2.0 * distance * slowestAxisPlateauTimeRepro * fullSpeed / ((float)F_CPU); // mm^2/s^2
     startSpeed = endSpeed = minSpeed = safeSpeed(drivingAxis);
     if (startSpeed > feedrate) {
@@ -443,13 +703,43 @@ void PrintLine::calculateMove(float axisDistanceMM[], fast8_t drivingAxis, float
     // Can accelerate to full speed within the line
     if (startSpeed * startSpeed + accelerationDistance2 >= fullSpeed * fullSpeed)
         setNominalMove();
+#endif // FIXED_POINT_PLANNER
 
     vMax = F_CPU / fullIntervalb; // maximum steps per second, we can reach
+#if ADAPTIVE_STEP_PACKING
+    // the stepper interrupt never gets faster than 512 ticks per call
+    ticks_t packingInterval = RMath::max(fullIntervalb, (ticks_t)512);
+    ticks_t packedInterval = packingInterval;
+    uint16_t minInterval = stepsPackingMinInterval();
+    stepsPacking = 1;
+    while (packedInterval < minInterval) {
+        packedInterval += packingInterval;
+        stepsPacking++;
+    }
+#endif // ADAPTIVE_STEP_PACKING
     // if(p->vMax>46000)            // gets overflow in N computation
     // p->vMax = 46000;
     // p->plateauN = (p->vMax*p->vMax/p->accelerationPrim)>>1;
 
 #if USE_ADVANCE
+#if FEATURE_SEGMENT_ADVANCE
+    if (!isXYZMove() || !isEPositiveMove()) { // No head move or E move only or sucking filament back
+        advanceFull = advanceQuadratic = 0;
+        advanceSmoothSteps = 0;
+    } else {
+        float eSpeed = fabs(speedE);
+        float toSteps = 0.001 * Printer::axisStepsPerMM[E_AXIS];
+        float advlin = eSpeed * Extruder::current->advanceL * toSteps;
+        float advquad = eSpeed * eSpeed * Extruder::current->advanceK * toSteps;
+        advanceQuadratic = RMath::min(advquad, 16000.0f);
+        advanceFull = advanceQuadratic + RMath::min(advlin, 16000.0f);
+        advanceSmoothSteps = RMath::min(Printer::advanceSmoothingTime * 0.001 * vMax, 65535.0f);
+        if (advlin + advquad > maxadv2) {
+            maxadv2 = advlin + advquad;
+            maxadvspeed = eSpeed;
+        }
+    }
+#else
     if (!isXYZMove() || !isEPositiveMove()) { // No head move or E move only or sucking filament back
         advanceL = 0;
     } else {
@@ -460,6 +750,7 @@ void PrintLine::calculateMove(float axisDistanceMM[], fast8_t drivingAxis, float
             maxadvspeed = fabs(speedE);
         }
     }
+#endif // FEATURE_SEGMENT_ADVANCE
 #endif // USE_ADVANCE
 
     DEBUG_MEMORY;
@@ -475,6 +766,7 @@ The first 2 entries in the queue are not checked. The first is the one that is a
 The method is called before linesCount is increased!
 */
 void PrintLine::updateTrapezoids() {
+    PLANNER_TIMING(PLANNER_TIMING_TRAPEZOIDS)
     uint8_t first = linesWritePos;
     PrintLine* firstLine;
     PrintLine* act = &lines[linesWritePos];
@@ -623,6 +915,7 @@ Speed from 100 to 200
 */
 
 inline void PrintLine::computeMaxJunctionSpeed(PrintLine* previous, PrintLine* current) {
+    PLANNER_TIMING(PLANNER_TIMING_JUNCTION)
     // if we are here we have two identical move types
     // either pure extrusion -> pure extrusion or
     // move -> move (with or without extrusion)
@@ -635,32 +928,58 @@ inline void PrintLine::computeMaxJunctionSpeed(PrintLine* previous, PrintLine* c
         lengthFactor = static_cast<float>(MAX_JERK_DISTANCE * MAX_JERK_DISTANCE) / (previous->distance * previous->distance);
 #endif
     float maxJoinSpeed = RMath::min(current->fullSpeed, previous->fullSpeed);
-
+    float currentSpeed[4], previousSpeed[4];
+    current->getAxisSpeeds(currentSpeed);
+    previous->getAxisSpeeds(previousSpeed);
+
+#if FEATURE_JUNCTION_DEVIATION
+    if (Printer::junctionMode == JUNCTION_MODE_DEVIATION && previous->isXYZMove() && current->isXYZMove()) {
+        // The corner is passed on an arc touching both segments, which has junctionDeviation distance to the corner.
+        // v² = a * r with r = junctionDeviation * sin(theta/2) / (1 - sin(theta/2)), theta is the angle between the segments.
+        float cosTheta = -(currentSpeed[X_AXIS] * previousSpeed[X_AXIS] + currentSpeed[Y_AXIS] * previousSpeed[Y_AXIS] + currentSpeed[Z_AXIS] * previousSpeed[Z_AXIS]) / (current->fullSpeed * previous->fullSpeed);
+        float sinThetaD2 = sqrt(0.5f * (1.0f - RMath::min(cosTheta, 1.0f)));
+        if (sinThetaD2 < 0.999f) { // else it is a straight line
+            float acceleration = RMath::min(previous->pathAcceleration(), current->pathAcceleration());
+            float junctionSpeed = sqrt(acceleration * Printer::junctionDeviation * sinThetaD2 / (1.0f - sinThetaD2));
+            // same lower limit as for the jerk computation, the segments start with at least half of the jerk
+            junctionSpeed = RMath::max(junctionSpeed, Printer::maxXYJerk * 0.5f);
+            if (junctionSpeed < maxJoinSpeed)
+                factor = junctionSpeed / maxJoinSpeed;
+        }
+    } else
+#endif // FEATURE_JUNCTION_DEVIATION
+    {
 #if ALTERNATIVE_JERK
-    float calculatedJerk = maxJoinSpeed * lengthFactor * (1.0 - (current->speedX * previous->speedX + current->speedY * previous->speedY + current->speedZ * previous->speedZ) / (current->fullSpeed * previous->fullSpeed));
+        float calculatedJerk = maxJoinSpeed * lengthFactor * (1.0 - (currentSpeed[X_AXIS] * previousSpeed[X_AXIS] + currentSpeed[Y_AXIS] * previousSpeed[Y_AXIS] + currentSpeed[Z_AXIS] * previousSpeed[Z_AXIS]) / (current->fullSpeed * previous->fullSpeed));
 #else
-    float dx = current->speedX - previous->speedX;
-    float dy = current->speedY - previous->speedY;
-    float calculatedJerk = sqrt(dx * dx + dy * dy) * lengthFactor;
+        float dx = currentSpeed[X_AXIS] - previousSpeed[X_AXIS];
+        float dy = currentSpeed[Y_AXIS] - previousSpeed[Y_AXIS];
+        float calculatedJerk = sqrt(dx * dx + dy * dy) * lengthFactor;
 #endif // ALTERNATIVE_JERK
 
-    if (calculatedJerk > Printer::maxXYJerk) {
-        factor = Printer::maxXYJerk / calculatedJerk; // always < 1.0!
-        if (factor * maxJoinSpeed * 2.0 < Printer::maxXYJerk)
-            factor = Printer::maxXYJerk / (2.0 * maxJoinSpeed);
+        if (calculatedJerk > Printer::maxXYJerk) {
+            factor = Printer::maxXYJerk / calculatedJerk; // always < 1.0!
+            if (factor * maxJoinSpeed * 2.0 < Printer::maxXYJerk)
+                factor = Printer::maxXYJerk / (2.0 * maxJoinSpeed);
+        }
     }
 
     if ((previous->dir | current->dir) & 64 /* previous zmove oder current zmove */) {
-        float zJerk = fabs(current->speedZ - previous->speedZ);
+        float zJerk = fabs(currentSpeed[Z_AXIS] - previousSpeed[Z_AXIS]);
         if (zJerk > Printer::maxZJerk)
             factor = RMath::min(factor, Printer::maxZJerk / zJerk);
     }
 
-    float eJerk = fabs(current->speedE - previous->speedE);
+    float eJerk = fabs(currentSpeed[E_AXIS] - previousSpeed[E_AXIS]);
     if (eJerk > Extruder::current->maxEJerk) {
         factor = RMath::min(factor, Extruder::current->maxEJerk / eJerk);
     }
+#if FIXED_POINT_PLANNER
+    maxJoinSpeed *= factor;
+    previous->maxJunctionSpeed2 = toSpeed2(maxJoinSpeed * maxJoinSpeed); // set speed limit
+#else
     previous->maxJunctionSpeed = maxJoinSpeed * factor; // set speed limit
+#endif // FIXED_POINT_PLANNER
 } // computeMaxJunctionSpeed
 
 /** \brief Update parameter used by updateTrapezoids
@@ -669,23 +988,37 @@ Computes the acceleration/deceleration steps and advanced parameter associated.
 void PrintLine::updateStepsParameter() {
     if (areParameterUpToDate() || isWarmUp())
         return;
+    PLANNER_TIMING(PLANNER_TIMING_STEPS_PARAMETER)
 
-    float startFactor = startSpeed * invFullSpeed;
-    float endFactor = endSpeed * invFullSpeed;
+    uint32_t vmax2 = HAL::U16SquaredToU32(vMax);
+    float inverseFullSpeed = getInvFullSpeed();
+
+#if FIXED_POINT_PLANNER
+    // vStart = vMax * startSpeed / fullSpeed, but computed from the squared speeds of the planner
+    float speed2ToFactor2 = (float)vmax2 * inverseFullSpeed * inverseFullSpeed / (float)(1L << SPEED2_FRACTION_BITS);
+    uint32_t vStart2 = RMath::min((uint32_t)(startSpeed2 * speed2ToFactor2), vmax2);
+    uint32_t vEnd2 = RMath::min((uint32_t)(endSpeed2 * speed2ToFactor2), vmax2);
+    vStart = HAL::integerSqrt(vStart2); // starting speed
+    vEnd = HAL::integerSqrt(vEnd2);
+#else
+    float startFactor = startSpeed * inverseFullSpeed;
+    float endFactor = endSpeed * inverseFullSpeed;
     vStart = vMax * startFactor; // starting speed
     vEnd = vMax * endFactor;
 
-    uint32_t vmax2 = HAL::U16SquaredToU32(vMax);
+    uint32_t vStart2 = HAL::U16SquaredToU32(vStart);
+    uint32_t vEnd2 = HAL::U16SquaredToU32(vEnd);
+#endif // FIXED_POINT_PLANNER
 
-    if (vStart == vMax) {
+    if (vStart2 >= vmax2) {
         accelSteps = 0;
     } else {
-        accelSteps = ((vmax2 - HAL::U16SquaredToU32(vStart)) / (accelerationPrim << 1)) + 1; // Always add 1 for missing precision
+        accelSteps = ((vmax2 - vStart2) / (accelerationPrim << 1)) + 1; // Always add 1 for missing precision
     }
-    if (vEnd == vMax) {
+    if (vEnd2 >= vmax2) {
         decelSteps = 0;
     } else {
-        decelSteps = ((vmax2 - HAL::U16SquaredToU32(vEnd)) / (accelerationPrim << 1)) + 1;
+        decelSteps = ((vmax2 - vEnd2) / (accelerationPrim << 1)) + 1;
     }
 
     if (static_cast<int32_t>(accelSteps + decelSteps) > stepsRemaining) // can't reach limit speed
@@ -694,9 +1027,89 @@ void PrintLine::updateStepsParameter() {
         accelSteps = accelSteps - RMath::min(static_cast<int32_t>(accelSteps), static_cast<int32_t>(red));
         decelSteps = decelSteps - RMath::min(static_cast<int32_t>(decelSteps), static_cast<int32_t>(red));
     }
+#if FEATURE_S_CURVE_ACCELERATION
+    sCurveAccelRecip = sCurveDecelRecip = 0;
+    if (Printer::sCurveMode && isXYZMove()) {
+        // the ramps may end below vMax, so the S-curve needs the speed really reached: vPeak² = vStart² + 2 * a * accelSteps
+        uint32_t rise = (accelerationPrim << 1) * accelSteps;
+        vPeak = HAL::integerSqrt(rise >= vmax2 - RMath::min(vStart2, vmax2) ? vmax2 : vStart2 + rise);
+        if (vPeak > vStart)
+            sCurveAccelRecip = (1UL << 24) / (vPeak - vStart);
+        if (vPeak > vEnd)
+            sCurveDecelRecip = (1UL << 24) / (vPeak - vEnd);
+    }
+#endif // FEATURE_S_CURVE_ACCELERATION
+#if USE_ADVANCE && FEATURE_SEGMENT_ADVANCE
+    computeAdvanceTargets();
+#endif // USE_ADVANCE && FEATURE_SEGMENT_ADVANCE
+#if STEP_INTERVAL_TABLES
+    computeIntervalTables();
+#if FEATURE_S_CURVE_ACCELERATION
+    if (sCurveAccelRecip || sCurveDecelRecip)
+        accelShift = decelShift = NO_STEP_INTERVAL_TABLE; // the tables only know linear ramps
+#endif // FEATURE_S_CURVE_ACCELERATION
+#endif // STEP_INTERVAL_TABLES
     setParameterUpToDate();
 } // updateStepsParameter
 
+#if USE_ADVANCE && FEATURE_SEGMENT_ADVANCE
+/** \brief Advance steps at speed v: advanceFull splits into a linear and a quadratic part of v / vMax, which is used in 1/256. */
+int16_t PrintLine::advanceAtSpeed(speed_t v) {
+    if (!vMax || v >= vMax)
+        return advanceFull;
+    uint32_t ratio = ((uint32_t)v << 8) / vMax;
+    uint32_t linear = ((uint32_t)(advanceFull - advanceQuadratic) * ratio) >> 8;
+    uint32_t quadratic = ((uint32_t)advanceQuadratic * ratio * ratio) >> 16;
+    return (int16_t)(linear + quadratic);
+} // advanceAtSpeed
+
+/** \brief Computes the advance targets of the ramps. A change of the advance lasts at least advanceSmoothSteps, so short ramps
+get a flatter advance which starts earlier in the deceleration and ends later in the acceleration. */
+void PrintLine::computeAdvanceTargets() {
+    advanceStart = advanceAtSpeed(vStart);
+    advanceEnd = advanceAtSpeed(vEnd);
+
+    uint32_t totalSteps = static_cast<uint32_t>(stepsRemaining);
+    advanceAccelSpan = RMath::min(RMath::max(accelSteps, (uint32_t)advanceSmoothSteps), totalSteps);
+    advanceDecelSpan = RMath::min(RMath::max(decelSteps, (uint32_t)advanceSmoothSteps), totalSteps);
+    advanceAccelSlope = (advanceAccelSpan ? ((uint32_t)(advanceFull - advanceStart) << 16) / advanceAccelSpan : 0);
+    advanceDecelSlope = (advanceDecelSpan ? ((uint32_t)(advanceFull - advanceEnd) << 16) / advanceDecelSpan : 0);
+} // computeAdvanceTargets
+#endif // USE_ADVANCE && FEATURE_SEGMENT_ADVANCE
+
+#if STEP_INTERVAL_TABLES
+/** \brief Fills one ramp table with the intervals at every 2^shift steps. v² = vLow² + 2 * a * n gives the speed after n steps.
+Returns false if the ramp is too long or too slow for 16 bit intervals, then the stepper interrupt computes the speed as usual. */
+bool PrintLine::fillIntervalTable(uint16_t* table, uint32_t rampSteps, speed_t vLow, uint8_t& shift) {
+    uint8_t s = 0;
+    while ((rampSteps >> s) >= STEP_INTERVAL_TABLE_SIZE)
+        s++;
+    if (s > 15)
+        return false;
+
+    float vLow2 = (float)vLow * (float)vLow;
+    float vMax2 = (float)vMax * (float)vMax;
+    float accelerationPerEntry2 = 2.0f * (float)accelerationPrim * (float)(1UL << s);
+    for (uint8_t i = 0; i <= STEP_INTERVAL_TABLE_SIZE; i++) {
+        float v2 = RMath::min(vLow2 + accelerationPerEntry2 * i, vMax2);
+        if (v2 < 1.0f)
+            return false;
+        float interval = (float)F_CPU / sqrt(v2);
+        if (interval > 65535.0f)
+            return false;
+        table[i] = (uint16_t)interval;
+    }
+    shift = s;
+    return true;
+} // fillIntervalTable
+
+void PrintLine::computeIntervalTables() {
+    if (!fillIntervalTable(accelIntervals, accelSteps, vStart, accelShift) || !fillIntervalTable(decelIntervals, decelSteps, vEnd, decelShift)) {
+        accelShift = decelShift = NO_STEP_INTERVAL_TABLE;
+    }
+} // computeIntervalTables
+#endif // STEP_INTERVAL_TABLES
+
 /** \brief
 Compute the maximum speed from the last entered move.
 The backwards planner traverses the moves from last to first looking at deceleration. The RHS of the accelerate/decelerate ramp.
@@ -705,7 +1118,43 @@ start = last line inserted
 last = last element until we check
 */
 inline void PrintLine::backwardPlanner(uint8_t start, uint8_t last) {
+    PLANNER_TIMING(PLANNER_TIMING_BACKWARD)
     PrintLine *act = &lines[start], *previous;
+#if FIXED_POINT_PLANNER
+    speed2_t lastJunctionSpeed2 = act->endSpeed2; // Start always with safe speed
+
+    while (start != last) {
+        previousPlannerIndex(start);
+        previous = &lines[start];
+        previous->block();
+        // Same as the float planner, but v² + 2*a*s needs no sqrt() and the comparisons work on the squares as well
+        lastJunctionSpeed2 = (act->isNominalMove() ? act->fullSpeed2 : addSpeed2(lastJunctionSpeed2, act->accelerationDistance2));
+
+        // If that speed is more that the maximum junction speed allowed then ...
+        if (lastJunctionSpeed2 >= previous->maxJunctionSpeed2) // Limit is reached
+        {
+            // If the previous line's end speed has not been updated to maximum speed then do it now
+            if (previous->endSpeed2 != previous->maxJunctionSpeed2) {
+                previous->invalidateParameter(); // Needs recomputation
+                previous->endSpeed2 = RMath::max(previous->minSpeed2, previous->maxJunctionSpeed2);
+            }
+
+            // If actual line start speed has not been updated to maximum speed then do it now
+            if (act->startSpeed2 != previous->maxJunctionSpeed2) {
+                act->startSpeed2 = RMath::max(act->minSpeed2, previous->maxJunctionSpeed2);
+                act->invalidateParameter();
+            }
+            lastJunctionSpeed2 = previous->endSpeed2;
+        } else {
+            // Block prev end and act start as calculated speed and recalculate plateau speeds (which could move the speed higher again)
+            act->startSpeed2 = RMath::max(act->minSpeed2, lastJunctionSpeed2);
+            lastJunctionSpeed2 = previous->endSpeed2 = RMath::max(lastJunctionSpeed2, previous->minSpeed2);
+            previous->invalidateParameter();
+            act->invalidateParameter();
+        }
+        act = previous;
+    } // while loop
+#else
     float lastJunctionSpeed = act->endSpeed; // Start always with safe speed
 
     while (start != last) {
@@ -740,12 +1189,53 @@ inline void PrintLine::backwardPlanner(uint8_t start, uint8_t last) {
         }
         act = previous;
     } // while loop
-
+#endif // FIXED_POINT_PLANNER
 } // backwardPlanner
 
 void PrintLine::forwardPlanner(uint8_t first) {
+    PLANNER_TIMING(PLANNER_TIMING_FORWARD)
     PrintLine* act;
     PrintLine* next = &lines[first];
+#if FIXED_POINT_PLANNER
+    speed2_t vmaxRight2;
+    speed2_t leftSpeed2 = next->startSpeed2;
+    while (first != linesWritePos) // All except last segment, which has fixed end speed
+    {
+        act = next;
+        nextPlannerIndex(first);
+        next = &lines[first];
+        // Avoid speed calculate if we know we can accelerate within the line.
+        vmaxRight2 = (act->isNominalMove() ? act->fullSpeed2 : addSpeed2(leftSpeed2, act->accelerationDistance2));
+        if (vmaxRight2 > act->endSpeed2) // Could be higher next run?
+        {
+            if (leftSpeed2 < act->minSpeed2) {
+                leftSpeed2 = act->minSpeed2;
+                act->endSpeed2 = addSpeed2(leftSpeed2, act->accelerationDistance2);
+            }
+            act->startSpeed2 = leftSpeed2;
+            next->startSpeed2 = leftSpeed2 = RMath::max(RMath::min(act->endSpeed2, act->maxJunctionSpeed2), next->minSpeed2);
+            if (act->endSpeed2 == act->maxJunctionSpeed2) // Full speed reached, don't compute again!
+            {
+                act->setEndSpeedFixed(true);
+                next->setStartSpeedFixed(true);
+            }
+            act->invalidateParameter();
+        } else // We can accelerate full speed without reaching limit, which is as fast as possible. Fix it!
+        {
+            act->fixStartAndEndSpeed();
+            act->invalidateParameter();
+            if (act->minSpeed2 > leftSpeed2) {
+                leftSpeed2 = act->minSpeed2;
+                vmaxRight2 = addSpeed2(leftSpeed2, act->accelerationDistance2);
+            }
+            act->startSpeed2 = leftSpeed2;
+            act->endSpeed2 = RMath::max(act->minSpeed2, vmaxRight2);
+            next->startSpeed2 = leftSpeed2 = RMath::max(RMath::min(act->endSpeed2, act->maxJunctionSpeed2), next->minSpeed2);
+            next->setStartSpeedFixed(true);
+        }
+    }                                                              // While
+    next->startSpeed2 = RMath::max(next->minSpeed2, leftSpeed2); // This is the new segment, wgich is updated anyway, no extra flag needed.
+#else
     float vmaxRight;
     float leftSpeed = next->startSpeed;
     while (first != linesWritePos) // All except last segment, which has fixed end speed
@@ -784,6 +1274,7 @@ void PrintLine::forwardPlanner(uint8_t first) {
         }
     }                                                         // While
     next->startSpeed = RMath::max(next->minSpeed, leftSpeed); // This is the new segment, wgich is updated anyway, no extra flag needed.
+#endif // FIXED_POINT_PLANNER
 } // forwardPlanner
 
 inline float PrintLine::safeSpeed(fast8_t drivingAxis) {
@@ -793,15 +1284,16 @@ inline float PrintLine::safeSpeed(fast8_t drivingAxis) {
     if (isZMove()) {
         mz = Printer::maxZJerk * 0.5f;
         if (isXOrYMove()) {
-            if (fabs(speedZ) > mz)
-                safe = RMath::min(safe, mz * fullSpeed / fabs(speedZ));
+            float speedZ = fabs(getSpeedZ());
+            if (speedZ > mz)
+                safe = RMath::min(safe, mz * fullSpeed / speedZ);
         } else {
             safe = mz;
         }
     }
     if (isEMove()) {
         if (isXYZMove())
-            safe = RMath::min(safe, 0.5f * Extruder::current->maxEJerk * fullSpeed / fabs(speedE));
+            safe = RMath::min(safe, 0.5f * Extruder::current->maxEJerk * fullSpeed / fabs(getSpeedE()));
         else
             safe = 0.5f * Extruder::current->maxEJerk; // This is a retraction move
     }
@@ -1206,7 +1698,11 @@ long PrintLine::performQueueMove() {
         HAL::forbidInterrupts();
 
 #if USE_ADVANCE
+#if FEATURE_SEGMENT_ADVANCE
+        cur->updateSegmentAdvance(FOR_QUEUE);
+#else
         cur->updateAdvanceSteps(cur->vStart); //startet advance extruder "etwas" vor der ersten bewegung: gut? ist Printer::interval immer klein genug?
+#endif                                        // FEATURE_SEGMENT_ADVANCE
 #endif                                        // USE_ADVANCE
 
         return (Printer::interval >> 1); //wait 50% to next interrupt.
@@ -1217,7 +1713,11 @@ long PrintLine::performQueueMove() {
         Printer::v = cur->fullSpeed;
         cur->adjustDirections();
 #if USE_ADVANCE
+#if FEATURE_SEGMENT_ADVANCE
+        cur->updateSegmentAdvance(FOR_QUEUE);
+#else
         cur->updateAdvanceSteps(Printer::vMaxReached[DIR_QUEUE]);
+#endif // FEATURE_SEGMENT_ADVANCE
 #endif // USE_ADVANCE
     }
 
@@ -1402,7 +1902,11 @@ long PrintLine::performDirectMove() {
         Printer::v = direct.fullSpeed;
 
 #if USE_ADVANCE
+#if FEATURE_SEGMENT_ADVANCE
+        direct.updateSegmentAdvance(FOR_DIRECT);
+#else
         direct.updateAdvanceSteps(direct.vStart); //startet advance extruder "etwas" vor der ersten bewegung: gut? ist Printer::interval immer klein genug?
+#endif                                            // FEATURE_SEGMENT_ADVANCE
 #endif                                            // USE_ADVANCE
 
         return (Printer::interval >> 1); //wait 50% to next interrupt.
@@ -1413,18 +1917,121 @@ long PrintLine::performDirectMove() {
         Printer::v = direct.fullSpeed;
         direct.adjustDirections();
 #if USE_ADVANCE
+#if FEATURE_SEGMENT_ADVANCE
+        direct.updateSegmentAdvance(FOR_DIRECT);
+#else
         direct.updateAdvanceSteps(Printer::vMaxReached[FOR_DIRECT]);
+#endif // FEATURE_SEGMENT_ADVANCE
 #endif // USE_ADVANCE
     }
 
     return performMove(&direct, FOR_DIRECT);
 } // performDirectMove
 
+#if FEATURE_INPUT_SHAPING
+/** \brief Sets frequency and damping. ZV shaper: K = exp(-damping * pi / sqrt(1 - damping²)), A1 = 1 / (1 + K), A2 = K / (1 + K),
+the second impulse follows after half of the damped period. */
+void InputShaper::configure(float newFrequency, float newDamping) {
+    uint8_t amplitude = 128;
+    uint16_t delay = 0;
+    if (newFrequency > 0) {
+        float root = sqrt(1.0f - newDamping * newDamping);
+        float k = exp(-newDamping * M_PI / root);
+        amplitude = lroundf(128.0f / (1.0f + k));
+        delay = lroundf(500000.0f / (newFrequency * root));
+    }
+
+    InterruptProtectedBlock noInts;
+    frequency = newFrequency;
+    damping = newDamping;
+    firstAmplitude = amplitude;
+    delayUs = delay;
+    windowUs = delay >> 4;
+} // configure
+
+/** \brief Drops all impulses which are not done yet, e.g. when the print is stopped. The dropped part is taken back from the position
+of the queued moves, so it matches the steps which were really done. Only called with interrupts blocked. */
+void InputShaper::flush() {
+    int32_t pending = fraction;
+    while (count) {
+        pending += steps[tail] * (128 - (int16_t)firstAmplitude);
+        tail = (tail + 1) & (INPUT_SHAPING_QUEUE_SIZE - 1);
+        count--;
+    }
+    Printer::currentSteps[axis] -= (pending + (pending < 0 ? -64 : 64)) / 128;
+    fraction = 0;
+} // flush
+
+/** \brief Does the physical steps for the impulses added so far, at most INPUT_SHAPING_MAX_STEPS_PER_CALL per stepper interrupt.
+Only called from the stepper interrupt. */
+void InputShaper::output() {
+    for (uint8_t done = 0; done < INPUT_SHAPING_MAX_STEPS_PER_CALL; done++) {
+        int8_t dir;
+        if (fraction >= 64)
+            dir = 1;
+        else if (fraction < -64)
+            dir = -1;
+        else
+            return;
+
+        bool positive = (dir > 0);
+        bool turn = (positive != (axis == X_AXIS ? Printer::getXDirectionIsPos() : Printer::getYDirectionIsPos()));
+        if (turn && PrintLine::holdsDirectionPin(axis))
+            return; // a move without shaping steps this axis, the impulse waits until that move is done
+        if (positive ? Printer::isMaxEndstopHit(axis) : Printer::isMinEndstopHit(axis)) {
+            flush(); // the rest of the shaped motion would drive into the endstop
+            return;
+        }
+        if (done)
+            HAL::delayMicroseconds(INPUT_SHAPING_PULSE_US); // low time between two pulses
+        fraction -= dir * 128;
+        outputStep(dir, turn);
+    }
+} // output
+
+/** \brief Outputs one physical step, a change of the direction gets the setup time of the driver before the step. */
+void InputShaper::outputStep(int8_t dir, bool turn) {
+    if (axis == X_AXIS) {
+        if (turn) {
+            Printer::setXDirection(dir > 0);
+            HAL::delayMicroseconds(INPUT_SHAPING_DIR_SETUP_US);
+        }
+        Printer::startXStep(dir);
+        HAL::delayMicroseconds(INPUT_SHAPING_PULSE_US);
+        Printer::endXStep();
+    } else {
+        if (turn) {
+            Printer::setYDirection(dir > 0);
+            HAL::delayMicroseconds(INPUT_SHAPING_DIR_SETUP_US);
+        }
+        Printer::startYStep(dir);
+        HAL::delayMicroseconds(INPUT_SHAPING_PULSE_US);
+        Printer::endYStep();
+    }
+} // outputStep
+
+/** \brief Checks if a move without shaping steps the axis. Such a move takes its direction from the pin, so the shaper must not turn it. */
+bool PrintLine::holdsDirectionPin(uint8_t axis) {
+    if ((direct.task == DIRECT_RUNNING || direct.task == DIRECT_RUNNING_STOPPABLE) && direct.isMoveOfAxis(axis))
+        return true;
+    if (cur != NULL && cur->isMoveOfAxis(axis))
+        return cur->isAbortAtEndstops() || !(axis == X_AXIS ? shaperX.isActive() : shaperY.isActive());
+    return false;
+} // holdsDirectionPin
+#endif // FEATURE_INPUT_SHAPING
+
 long PrintLine::performMove(PrintLine* move, uint8_t forQueue) {
     HAL::allowInterrupts();
     fast8_t max_loops = Printer::stepsPerTimerCall;
     if (move->stepsRemaining < max_loops)
         max_loops = move->stepsRemaining;
+#if FEATURE_INPUT_SHAPING
+    processInputShaping();
+    uint16_t shapingTime = shapingNow();
+    // moves which check the endstops have to stop exactly, so they are never shaped
+    bool shapeX = forQueue && shaperX.isActive() && !move->isAbortAtEndstops();
+    bool shapeY = forQueue && shaperY.isActive() && !move->isAbortAtEndstops();
+#endif // FEATURE_INPUT_SHAPING
     HAL::forbidInterrupts();
 
     for (fast8_t loop = 0; loop < max_loops; loop++) {
@@ -1499,9 +2106,19 @@ long PrintLine::performMove(PrintLine* move, uint8_t forQueue) {
         if (move->isXMove()) {
             if ((move->error[X_AXIS] -= move->delta[X_AXIS]) < 0) {
                 HAL::allowInterrupts();
+#if FEATURE_INPUT_SHAPING
+                // the shaper owns the direction pin while a shaped move runs
+                int8_t dir = (shapeX ? (move->isXPositiveMove() ? 1 : -1) : (Printer::getXDirectionIsPos() ? 1 : -1));
+#else
                 int8_t dir = (Printer::getXDirectionIsPos() ? 1 : -1);
+#endif // FEATURE_INPUT_SHAPING
                 if (inBauraum(X_AXIS, move, forQueue)) {
-                    Printer::startXStep(dir);
+#if FEATURE_INPUT_SHAPING
+                    if (shapeX)
+                        shaperX.step(dir, shapingTime);
+                    else
+#endif // FEATURE_INPUT_SHAPING
+                        Printer::startXStep(dir);
                 }
                 HAL::forbidInterrupts();
 
@@ -1519,9 +2136,19 @@ long PrintLine::performMove(PrintLine* move, uint8_t forQueue) {
         if (move->isYMove()) {
             if ((move->error[Y_AXIS] -= move->delta[Y_AXIS]) < 0) {
                 HAL::allowInterrupts();
+#if FEATURE_INPUT_SHAPING
+                // the shaper owns the direction pin while a shaped move runs
+                int8_t dir = (shapeY ? (move->isYPositiveMove() ? 1 : -1) : (Printer::getYDirectionIsPos() ? 1 : -1));
+#else
                 int8_t dir = (Printer::getYDirectionIsPos() ? 1 : -1);
+#endif // FEATURE_INPUT_SHAPING
                 if (inBauraum(Y_AXIS, move, forQueue)) {
-                    Printer::startYStep(dir);
+#if FEATURE_INPUT_SHAPING
+                    if (shapeY)
+                        shaperY.step(dir, shapingTime);
+                    else
+#endif // FEATURE_INPUT_SHAPING
+                        Printer::startYStep(dir);
                 }
                 HAL::forbidInterrupts();
 
@@ -1591,6 +2218,9 @@ long PrintLine::performMove(PrintLine* move, uint8_t forQueue) {
         Printer::endXYZSteps();
     }                       // for loop
     HAL::allowInterrupts(); // Allow interrupts for other types, timer1 is still disabled
+#if FEATURE_INPUT_SHAPING
+    outputInputShaping();
+#endif // FEATURE_INPUT_SHAPING
 
     /***
     Printer::interval -> printers interval
@@ -1603,37 +2233,78 @@ long PrintLine::performMove(PrintLine* move, uint8_t forQueue) {
     Printer::stepNumber[forQueue] += max_loops;
     Printer::timer[forQueue] += (Printer::interval * max_loops);
 
-    //If acceleration is enabled on this move and we are in the acceleration segment, calculate the current interval
-    if (move->moveAccelerating(forQueue)) // we are accelerating
-    {
-        v = HAL::ComputeV(Printer::timer[forQueue], move->fAcceleration);
-        v += move->vStart;
-        if (v > move->vMax)
-            v = move->vMax;
-        Printer::vMaxReached[forQueue] = v;
-    } else if (move->moveDecelerating(forQueue)) // time to slow down
-    {
-        // Printer::timer got reset the first time reaching here.
-        //dieses v ist hier erst gegenbeschleunigend und wird dann gleich abgezogen -> das ist die korrektur.
-        unsigned int v_inv = HAL::ComputeV(Printer::timer[forQueue], move->fAcceleration); //hier negativgeschleunigung positiv ausgerechnet.
-        if (v_inv > Printer::vMaxReached[forQueue])                                        // if deceleration goes too far it can become too large -> schneller vorab-limiter, eigentlich Printer::vMaxReached - move-vEnd, aber wie programmiert scheints egal und schneller zu sein.
-            v = move->vEnd;
-        else {
-            v = Printer::vMaxReached[forQueue] - v_inv; //flip positive calculation to decelerated speed.
-            if (v < move->vEnd)
-                v = move->vEnd; // extra steps at the end of desceleration due to rounding errors
+#if FEATURE_SEGMENT_Z_COMPENSATION
+    if (forQueue)
+        move->updateSegmentDepth();
+#endif // FEATURE_SEGMENT_Z_COMPENSATION
+
+#if STEP_INTERVAL_TABLES
+    if (move->hasIntervalTables()) {
+        // The ramps were precomputed by the path planner, we only interpolate the interval of the current step.
+        if (move->moveAccelerating(forQueue))
+            Printer::interval = intervalFromTable(move->accelIntervals, move->accelShift, Printer::stepNumber[forQueue]);
+        else if (move->moveDecelerating(forQueue))
+            Printer::interval = intervalFromTable(move->decelIntervals, move->decelShift, move->stepsRemaining);
+        else
+            Printer::interval = intervalFromTable(move->accelIntervals, move->accelShift, move->accelSteps);
+#if USE_ADVANCE
+#if FEATURE_SEGMENT_ADVANCE
+        move->updateSegmentAdvance(forQueue);
+#else
+        if (Printer::isAdvanceActivated()) {
+            v = HAL::CPUDivU2(Printer::interval);
+            Printer::vMaxReached[forQueue] = v;
+            move->updateAdvanceSteps(v);
         }
-    } else // full speed reached
+#endif // FEATURE_SEGMENT_ADVANCE
+#endif // USE_ADVANCE
+    } else
+#endif // STEP_INTERVAL_TABLES
     {
-        // If we had acceleration, we need to use the latest vMaxReached and interval
-        // If we started full speed, we need to use move->fullInterval and vMax
-        v = (!move->accelSteps ? move->vMax : Printer::vMaxReached[forQueue]);
-    }
+        //If acceleration is enabled on this move and we are in the acceleration segment, calculate the current interval
+        if (move->moveAccelerating(forQueue)) // we are accelerating
+        {
+            v = HAL::ComputeV(Printer::timer[forQueue], move->fAcceleration);
+#if FEATURE_S_CURVE_ACCELERATION
+            if (move->sCurveAccelRecip)
+                v = sCurveSpeed(v, move->sCurveAccelRecip, move->vPeak - move->vStart);
+#endif // FEATURE_S_CURVE_ACCELERATION
+            v += move->vStart;
+            if (v > move->vMax)
+                v = move->vMax;
+            Printer::vMaxReached[forQueue] = v;
+        } else if (move->moveDecelerating(forQueue)) // time to slow down
+        {
+            // Printer::timer got reset the first time reaching here.
+            //dieses v ist hier erst gegenbeschleunigend und wird dann gleich abgezogen -> das ist die korrektur.
+            unsigned int v_inv = HAL::ComputeV(Printer::timer[forQueue], move->fAcceleration); //hier negativgeschleunigung positiv ausgerechnet.
+#if FEATURE_S_CURVE_ACCELERATION
+            if (move->sCurveDecelRecip)
+                v_inv = sCurveSpeed(v_inv, move->sCurveDecelRecip, move->vPeak - move->vEnd);
+#endif // FEATURE_S_CURVE_ACCELERATION
+            if (v_inv > Printer::vMaxReached[forQueue])                                        // if deceleration goes too far it can become too large -> schneller vorab-limiter, eigentlich Printer::vMaxReached - move-vEnd, aber wie programmiert scheints egal und schneller zu sein.
+                v = move->vEnd;
+            else {
+                v = Printer::vMaxReached[forQueue] - v_inv; //flip positive calculation to decelerated speed.
+                if (v < move->vEnd)
+                    v = move->vEnd; // extra steps at the end of desceleration due to rounding errors
+            }
+        } else // full speed reached
+        {
+            // If we had acceleration, we need to use the latest vMaxReached and interval
+            // If we started full speed, we need to use move->fullInterval and vMax
+            v = (!move->accelSteps ? move->vMax : Printer::vMaxReached[forQueue]);
+        }
 #if USE_ADVANCE
-    move->updateAdvanceSteps(v);
+#if FEATURE_SEGMENT_ADVANCE
+        move->updateSegmentAdvance(forQueue);
+#else
+        move->updateAdvanceSteps(v);
+#endif // FEATURE_SEGMENT_ADVANCE
 #endif // USE_ADVANCE
 
-    Printer::interval = HAL::CPUDivU2(v);
+        Printer::interval = HAL::CPUDivU2(v);
+    }
 
     // Dieses Limit bedeutet max. 31250 steps/s bei 16mhz.
     if (Printer::interval < 512)
@@ -1654,17 +2325,30 @@ long PrintLine::performMove(PrintLine* move, uint8_t forQueue) {
 
     //Now manipulate step-width=interval according to single-, double-, tripple-, ... steppings needs:
     //we know that next time will be a (as example) double or quad step so we let pass twice the time and set the stepsPerTimerCall accordingly.
-    Printer::stepsPerTimerCall = 1;
     unsigned long one_interval = interval;
-    uint16_t minInterval = Printer::stepsPackingMinInterval;
-    if (Printer::isAdvanceActivated()) {
-        minInterval += 64;
+    uint16_t minInterval = stepsPackingMinInterval();
+    Printer::stepsPerTimerCall = 1;
+#if ADAPTIVE_STEP_PACKING
+    // follow the current speed through 1, 2, 3, ... steps per call, the ramps never need more than the packing planned for vMax
+    while (interval < minInterval && Printer::stepsPerTimerCall < move->stepsPacking) {
+        interval += one_interval;
+        Printer::stepsPerTimerCall += 1;
     }
-    while (interval < Printer::stepsPackingMinInterval) {
+#endif // ADAPTIVE_STEP_PACKING
+    // flow compensation can make the interval shorter than planned, so we still have to check it
+    while (interval < minInterval) {
         interval += one_interval;
         Printer::stepsPerTimerCall += 1;
     }
 
+#if FEATURE_STEP_TRACE
+    Printer::traceSteps(max_loops, interval);
+#endif // FEATURE_STEP_TRACE
+#if FEATURE_SEGMENT_TRACE
+    if (forQueue && segmentTraceActive)
+        segmentTraceCalls++;
+#endif // FEATURE_SEGMENT_TRACE
+
     if (move->stepsRemaining <= 0 || move->isNoMove()) // line finished
     {
         //Wenn keine Steps mehr da, sollten alle Achsen die benutzt wurden wieder freigegeben werden. Bei Z ist der Sonderfall, dass die Z-Kompensation sich reinschummeln könnte.
@@ -1672,6 +2356,10 @@ long PrintLine::performMove(PrintLine* move, uint8_t forQueue) {
                                      // Auch wenn kein Z-Move, könnte die Z-Kompensation die Achse Z benutzt haben.
 
         if (forQueue) {
+#if FEATURE_SEGMENT_TRACE
+            if (segmentTraceActive)
+                traceSegment(move);
+#endif // FEATURE_SEGMENT_TRACE
             removeCurrentLineForbidInterrupt();
         } else {
             //forDirect:
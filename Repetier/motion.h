@@ -48,6 +48,127 @@
 #define FOR_DIRECT 0
 #define FOR_QUEUE 1
 
+#if FIXED_POINT_PLANNER
+#define SPEED2_FRACTION_BITS 10 // squared speeds are stored in [mm²/s² / 1024], so the slow z moves keep their start speed and 2048 mm/s still fit
+#define SPEED2_MAX 0xFFFFFFFFUL
+typedef uint32_t speed2_t;
+#endif // FIXED_POINT_PLANNER
+
+#if STEP_INTERVAL_TABLES
+#define NO_STEP_INTERVAL_TABLE 255 // accelShift/decelShift value of a move without valid interval tables
+#endif // STEP_INTERVAL_TABLES
+
+#if FEATURE_PLANNER_TIMING
+#define PLANNER_TIMING_TRAPEZOIDS 0
+#define PLANNER_TIMING_JUNCTION 1
+#define PLANNER_TIMING_BACKWARD 2
+#define PLANNER_TIMING_FORWARD 3
+#define PLANNER_TIMING_STEPS_PARAMETER 4
+#define PLANNER_TIMING_COUNT 5
+#ifdef SIMULATOR
+#define PLANNER_TIMING_UNIT " [ns]" // nanoseconds of the host
+#else
+#define PLANNER_TIMING_UNIT " [us]"
+#endif // SIMULATOR
+#endif // FEATURE_PLANNER_TIMING
+
+#if FEATURE_SEGMENT_TRACE
+#define SEGMENT_TRACE_SIZE 16       // records in the ring buffer, must be a power of 2
+#define SEGMENT_TRACE_LINE_SIZE 48  // free bytes in the serial output buffer which are needed to send one more record without waiting long
+#define SEGMENT_TRACE_FLUSH_LINES 4 // records sent per call of flushSegmentTrace() when the free output buffer is unknown
+
+/** \brief Planned and executed values of one finished queued move. */
+struct SegmentTraceRecord {
+    uint32_t steps;      ///< Steps of the primary axis
+    uint16_t vStart;     ///< Planned speeds in steps/s
+    uint16_t vMax;
+    uint16_t vEnd;
+    uint16_t vReached;   ///< Highest speed the stepper interrupt reached
+    uint16_t accelSteps; ///< Planned ramps, 65535 = longer
+    uint16_t decelSteps;
+    uint16_t stepsLeft;  ///< Steps which were not done, e.g. because of an endstop
+    uint16_t calls;      ///< Stepper timer calls of the move
+    uint8_t sequence;    ///< Counts the recorded moves, gaps show dropped records
+};
+#endif // FEATURE_SEGMENT_TRACE
+
+#if FEATURE_QUEUE_TELEMETRY
+#define QUEUE_TELEMETRY_SLOTS 8
+#define QUEUE_TELEMETRY_SLOT_WIDTH ((MOVE_CACHE_SIZE + QUEUE_TELEMETRY_SLOTS) / QUEUE_TELEMETRY_SLOTS)
+#endif // FEATURE_QUEUE_TELEMETRY
+
+#if FEATURE_INPUT_SHAPING
+/** \brief ZV input shaper for one axis. The stepper interrupt hands every step of a queued move to step(), which adds the first impulse at once
+and queues the second one. process() adds the queued impulses when they are due and output() does the physical steps. The sum of both impulses
+is rounded to full steps. The queue entries collect the delayed impulses of 1/16 of the delay each, so their number does not depend on the step rate.
+While a shaped move runs, the shaper owns the direction pin of its axis. */
+class InputShaper {
+public:
+    float frequency;        ///< Ringing frequency in Hz, 0 = off
+    float damping;          ///< Damping ratio of the ringing
+    uint16_t overflows;     ///< Number of delayed impulses which had to be done at once because the queue was full
+    uint8_t axis;           ///< X_AXIS or Y_AXIS
+    uint8_t firstAmplitude; ///< A1 in 1/128 of a step, the delayed impulse gets 128 - A1
+    uint16_t delayUs;       ///< Delay of the second impulse in us, 0 = off
+    uint16_t windowUs;      ///< Time span collected by one queue entry in us
+
+    void configure(float newFrequency, float newDamping);
+    void flush();
+    void output();
+
+    INLINE bool isActive() {
+        return delayUs != 0;
+    } // isActive
+
+    /** \brief Checks if delayed impulses or steps are still waiting. */
+    INLINE bool isBusy() {
+        return count != 0 || fraction >= 64 || fraction < -64;
+    } // isBusy
+
+    /** \brief Takes one step of a queued move. Only called from the stepper interrupt. */
+    INLINE void step(int8_t dir, uint16_t now) {
+        fraction += dir * (int16_t)firstAmplitude;
+        uint16_t delayed = now + delayUs;
+        if (count) {
+            uint8_t last = (tail + count - 1) & (INPUT_SHAPING_QUEUE_SIZE - 1);
+            int8_t sum = steps[last] + dir;
+            if ((uint16_t)(delayed - dueTime[last]) < windowUs && sum > -128 && sum < 128) {
+                steps[last] = sum;
+                return;
+            }
+        }
+        if (count < INPUT_SHAPING_QUEUE_SIZE) {
+            uint8_t pos = (tail + count) & (INPUT_SHAPING_QUEUE_SIZE - 1);
+            dueTime[pos] = delayed;
+            steps[pos] = dir;
+            count++;
+        } else {
+            overflows++;
+            fraction += dir * (128 - (int16_t)firstAmplitude);
+        }
+    } // step
+
+    /** \brief Adds all delayed impulses which are due. An entry is done in the middle of its window, so the error of the delay is at most windowUs / 2.
+    Only called from the stepper interrupt. */
+    INLINE void process(uint16_t now) {
+        while (count && (int16_t)(now - dueTime[tail] - (windowUs >> 1)) >= 0) {
+            fraction += steps[tail] * (128 - (int16_t)firstAmplitude);
+            tail = (tail + 1) & (INPUT_SHAPING_QUEUE_SIZE - 1);
+            count--;
+        }
+    } // process
+
+private:
+    int16_t fraction; ///< Shaped position minus output position in 1/128 steps
+    uint8_t tail;
+    uint8_t count;
+    uint16_t dueTime[INPUT_SHAPING_QUEUE_SIZE]; ///< Start of the window of the entry plus the delay
+    int8_t steps[INPUT_SHAPING_QUEUE_SIZE];     ///< Sum of the delayed impulses in the window, counted in steps
+
+    void outputStep(int8_t dir, bool turn);
+};
+#endif // FEATURE_INPUT_SHAPING
+
 class UIDisplay;
 class PrintLine {
     friend class UIDisplay;
@@ -56,6 +177,32 @@ public:
     static uint8_t linesPos; // Position for executing line movement
     static PrintLine lines[];
     static uint8_t linesWritePos; // Position where we write the next cached line move
+#if FEATURE_INPUT_SHAPING
+    static InputShaper shaperX;
+    static InputShaper shaperY;
+
+    static uint32_t shapingClock; ///< Stepper timer ticks, advanced by every stepper interrupt
+
+    /** \brief Time of the current stepper interrupt in us, taken from the stepper timer instead of micros(). */
+    static INLINE uint16_t shapingNow() {
+        return (uint16_t)(shapingClock >> 4);
+    } // shapingNow
+
+    /** \brief Adds the due delayed impulses of both shapers. Only called from the stepper interrupt. */
+    static INLINE void processInputShaping() {
+        uint16_t now = shapingNow();
+        shaperX.process(now);
+        shaperY.process(now);
+    } // processInputShaping
+
+    /** \brief Does the physical steps of both shapers. Only called from the stepper interrupt. */
+    static INLINE void outputInputShaping() {
+        shaperX.output();
+        shaperY.output();
+    } // outputInputShaping
+
+    static bool holdsDirectionPin(uint8_t axis);
+#endif // FEATURE_INPUT_SHAPING
     flag8_t joinFlags;
     volatile flag8_t flags;
 
@@ -65,17 +212,30 @@ private:
     flag8_t dir;                 ///< Direction of movement. 1 = X+, 2 = Y+, 4= Z+, values can be combined.
     int32_t delta[4];            ///< Steps we want to move.
     int32_t error[4];            ///< Error calculation for Bresenham algorithm
+#if !PACKED_PRINTLINE
     float speedX;                ///< Speed in x direction at vMax in mm/s
     float speedY;                ///< Speed in y direction at vMax in mm/s
     float speedZ;                ///< Speed in z direction at vMax in mm/s
     float speedE;                ///< Speed in E direction at vMax in mm/s
+#endif                           // !PACKED_PRINTLINE
     float fullSpeed;             ///< Desired speed mm/s
+#if !PACKED_PRINTLINE
     float invFullSpeed;          ///< 1.0/fullSpeed for faster computation
+#endif                           // !PACKED_PRINTLINE
+#if FIXED_POINT_PLANNER
+    speed2_t fullSpeed2;            ///< fullSpeed²
+    speed2_t accelerationDistance2; ///< Real 2.0*distance*acceleration
+    speed2_t maxJunctionSpeed2;     ///< Max. junction speed² between this and next segment
+    speed2_t startSpeed2;           ///< Starting speed²
+    speed2_t endSpeed2;             ///< Exit speed²
+    speed2_t minSpeed2;
+#else
     float accelerationDistance2; ///< Real 2.0*distance*acceleration mm²/s²
     float maxJunctionSpeed;      ///< Max. junction speed between this and next segment
     float startSpeed;            ///< Starting speed in mm/s
     float endSpeed;              ///< Exit speed in mm/s
     float minSpeed;
+#endif // FIXED_POINT_PLANNER
     float distance;
     uint32_t accelSteps;       ///< How much steps does it take, to reach the plateau.
     uint32_t decelSteps;       ///< How much steps does it take, to reach the end speed.
@@ -84,11 +244,119 @@ private:
     speed_t vMax;              ///< Maximum reached speed in steps/s.
     speed_t vStart;            ///< Starting speed in steps/s.
     speed_t vEnd;              ///< End speed in steps/s
+#if ADAPTIVE_STEP_PACKING
+    uint8_t stepsPacking; ///< Steps per stepper interrupt needed at vMax
+#endif // ADAPTIVE_STEP_PACKING
+#if FEATURE_S_CURVE_ACCELERATION
+    speed_t vPeak;             ///< Speed at the end of the acceleration in steps/s
+    uint32_t sCurveAccelRecip; ///< 2^24 / (vPeak - vStart), 0 = linear ramp
+    uint32_t sCurveDecelRecip; ///< 2^24 / (vPeak - vEnd), 0 = linear ramp
+#endif                         // FEATURE_S_CURVE_ACCELERATION
 
 #if USE_ADVANCE
+#if FEATURE_SEGMENT_ADVANCE
+    int16_t advanceFull;        ///< Advance steps at vMax
+    int16_t advanceQuadratic;   ///< Part of advanceFull from the quadratic faktor
+    int16_t advanceStart;       ///< Advance steps at vStart
+    int16_t advanceEnd;         ///< Advance steps at vEnd
+    uint16_t advanceSmoothSteps; ///< Primary axis steps within the smoothing time at vMax
+    uint32_t advanceAccelSpan;  ///< Primary axis steps from the start, in which the advance rises from advanceStart to advanceFull
+    uint32_t advanceDecelSpan;  ///< Remaining primary axis steps, in which the advance falls from advanceFull to advanceEnd
+    uint32_t advanceAccelSlope; ///< Rise of the advance per primary axis step, 16.16 fixed point
+    uint32_t advanceDecelSlope; ///< Fall of the advance per primary axis step, 16.16 fixed point
+
+    int16_t advanceAtSpeed(speed_t v);
+    void computeAdvanceTargets();
+#else
     uint32_t advanceL; ///< Recomputated L value
+#endif                 // FEATURE_SEGMENT_ADVANCE
 #endif                 // USE_ADVANCE
 
+#if FEATURE_SEGMENT_Z_COMPENSATION
+    int16_t depthStart; ///< Z-matrix depth at the start of the move in z-steps
+    int32_t depthSlope; ///< Change of the z-matrix depth per primary axis step, 16.16 fixed point
+    bool depthValid;    ///< The path planner computed the depth, so the z-compensation follows the move
+
+    void computeSegmentDepth(long xStart, long yStart, long xEnd, long yEnd);
+    static bool splitForSegmentDepth(uint8_t pathOptimize, float feedrate);
+#endif // FEATURE_SEGMENT_Z_COMPENSATION
+
+#if STEP_INTERVAL_TABLES
+    uint16_t accelIntervals[STEP_INTERVAL_TABLE_SIZE + 1]; ///< Interval at every 2^accelShift steps of the acceleration
+    uint16_t decelIntervals[STEP_INTERVAL_TABLE_SIZE + 1]; ///< Interval at every 2^decelShift remaining steps of the deceleration
+    uint8_t accelShift;
+    uint8_t decelShift;
+
+    bool fillIntervalTable(uint16_t* table, uint32_t rampSteps, speed_t vLow, uint8_t& shift);
+    void computeIntervalTables();
+#endif // STEP_INTERVAL_TABLES
+
+#if PACKED_PRINTLINE
+    /** \brief Speed of one axis at full speed in mm/s, derived from the steps: v_axis = s_axis * fullSpeed / distance. */
+    INLINE float axisSpeed(uint8_t axis) {
+        float speed = (float)delta[axis] * Printer::axisMMPerSteps[axis] * fullSpeed / distance;
+        return (isNegativeMoveOfAxis(axis) ? -speed : speed);
+    } // axisSpeed
+
+    INLINE float getSpeedX() {
+        return axisSpeed(X_AXIS);
+    }
+    INLINE float getSpeedY() {
+        return axisSpeed(Y_AXIS);
+    }
+    INLINE float getSpeedZ() {
+        return axisSpeed(Z_AXIS);
+    }
+    INLINE float getSpeedE() {
+        return axisSpeed(E_AXIS);
+    }
+    INLINE float getInvFullSpeed() {
+        return 1.0f / fullSpeed;
+    }
+    /** \brief All four axis speeds with only one division, for code which needs more than one of them. */
+    INLINE void getAxisSpeeds(float* speed) {
+        float factor = fullSpeed / distance;
+        for (uint8_t axis = 0; axis < 4; axis++) {
+            speed[axis] = (float)delta[axis] * Printer::axisMMPerSteps[axis] * factor;
+            if (isNegativeMoveOfAxis(axis))
+                speed[axis] = -speed[axis];
+        }
+    } // getAxisSpeeds
+#else
+    INLINE float getSpeedX() {
+        return speedX;
+    }
+    INLINE float getSpeedY() {
+        return speedY;
+    }
+    INLINE float getSpeedZ() {
+        return speedZ;
+    }
+    INLINE float getSpeedE() {
+        return speedE;
+    }
+    INLINE float getInvFullSpeed() {
+        return invFullSpeed;
+    }
+    INLINE void getAxisSpeeds(float* speed) {
+        speed[X_AXIS] = speedX;
+        speed[Y_AXIS] = speedY;
+        speed[Z_AXIS] = speedZ;
+        speed[E_AXIS] = speedE;
+    } // getAxisSpeeds
+#endif // PACKED_PRINTLINE
+
+#if FEATURE_JUNCTION_DEVIATION
+    /** \brief Acceleration along the path in mm/s², taken from accelerationDistance2 = 2 * distance * acceleration. */
+    INLINE float pathAcceleration() {
+#if FIXED_POINT_PLANNER
+        return (float)accelerationDistance2 / (2.0f * distance * (float)(1L << SPEED2_FRACTION_BITS));
+#else
+        return accelerationDistance2 / (2.0f * distance);
+#endif // FIXED_POINT_PLANNER
+    } // pathAcceleration
+#endif // FEATURE_JUNCTION_DEVIATION
+
 public:
     int32_t stepsRemaining; ///< Remaining steps, until move is finished
     static PrintLine* cur;
@@ -97,6 +365,73 @@ public:
 
     static volatile uint8_t linesCount; // Number of lines cached 0 = nothing to do
 
+#if FEATURE_PLANNER_TIMING
+    static unsigned long plannerTimingCalls[PLANNER_TIMING_COUNT]; ///< Number of measured calls
+    static unsigned long plannerTimingSum[PLANNER_TIMING_COUNT];   ///< Summed up time in PLANNER_TIMING_UNIT
+    static unsigned long plannerTimingMax[PLANNER_TIMING_COUNT];   ///< Longest call in PLANNER_TIMING_UNIT
+
+    static void addPlannerTiming(uint8_t slot, unsigned long duration) {
+        InterruptProtectedBlock noInts; // updateStepsParameter() might be called from the stepper interrupt too
+        plannerTimingCalls[slot]++;
+        plannerTimingSum[slot] += duration;
+        if (duration > plannerTimingMax[slot])
+            plannerTimingMax[slot] = duration;
+    } // addPlannerTiming
+
+    static void resetPlannerTiming();
+    static void printPlannerTiming();
+#endif // FEATURE_PLANNER_TIMING
+
+#if FEATURE_SEGMENT_TRACE
+    static SegmentTraceRecord segmentTrace[SEGMENT_TRACE_SIZE];
+    static volatile uint8_t segmentTraceHead; ///< Next record written by the stepper interrupt
+    static volatile uint8_t segmentTraceTail; ///< Next record sent by flushSegmentTrace()
+    static uint8_t segmentTraceSequence;
+    static uint8_t segmentTraceActive;
+    static uint16_t segmentTraceCalls;        ///< Stepper timer calls of the current queued move
+    static volatile uint16_t segmentTraceDropped;
+
+    /** \brief Stores the finished move, called from the stepper interrupt with interrupts disabled. */
+    static INLINE void traceSegment(PrintLine* move) {
+        uint8_t next = (segmentTraceHead + 1) & (SEGMENT_TRACE_SIZE - 1);
+        if (next == segmentTraceTail) {
+            segmentTraceDropped++;
+        } else {
+            SegmentTraceRecord& record = segmentTrace[segmentTraceHead];
+            record.steps = move->delta[move->primaryAxis];
+            record.vStart = move->vStart;
+            record.vMax = move->vMax;
+            record.vEnd = move->vEnd;
+            record.vReached = Printer::vMaxReached[FOR_QUEUE];
+            record.accelSteps = (move->accelSteps < 0xFFFF ? move->accelSteps : 0xFFFF);
+            record.decelSteps = (move->decelSteps < 0xFFFF ? move->decelSteps : 0xFFFF);
+            record.stepsLeft = (move->stepsRemaining <= 0 ? 0 : (move->stepsRemaining < 0xFFFF ? move->stepsRemaining : 0xFFFF));
+            record.calls = segmentTraceCalls;
+            record.sequence = segmentTraceSequence;
+            segmentTraceHead = next;
+        }
+        segmentTraceSequence++;
+        segmentTraceCalls = 0;
+    } // traceSegment
+
+    static void startSegmentTrace(uint8_t active);
+    static void flushSegmentTrace();
+#endif // FEATURE_SEGMENT_TRACE
+
+#if FEATURE_QUEUE_TELEMETRY
+    static unsigned long queueTelemetrySegments;                          ///< Number of queued moves
+    static unsigned long queueTelemetrySlowed;                            ///< Moves which were slowed down because the cache ran low
+    static unsigned long queueTelemetryAddedTime;                         ///< Time which was added to the slowed down moves in [us]
+    static uint8_t queueTelemetryLowWater;                                ///< Fewest cached moves at the start of a move
+    static unsigned long queueTelemetryHistogram[QUEUE_TELEMETRY_SLOTS]; ///< Number of cached moves at the start of a move
+    static uint16_t queueTelemetryReportInterval;                         ///< Seconds between two outputs while moving, 0 = off
+
+    static void addQueueTelemetry(uint8_t lines, float addedTicks);
+    static void resetQueueTelemetry();
+    static void printQueueTelemetry();
+    static void reportQueueTelemetry(millis_t now);
+#endif // FEATURE_QUEUE_TELEMETRY
+
     inline bool areParameterUpToDate() {
         return joinFlags & FLAG_JOIN_STEPPARAMS_COMPUTED;
     } // areParameterUpToDate
@@ -294,12 +629,55 @@ public:
         dir |= 1 << axis;
     } // setPositiveDirectionForAxis
 
+#if FIXED_POINT_PLANNER
+    /** \brief Converts a squared speed in [mm²/s²] into the fixed point format of the planner. */
+    static INLINE speed2_t toSpeed2(float speedSquared) {
+        speedSquared *= (float)(1L << SPEED2_FRACTION_BITS);
+        if (speedSquared >= 4294967040.0f)
+            return SPEED2_MAX;
+        return (speed2_t)speedSquared;
+    } // toSpeed2
+
+    /** \brief Adds two squared speeds without overflow. */
+    static INLINE speed2_t addSpeed2(speed2_t a, speed2_t b) {
+        speed2_t sum = a + b;
+        return (sum < a ? SPEED2_MAX : sum);
+    } // addSpeed2
+#endif // FIXED_POINT_PLANNER
+
     inline static void resetPathPlanner() {
         linesCount = 0;
         linesPos = linesWritePos;
+#if FEATURE_SEGMENT_Z_COMPENSATION
+        Printer::compensationFollowsSegment = false; // the dropped moves do not set the target anymore
+#endif // FEATURE_SEGMENT_Z_COMPENSATION
     } // resetPathPlanner
 
 #if USE_ADVANCE
+#if FEATURE_SEGMENT_ADVANCE
+    /** \brief Sets the advance target of the current position in the move, the targets were computed by the path planner. */
+    inline void updateSegmentAdvance(uint8_t forQueue) {
+        if (!Printer::isAdvanceActivated())
+            return;
+
+        int16_t target = advanceFull;
+        uint32_t stepNumber = Printer::stepNumber[forQueue];
+        if (stepNumber < advanceAccelSpan)
+            target = advanceStart + (int16_t)((advanceAccelSlope * stepNumber) >> 16);
+        if (static_cast<uint32_t>(stepsRemaining) < advanceDecelSpan) {
+            int16_t decelTarget = advanceEnd + (int16_t)((advanceDecelSlope * stepsRemaining) >> 16);
+            if (decelTarget < target)
+                target = decelTarget;
+        }
+        if (target == Printer::advanceStepsSet)
+            return;
+
+        HAL::forbidInterrupts();
+        Printer::extruderStepsNeeded += target - Printer::advanceStepsSet;
+        Printer::advanceStepsSet = target;
+        HAL::allowInterrupts();
+    } // updateSegmentAdvance
+#else
     inline void updateAdvanceSteps(speed_t v) {
         if (!Printer::isAdvanceActivated())
             return;
@@ -310,8 +688,23 @@ public:
         Printer::advanceStepsSet = tred;
         HAL::allowInterrupts();
     }  // updateAdvanceSteps
+#endif // FEATURE_SEGMENT_ADVANCE
 #endif // USE_ADVANCE
 
+#if FEATURE_SEGMENT_Z_COMPENSATION
+    /** \brief Sets the z-compensation target from the z-matrix depth at the current position in the move. */
+    inline void updateSegmentDepth() {
+        if (!depthValid)
+            return;
+
+        int32_t depth = depthStart + ((depthSlope * (delta[primaryAxis] - stepsRemaining)) >> 16);
+        HAL::forbidInterrupts();
+        Printer::compensatedPositionTargetStepsZ = ((Printer::compensationDepthScale * depth) >> 16) + Printer::compensationDepthOffset;
+        Printer::compensationFollowsSegment = true;
+        HAL::allowInterrupts();
+    } // updateSegmentDepth
+#endif // FEATURE_SEGMENT_Z_COMPENSATION
+
     INLINE bool moveDecelerating(uint8_t forQueue) {
         if (stepsRemaining <= static_cast<int32_t>(decelSteps)) {
             if (!(flags & FLAG_DECELERATING)) //reset "timer" only once.
@@ -329,6 +722,49 @@ public:
         return Printer::stepNumber[forQueue] <= accelSteps;
     } // moveAccelerating
 
+    /** \brief Shortest interval for one stepper interrupt call, with adaptive step packing advance gets some more time per call. */
+    static INLINE uint16_t stepsPackingMinInterval() {
+#if ADAPTIVE_STEP_PACKING
+        if (Printer::isAdvanceActivated())
+            return Printer::stepsPackingMinInterval + 64;
+#endif // ADAPTIVE_STEP_PACKING
+        return Printer::stepsPackingMinInterval;
+    } // stepsPackingMinInterval
+
+#if FEATURE_S_CURVE_ACCELERATION
+    /** \brief Maps the linear speed change of a ramp to the S-curve: dv * (3 t² - 2 t³) with t = linear / dv.
+    The average acceleration and the ramp length stay the same as for the linear ramp. */
+    static INLINE speed_t sCurveSpeed(speed_t linear, uint32_t recip, speed_t dv) {
+        if (linear >= dv)
+            return dv;
+
+        uint16_t t = ((uint32_t)linear * recip) >> 8;                                // t in 1/65536
+        uint16_t t2 = HAL::U16SquaredToU32(t) >> 16;                                  // t² in 1/65536
+        uint32_t s = ((uint32_t)t2 * (uint16_t)((3UL * 65536 - 2UL * t) >> 2)) >> 14; // t² * (3 - 2 t) in 1/65536
+        return ((uint32_t)dv * s) >> 16;
+    } // sCurveSpeed
+#endif // FEATURE_S_CURVE_ACCELERATION
+
+#if STEP_INTERVAL_TABLES
+    INLINE bool hasIntervalTables() {
+        return accelShift != NO_STEP_INTERVAL_TABLE;
+    } // hasIntervalTables
+
+    /** \brief Interpolates the interval at ramp step n between two table entries. */
+    static INLINE unsigned long intervalFromTable(uint16_t* table, uint8_t shift, uint32_t n) {
+        uint16_t i = n >> shift;
+        if (i >= STEP_INTERVAL_TABLE_SIZE)
+            return table[STEP_INTERVAL_TABLE_SIZE];
+
+        uint16_t part = (uint16_t)n & ((1 << shift) - 1);
+        uint16_t left = table[i];
+        uint16_t right = table[i + 1];
+        if (left > right)
+            return left - (uint16_t)(((uint32_t)(left - right) * part) >> shift);
+        return left + (uint16_t)(((uint32_t)(right - left) * part) >> shift);
+    } // intervalFromTable
+#endif // STEP_INTERVAL_TABLES
+
     void updateStepsParameter();
     inline float safeSpeed(fast8_t drivingAxis);
     void calculateMove(float axis_diff[], fast8_t drivingAxis, float feedrate);
@@ -360,6 +796,9 @@ public:
         cur->task = TASK_NO_TASK;
         cur = NULL;
         --linesCount;
+#if FEATURE_SEGMENT_Z_COMPENSATION
+        Printer::compensationFollowsSegment = false; // recalculateZCompensation() sets the target until the next move with a depth
+#endif // FEATURE_SEGMENT_Z_COMPENSATION
     } // removeCurrentLineForbidInterrupt
 
     static INLINE void pushLine() {
@@ -461,4 +900,27 @@ public:
     } // adjustDirections
 };
 
+#if FEATURE_PLANNER_TIMING
+/** \brief Measures the time from its construction until it goes out of scope and adds it to the planner timing slot. */
+class PlannerTimer {
+private:
+    uint8_t slot;
+    unsigned long start;
+
+public:
+    inline PlannerTimer(uint8_t s) {
+        slot = s;
+        start = HAL::plannerTimingNow();
+    }
+
+    inline ~PlannerTimer() {
+        PrintLine::addPlannerTiming(slot, HAL::plannerTimingNow() - start);
+    }
+};
+
+#define PLANNER_TIMING(slot) PlannerTimer plannerTimer(slot);
+#else
+#define PLANNER_TIMING(slot)
+#endif // FEATURE_PLANNER_TIMING
+
 #endif // MOTION_H
@@ -0,0 +1,381 @@
+/*
+    This file is part of the Repetier-Firmware for RF devices from Conrad Electronic SE.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Arduino.h"
+#include "Wire.h"
+#include "fastio.h"
+#include "SimMachine.h"
+
+// ---------------- time ----------------
+
+unsigned long millis(void) {
+    simHook();
+    return (unsigned long)(simNow / (F_CPU / 1000));
+} // millis
+
+unsigned long micros(void) {
+    simHook();
+    return (unsigned long)(simNow / (F_CPU / 1000000));
+} // micros
+
+void delay(unsigned long ms) {
+    simAdvance((simticks_t)ms * (F_CPU / 1000));
+} // delay
+
+void delayMicroseconds(unsigned int us) {
+    simAdvance((simticks_t)us * (F_CPU / 1000000));
+} // delayMicroseconds
+
+// ---------------- pins ----------------
+
+struct SimArduinoPin {
+    uint8_t port;
+    uint8_t bit;
+};
+
+#define SIM_ARDUINO_PIN(n) \
+    { DIO##n##_WPORT.index(), DIO##n##_PIN }
+
+/** Port and bit of the Arduino Mega pins 0 to 69, which fastio.h numbers the same way. */
+static const SimArduinoPin simArduinoPins[] = {
+    SIM_ARDUINO_PIN(0),
+    SIM_ARDUINO_PIN(1),
+    SIM_ARDUINO_PIN(2),
+    SIM_ARDUINO_PIN(3),
+    SIM_ARDUINO_PIN(4),
+    SIM_ARDUINO_PIN(5),
+    SIM_ARDUINO_PIN(6),
+    SIM_ARDUINO_PIN(7),
+    SIM_ARDUINO_PIN(8),
+    SIM_ARDUINO_PIN(9),
+    SIM_ARDUINO_PIN(10),
+    SIM_ARDUINO_PIN(11),
+    SIM_ARDUINO_PIN(12),
+    SIM_ARDUINO_PIN(13),
+    SIM_ARDUINO_PIN(14),
+    SIM_ARDUINO_PIN(15),
+    SIM_ARDUINO_PIN(16),
+    SIM_ARDUINO_PIN(17),
+    SIM_ARDUINO_PIN(18),
+    SIM_ARDUINO_PIN(19),
+    SIM_ARDUINO_PIN(20),
+    SIM_ARDUINO_PIN(21),
+    SIM_ARDUINO_PIN(22),
+    SIM_ARDUINO_PIN(23),
+    SIM_ARDUINO_PIN(24),
+    SIM_ARDUINO_PIN(25),
+    SIM_ARDUINO_PIN(26),
+    SIM_ARDUINO_PIN(27),
+    SIM_ARDUINO_PIN(28),
+    SIM_ARDUINO_PIN(29),
+    SIM_ARDUINO_PIN(30),
+    SIM_ARDUINO_PIN(31),
+    SIM_ARDUINO_PIN(32),
+    SIM_ARDUINO_PIN(33),
+    SIM_ARDUINO_PIN(34),
+    SIM_ARDUINO_PIN(35),
+    SIM_ARDUINO_PIN(36),
+    SIM_ARDUINO_PIN(37),
+    SIM_ARDUINO_PIN(38),
+    SIM_ARDUINO_PIN(39),
+    SIM_ARDUINO_PIN(40),
+    SIM_ARDUINO_PIN(41),
+    SIM_ARDUINO_PIN(42),
+    SIM_ARDUINO_PIN(43),
+    SIM_ARDUINO_PIN(44),
+    SIM_ARDUINO_PIN(45),
+    SIM_ARDUINO_PIN(46),
+    SIM_ARDUINO_PIN(47),
+    SIM_ARDUINO_PIN(48),
+    SIM_ARDUINO_PIN(49),
+    SIM_ARDUINO_PIN(50),
+    SIM_ARDUINO_PIN(51),
+    SIM_ARDUINO_PIN(52),
+    SIM_ARDUINO_PIN(53),
+    SIM_ARDUINO_PIN(54),
+    SIM_ARDUINO_PIN(55),
+    SIM_ARDUINO_PIN(56),
+    SIM_ARDUINO_PIN(57),
+    SIM_ARDUINO_PIN(58),
+    SIM_ARDUINO_PIN(59),
+    SIM_ARDUINO_PIN(60),
+    SIM_ARDUINO_PIN(61),
+    SIM_ARDUINO_PIN(62),
+    SIM_ARDUINO_PIN(63),
+    SIM_ARDUINO_PIN(64),
+    SIM_ARDUINO_PIN(65),
+    SIM_ARDUINO_PIN(66),
+    SIM_ARDUINO_PIN(67),
+    SIM_ARDUINO_PIN(68),
+    SIM_ARDUINO_PIN(69)
+};
+
+#define SIM_ARDUINO_PINS (sizeof(simArduinoPins) / sizeof(simArduinoPins[0]))
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    if (pin >= SIM_ARDUINO_PINS)
+        return;
+    const SimArduinoPin& p = simArduinoPins[pin];
+    uint8_t mask = 1 << p.bit;
+    if (mode == OUTPUT) {
+        simPorts[p.port].ddr |= mask;
+    } else {
+        simPorts[p.port].ddr &= ~mask;
+        if (mode == INPUT_PULLUP)
+            simWritePort(p.port, simPorts[p.port].out | mask);
+        else
+            simWritePort(p.port, simPorts[p.port].out & ~mask);
+    }
+} // pinMode
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    if (pin >= SIM_ARDUINO_PINS)
+        return;
+    const SimArduinoPin& p = simArduinoPins[pin];
+    uint8_t mask = 1 << p.bit;
+    simWritePort(p.port, value ? simPorts[p.port].out | mask : simPorts[p.port].out & ~mask);
+} // digitalWrite
+
+int digitalRead(uint8_t pin) {
+    if (pin >= SIM_ARDUINO_PINS)
+        return LOW;
+    const SimArduinoPin& p = simArduinoPins[pin];
+    return (SimPortIn(p.port) & (1 << p.bit)) ? HIGH : LOW;
+} // digitalRead
+
+void tone(uint8_t, unsigned int, unsigned long) { }
+
+void noTone(uint8_t) { }
+
+void attachInterrupt(uint8_t, void (*)(void), int) { }
+
+void detachInterrupt(uint8_t) { }
+
+// ---------------- random numbers ----------------
+
+static uint32_t simRandomState = 1; // fixed seed, so every run of the same G-code is identical
+
+void randomSeed(unsigned long seed) {
+    if (seed != 0)
+        simRandomState = (uint32_t)seed;
+} // randomSeed
+
+long random(long howbig) {
+    if (howbig <= 0)
+        return 0;
+    simRandomState = simRandomState * 1103515245UL + 12345UL;
+    return (long)((simRandomState >> 1) % (uint32_t)howbig);
+} // random
+
+long random(long howsmall, long howbig) {
+    if (howsmall >= howbig)
+        return howsmall;
+    return random(howbig - howsmall) + howsmall;
+} // random
+
+// ---------------- avr-libc conversions ----------------
+
+static char* simUnsignedToString(unsigned long value, char* buffer, int radix, bool negative) {
+    char digits[40];
+    int n = 0;
+    do {
+        int d = (int)(value % radix);
+        digits[n++] = (char)(d < 10 ? '0' + d : 'a' + d - 10);
+        value /= radix;
+    } while (value);
+    char* p = buffer;
+    if (negative)
+        *p++ = '-';
+    while (n)
+        *p++ = digits[--n];
+    *p = 0;
+    return buffer;
+} // simUnsignedToString
+
+char* utoa(unsigned int value, char* buffer, int radix) {
+    return simUnsignedToString(value, buffer, radix, false);
+} // utoa
+
+char* ultoa(unsigned long value, char* buffer, int radix) {
+    return simUnsignedToString(value, buffer, radix, false);
+} // ultoa
+
+char* itoa(int value, char* buffer, int radix) {
+    return ltoa(value, buffer, radix);
+} // itoa
+
+char* ltoa(long value, char* buffer, int radix) {
+    if (value < 0 && radix == 10)
+        return simUnsignedToString(-(unsigned long)value, buffer, radix, true);
+    return simUnsignedToString((unsigned long)value, buffer, radix, false);
+} // ltoa
+
+// ---------------- serial ports ----------------
+
+SimSerial Serial(0);
+SimSerial Serial1(1);
+SimSerial Serial2(2);
+SimSerial Serial3(3);
+
+static unsigned long simBaudrate = 115200;
+static int simPeekByte = -1;
+static bool simEndOfFile = false;
+static simticks_t simNextByteTime = 0;
+
+bool simInputFinished() {
+    return simEndOfFile && simPeekByte < 0;
+} // simInputFinished
+
+void SimSerial::begin(unsigned long baud) {
+    if (port == 0 && baud)
+        simBaudrate = baud;
+} // begin
+
+int SimSerial::available() {
+    simHook();
+    if (port != 0)
+        return 0;
+    if (simPeekByte < 0 && !simEndOfFile && simGCodeFile) {
+        simPeekByte = fgetc(simGCodeFile);
+        if (simPeekByte < 0)
+            simEndOfFile = true;
+    }
+    if (simPeekByte < 0)
+        return 0;
+    if (simLimitBaudrate && simNow < simNextByteTime)
+        return 0;
+    return 1;
+} // available
+
+int SimSerial::peek() {
+    return available() ? simPeekByte : -1;
+} // peek
+
+int SimSerial::read() {
+    if (!available())
+        return -1;
+    int c = simPeekByte;
+    simPeekByte = -1;
+    simNextByteTime = simNow + (simticks_t)F_CPU * 10 / simBaudrate; // start bit, 8 data bits, stop bit
+    return c;
+} // read
+
+void SimSerial::flush() {
+    if (port == 0 && simLogFile)
+        fflush(simLogFile);
+} // flush
+
+size_t SimSerial::write(uint8_t c) {
+    if (port == 0 && simLogFile)
+        fputc(c, simLogFile);
+    return 1;
+} // write
+
+// ---------------- I2C ----------------
+
+#define SIM_I2C_EEPROMS 8
+#define SIM_I2C_EEPROM_SIZE 32768
+
+uint8_t simI2cEepromsPresent = 0;
+static uint8_t simI2cEeprom[SIM_I2C_EEPROMS][SIM_I2C_EEPROM_SIZE];
+static uint16_t simI2cEepromPointer[SIM_I2C_EEPROMS];
+
+TwoWire Wire;
+
+TwoWire::TwoWire()
+    : address(0)
+    , txLength(0)
+    , rxLength(0)
+    , rxPos(0) {
+    memset(simI2cEeprom, 0xFF, sizeof(simI2cEeprom)); // erased
+} // TwoWire
+
+static bool simI2cIsEepromAddress(uint8_t address) {
+    return address >= SIM_I2C_EEPROM_FIRST && address < SIM_I2C_EEPROM_FIRST + SIM_I2C_EEPROMS;
+} // simI2cIsEepromAddress
+
+/** \brief Index of the EEPROM at this address, -1 for the other devices and for EEPROMs the printer does not have. */
+static int simI2cEepromIndex(uint8_t address) {
+    if (!simI2cIsEepromAddress(address) || !(simI2cEepromsPresent & (1 << (address - SIM_I2C_EEPROM_FIRST))))
+        return -1;
+    return address - SIM_I2C_EEPROM_FIRST;
+} // simI2cEepromIndex
+
+/** \brief A missing EEPROM does not acknowledge its address, all other devices do. */
+static bool simI2cAnswers(uint8_t address) {
+    return !simI2cIsEepromAddress(address) || simI2cEepromIndex(address) >= 0;
+} // simI2cAnswers
+
+void TwoWire::beginTransmission(uint8_t a) {
+    address = a;
+    txLength = 0;
+} // beginTransmission
+
+size_t TwoWire::write(uint8_t data) {
+    if (txLength >= SIM_WIRE_BUFFER_SIZE)
+        return 0;
+    txBuffer[txLength++] = data;
+    return 1;
+} // write
+
+uint8_t TwoWire::endTransmission(uint8_t) {
+    if (!simI2cAnswers(address)) {
+        txLength = 0;
+        return 2; // address not acknowledged
+    }
+    int e = simI2cEepromIndex(address);
+    if (e >= 0 && txLength >= 2) {
+        uint16_t pointer = ((txBuffer[0] << 8) | txBuffer[1]) % SIM_I2C_EEPROM_SIZE;
+        for (uint8_t i = 2; i < txLength; i++) {
+            simI2cEeprom[e][pointer] = txBuffer[i];
+            pointer = (pointer + 1) % SIM_I2C_EEPROM_SIZE;
+        }
+        simI2cEepromPointer[e] = pointer;
+    }
+    txLength = 0;
+    return 0; // acknowledged
+} // endTransmission
+
+uint8_t TwoWire::requestFrom(uint8_t a, uint8_t quantity) {
+    if (!simI2cAnswers(a))
+        quantity = 0;
+    if (quantity > SIM_WIRE_BUFFER_SIZE)
+        quantity = SIM_WIRE_BUFFER_SIZE;
+    int e = simI2cEepromIndex(a);
+    for (uint8_t i = 0; i < quantity; i++) {
+        if (e >= 0) {
+            rxBuffer[i] = simI2cEeprom[e][simI2cEepromPointer[e]];
+            simI2cEepromPointer[e] = (simI2cEepromPointer[e] + 1) % SIM_I2C_EEPROM_SIZE;
+        } else
+            rxBuffer[i] = 0;
+    }
+    rxLength = quantity;
+    rxPos = 0;
+    return quantity;
+} // requestFrom
+
+int TwoWire::available() {
+    return rxLength - rxPos;
+} // available
+
+int TwoWire::read() {
+    return rxPos < rxLength ? rxBuffer[rxPos++] : -1;
+} // read
+
+int TwoWire::peek() {
+    return rxPos < rxLength ? rxBuffer[rxPos] : -1;
+} // peek
@@ -0,0 +1,229 @@
+/*
+    This file is part of the Repetier-Firmware for RF devices from Conrad Electronic SE.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <avr/io.h>
+#include <compat/twi.h>
+#include <time.h>
+
+simticks_t simNow = 0;
+uint32_t simHookCycles = 64;
+uint8_t simInterruptDepth = 0;
+uint8_t simSreg = 0;
+
+SimPort simPorts[SIM_PORTS];
+
+SimPortOut PORTA(SIM_PORT_A), PORTB(SIM_PORT_B), PORTC(SIM_PORT_C), PORTD(SIM_PORT_D), PORTE(SIM_PORT_E), PORTF(SIM_PORT_F),
+    PORTG(SIM_PORT_G), PORTH(SIM_PORT_H), PORTJ(SIM_PORT_J), PORTK(SIM_PORT_K), PORTL(SIM_PORT_L);
+SimPortIn PINA(SIM_PORT_A), PINB(SIM_PORT_B), PINC(SIM_PORT_C), PIND(SIM_PORT_D), PINE(SIM_PORT_E), PINF(SIM_PORT_F),
+    PING(SIM_PORT_G), PINH(SIM_PORT_H), PINJ(SIM_PORT_J), PINK(SIM_PORT_K), PINL(SIM_PORT_L);
+
+SimStatusRegister SREG;
+
+uint8_t TCCR0A, TCCR0B, OCR0A, OCR0B, TIMSK0, TIFR0;
+SimTimer0Counter TCNT0;
+
+simticks_t simTimer1Base = 0;
+uint8_t TCCR1A, TCCR1B, TCCR1C, TIMSK1, TIFR1;
+uint16_t OCR1A, OCR1B, OCR1C, ICR1;
+SimTimer1Counter TCNT1;
+
+uint8_t TCCR2A, TCCR2B, TCNT2, OCR2A, OCR2B, TIMSK2, TIFR2;
+uint8_t TCCR3A, TCCR3B, TCCR3C, TIMSK3, TIFR3;
+uint16_t TCNT3, OCR3A, OCR3B, OCR3C, ICR3;
+uint8_t TCCR4A, TCCR4B, TCCR4C, TIMSK4, TIFR4;
+uint16_t TCNT4, OCR4A, OCR4B, OCR4C, ICR4;
+uint8_t TCCR5A, TCCR5B, TCCR5C, TIMSK5, TIFR5;
+uint16_t TCNT5, OCR5A, OCR5B, OCR5C, ICR5;
+
+uint8_t simAdcsra, simAdmux, simAdcsrb;
+uint16_t simAdcw;
+SimAdcControl ADCSRA;
+uint8_t DIDR0, DIDR2;
+
+uint8_t SPCR;
+SimSpiStatus SPSR;
+SimSpiData SPDR;
+
+uint8_t simTwcr, simTwsr, simTwdr;
+uint8_t TWBR, TWAR;
+SimTwiControl TWCR;
+
+uint8_t MCUSR = _BV(PORF);
+uint8_t WDTCSR;
+
+uint8_t simEeprom[SIM_EEPROM_SIZE];
+
+// The firmware defines the interrupt routines it uses, the others stay null.
+extern "C" void WDT_vect(void) __attribute__((weak));
+extern "C" void TIMER1_COMPA_vect(void) __attribute__((weak));
+extern "C" void TIMER0_COMPA_vect(void) __attribute__((weak));
+extern "C" void TIMER0_COMPB_vect(void) __attribute__((weak));
+
+#define SIM_NEVER (~(simticks_t)0)
+#define SIM_WDT_PERIOD ((simticks_t)F_CPU / 1000 * 16)
+
+/** \brief Time of the next compare match of timer 1. The counter wraps at 65536 without a match, if OCR1A was set below it. */
+static simticks_t nextTimer1Match() {
+    if ((TCCR1B & (_BV(CS10) | _BV(CS11) | _BV(CS12))) == 0)
+        return SIM_NEVER; // stopped
+    while (simNow - simTimer1Base >= 65536)
+        simTimer1Base += 65536;
+    simticks_t count = simNow - simTimer1Base;
+    if (OCR1A >= count)
+        return simTimer1Base + OCR1A + 1; // CTC mode: the counter clears at the tick after the match
+    return simTimer1Base + 65536 + OCR1A + 1;
+} // nextTimer1Match
+
+/** \brief Time of the next tick of timer 0 at which the counter equals ocr. */
+static simticks_t nextTimer0Match(uint8_t ocr) {
+    simticks_t tick = simNow >> 6;
+    uint8_t delta = (uint8_t)(ocr - (uint8_t)tick);
+    return (tick + (delta ? delta : 256)) << 6;
+} // nextTimer0Match
+
+static simticks_t nextWatchdog() {
+    if (!(WDTCSR & _BV(WDIE)))
+        return SIM_NEVER;
+    return (simNow / SIM_WDT_PERIOD + 1) * SIM_WDT_PERIOD;
+} // nextWatchdog
+
+void simAdvance(simticks_t cycles) {
+    simticks_t target = simNow + cycles;
+    for (;;) {
+        simticks_t t1 = nextTimer1Match();
+        simticks_t t0a = nextTimer0Match(OCR0A);
+        simticks_t t0b = nextTimer0Match(OCR0B);
+        simticks_t twdt = nextWatchdog();
+        simticks_t next = t1;
+        if (t0a < next)
+            next = t0a;
+        if (t0b < next)
+            next = t0b;
+        if (twdt < next)
+            next = twdt;
+        if (next > target)
+            break;
+
+        simNow = next;
+        if (next == t1) {
+            simTimer1Base = next;
+            TIFR1 |= _BV(OCF1A);
+        }
+        if (next == t0a)
+            TIFR0 |= _BV(OCF0A);
+        if (next == t0b)
+            TIFR0 |= _BV(OCF0B);
+        if (next == twdt)
+            WDTCSR |= _BV(WDIF);
+        simDispatch();
+    }
+    if (simNow < target) // a delay inside an interrupt routine may already have passed the target
+        simNow = target;
+} // simAdvance
+
+void simHook() {
+    if (simInterruptDepth == 0)
+        simAdvance(simHookCycles);
+} // simHook
+
+uint64_t simHostNanoseconds() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+} // simHostNanoseconds
+
+void simCli() {
+    simSreg &= ~SIM_SREG_I;
+} // simCli
+
+void simSei() {
+    if (!(simSreg & SIM_SREG_I)) {
+        simSreg |= SIM_SREG_I;
+        simDispatch();
+    }
+} // simSei
+
+/** \brief Calls an interrupt routine like the CPU does: with the I-bit cleared while it runs and set again by reti. */
+static void simCallVector(void (*vector)(void)) {
+    simSreg &= ~SIM_SREG_I;
+    simInterruptDepth++;
+    if (vector)
+        vector();
+    simInterruptDepth--;
+    simSreg |= SIM_SREG_I;
+} // simCallVector
+
+void simDispatch() {
+    // Pending interrupts are served in the order of their vector numbers, as on the ATmega2560.
+    while (simSreg & SIM_SREG_I) {
+        if ((WDTCSR & _BV(WDIF)) && (WDTCSR & _BV(WDIE))) {
+            WDTCSR &= ~_BV(WDIF);
+            simCallVector(WDT_vect);
+        } else if ((TIFR1 & _BV(OCF1A)) && (TIMSK1 & _BV(OCIE1A))) {
+            TIFR1 &= ~_BV(OCF1A);
+            simCallVector(TIMER1_COMPA_vect);
+        } else if ((TIFR0 & _BV(OCF0A)) && (TIMSK0 & _BV(OCIE0A))) {
+            TIFR0 &= ~_BV(OCF0A);
+            simCallVector(TIMER0_COMPA_vect);
+        } else if ((TIFR0 & _BV(OCF0B)) && (TIMSK0 & _BV(OCIE0B))) {
+            TIFR0 &= ~_BV(OCF0B);
+            simCallVector(TIMER0_COMPB_vect);
+        } else
+            break;
+    }
+} // simDispatch
+
+SimAdcControl& SimAdcControl::operator=(int v) {
+    simAdcsra = (uint8_t)v;
+    if ((v & _BV(ADSC)) && (v & _BV(ADEN))) {
+        uint8_t channel = (simAdmux & 7) | ((simAdcsrb & _BV(MUX5)) ? 8 : 0);
+        simAdcw = simAnalogRead(channel);
+        simAdcsra = (v & ~_BV(ADSC)) | _BV(ADIF);
+    }
+    return *this;
+} // SimAdcControl::operator=
+
+static bool simTwiBusy = false;
+static bool simTwiAddressPhase = false;
+static bool simTwiReading = false;
+
+SimTwiControl& SimTwiControl::operator=(int v) {
+    simTwcr = (uint8_t)v;
+    if (!(v & _BV(TWINT)))
+        return *this;
+
+    uint8_t status;
+    if (v & _BV(TWSTA)) {
+        status = simTwiBusy ? TW_REP_START : TW_START;
+        simTwiBusy = true;
+        simTwiAddressPhase = true;
+    } else if (v & _BV(TWSTO)) {
+        simTwiBusy = false;
+        simTwcr &= ~(_BV(TWSTO) | _BV(TWINT));
+        return *this;
+    } else if (simTwiAddressPhase) {
+        simTwiReading = simTwdr & 1;
+        simTwiAddressPhase = false;
+        status = simTwiReading ? TW_MR_SLA_ACK : TW_MT_SLA_ACK;
+    } else if (simTwiReading) {
+        simTwdr = 0;
+        status = (v & _BV(TWEA)) ? TW_MR_DATA_ACK : TW_MR_DATA_NACK;
+    } else
+        status = TW_MT_DATA_ACK;
+    simTwsr = (simTwsr & ~TW_STATUS_MASK) | status;
+    return *this; // TWINT stays set: the action is complete
+} // SimTwiControl::operator=
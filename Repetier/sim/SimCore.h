@@ -0,0 +1,225 @@
+/*
+    This file is part of the Repetier-Firmware for RF devices from Conrad Electronic SE.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SIM_CORE_H
+#define SIM_CORE_H
+
+/**
+  Core of the host simulation: a virtual CPU clock and the ATmega2560 registers the firmware touches.
+
+  The firmware runs unmodified on top of these registers. Time only advances at well defined points:
+  - the main program advances the clock by simHookCycles at every call of millis(), micros(), the serial port and sei(),
+  - delay() and delayMicroseconds() advance the clock by their duration,
+  - interrupt routines take no time apart from their explicit delays.
+  Whenever the clock advances, timer 1 (CTC mode, no prescaler), timer 0 (free running, F_CPU/64) and the
+  watchdog interrupt raise their flags at the exact cycle and are dispatched in time order, when the I-bit
+  and their mask allow. So the stepper interrupt is driven by OCR1A just like on the real printer.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint64_t simticks_t;
+
+extern simticks_t simNow;        ///< Current time in CPU cycles since the start
+extern uint32_t simHookCycles;   ///< Cycles the main program spends between two hooks
+extern uint8_t simInterruptDepth; ///< Number of running interrupt routines
+
+void simAdvance(simticks_t cycles); ///< Let the virtual clock run, dispatching all interrupts which become due
+void simHook();                     ///< Called by the main program whenever it polls the hardware
+void simCli();
+void simSei();
+void simDispatch(); ///< Runs all pending and enabled interrupts
+void simReset();    ///< The firmware requested a hardware reset
+uint64_t simHostNanoseconds(); ///< Time of the host, for benchmarks of firmware code, which takes no simulated time
+
+// ---------------- I/O ports ----------------
+
+#define SIM_PORT_A 0
+#define SIM_PORT_B 1
+#define SIM_PORT_C 2
+#define SIM_PORT_D 3
+#define SIM_PORT_E 4
+#define SIM_PORT_F 5
+#define SIM_PORT_G 6
+#define SIM_PORT_H 7
+#define SIM_PORT_J 8
+#define SIM_PORT_K 9
+#define SIM_PORT_L 10
+#define SIM_PORTS 11
+
+struct SimPort {
+    uint8_t out;     ///< PORTx
+    uint8_t ddr;     ///< DDRx
+    uint8_t ext;     ///< Level the simulated machine drives on the input pins
+    uint8_t extMask; ///< Input pins which are driven by the simulated machine, the others read their pull-up
+    uint8_t watch;   ///< Output pins whose edges are reported to simPinChanged()
+};
+
+extern SimPort simPorts[SIM_PORTS];
+
+/** \brief Called when watched pins of a port changed their output level. */
+void simPinChanged(uint8_t port, uint8_t oldLevel, uint8_t newLevel);
+
+inline void simWritePort(uint8_t port, uint8_t value) {
+    SimPort& p = simPorts[port];
+    uint8_t old = p.out;
+    p.out = value;
+    if ((old ^ value) & p.watch)
+        simPinChanged(port, old, value);
+}
+
+/** \brief PORTx register */
+class SimPortOut {
+    uint8_t port;
+
+public:
+    explicit SimPortOut(uint8_t p)
+        : port(p) { }
+    operator uint8_t() const { return simPorts[port].out; }
+    // The operands are int like in the register arithmetic on the AVR, e.g. PORTA &= ~_BV(7)
+    SimPortOut& operator=(int v) {
+        simWritePort(port, (uint8_t)v);
+        return *this;
+    }
+    SimPortOut& operator|=(int v) {
+        simWritePort(port, (uint8_t)(simPorts[port].out | v));
+        return *this;
+    }
+    SimPortOut& operator&=(int v) {
+        simWritePort(port, (uint8_t)(simPorts[port].out & v));
+        return *this;
+    }
+    SimPortOut& operator^=(int v) {
+        simWritePort(port, (uint8_t)(simPorts[port].out ^ v));
+        return *this;
+    }
+    uint8_t index() const { return port; }
+};
+
+/** \brief PINx register. Outputs read their own level, inputs the simulated machine or their pull-up. Writing toggles PORTx. */
+class SimPortIn {
+    uint8_t port;
+
+public:
+    explicit SimPortIn(uint8_t p)
+        : port(p) { }
+    operator uint8_t() const {
+        const SimPort& p = simPorts[port];
+        return (p.out & (p.ddr | ~p.extMask)) | (p.ext & p.extMask & ~p.ddr);
+    }
+    SimPortIn& operator=(int v) {
+        simWritePort(port, (uint8_t)(simPorts[port].out ^ v));
+        return *this;
+    }
+};
+
+// ---------------- status register ----------------
+
+#define SIM_SREG_I 0x80
+
+extern uint8_t simSreg;
+
+class SimStatusRegister {
+public:
+    operator uint8_t() const { return simSreg; }
+    SimStatusRegister& operator=(uint8_t v) {
+        bool enable = (v & SIM_SREG_I) && !(simSreg & SIM_SREG_I);
+        simSreg = v;
+        if (enable)
+            simDispatch();
+        return *this;
+    }
+};
+
+// ---------------- timer 1 ----------------
+
+extern simticks_t simTimer1Base; ///< Time at which TCNT1 was 0
+
+class SimTimer1Counter {
+public:
+    operator uint16_t() const { return (uint16_t)(simNow - simTimer1Base); }
+    SimTimer1Counter& operator=(uint16_t v) {
+        simTimer1Base = simNow - v;
+        return *this;
+    }
+};
+
+// ---------------- timer 0 ----------------
+
+class SimTimer0Counter {
+public:
+    operator uint8_t() const { return (uint8_t)(simNow >> 6); }
+};
+
+// ---------------- ADC ----------------
+
+extern uint8_t simAdcsra;
+extern uint8_t simAdmux;
+extern uint8_t simAdcsrb;
+extern uint16_t simAdcw;
+
+/** \brief Returns the 10 bit conversion result of an analog channel. Implemented by the simulated machine. */
+uint16_t simAnalogRead(uint8_t channel);
+
+/** \brief ADCSRA register. A started conversion is finished at once. */
+class SimAdcControl {
+public:
+    operator uint8_t() const { return simAdcsra; }
+    SimAdcControl& operator=(int v);
+    SimAdcControl& operator|=(int v) { return *this = simAdcsra | v; }
+    SimAdcControl& operator&=(int v) { return *this = simAdcsra & v; }
+};
+
+// ---------------- SPI ----------------
+
+/** \brief SPSR register, every transfer is finished at once. */
+class SimSpiStatus {
+public:
+    operator uint8_t() const { return 0x80; } // SPIF
+    SimSpiStatus& operator=(uint8_t) { return *this; }
+};
+
+/** \brief SPDR register. No device answers, so MISO stays high. */
+class SimSpiData {
+public:
+    operator uint8_t() const { return 0xFF; }
+    SimSpiData& operator=(uint8_t) { return *this; }
+};
+
+// ---------------- TWI ----------------
+
+extern uint8_t simTwcr;
+extern uint8_t simTwsr;
+extern uint8_t simTwdr;
+
+/** \brief TWCR register. Every action is finished at once and every address is acknowledged. */
+class SimTwiControl {
+public:
+    operator uint8_t() const { return simTwcr; }
+    SimTwiControl& operator=(int v);
+    SimTwiControl& operator|=(int v) { return *this = simTwcr | v; }
+    SimTwiControl& operator&=(int v) { return *this = simTwcr & v; }
+};
+
+// ---------------- EEPROM ----------------
+
+#define SIM_EEPROM_SIZE 4096
+
+extern uint8_t simEeprom[SIM_EEPROM_SIZE];
+
+#endif // SIM_CORE_H
@@ -0,0 +1,412 @@
+/*
+    This file is part of the Repetier-Firmware for RF devices from Conrad Electronic SE.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+  The simulated printer around the firmware: step trace, endstops, heaters and the command line.
+
+  Trace file format (little endian):
+  - header: the 8 characters "RFSTEPS1", uint32 CPU frequency in Hz, uint32 number of channels,
+  - then one uint64 per pin edge: bits 0-55 time in CPU cycles, bits 56-59 channel (SIM_CHANNEL_*),
+    bits 60-63 event (SIM_EVENT_*).
+*/
+
+#include "Repetier.h"
+#include "SimMachine.h"
+#include "SimTrace.h"
+
+#include <math.h>
+#include <string.h>
+#include <time.h>
+
+void setup();
+void loop();
+int simParserBenchmark(const char* name, unsigned repeats);
+int simParserNumbers(unsigned long count);
+
+FILE* simGCodeFile = NULL;
+FILE* simLogFile = NULL;
+bool simLimitBaudrate = false;
+
+static FILE* simTraceFile = NULL;
+static uint64_t simSteps[SIM_CHANNELS];
+
+// ---------------- step trace and axis positions ----------------
+
+#define SIM_PIN_PORT(IO) _SIM_PIN_PORT(IO)
+#define _SIM_PIN_PORT(IO) (DIO##IO##_WPORT.index())
+#define SIM_PIN_BIT(IO) _SIM_PIN_BIT(IO)
+#define _SIM_PIN_BIT(IO) (DIO##IO##_PIN)
+
+struct SimWatchedPin {
+    uint8_t port;
+    uint8_t bit;
+    uint8_t channel;
+    uint8_t isDir;
+};
+
+static SimWatchedPin simWatched[2 * SIM_CHANNELS];
+static uint8_t simWatchedCount = 0;
+
+static void simWatch(uint8_t port, uint8_t bit, uint8_t channel, uint8_t isDir) {
+    SimWatchedPin& w = simWatched[simWatchedCount++];
+    w.port = port;
+    w.bit = bit;
+    w.channel = channel;
+    w.isDir = isDir;
+    simPorts[port].watch |= 1 << bit;
+} // simWatch
+
+#define SIM_WATCH_STEPPER(channel, stepPin, dirPin) \
+    do { \
+        simWatch(SIM_PIN_PORT(stepPin), SIM_PIN_BIT(stepPin), channel, 0); \
+        simWatch(SIM_PIN_PORT(dirPin), SIM_PIN_BIT(dirPin), channel, 1); \
+    } while (0)
+
+/** Position of the x, y and z carriage in steps. The machine is switched on in the middle of its travel. */
+static long simPosition[3];
+static long simTravel[3];
+static const bool simInvertDir[3] = { INVERT_X_DIR, INVERT_Y_DIR, INVERT_Z_DIR };
+static bool simDirLevel[SIM_CHANNELS];
+
+struct SimEndstop {
+    uint8_t port;
+    uint8_t bit;
+    uint8_t axis;
+    bool isMax;
+    bool inverting;
+};
+
+static SimEndstop simEndstops[6];
+static uint8_t simEndstopCount = 0;
+
+#define SIM_ENDSTOP(pin, a, max, inv) \
+    do { \
+        SimEndstop& e = simEndstops[simEndstopCount++]; \
+        e.port = SIM_PIN_PORT(pin); \
+        e.bit = SIM_PIN_BIT(pin); \
+        e.axis = a; \
+        e.isMax = max; \
+        e.inverting = inv; \
+        simPorts[e.port].extMask |= 1 << e.bit; \
+    } while (0)
+
+/** \brief Drives the endstop inputs of one axis from its position. */
+static void simUpdateEndstops(uint8_t axis) {
+    for (uint8_t i = 0; i < simEndstopCount; i++) {
+        const SimEndstop& e = simEndstops[i];
+        if (e.axis != axis)
+            continue;
+        bool hit = e.isMax ? simPosition[axis] >= simTravel[axis] : simPosition[axis] <= 0;
+        if (hit != e.inverting)
+            simPorts[e.port].ext |= 1 << e.bit;
+        else
+            simPorts[e.port].ext &= ~(1 << e.bit);
+    }
+} // simUpdateEndstops
+
+static void simTraceEvent(uint8_t channel, uint8_t event) {
+    if (!simTraceFile)
+        return;
+    uint64_t record = (simNow & SIM_TRACE_TIME_MASK) | ((uint64_t)channel << SIM_TRACE_CHANNEL_SHIFT) | ((uint64_t)event << SIM_TRACE_EVENT_SHIFT);
+    uint8_t bytes[8];
+    for (uint8_t i = 0; i < 8; i++)
+        bytes[i] = (uint8_t)(record >> (8 * i));
+    fwrite(bytes, 8, 1, simTraceFile);
+} // simTraceEvent
+
+void simPinChanged(uint8_t port, uint8_t oldLevel, uint8_t newLevel) {
+    uint8_t changed = oldLevel ^ newLevel;
+    for (uint8_t i = 0; i < simWatchedCount; i++) {
+        const SimWatchedPin& w = simWatched[i];
+        uint8_t mask = 1 << w.bit;
+        if (w.port != port || !(changed & mask))
+            continue;
+        bool level = (newLevel & mask) != 0;
+        if (w.isDir) {
+            simDirLevel[w.channel] = level;
+            simTraceEvent(w.channel, level ? SIM_EVENT_DIR_HIGH : SIM_EVENT_DIR_LOW);
+            continue;
+        }
+        simTraceEvent(w.channel, level ? SIM_EVENT_STEP_HIGH : SIM_EVENT_STEP_LOW);
+        if (!level)
+            continue;
+        simSteps[w.channel]++;
+        if (w.channel <= SIM_CHANNEL_Z) {
+            simPosition[w.channel] += simDirLevel[w.channel] != simInvertDir[w.channel] ? 1 : -1;
+            simUpdateEndstops(w.channel);
+        }
+    }
+} // simPinChanged
+
+static void simSetupMachine() {
+    SIM_WATCH_STEPPER(SIM_CHANNEL_X, X_STEP_PIN, X_DIR_PIN);
+    SIM_WATCH_STEPPER(SIM_CHANNEL_Y, Y_STEP_PIN, Y_DIR_PIN);
+    SIM_WATCH_STEPPER(SIM_CHANNEL_Z, Z_STEP_PIN, Z_DIR_PIN);
+    SIM_WATCH_STEPPER(SIM_CHANNEL_E0, EXT0_STEP_PIN, EXT0_DIR_PIN);
+#if NUM_EXTRUDER > 1
+    SIM_WATCH_STEPPER(SIM_CHANNEL_E1, EXT1_STEP_PIN, EXT1_DIR_PIN);
+#endif // NUM_EXTRUDER > 1
+
+#if X_MIN_PIN > -1 && MIN_HARDWARE_ENDSTOP_X
+    SIM_ENDSTOP(X_MIN_PIN, X_AXIS, false, ENDSTOP_X_MIN_INVERTING);
+#endif // X_MIN_PIN > -1 && MIN_HARDWARE_ENDSTOP_X
+#if Y_MIN_PIN > -1 && MIN_HARDWARE_ENDSTOP_Y
+    SIM_ENDSTOP(Y_MIN_PIN, Y_AXIS, false, ENDSTOP_Y_MIN_INVERTING);
+#endif // Y_MIN_PIN > -1 && MIN_HARDWARE_ENDSTOP_Y
+#if Z_MIN_PIN > -1 && MIN_HARDWARE_ENDSTOP_Z
+    SIM_ENDSTOP(Z_MIN_PIN, Z_AXIS, false, ENDSTOP_Z_MIN_INVERTING);
+#endif // Z_MIN_PIN > -1 && MIN_HARDWARE_ENDSTOP_Z
+#if X_MAX_PIN > -1 && MAX_HARDWARE_ENDSTOP_X
+    SIM_ENDSTOP(X_MAX_PIN, X_AXIS, true, ENDSTOP_X_MAX_INVERTING);
+#endif // X_MAX_PIN > -1 && MAX_HARDWARE_ENDSTOP_X
+#if Y_MAX_PIN > -1 && MAX_HARDWARE_ENDSTOP_Y
+    SIM_ENDSTOP(Y_MAX_PIN, Y_AXIS, true, ENDSTOP_Y_MAX_INVERTING);
+#endif // Y_MAX_PIN > -1 && MAX_HARDWARE_ENDSTOP_Y
+#if Z_MAX_PIN > -1 && MAX_HARDWARE_ENDSTOP_Z && Z_MAX_PIN != Z_MIN_PIN
+    SIM_ENDSTOP(Z_MAX_PIN, Z_AXIS, true, ENDSTOP_Z_MAX_INVERTING);
+#endif // Z_MAX_PIN > -1 && MAX_HARDWARE_ENDSTOP_Z && Z_MAX_PIN != Z_MIN_PIN
+
+    // the RF1000 has no type EEPROM, the firmware tells the printers apart by it
+    simI2cEepromsPresent = 1 << (I2C_ADDRESS_EXTERNAL_EEPROM - SIM_I2C_EEPROM_FIRST);
+#if MOTHERBOARD != DEVICE_TYPE_RF1000
+    simI2cEepromsPresent |= 1 << (I2C_ADDRESS_TYPE_EEPROM - SIM_I2C_EEPROM_FIRST);
+#endif // MOTHERBOARD != DEVICE_TYPE_RF1000
+
+    for (uint8_t axis = X_AXIS; axis <= Z_AXIS; axis++) {
+        simTravel[axis] = 1000000L; // until the firmware read its EEPROM
+        simPosition[axis] = simTravel[axis] / 2;
+        simUpdateEndstops(axis);
+    }
+} // simSetupMachine
+
+/** \brief Sets the travel of the axes from the configuration of the firmware, keeping the carriages in the middle. */
+static void simSetupTravel() {
+    for (uint8_t axis = X_AXIS; axis <= Z_AXIS; axis++) {
+        simTravel[axis] = (long)(Printer::axisLengthMM[axis] * Printer::axisStepsPerMM[axis]);
+        simPosition[axis] = simTravel[axis] / 2;
+        simUpdateEndstops(axis);
+    }
+} // simSetupTravel
+
+// ---------------- heaters ----------------
+
+#define SIM_AMBIENT_TEMPERATURE 25.0f
+#define SIM_EXTRUDER_HEATING_RATE 10.0f ///< [degC/s] at full power and ambient temperature
+#define SIM_EXTRUDER_MAX_TEMPERATURE 450.0f ///< [degC] reached at full power, so 200 degC need about 40 % like a real hot end
+#define SIM_BED_HEATING_RATE 1.0f ///< [degC/s] at full power and ambient temperature
+#define SIM_BED_MAX_TEMPERATURE 150.0f ///< [degC] reached at full power
+
+static float simTemperature[NUM_TEMPERATURE_LOOPS];
+static simticks_t simTemperatureTime[NUM_TEMPERATURE_LOOPS];
+
+/** \brief Integrates the temperature of a heater since the last reading.
+The heater is a single thermal mass which gains heat in proportion to its pwm output and loses it in proportion
+to its difference to the ambient temperature, so the temperature controller of the firmware closes the loop. */
+static float simUpdateTemperature(uint8_t i) {
+    TemperatureController* tc = tempController[i];
+    bool isBed = tc->pwmIndex == NUM_EXTRUDER;
+    float rate = isBed ? SIM_BED_HEATING_RATE : SIM_EXTRUDER_HEATING_RATE;
+    float loss = rate / ((isBed ? SIM_BED_MAX_TEMPERATURE : SIM_EXTRUDER_MAX_TEMPERATURE) - SIM_AMBIENT_TEMPERATURE); // [1/s]
+    float dt = (float)(simNow - simTemperatureTime[i]) / F_CPU;
+    float steady = SIM_AMBIENT_TEMPERATURE + rate * pwm_pos[tc->pwmIndex] / (255.0f * loss);
+    float& t = simTemperature[i];
+
+    simTemperatureTime[i] = simNow;
+    t = steady + (t - steady) * expf(-loss * dt);
+    return t;
+} // simUpdateTemperature
+
+/** \brief Inverse of TemperatureController::updateCurrentTemperature(): the table key of a temperature. */
+static int simKeyFromTemperature(uint8_t type, float temperature) {
+    if (type == 60)
+        return (int)(temperature * 4096.0f / 1000.0f);
+    if (type == 100)
+        return (int)(temperature * 4096.0f / 500.0f);
+    if (type >= 50 && type <= 52)
+        type -= 45;
+    else if (type == 53)
+        type -= 38;
+    else if (type < 1 || type > 14)
+        return 2048;
+    type--;
+
+    uint8_t num = pgm_read_byte(&temptables_num[type]);
+    const int16_t* table = (const int16_t*)pgm_read_word(&temptables[type]);
+    if (!table || num < 2)
+        return 2048;
+    for (uint8_t i = 1; i < num; i++) {
+        float oldKey = table[2 * i - 2], oldTemp = TEMP_INT_TO_FLOAT(table[2 * i - 1]);
+        float newKey = table[2 * i], newTemp = TEMP_INT_TO_FLOAT(table[2 * i + 1]);
+        if ((temperature >= oldTemp && temperature <= newTemp) || (temperature <= oldTemp && temperature >= newTemp))
+            return (int)(oldKey + (temperature - oldTemp) * (newKey - oldKey) / (newTemp - oldTemp) + 0.5f);
+    }
+    return table[2 * num - 2];
+} // simKeyFromTemperature
+
+/** \brief The ADC value which makes the firmware read this temperature. Its input value is the sum of 32 conversions >> 3, which the tables use as key. */
+static uint16_t simAdcFromTemperature(uint8_t type, float temperature) {
+    int adc = simKeyFromTemperature(type, temperature) >> 2;
+    return adc < 0 ? 0 : (adc > 1023 ? 1023 : adc);
+} // simAdcFromTemperature
+
+uint16_t simAnalogRead(uint8_t channel) {
+    for (uint8_t i = 0; i < NUM_TEMPERATURE_LOOPS; i++) {
+        TemperatureController* tc = tempController[i];
+        if (pgm_read_byte(&osAnalogInputChannels[tc->sensorPin]) == channel)
+            return simAdcFromTemperature(tc->sensorType, simUpdateTemperature(i));
+    }
+#if RESERVE_ANALOG_INPUTS
+    if (pgm_read_byte(&osAnalogInputChannels[optTempController.sensorPin]) == channel)
+        return simAdcFromTemperature(optTempController.sensorType, SIM_AMBIENT_TEMPERATURE);
+#endif // RESERVE_ANALOG_INPUTS
+    return 512;
+} // simAnalogRead
+
+// ---------------- command line ----------------
+
+static void simUsage(const char* name) {
+    fprintf(stderr,
+            "usage: %s [options] file.gcode\n"
+            "  -t file   write the binary step trace to file (default steps.bin)\n"
+            "  -l file   write the serial output to file (default stdout)\n"
+            "  -e file   load the EEPROM from file and store it there at the end\n"
+            "  -b        deliver the G-code at the baud rate of the firmware instead of at once\n"
+            "  -c cycles CPU cycles the main program needs between two hardware accesses (default %u)\n"
+            "  -m secs   stop after this simulated time (default 86400)\n"
+            "  -p count  parse the G-code count times instead of printing it and report the lines per second\n"
+            "  -n count  compare the number decoder with strtof() for count random values instead of printing, no G-code file\n",
+            name, (unsigned)simHookCycles);
+} // simUsage
+
+static bool simIdle() {
+    return simInputFinished() && GCode::peekCurrentCommand() == NULL && !PrintLine::hasLines() && PrintLine::direct.task == TASK_NO_TASK && Printer::extruderStepsNeeded == 0;
+} // simIdle
+
+int main(int argc, char** argv) {
+    const char* traceName = "steps.bin";
+    const char* logName = NULL;
+    const char* eepromName = NULL;
+    double maxSeconds = 86400;
+    const char* gcodeName = NULL;
+    unsigned parseRepeats = 0;
+    unsigned long numberCount = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-t") && i + 1 < argc)
+            traceName = argv[++i];
+        else if (!strcmp(argv[i], "-l") && i + 1 < argc)
+            logName = argv[++i];
+        else if (!strcmp(argv[i], "-e") && i + 1 < argc)
+            eepromName = argv[++i];
+        else if (!strcmp(argv[i], "-b"))
+            simLimitBaudrate = true;
+        else if (!strcmp(argv[i], "-c") && i + 1 < argc)
+            simHookCycles = (uint32_t)strtoul(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "-m") && i + 1 < argc)
+            maxSeconds = strtod(argv[++i], NULL);
+        else if (!strcmp(argv[i], "-p") && i + 1 < argc)
+            parseRepeats = (unsigned)strtoul(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+            numberCount = strtoul(argv[++i], NULL, 10);
+        else if (argv[i][0] != '-' && !gcodeName)
+            gcodeName = argv[i];
+        else {
+            simUsage(argv[0]);
+            return 2;
+        }
+    }
+    if ((!gcodeName && !numberCount) || simHookCycles == 0) {
+        simUsage(argv[0]);
+        return 2;
+    }
+
+    // the parser checks read the G-code themselves, the firmware gets no input
+    simGCodeFile = (gcodeName && !parseRepeats ? fopen(gcodeName, "rb") : NULL);
+    if (gcodeName && !parseRepeats && !simGCodeFile) {
+        perror(gcodeName);
+        return 1;
+    }
+    simLogFile = logName ? fopen(logName, "w") : stdout;
+    if (!simLogFile) {
+        perror(logName);
+        return 1;
+    }
+    simTraceFile = fopen(traceName, "wb");
+    if (!simTraceFile) {
+        perror(traceName);
+        return 1;
+    }
+    fwrite(SIM_TRACE_MAGIC, 8, 1, simTraceFile);
+    uint32_t header[2] = { (uint32_t)F_CPU, SIM_CHANNELS };
+    fwrite(header, sizeof(header), 1, simTraceFile);
+
+    memset(simEeprom, 0xFF, sizeof(simEeprom));
+    if (eepromName) {
+        FILE* f = fopen(eepromName, "rb");
+        if (f) {
+            if (fread(simEeprom, 1, sizeof(simEeprom), f) != sizeof(simEeprom))
+                fprintf(stderr, "%s: short EEPROM image, the rest stays erased\n", eepromName);
+            fclose(f);
+        }
+    }
+
+    clock_t started = clock();
+    simticks_t maxTicks = (simticks_t)(maxSeconds * F_CPU);
+
+    // Arduino core: timer 0 runs free with F_CPU/64, interrupts are enabled before setup().
+    TCCR0B = _BV(CS01) | _BV(CS00);
+    simSetupMachine();
+    for (uint8_t i = 0; i < NUM_TEMPERATURE_LOOPS; i++) {
+        simTemperature[i] = SIM_AMBIENT_TEMPERATURE;
+        simTemperatureTime[i] = simNow;
+    }
+    simSei();
+    setup();
+    simSetupTravel();
+    if (parseRepeats)
+        return simParserBenchmark(gcodeName, parseRepeats);
+    if (numberCount)
+        return simParserNumbers(numberCount);
+
+    while (!simIdle() && simNow < maxTicks) {
+        loop();
+        simHook();
+    }
+
+    fflush(simLogFile);
+    fclose(simTraceFile);
+    if (eepromName) {
+        FILE* f = fopen(eepromName, "wb");
+        if (f) {
+            fwrite(simEeprom, 1, sizeof(simEeprom), f);
+            fclose(f);
+        }
+    }
+
+    fprintf(stderr, "simulated %.3f s in %.3f s, steps x=%llu y=%llu z=%llu e0=%llu e1=%llu%s\n",
+            (double)simNow / F_CPU, (double)(clock() - started) / CLOCKS_PER_SEC,
+            (unsigned long long)simSteps[SIM_CHANNEL_X], (unsigned long long)simSteps[SIM_CHANNEL_Y],
+            (unsigned long long)simSteps[SIM_CHANNEL_Z], (unsigned long long)simSteps[SIM_CHANNEL_E0],
+            (unsigned long long)simSteps[SIM_CHANNEL_E1], simNow >= maxTicks ? ", time limit reached" : "");
+    return simNow >= maxTicks ? 3 : 0;
+} // main
+
+void simReset() {
+    fflush(simLogFile);
+    fprintf(stderr, "firmware requested a reset at %.3f s\n", (double)simNow / F_CPU);
+    exit(4);
+} // simReset
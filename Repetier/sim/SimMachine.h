@@ -0,0 +1,34 @@
+/*
+    This file is part of the Repetier-Firmware for RF devices from Conrad Electronic SE.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SIM_MACHINE_H
+#define SIM_MACHINE_H
+
+/** Interface between the simulated Arduino core and the simulated printer. */
+
+#include <stdio.h>
+#include "SimCore.h"
+
+extern FILE* simGCodeFile; ///< Input of the serial port
+extern FILE* simLogFile;   ///< Output of the serial port
+extern bool simLimitBaudrate; ///< Deliver the G-code not faster than the baud rate the firmware set up
+#define SIM_I2C_EEPROM_FIRST 0x50   ///< I2C address of the first 24Cxx EEPROM
+extern uint8_t simI2cEepromsPresent; ///< Bit n is set if a 24Cxx EEPROM answers at the I2C address SIM_I2C_EEPROM_FIRST + n
+
+bool simInputFinished(); ///< All bytes of the G-code file were read by the firmware
+
+#endif // SIM_MACHINE_H
@@ -0,0 +1,101 @@
+/*
+    This file is part of the Repetier-Firmware for RF devices from Conrad Electronic SE.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+  Host checks of the ASCII parser of the firmware, they run after setup() instead of the printer:
+  - the parser benchmark hands every line of a G-code file to GCode::parseAscii() and measures the host time,
+  - the number check compares GCode::parseFloatValue() with strtof() for random values as a slicer writes them.
+*/
+
+#include "Repetier.h"
+#include "SimMachine.h"
+
+#include <string.h>
+#include <vector>
+#include <string>
+
+/** Makes the number decoder of the firmware accessible. */
+class SimGCode : public GCode {
+public:
+    using GCode::parseFloatValue;
+};
+
+int simParserBenchmark(const char* name, unsigned repeats) {
+    FILE* f = fopen(name, "r");
+    if (!f) {
+        perror(name);
+        return 1;
+    }
+    std::vector<std::string> lines;
+    char line[MAX_CMD_SIZE + 2];
+    while (fgets(line, sizeof(line), f)) {
+        line[strcspn(line, "\r\n")] = 0;
+        lines.push_back(line);
+    }
+    fclose(f);
+
+    SimGCode code;
+    char command[MAX_CMD_SIZE + 2];
+    unsigned long parsed = 0, failed = 0;
+    uint64_t started = simHostNanoseconds();
+    for (unsigned r = 0; r < repeats; r++) {
+        for (size_t i = 0; i < lines.size(); i++) {
+            // the firmware parses a copy in commandReceiving too
+            strcpy(command, lines[i].c_str());
+            if (!code.parseAscii(command, true))
+                failed++;
+            parsed++;
+        }
+    }
+    double seconds = (simHostNanoseconds() - started) * 1e-9;
+    printf("parser: %lu lines in %.3f s, %.0f lines/s, %lu rejected, FEATURE_FAST_ASCII_PARSER = %d\n",
+           parsed, seconds, seconds > 0 ? parsed / seconds : 0.0, failed, FEATURE_FAST_ASCII_PARSER);
+    return failed ? 1 : 0;
+} // simParserBenchmark
+
+int simParserNumbers(unsigned long count) {
+    SimGCode code;
+    uint32_t seed = 12345;
+    unsigned long differ = 0;
+    char text[32];
+    for (unsigned long i = 0; i < count; i++) {
+        // coordinates, extrusion and feedrates: up to 4 integer and 5 fractional digits, with and without sign
+        seed = seed * 1664525UL + 1013904223UL;
+        uint32_t integer = (seed >> 8) % 10000;
+        seed = seed * 1664525UL + 1013904223UL;
+        uint8_t decimals = (seed >> 8) % 6;
+        seed = seed * 1664525UL + 1013904223UL;
+        uint32_t fraction = (seed >> 8) % 100000;
+        static const uint32_t scale[6] = { 1, 10, 100, 1000, 10000, 100000 };
+        const char* sign = ((seed >> 28) == 0 ? "-" : ((seed >> 28) == 1 ? "+" : ""));
+        if (decimals)
+            snprintf(text, sizeof(text), "%s%u.%0*u", sign, (unsigned)integer, decimals, (unsigned)(fraction % scale[decimals]));
+        else
+            snprintf(text, sizeof(text), "%s%u", sign, (unsigned)integer);
+
+        float expected = strtof(text, NULL);
+        char* pos = text;
+        float value = code.parseFloatValue(pos);
+        if (memcmp(&value, &expected, sizeof(float)) != 0) {
+            if (differ < 10)
+                printf("numbers: %s is %.9g instead of %.9g\n", text, (double)value, (double)expected);
+            differ++;
+        }
+    }
+    printf("numbers: %lu of %lu values differ from strtof(), FEATURE_FAST_ASCII_PARSER = %d\n", differ, count, FEATURE_FAST_ASCII_PARSER);
+    return differ ? 1 : 0;
+} // simParserNumbers
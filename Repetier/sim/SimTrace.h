@@ -0,0 +1,42 @@
+/*
+    This file is part of the Repetier-Firmware for RF devices from Conrad Electronic SE.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SIM_TRACE_H
+#define SIM_TRACE_H
+
+/** Format of the binary step trace, shared by the simulator and the steptrace tool. */
+
+#define SIM_TRACE_MAGIC "RFSTEPS1"
+#define SIM_TRACE_HEADER_SIZE 16
+
+#define SIM_CHANNEL_X 0
+#define SIM_CHANNEL_Y 1
+#define SIM_CHANNEL_Z 2
+#define SIM_CHANNEL_E0 3
+#define SIM_CHANNEL_E1 4
+#define SIM_CHANNELS 5
+
+#define SIM_EVENT_STEP_LOW 0
+#define SIM_EVENT_STEP_HIGH 1
+#define SIM_EVENT_DIR_LOW 2
+#define SIM_EVENT_DIR_HIGH 3
+
+#define SIM_TRACE_TIME_MASK ((1ULL << 56) - 1)
+#define SIM_TRACE_CHANNEL_SHIFT 56
+#define SIM_TRACE_EVENT_SHIFT 60
+
+#endif // SIM_TRACE_H
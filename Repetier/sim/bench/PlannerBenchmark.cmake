@@ -0,0 +1,41 @@
+# Runs every G-code stream on every variant of the simulation and prints the time of the path planner per segment (M3202).
+#
+#   cmake -DSIMS=rfsim-planner-16,rfsim-planner-24 -DGCODES=curves.gcode,arcs.gcode -DOUTPUT=name -P PlannerBenchmark.cmake
+#
+# The lists are separated by commas. The serial output of each run is written to OUTPUT-<sim>-<stream>.log.
+
+foreach(variable SIMS GCODES OUTPUT)
+  if(NOT DEFINED ${variable})
+    message(FATAL_ERROR "PlannerBenchmark.cmake: ${variable} is not set")
+  endif()
+endforeach()
+string(REPLACE "," ";" SIMS "${SIMS}")
+string(REPLACE "," ";" GCODES "${GCODES}")
+
+foreach(gcode ${GCODES})
+  get_filename_component(stream ${gcode} NAME_WE)
+  message("${stream}: per segment [ns]")
+  foreach(sim ${SIMS})
+    get_filename_component(sim_name ${sim} NAME_WE)
+    set(log ${OUTPUT}-${sim_name}-${stream}.log)
+    execute_process(COMMAND ${sim} -t ${OUTPUT}.bin -l ${log} ${gcode} RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+      message(FATAL_ERROR "${sim} failed with ${result}")
+    endif()
+
+    # the last M3202 of the stream holds the result
+    file(STRINGS ${log} lines REGEX "Planner timing: |: calls = ")
+    set(row "")
+    foreach(line ${lines})
+      if(line MATCHES "Planner timing: segments = ([0-9]+), MOVE_CACHE_SIZE = ([0-9]+)")
+        set(row "  MOVE_CACHE_SIZE = ${CMAKE_MATCH_2}, segments = ${CMAKE_MATCH_1}")
+      elseif(line MATCHES "([A-Za-z]+): calls = .*per segment = ([0-9.]+)")
+        set(row "${row}, ${CMAKE_MATCH_1} = ${CMAKE_MATCH_2}")
+      endif()
+    endforeach()
+    if(row STREQUAL "")
+      message(FATAL_ERROR "${log} contains no planner timing")
+    endif()
+    message("${row}")
+  endforeach()
+endforeach()
@@ -0,0 +1,131 @@
+; Planner benchmark: arcs of G2 / G3 in alternating directions with extrusion.
+G28
+M109 S200
+G92 E0
+G1 Z0.3 F600
+M400
+M3202 S1
+G1 X60 Y90 F6000
+G2 X64.000 Y90 I2.000 J0 E0.2073 F3600
+G3 X70.000 Y90 I3.000 J0 E0.5184 F3600
+G2 X78.000 Y90 I4.000 J0 E0.9331 F3600
+G3 X88.000 Y90 I5.000 J0 E1.4514 F3600
+G2 X100.000 Y90 I6.000 J0 E2.0735 F3600
+G3 X114.000 Y90 I7.000 J0 E2.7992 F3600
+G2 X98.000 Y90 I-8.000 J0 E3.6285 F3600
+G3 X102.000 Y90 I2.000 J0 E3.8359 F3600
+G2 X108.000 Y90 I3.000 J0 E4.1469 F3600
+G3 X116.000 Y90 I4.000 J0 E4.5616 F3600
+G2 X106.000 Y90 I-5.000 J0 E5.0800 F3600
+G3 X118.000 Y90 I6.000 J0 E5.7020 F3600
+G2 X104.000 Y90 I-7.000 J0 E6.4277 F3600
+G3 X88.000 Y90 I-8.000 J0 E7.2571 F3600
+G2 X92.000 Y90 I2.000 J0 E7.4644 F3600
+G3 X98.000 Y90 I3.000 J0 E7.7754 F3600
+G2 X106.000 Y90 I4.000 J0 E8.1901 F3600
+G3 X116.000 Y90 I5.000 J0 E8.7085 F3600
+G2 X104.000 Y90 I-6.000 J0 E9.3305 F3600
+G3 X118.000 Y90 I7.000 J0 E10.0562 F3600
+G2 X102.000 Y90 I-8.000 J0 E10.8856 F3600
+G3 X106.000 Y90 I2.000 J0 E11.0930 F3600
+G2 X112.000 Y90 I3.000 J0 E11.4040 F3600
+G3 X104.000 Y90 I-4.000 J0 E11.8187 F3600
+G2 X114.000 Y90 I5.000 J0 E12.3370 F3600
+G3 X102.000 Y90 I-6.000 J0 E12.9591 F3600
+G2 X116.000 Y90 I7.000 J0 E13.6848 F3600
+G3 X100.000 Y90 I-8.000 J0 E14.5142 F3600
+G2 X104.000 Y90 I2.000 J0 E14.7215 F3600
+G3 X110.000 Y90 I3.000 J0 E15.0325 F3600
+G2 X118.000 Y90 I4.000 J0 E15.4472 F3600
+G3 X108.000 Y90 I-5.000 J0 E15.9656 F3600
+G2 X96.000 Y90 I-6.000 J0 E16.5876 F3600
+G3 X110.000 Y90 I7.000 J0 E17.3133 F3600
+G2 X94.000 Y90 I-8.000 J0 E18.1427 F3600
+G3 X98.000 Y90 I2.000 J0 E18.3500 F3600
+G2 X104.000 Y90 I3.000 J0 E18.6611 F3600
+G3 X112.000 Y90 I4.000 J0 E19.0758 F3600
+G2 X102.000 Y90 I-5.000 J0 E19.5941 F3600
+G3 X114.000 Y90 I6.000 J0 E20.2161 F3600
+G2 X100.000 Y90 I-7.000 J0 E20.9419 F3600
+G3 X116.000 Y90 I8.000 J0 E21.7712 F3600
+G2 X112.000 Y90 I-2.000 J0 E21.9786 F3600
+G3 X118.000 Y90 I3.000 J0 E22.2896 F3600
+G2 X110.000 Y90 I-4.000 J0 E22.7043 F3600
+G3 X100.000 Y90 I-5.000 J0 E23.2227 F3600
+G2 X112.000 Y90 I6.000 J0 E23.8447 F3600
+G3 X98.000 Y90 I-7.000 J0 E24.5704 F3600
+G2 X114.000 Y90 I8.000 J0 E25.3998 F3600
+G3 X118.000 Y90 I2.000 J0 E25.6071 F3600
+G2 X112.000 Y90 I-3.000 J0 E25.9181 F3600
+G3 X104.000 Y90 I-4.000 J0 E26.3328 F3600
+G2 X114.000 Y90 I5.000 J0 E26.8512 F3600
+G3 X102.000 Y90 I-6.000 J0 E27.4732 F3600
+G2 X116.000 Y90 I7.000 J0 E28.1989 F3600
+G3 X100.000 Y90 I-8.000 J0 E29.0283 F3600
+G2 X104.000 Y90 I2.000 J0 E29.2357 F3600
+G3 X110.000 Y90 I3.000 J0 E29.5467 F3600
+G2 X118.000 Y90 I4.000 J0 E29.9614 F3600
+G3 X108.000 Y90 I-5.000 J0 E30.4797 F3600
+G2 X96.000 Y90 I-6.000 J0 E31.1018 F3600
+G3 X110.000 Y90 I7.000 J0 E31.8275 F3600
+G2 X94.000 Y90 I-8.000 J0 E32.6569 F3600
+G3 X98.000 Y90 I2.000 J0 E32.8642 F3600
+G2 X104.000 Y90 I3.000 J0 E33.1752 F3600
+G3 X112.000 Y90 I4.000 J0 E33.5899 F3600
+G2 X102.000 Y90 I-5.000 J0 E34.1083 F3600
+G3 X114.000 Y90 I6.000 J0 E34.7303 F3600
+G2 X100.000 Y90 I-7.000 J0 E35.4560 F3600
+G3 X116.000 Y90 I8.000 J0 E36.2854 F3600
+G2 X112.000 Y90 I-2.000 J0 E36.4927 F3600
+G3 X118.000 Y90 I3.000 J0 E36.8038 F3600
+G2 X110.000 Y90 I-4.000 J0 E37.2184 F3600
+G3 X100.000 Y90 I-5.000 J0 E37.7368 F3600
+G2 X112.000 Y90 I6.000 J0 E38.3588 F3600
+G3 X98.000 Y90 I-7.000 J0 E39.0846 F3600
+G2 X114.000 Y90 I8.000 J0 E39.9139 F3600
+G3 X118.000 Y90 I2.000 J0 E40.1213 F3600
+G2 X112.000 Y90 I-3.000 J0 E40.4323 F3600
+G3 X104.000 Y90 I-4.000 J0 E40.8470 F3600
+G2 X114.000 Y90 I5.000 J0 E41.3654 F3600
+G3 X102.000 Y90 I-6.000 J0 E41.9874 F3600
+G2 X116.000 Y90 I7.000 J0 E42.7131 F3600
+G3 X100.000 Y90 I-8.000 J0 E43.5425 F3600
+G2 X104.000 Y90 I2.000 J0 E43.7498 F3600
+G3 X110.000 Y90 I3.000 J0 E44.0608 F3600
+G2 X118.000 Y90 I4.000 J0 E44.4755 F3600
+G3 X108.000 Y90 I-5.000 J0 E44.9939 F3600
+G2 X96.000 Y90 I-6.000 J0 E45.6159 F3600
+G3 X110.000 Y90 I7.000 J0 E46.3416 F3600
+G2 X94.000 Y90 I-8.000 J0 E47.1710 F3600
+G3 X98.000 Y90 I2.000 J0 E47.3784 F3600
+G2 X104.000 Y90 I3.000 J0 E47.6894 F3600
+G3 X112.000 Y90 I4.000 J0 E48.1041 F3600
+G2 X102.000 Y90 I-5.000 J0 E48.6224 F3600
+G3 X114.000 Y90 I6.000 J0 E49.2445 F3600
+G2 X100.000 Y90 I-7.000 J0 E49.9702 F3600
+G3 X116.000 Y90 I8.000 J0 E50.7996 F3600
+G2 X112.000 Y90 I-2.000 J0 E51.0069 F3600
+G3 X118.000 Y90 I3.000 J0 E51.3179 F3600
+G2 X110.000 Y90 I-4.000 J0 E51.7326 F3600
+G3 X100.000 Y90 I-5.000 J0 E52.2510 F3600
+G2 X112.000 Y90 I6.000 J0 E52.8730 F3600
+G3 X98.000 Y90 I-7.000 J0 E53.5987 F3600
+G2 X114.000 Y90 I8.000 J0 E54.4281 F3600
+G3 X118.000 Y90 I2.000 J0 E54.6354 F3600
+G2 X112.000 Y90 I-3.000 J0 E54.9465 F3600
+G3 X104.000 Y90 I-4.000 J0 E55.3611 F3600
+G2 X114.000 Y90 I5.000 J0 E55.8795 F3600
+G3 X102.000 Y90 I-6.000 J0 E56.5015 F3600
+G2 X116.000 Y90 I7.000 J0 E57.2273 F3600
+G3 X100.000 Y90 I-8.000 J0 E58.0566 F3600
+G2 X104.000 Y90 I2.000 J0 E58.2640 F3600
+G3 X110.000 Y90 I3.000 J0 E58.5750 F3600
+G2 X118.000 Y90 I4.000 J0 E58.9897 F3600
+G3 X108.000 Y90 I-5.000 J0 E59.5080 F3600
+G2 X96.000 Y90 I-6.000 J0 E60.1301 F3600
+G3 X110.000 Y90 I7.000 J0 E60.8558 F3600
+G2 X94.000 Y90 I-8.000 J0 E61.6852 F3600
+G3 X98.000 Y90 I2.000 J0 E61.8925 F3600
+M400
+M3202
+M104 S0
@@ -0,0 +1,3011 @@
+; Planner benchmark: organic curves of about 0.4 mm segments with extrusion.
+G28
+M109 S200
+G92 E0
+G1 Z0.3 F600
+M400
+M3202 S1
+G1 X117.524 Y90.000 F6000
+G1 X117.899 Y90.175 E0.0136 F3600
+G1 X118.255 Y90.355 E0.0268 F3600
+G1 X118.590 Y90.539 E0.0394 F3600
+G1 X118.905 Y90.727 E0.0515 F3600
+G1 X119.198 Y90.918 E0.0630 F3600
+G1 X119.468 Y91.111 E0.0740 F3600
+G1 X119.716 Y91.308 E0.0845 F3600
+G1 X119.941 Y91.506 E0.0944 F3600
+G1 X120.143 Y91.706 E0.1038 F3600
+G1 X120.322 Y91.908 E0.1126 F3600
+G1 X120.477 Y92.110 E0.1211 F3600
+G1 X120.610 Y92.312 E0.1290 F3600
+G1 X120.720 Y92.515 E0.1366 F3600
+G1 X120.808 Y92.717 E0.1439 F3600
+G1 X120.874 Y92.918 E0.1509 F3600
+G1 X120.920 Y93.119 E0.1577 F3600
+G1 X120.946 Y93.318 E0.1643 F3600
+G1 X120.954 Y93.516 E0.1709 F3600
+G1 X120.943 Y93.712 E0.1773 F3600
+G1 X120.916 Y93.906 E0.1838 F3600
+G1 X120.873 Y94.097 E0.1903 F3600
+G1 X120.816 Y94.287 E0.1968 F3600
+G1 X120.746 Y94.474 E0.2034 F3600
+G1 X120.665 Y94.660 E0.2101 F3600
+G1 X120.574 Y94.842 E0.2168 F3600
+G1 X120.474 Y95.023 E0.2236 F3600
+G1 X120.367 Y95.202 E0.2305 F3600
+G1 X120.255 Y95.378 E0.2374 F3600
+G1 X120.138 Y95.553 E0.2444 F3600
+G1 X120.019 Y95.726 E0.2513 F3600
+G1 X119.898 Y95.898 E0.2582 F3600
+G1 X119.778 Y96.069 E0.2651 F3600
+G1 X119.659 Y96.239 E0.2720 F3600
+G1 X119.542 Y96.409 E0.2788 F3600
+G1 X119.430 Y96.578 E0.2855 F3600
+G1 X119.322 Y96.748 E0.2921 F3600
+G1 X119.221 Y96.918 E0.2987 F3600
+G1 X119.126 Y97.089 E0.3051 F3600
+G1 X119.040 Y97.262 E0.3115 F3600
+G1 X118.961 Y97.436 E0.3178 F3600
+G1 X118.892 Y97.612 E0.3240 F3600
+G1 X118.833 Y97.791 E0.3302 F3600
+G1 X118.784 Y97.972 E0.3364 F3600
+G1 X118.745 Y98.156 E0.3426 F3600
+G1 X118.716 Y98.343 E0.3489 F3600
+G1 X118.698 Y98.533 E0.3552 F3600
+G1 X118.690 Y98.728 E0.3616 F3600
+G1 X118.693 Y98.926 E0.3681 F3600
+G1 X118.705 Y99.128 E0.3748 F3600
+G1 X118.727 Y99.334 E0.3817 F3600
+G1 X118.757 Y99.544 E0.3887 F3600
+G1 X118.795 Y99.758 E0.3958 F3600
+G1 X118.841 Y99.976 E0.4032 F3600
+G1 X118.893 Y100.197 E0.4107 F3600
+G1 X118.950 Y100.423 E0.4184 F3600
+G1 X119.012 Y100.651 E0.4262 F3600
+G1 X119.076 Y100.883 E0.4341 F3600
+G1 X119.143 Y101.117 E0.4422 F3600
+G1 X119.211 Y101.354 E0.4503 F3600
+G1 X119.278 Y101.592 E0.4584 F3600
+G1 X119.343 Y101.832 E0.4666 F3600
+G1 X119.405 Y102.072 E0.4748 F3600
+G1 X119.462 Y102.312 E0.4830 F3600
+G1 X119.514 Y102.552 E0.4911 F3600
+G1 X119.558 Y102.791 E0.4991 F3600
+G1 X119.593 Y103.027 E0.5070 F3600
+G1 X119.618 Y103.261 E0.5147 F3600
+G1 X119.631 Y103.491 E0.5223 F3600
+G1 X119.632 Y103.717 E0.5298 F3600
+G1 X119.620 Y103.938 E0.5371 F3600
+G1 X119.592 Y104.153 E0.5442 F3600
+G1 X119.548 Y104.360 E0.5512 F3600
+G1 X119.487 Y104.561 E0.5582 F3600
+G1 X119.408 Y104.752 E0.5650 F3600
+G1 X119.311 Y104.935 E0.5718 F3600
+G1 X119.194 Y105.107 E0.5787 F3600
+G1 X119.058 Y105.269 E0.5857 F3600
+G1 X118.901 Y105.419 E0.5928 F3600
+G1 X118.723 Y105.556 E0.6003 F3600
+G1 X118.524 Y105.681 E0.6080 F3600
+G1 X118.304 Y105.793 E0.6161 F3600
+G1 X118.064 Y105.891 E0.6247 F3600
+G1 X117.802 Y105.974 E0.6338 F3600
+G1 X117.519 Y106.042 E0.6434 F3600
+G1 X117.217 Y106.096 E0.6535 F3600
+G1 X116.894 Y106.134 E0.6642 F3600
+G1 X116.553 Y106.157 E0.6755 F3600
+G1 X116.193 Y106.164 E0.6874 F3600
+G1 X115.816 Y106.156 E0.6998 F3600
+G1 X115.422 Y106.133 E0.7129 F3600
+G1 X115.012 Y106.095 E0.7264 F3600
+G1 X114.588 Y106.041 E0.7405 F3600
+G1 X114.151 Y105.973 E0.7551 F3600
+G1 X113.703 Y105.891 E0.7702 F3600
+G1 X113.243 Y105.796 E0.7857 F3600
+G1 X112.775 Y105.688 E0.8015 F3600
+G1 X112.299 Y105.568 E0.8177 F3600
+G1 X111.817 Y105.436 E0.8342 F3600
+G1 X111.331 Y105.294 E0.8509 F3600
+G1 X110.841 Y105.142 E0.8678 F3600
+G1 X110.351 Y104.982 E0.8849 F3600
+G1 X109.860 Y104.814 E0.9020 F3600
+G1 X109.372 Y104.640 E0.9191 F3600
+G1 X108.887 Y104.461 E0.9362 F3600
+G1 X108.407 Y104.278 E0.9531 F3600
+G1 X107.933 Y104.091 E0.9699 F3600
+G1 X107.467 Y103.904 E0.9865 F3600
+G1 X107.010 Y103.716 E1.0028 F3600
+G1 X106.564 Y103.529 E1.0188 F3600
+G1 X106.130 Y103.344 E1.0343 F3600
+G1 X105.709 Y103.162 E1.0495 F3600
+G1 X105.301 Y102.986 E1.0641 F3600
+G1 X104.909 Y102.815 E1.0782 F3600
+G1 X104.533 Y102.651 E1.0918 F3600
+G1 X104.174 Y102.496 E1.1047 F3600
+G1 X103.832 Y102.350 E1.1169 F3600
+G1 X103.509 Y102.214 E1.1285 F3600
+G1 X103.203 Y102.090 E1.1394 F3600
+G1 X102.917 Y101.978 E1.1495 F3600
+G1 X102.650 Y101.880 E1.1589 F3600
+G1 X102.403 Y101.795 E1.1676 F3600
+G1 X102.175 Y101.724 E1.1754 F3600
+G1 X101.966 Y101.669 E1.1826 F3600
+G1 X101.776 Y101.629 E1.1890 F3600
+G1 X101.605 Y101.605 E1.1947 F3600
+G1 X101.452 Y101.597 E1.1997 F3600
+G1 X101.318 Y101.606 E1.2042 F3600
+G1 X101.201 Y101.631 E1.2081 F3600
+G1 X101.100 Y101.672 E1.2117 F3600
+G1 X101.015 Y101.730 E1.2151 F3600
+G1 X100.946 Y101.804 E1.2184 F3600
+G1 X100.890 Y101.893 E1.2219 F3600
+G1 X100.848 Y101.998 E1.2256 F3600
+G1 X100.819 Y102.117 E1.2297 F3600
+G1 X100.800 Y102.250 E1.2341 F3600
+G1 X100.791 Y102.397 E1.2390 F3600
+G1 X100.792 Y102.556 E1.2442 F3600
+G1 X100.800 Y102.726 E1.2498 F3600
+G1 X100.815 Y102.908 E1.2558 F3600
+G1 X100.836 Y103.099 E1.2622 F3600
+G1 X100.861 Y103.298 E1.2688 F3600
+G1 X100.889 Y103.505 E1.2757 F3600
+G1 X100.920 Y103.719 E1.2828 F3600
+G1 X100.952 Y103.937 E1.2901 F3600
+G1 X100.983 Y104.160 E1.2975 F3600
+G1 X101.014 Y104.385 E1.3050 F3600
+G1 X101.043 Y104.612 E1.3126 F3600
+G1 X101.069 Y104.839 E1.3201 F3600
+G1 X101.091 Y105.066 E1.3277 F3600
+G1 X101.109 Y105.290 E1.3351 F3600
+G1 X101.122 Y105.512 E1.3424 F3600
+G1 X101.129 Y105.729 E1.3496 F3600
+G1 X101.129 Y105.941 E1.3566 F3600
+G1 X101.123 Y106.148 E1.3634 F3600
+G1 X101.109 Y106.347 E1.3700 F3600
+G1 X101.088 Y106.538 E1.3763 F3600
+G1 X101.059 Y106.721 E1.3824 F3600
+G1 X101.021 Y106.894 E1.3883 F3600
+G1 X100.976 Y107.058 E1.3939 F3600
+G1 X100.923 Y107.211 E1.3993 F3600
+G1 X100.861 Y107.354 E1.4044 F3600
+G1 X100.791 Y107.486 E1.4093 F3600
+G1 X100.714 Y107.608 E1.4141 F3600
+G1 X100.629 Y107.718 E1.4187 F3600
+G1 X100.537 Y107.817 E1.4231 F3600
+G1 X100.438 Y107.906 E1.4275 F3600
+G1 X100.333 Y107.984 E1.4318 F3600
+G1 X100.222 Y108.053 E1.4361 F3600
+G1 X100.106 Y108.112 E1.4405 F3600
+G1 X99.985 Y108.162 E1.4448 F3600
+G1 X99.859 Y108.204 E1.4491 F3600
+G1 X99.731 Y108.239 E1.4535 F3600
+G1 X99.599 Y108.267 E1.4580 F3600
+G1 X99.465 Y108.291 E1.4625 F3600
+G1 X99.329 Y108.309 E1.4670 F3600
+G1 X99.193 Y108.325 E1.4715 F3600
+G1 X99.056 Y108.339 E1.4761 F3600
+G1 X98.919 Y108.352 E1.4806 F3600
+G1 X98.783 Y108.365 E1.4851 F3600
+G1 X98.649 Y108.380 E1.4896 F3600
+G1 X98.517 Y108.399 E1.4940 F3600
+G1 X98.387 Y108.422 E1.4983 F3600
+G1 X98.261 Y108.450 E1.5026 F3600
+G1 X98.138 Y108.486 E1.5068 F3600
+G1 X98.019 Y108.531 E1.5110 F3600
+G1 X97.904 Y108.585 E1.5152 F3600
+G1 X97.794 Y108.650 E1.5194 F3600
+G1 X97.688 Y108.727 E1.5237 F3600
+G1 X97.588 Y108.818 E1.5282 F3600
+G1 X97.492 Y108.923 E1.5329 F3600
+G1 X97.402 Y109.043 E1.5379 F3600
+G1 X97.316 Y109.180 E1.5432 F3600
+G1 X97.236 Y109.333 E1.5489 F3600
+G1 X97.161 Y109.504 E1.5551 F3600
+G1 X97.090 Y109.694 E1.5617 F3600
+G1 X97.024 Y109.902 E1.5689 F3600
+G1 X96.963 Y110.130 E1.5767 F3600
+G1 X96.905 Y110.376 E1.5851 F3600
+G1 X96.851 Y110.642 E1.5940 F3600
+G1 X96.800 Y110.928 E1.6036 F3600
+G1 X96.752 Y111.233 E1.6138 F3600
+G1 X96.706 Y111.556 E1.6246 F3600
+G1 X96.662 Y111.898 E1.6360 F3600
+G1 X96.619 Y112.258 E1.6479 F3600
+G1 X96.576 Y112.635 E1.6604 F3600
+G1 X96.534 Y113.029 E1.6735 F3600
+G1 X96.491 Y113.438 E1.6871 F3600
+G1 X96.447 Y113.861 E1.7011 F3600
+G1 X96.401 Y114.297 E1.7156 F3600
+G1 X96.353 Y114.745 E1.7305 F3600
+G1 X96.303 Y115.203 E1.7457 F3600
+G1 X96.248 Y115.671 E1.7612 F3600
+G1 X96.190 Y116.146 E1.7770 F3600
+G1 X96.128 Y116.626 E1.7930 F3600
+G1 X96.060 Y117.111 E1.8091 F3600
+G1 X95.987 Y117.597 E1.8254 F3600
+G1 X95.908 Y118.085 E1.8416 F3600
+G1 X95.823 Y118.570 E1.8579 F3600
+G1 X95.732 Y119.053 E1.8741 F3600
+G1 X95.633 Y119.530 E1.8902 F3600
+G1 X95.528 Y120.000 E1.9061 F3600
+G1 X95.415 Y120.462 E1.9218 F3600
+G1 X95.295 Y120.912 E1.9372 F3600
+G1 X95.168 Y121.350 E1.9522 F3600
+G1 X95.033 Y121.774 E1.9669 F3600
+G1 X94.890 Y122.182 E1.9812 F3600
+G1 X94.740 Y122.572 E1.9950 F3600
+G1 X94.583 Y122.943 E2.0083 F3600
+G1 X94.419 Y123.294 E2.0210 F3600
+G1 X94.248 Y123.623 E2.0333 F3600
+G1 X94.070 Y123.928 E2.0449 F3600
+G1 X93.886 Y124.209 E2.0560 F3600
+G1 X93.695 Y124.465 E2.0665 F3600
+G1 X93.500 Y124.694 E2.0765 F3600
+G1 X93.299 Y124.897 E2.0859 F3600
+G1 X93.093 Y125.072 E2.0948 F3600
+G1 X92.883 Y125.218 E2.1033 F3600
+G1 X92.669 Y125.337 E2.1113 F3600
+G1 X92.452 Y125.427 E2.1191 F3600
+G1 X92.233 Y125.488 E2.1266 F3600
+G1 X92.011 Y125.521 E2.1340 F3600
+G1 X91.787 Y125.525 E2.1414 F3600
+G1 X91.562 Y125.502 E2.1488 F3600
+G1 X91.337 Y125.451 E2.1565 F3600
+G1 X91.112 Y125.374 E2.1643 F3600
+G1 X90.887 Y125.271 E2.1725 F3600
+G1 X90.663 Y125.143 E2.1810 F3600
+G1 X90.440 Y124.991 E2.1899 F3600
+G1 X90.219 Y124.817 E2.1992 F3600
+G1 X90.000 Y124.621 E2.2089 F3600
+G1 X89.784 Y124.405 E2.2190 F3600
+G1 X89.571 Y124.170 E2.2294 F3600
+G1 X89.361 Y123.919 E2.2403 F3600
+G1 X89.154 Y123.651 E2.2514 F3600
+G1 X88.951 Y123.370 E2.2628 F3600
+G1 X88.752 Y123.077 E2.2745 F3600
+G1 X88.558 Y122.773 E2.2865 F3600
+G1 X88.367 Y122.460 E2.2985 F3600
+G1 X88.181 Y122.140 E2.3108 F3600
+G1 X87.998 Y121.815 E2.3231 F3600
+G1 X87.820 Y121.486 E2.3354 F3600
+G1 X87.646 Y121.155 E2.3477 F3600
+G1 X87.477 Y120.824 E2.3600 F3600
+G1 X87.311 Y120.494 E2.3722 F3600
+G1 X87.148 Y120.167 E2.3842 F3600
+G1 X86.990 Y119.845 E2.3961 F3600
+G1 X86.834 Y119.528 E2.4078 F3600
+G1 X86.681 Y119.218 E2.4192 F3600
+G1 X86.532 Y118.916 E2.4303 F3600
+G1 X86.384 Y118.623 E2.4411 F3600
+G1 X86.239 Y118.341 E2.4516 F3600
+G1 X86.095 Y118.070 E2.4617 F3600
+G1 X85.953 Y117.811 E2.4715 F3600
+G1 X85.812 Y117.564 E2.4808 F3600
+G1 X85.671 Y117.331 E2.4898 F3600
+G1 X85.531 Y117.111 E2.4984 F3600
+G1 X85.391 Y116.905 E2.5066 F3600
+G1 X85.251 Y116.712 E2.5145 F3600
+G1 X85.111 Y116.534 E2.5220 F3600
+G1 X84.970 Y116.369 E2.5292 F3600
+G1 X84.828 Y116.217 E2.5360 F3600
+G1 X84.685 Y116.079 E2.5426 F3600
+G1 X84.540 Y115.953 E2.5489 F3600
+G1 X84.395 Y115.839 E2.5550 F3600
+G1 X84.247 Y115.736 E2.5609 F3600
+G1 X84.099 Y115.644 E2.5667 F3600
+G1 X83.948 Y115.561 E2.5724 F3600
+G1 X83.797 Y115.486 E2.5780 F3600
+G1 X83.644 Y115.419 E2.5835 F3600
+G1 X83.489 Y115.358 E2.5890 F3600
+G1 X83.334 Y115.302 E2.5944 F3600
+G1 X83.178 Y115.250 E2.5998 F3600
+G1 X83.021 Y115.200 E2.6053 F3600
+G1 X82.864 Y115.152 E2.6107 F3600
+G1 X82.707 Y115.103 E2.6161 F3600
+G1 X82.550 Y115.053 E2.6215 F3600
+G1 X82.395 Y115.001 E2.6270 F3600
+G1 X82.240 Y114.944 E2.6324 F3600
+G1 X82.088 Y114.881 E2.6378 F3600
+G1 X81.938 Y114.813 E2.6433 F3600
+G1 X81.791 Y114.736 E2.6487 F3600
+G1 X81.647 Y114.650 E2.6543 F3600
+G1 X81.507 Y114.555 E2.6599 F3600
+G1 X81.371 Y114.448 E2.6655 F3600
+G1 X81.241 Y114.330 E2.6714 F3600
+G1 X81.116 Y114.199 E2.6773 F3600
+G1 X80.997 Y114.054 E2.6835 F3600
+G1 X80.885 Y113.895 E2.6899 F3600
+G1 X80.780 Y113.722 E2.6966 F3600
+G1 X80.682 Y113.534 E2.7036 F3600
+G1 X80.593 Y113.330 E2.7109 F3600
+G1 X80.512 Y113.112 E2.7186 F3600
+G1 X80.440 Y112.877 E2.7267 F3600
+G1 X80.376 Y112.628 E2.7352 F3600
+G1 X80.323 Y112.363 E2.7441 F3600
+G1 X80.278 Y112.083 E2.7535 F3600
+G1 X80.244 Y111.790 E2.7633 F3600
+G1 X80.219 Y111.482 E2.7734 F3600
+G1 X80.204 Y111.161 E2.7840 F3600
+G1 X80.199 Y110.828 E2.7950 F3600
+G1 X80.203 Y110.484 E2.8064 F3600
+G1 X80.217 Y110.129 E2.8181 F3600
+G1 X80.240 Y109.765 E2.8302 F3600
+G1 X80.272 Y109.392 E2.8425 F3600
+G1 X80.312 Y109.013 E2.8551 F3600
+G1 X80.360 Y108.628 E2.8679 F3600
+G1 X80.416 Y108.239 E2.8808 F3600
+G1 X80.478 Y107.848 E2.8939 F3600
+G1 X80.547 Y107.455 E2.9071 F3600
+G1 X80.620 Y107.062 E2.9203 F3600
+G1 X80.698 Y106.671 E2.9334 F3600
+G1 X80.780 Y106.283 E2.9465 F3600
+G1 X80.865 Y105.900 E2.9595 F3600
+G1 X80.951 Y105.523 E2.9722 F3600
+G1 X81.038 Y105.154 E2.9847 F3600
+G1 X81.125 Y104.794 E2.9969 F3600
+G1 X81.210 Y104.445 E3.0088 F3600
+G1 X81.293 Y104.108 E3.0203 F3600
+G1 X81.373 Y103.785 E3.0313 F3600
+G1 X81.448 Y103.476 E3.0417 F3600
+G1 X81.517 Y103.183 E3.0517 F3600
+G1 X81.580 Y102.907 E3.0610 F3600
+G1 X81.635 Y102.648 E3.0697 F3600
+G1 X81.680 Y102.409 E3.0778 F3600
+G1 X81.716 Y102.189 E3.0851 F3600
+G1 X81.741 Y101.990 E3.0917 F3600
+G1 X81.754 Y101.812 E3.0977 F3600
+G1 X81.754 Y101.654 E3.1028 F3600
+G1 X81.741 Y101.519 E3.1073 F3600
+G1 X81.713 Y101.406 E3.1112 F3600
+G1 X81.671 Y101.314 E3.1145 F3600
+G1 X81.612 Y101.245 E3.1175 F3600
+G1 X81.537 Y101.198 E3.1204 F3600
+G1 X81.446 Y101.172 E3.1235 F3600
+G1 X81.338 Y101.167 E3.1271 F3600
+G1 X81.212 Y101.183 E3.1313 F3600
+G1 X81.069 Y101.220 E3.1362 F3600
+G1 X80.908 Y101.276 E3.1418 F3600
+G1 X80.730 Y101.350 E3.1482 F3600
+G1 X80.534 Y101.442 E3.1553 F3600
+G1 X80.321 Y101.551 E3.1632 F3600
+G1 X80.091 Y101.676 E3.1718 F3600
+G1 X79.845 Y101.815 E3.1812 F3600
+G1 X79.583 Y101.967 E3.1912 F3600
+G1 X79.305 Y102.131 E3.2018 F3600
+G1 X79.012 Y102.306 E3.2131 F3600
+G1 X78.706 Y102.490 E3.2249 F3600
+G1 X78.387 Y102.683 E3.2372 F3600
+G1 X78.055 Y102.881 E3.2499 F3600
+G1 X77.712 Y103.085 E3.2631 F3600
+G1 X77.360 Y103.292 E3.2766 F3600
+G1 X76.998 Y103.502 E3.2904 F3600
+G1 X76.628 Y103.712 E3.3044 F3600
+G1 X76.252 Y103.922 E3.3186 F3600
+G1 X75.871 Y104.129 E3.3330 F3600
+G1 X75.485 Y104.334 E3.3474 F3600
+G1 X75.097 Y104.533 E3.3618 F3600
+G1 X74.707 Y104.727 E3.3761 F3600
+G1 X74.317 Y104.914 E3.3904 F3600
+G1 X73.928 Y105.093 E3.4045 F3600
+G1 X73.541 Y105.263 E3.4185 F3600
+G1 X73.158 Y105.422 E3.4322 F3600
+G1 X72.779 Y105.571 E3.4456 F3600
+G1 X72.406 Y105.708 E3.4587 F3600
+G1 X72.041 Y105.833 E3.4715 F3600
+G1 X71.683 Y105.945 E3.4838 F3600
+G1 X71.334 Y106.044 E3.4958 F3600
+G1 X70.995 Y106.129 E3.5073 F3600
+G1 X70.667 Y106.199 E3.5184 F3600
+G1 X70.350 Y106.256 E3.5290 F3600
+G1 X70.045 Y106.298 E3.5392 F3600
+G1 X69.753 Y106.326 E3.5489 F3600
+G1 X69.474 Y106.339 E3.5581 F3600
+G1 X69.208 Y106.338 E3.5669 F3600
+G1 X68.955 Y106.324 E3.5752 F3600
+G1 X68.716 Y106.296 E3.5832 F3600
+G1 X68.491 Y106.255 E3.5907 F3600
+G1 X68.280 Y106.202 E3.5979 F3600
+G1 X68.081 Y106.136 E3.6048 F3600
+G1 X67.896 Y106.059 E3.6114 F3600
+G1 X67.724 Y105.972 E3.6178 F3600
+G1 X67.564 Y105.874 E3.6240 F3600
+G1 X67.415 Y105.767 E3.6300 F3600
+G1 X67.277 Y105.652 E3.6360 F3600
+G1 X67.150 Y105.529 E3.6418 F3600
+G1 X67.031 Y105.399 E3.6476 F3600
+G1 X66.922 Y105.264 E3.6534 F3600
+G1 X66.819 Y105.123 E3.6591 F3600
+G1 X66.723 Y104.978 E3.6648 F3600
+G1 X66.632 Y104.830 E3.6706 F3600
+G1 X66.545 Y104.679 E3.6763 F3600
+G1 X66.462 Y104.526 E3.6821 F3600
+G1 X66.380 Y104.373 E3.6878 F3600
+G1 X66.299 Y104.219 E3.6935 F3600
+G1 X66.217 Y104.065 E3.6993 F3600
+G1 X66.134 Y103.913 E3.7050 F3600
+G1 X66.048 Y103.762 E3.7107 F3600
+G1 X65.957 Y103.614 E3.7165 F3600
+G1 X65.862 Y103.468 E3.7222 F3600
+G1 X65.761 Y103.325 E3.7280 F3600
+G1 X65.653 Y103.186 E3.7338 F3600
+G1 X65.537 Y103.051 E3.7397 F3600
+G1 X65.412 Y102.920 E3.7457 F3600
+G1 X65.277 Y102.793 E3.7518 F3600
+G1 X65.132 Y102.671 E3.7580 F3600
+G1 X64.976 Y102.553 E3.7645 F3600
+G1 X64.809 Y102.439 E3.7711 F3600
+G1 X64.631 Y102.330 E3.7781 F3600
+G1 X64.440 Y102.224 E3.7852 F3600
+G1 X64.238 Y102.123 E3.7927 F3600
+G1 X64.023 Y102.025 E3.8005 F3600
+G1 X63.796 Y101.931 E3.8086 F3600
+G1 X63.558 Y101.839 E3.8170 F3600
+G1 X63.308 Y101.750 E3.8258 F3600
+G1 X63.047 Y101.664 E3.8349 F3600
+G1 X62.776 Y101.579 E3.8442 F3600
+G1 X62.495 Y101.494 E3.8539 F3600
+G1 X62.205 Y101.411 E3.8639 F3600
+G1 X61.907 Y101.328 E3.8741 F3600
+G1 X61.602 Y101.244 E3.8845 F3600
+G1 X61.291 Y101.159 E3.8952 F3600
+G1 X60.975 Y101.072 E3.9060 F3600
+G1 X60.656 Y100.983 E3.9169 F3600
+G1 X60.335 Y100.891 E3.9279 F3600
+G1 X60.014 Y100.796 E3.9390 F3600
+G1 X59.693 Y100.696 E3.9501 F3600
+G1 X59.375 Y100.593 E3.9611 F3600
+G1 X59.061 Y100.484 E3.9721 F3600
+G1 X58.752 Y100.370 E3.9829 F3600
+G1 X58.451 Y100.251 E3.9936 F3600
+G1 X58.159 Y100.125 E4.0041 F3600
+G1 X57.877 Y99.993 E4.0144 F3600
+G1 X57.607 Y99.854 E4.0244 F3600
+G1 X57.351 Y99.708 E4.0341 F3600
+G1 X57.111 Y99.555 E4.0435 F3600
+G1 X56.887 Y99.395 E4.0526 F3600
+G1 X56.681 Y99.228 E4.0614 F3600
+G1 X56.495 Y99.053 E4.0698 F3600
+G1 X56.330 Y98.871 E4.0779 F3600
+G1 X56.187 Y98.682 E4.0857 F3600
+G1 X56.067 Y98.486 E4.0933 F3600
+G1 X55.972 Y98.283 E4.1007 F3600
+G1 X55.901 Y98.073 E4.1080 F3600
+G1 X55.857 Y97.858 E4.1153 F3600
+G1 X55.839 Y97.636 E4.1226 F3600
+G1 X55.848 Y97.409 E4.1301 F3600
+G1 X55.884 Y97.177 E4.1379 F3600
+G1 X55.948 Y96.940 E4.1459 F3600
+G1 X56.040 Y96.700 E4.1544 F3600
+G1 X56.160 Y96.455 E4.1634 F3600
+G1 X56.307 Y96.208 E4.1729 F3600
+G1 X56.481 Y95.959 E4.1830 F3600
+G1 X56.682 Y95.707 E4.1936 F3600
+G1 X56.910 Y95.454 E4.2048 F3600
+G1 X57.162 Y95.201 E4.2166 F3600
+G1 X57.439 Y94.948 E4.2290 F3600
+G1 X57.740 Y94.695 E4.2420 F3600
+G1 X58.062 Y94.443 E4.2555 F3600
+G1 X58.406 Y94.193 E4.2695 F3600
+G1 X58.770 Y93.945 E4.2840 F3600
+G1 X59.151 Y93.700 E4.2990 F3600
+G1 X59.550 Y93.459 E4.3144 F3600
+G1 X59.963 Y93.221 E4.3301 F3600
+G1 X60.390 Y92.987 E4.3461 F3600
+G1 X60.828 Y92.758 E4.3625 F3600
+G1 X61.276 Y92.533 E4.3790 F3600
+G1 X61.732 Y92.314 E4.3957 F3600
+G1 X62.194 Y92.101 E4.4125 F3600
+G1 X62.660 Y91.893 E4.4293 F3600
+G1 X63.127 Y91.691 E4.4461 F3600
+G1 X63.596 Y91.495 E4.4629 F3600
+G1 X64.062 Y91.305 E4.4795 F3600
+G1 X64.525 Y91.121 E4.4959 F3600
+G1 X64.983 Y90.944 E4.5121 F3600
+G1 X65.434 Y90.772 E4.5281 F3600
+G1 X65.876 Y90.606 E4.5436 F3600
+G1 X66.307 Y90.447 E4.5588 F3600
+G1 X66.727 Y90.292 E4.5736 F3600
+G1 X67.133 Y90.144 E4.5878 F3600
+G1 X67.524 Y90.000 E4.6016 F3600
+G1 X67.900 Y89.861 E4.6148 F3600
+G1 X68.258 Y89.727 E4.6275 F3600
+G1 X68.599 Y89.597 E4.6395 F3600
+G1 X68.920 Y89.470 E4.6509 F3600
+G1 X69.222 Y89.347 E4.6616 F3600
+G1 X69.504 Y89.227 E4.6717 F3600
+G1 X69.765 Y89.109 E4.6812 F3600
+G1 X70.005 Y88.994 E4.6900 F3600
+G1 X70.223 Y88.880 E4.6981 F3600
+G1 X70.421 Y88.768 E4.7056 F3600
+G1 X70.597 Y88.657 E4.7125 F3600
+G1 X70.752 Y88.546 E4.7188 F3600
+G1 X70.887 Y88.435 E4.7245 F3600
+G1 X71.001 Y88.324 E4.7298 F3600
+G1 X71.096 Y88.213 E4.7346 F3600
+G1 X71.173 Y88.101 E4.7391 F3600
+G1 X71.231 Y87.988 E4.7433 F3600
+G1 X71.273 Y87.873 E4.7473 F3600
+G1 X71.299 Y87.757 E4.7513 F3600
+G1 X71.310 Y87.639 E4.7552 F3600
+G1 X71.308 Y87.519 E4.7591 F3600
+G1 X71.293 Y87.398 E4.7632 F3600
+G1 X71.268 Y87.274 E4.7673 F3600
+G1 X71.233 Y87.148 E4.7716 F3600
+G1 X71.190 Y87.021 E4.7761 F3600
+G1 X71.140 Y86.891 E4.7806 F3600
+G1 X71.085 Y86.760 E4.7853 F3600
+G1 X71.027 Y86.627 E4.7901 F3600
+G1 X70.966 Y86.493 E4.7950 F3600
+G1 X70.905 Y86.357 E4.7999 F3600
+G1 X70.844 Y86.221 E4.8048 F3600
+G1 X70.785 Y86.084 E4.8098 F3600
+G1 X70.730 Y85.946 E4.8146 F3600
+G1 X70.679 Y85.809 E4.8195 F3600
+G1 X70.634 Y85.671 E4.8243 F3600
+G1 X70.596 Y85.534 E4.8289 F3600
+G1 X70.566 Y85.399 E4.8335 F3600
+G1 X70.545 Y85.265 E4.8380 F3600
+G1 X70.533 Y85.132 E4.8424 F3600
+G1 X70.532 Y85.002 E4.8467 F3600
+G1 X70.542 Y84.874 E4.8509 F3600
+G1 X70.564 Y84.748 E4.8551 F3600
+G1 X70.598 Y84.627 E4.8593 F3600
+G1 X70.643 Y84.508 E4.8635 F3600
+G1 X70.701 Y84.393 E4.8677 F3600
+G1 X70.772 Y84.282 E4.8721 F3600
+G1 X70.855 Y84.176 E4.8765 F3600
+G1 X70.950 Y84.074 E4.8811 F3600
+G1 X71.056 Y83.976 E4.8859 F3600
+G1 X71.174 Y83.883 E4.8908 F3600
+G1 X71.302 Y83.794 E4.8960 F3600
+G1 X71.440 Y83.711 E4.9013 F3600
+G1 X71.587 Y83.631 E4.9068 F3600
+G1 X71.743 Y83.556 E4.9125 F3600
+G1 X71.906 Y83.486 E4.9184 F3600
+G1 X72.075 Y83.419 E4.9244 F3600
+G1 X72.249 Y83.356 E4.9305 F3600
+G1 X72.427 Y83.297 E4.9367 F3600
+G1 X72.607 Y83.240 E4.9429 F3600
+G1 X72.789 Y83.186 E4.9492 F3600
+G1 X72.971 Y83.134 E4.9554 F3600
+G1 X73.151 Y83.083 E4.9616 F3600
+G1 X73.329 Y83.033 E4.9677 F3600
+G1 X73.502 Y82.983 E4.9737 F3600
+G1 X73.670 Y82.933 E4.9794 F3600
+G1 X73.831 Y82.882 E4.9850 F3600
+G1 X73.983 Y82.829 E4.9903 F3600
+G1 X74.126 Y82.773 E4.9954 F3600
+G1 X74.258 Y82.713 E5.0002 F3600
+G1 X74.378 Y82.649 E5.0047 F3600
+G1 X74.485 Y82.580 E5.0089 F3600
+G1 X74.578 Y82.505 E5.0128 F3600
+G1 X74.655 Y82.423 E5.0165 F3600
+G1 X74.716 Y82.333 E5.0201 F3600
+G1 X74.761 Y82.235 E5.0237 F3600
+G1 X74.788 Y82.128 E5.0273 F3600
+G1 X74.796 Y82.011 E5.0312 F3600
+G1 X74.786 Y81.883 E5.0354 F3600
+G1 X74.757 Y81.744 E5.0401 F3600
+G1 X74.709 Y81.594 E5.0453 F3600
+G1 X74.641 Y81.430 E5.0511 F3600
+G1 X74.554 Y81.254 E5.0576 F3600
+G1 X74.448 Y81.065 E5.0648 F3600
+G1 X74.323 Y80.861 E5.0727 F3600
+G1 X74.180 Y80.644 E5.0813 F3600
+G1 X74.018 Y80.412 E5.0906 F3600
+G1 X73.839 Y80.166 E5.1006 F3600
+G1 X73.643 Y79.906 E5.1114 F3600
+G1 X73.432 Y79.631 E5.1228 F3600
+G1 X73.205 Y79.342 E5.1350 F3600
+G1 X72.965 Y79.038 E5.1477 F3600
+G1 X72.712 Y78.721 E5.1611 F3600
+G1 X72.447 Y78.391 E5.1751 F3600
+G1 X72.173 Y78.048 E5.1896 F3600
+G1 X71.889 Y77.692 E5.2046 F3600
+G1 X71.598 Y77.324 E5.2201 F3600
+G1 X71.301 Y76.946 E5.2359 F3600
+G1 X71.000 Y76.557 E5.2522 F3600
+G1 X70.696 Y76.159 E5.2687 F3600
+G1 X70.391 Y75.753 E5.2855 F3600
+G1 X70.085 Y75.339 E5.3024 F3600
+G1 X69.782 Y74.919 E5.3195 F3600
+G1 X69.482 Y74.494 E5.3367 F3600
+G1 X69.187 Y74.064 E5.3539 F3600
+G1 X68.899 Y73.632 E5.3710 F3600
+G1 X68.618 Y73.199 E5.3881 F3600
+G1 X68.347 Y72.764 E5.4050 F3600
+G1 X68.087 Y72.331 E5.4217 F3600
+G1 X67.839 Y71.900 E5.4381 F3600
+G1 X67.604 Y71.473 E5.4542 F3600
+G1 X67.384 Y71.050 E5.4699 F3600
+G1 X67.179 Y70.633 E5.4852 F3600
+G1 X66.991 Y70.223 E5.5001 F3600
+G1 X66.821 Y69.822 E5.5145 F3600
+G1 X66.668 Y69.430 E5.5283 F3600
+G1 X66.535 Y69.049 E5.5417 F3600
+G1 X66.421 Y68.680 E5.5544 F3600
+G1 X66.328 Y68.324 E5.5666 F3600
+G1 X66.255 Y67.981 E5.5782 F3600
+G1 X66.202 Y67.652 E5.5891 F3600
+G1 X66.170 Y67.339 E5.5995 F3600
+G1 X66.159 Y67.041 E5.6093 F3600
+G1 X66.169 Y66.760 E5.6186 F3600
+G1 X66.199 Y66.496 E5.6274 F3600
+G1 X66.250 Y66.250 E5.6357 F3600
+G1 X66.320 Y66.021 E5.6436 F3600
+G1 X66.410 Y65.809 E5.6512 F3600
+G1 X66.518 Y65.616 E5.6585 F3600
+G1 X66.644 Y65.440 E5.6657 F3600
+G1 X66.788 Y65.282 E5.6727 F3600
+G1 X66.948 Y65.141 E5.6797 F3600
+G1 X67.124 Y65.018 E5.6868 F3600
+G1 X67.314 Y64.911 E5.6940 F3600
+G1 X67.518 Y64.820 E5.7014 F3600
+G1 X67.734 Y64.745 E5.7090 F3600
+G1 X67.962 Y64.684 E5.7167 F3600
+G1 X68.200 Y64.638 E5.7247 F3600
+G1 X68.448 Y64.604 E5.7330 F3600
+G1 X68.703 Y64.583 E5.7414 F3600
+G1 X68.965 Y64.573 E5.7501 F3600
+G1 X69.233 Y64.573 E5.7589 F3600
+G1 X69.505 Y64.582 E5.7679 F3600
+G1 X69.781 Y64.599 E5.7770 F3600
+G1 X70.059 Y64.623 E5.7862 F3600
+G1 X70.338 Y64.652 E5.7955 F3600
+G1 X70.618 Y64.686 E5.8048 F3600
+G1 X70.896 Y64.722 E5.8141 F3600
+G1 X71.174 Y64.761 E5.8233 F3600
+G1 X71.448 Y64.800 E5.8325 F3600
+G1 X71.720 Y64.840 E5.8415 F3600
+G1 X71.987 Y64.877 E5.8504 F3600
+G1 X72.250 Y64.912 E5.8592 F3600
+G1 X72.508 Y64.944 E5.8677 F3600
+G1 X72.759 Y64.971 E5.8761 F3600
+G1 X73.005 Y64.993 E5.8842 F3600
+G1 X73.244 Y65.008 E5.8921 F3600
+G1 X73.476 Y65.017 E5.8998 F3600
+G1 X73.702 Y65.018 E5.9073 F3600
+G1 X73.920 Y65.011 E5.9145 F3600
+G1 X74.131 Y64.995 E5.9214 F3600
+G1 X74.335 Y64.970 E5.9282 F3600
+G1 X74.533 Y64.937 E5.9348 F3600
+G1 X74.723 Y64.894 E5.9413 F3600
+G1 X74.907 Y64.842 E5.9476 F3600
+G1 X75.085 Y64.780 E5.9538 F3600
+G1 X75.257 Y64.710 E5.9599 F3600
+G1 X75.424 Y64.631 E5.9660 F3600
+G1 X75.586 Y64.544 E5.9721 F3600
+G1 X75.743 Y64.449 E5.9782 F3600
+G1 X75.897 Y64.347 E5.9843 F3600
+G1 X76.047 Y64.238 E5.9904 F3600
+G1 X76.195 Y64.124 E5.9965 F3600
+G1 X76.341 Y64.006 E6.0027 F3600
+G1 X76.486 Y63.884 E6.0090 F3600
+G1 X76.630 Y63.759 E6.0153 F3600
+G1 X76.773 Y63.633 E6.0216 F3600
+G1 X76.918 Y63.507 E6.0279 F3600
+G1 X77.063 Y63.381 E6.0342 F3600
+G1 X77.211 Y63.258 E6.0406 F3600
+G1 X77.360 Y63.139 E6.0469 F3600
+G1 X77.513 Y63.025 E6.0532 F3600
+G1 X77.669 Y62.916 E6.0594 F3600
+G1 X77.829 Y62.816 E6.0657 F3600
+G1 X77.993 Y62.724 E6.0719 F3600
+G1 X78.162 Y62.643 E6.0781 F3600
+G1 X78.335 Y62.573 E6.0842 F3600
+G1 X78.515 Y62.516 E6.0904 F3600
+G1 X78.699 Y62.473 E6.0967 F3600
+G1 X78.890 Y62.445 E6.1031 F3600
+G1 X79.086 Y62.434 E6.1095 F3600
+G1 X79.288 Y62.439 E6.1162 F3600
+G1 X79.496 Y62.463 E6.1231 F3600
+G1 X79.709 Y62.506 E6.1303 F3600
+G1 X79.929 Y62.568 E6.1378 F3600
+G1 X80.153 Y62.650 E6.1457 F3600
+G1 X80.383 Y62.753 E6.1540 F3600
+G1 X80.618 Y62.876 E6.1628 F3600
+G1 X80.858 Y63.021 E6.1720 F3600
+G1 X81.102 Y63.188 E6.1818 F3600
+G1 X81.349 Y63.375 E6.1920 F3600
+G1 X81.600 Y63.584 E6.2028 F3600
+G1 X81.854 Y63.813 E6.2141 F3600
+G1 X82.110 Y64.063 E6.2259 F3600
+G1 X82.368 Y64.332 E6.2382 F3600
+G1 X82.627 Y64.621 E6.2510 F3600
+G1 X82.886 Y64.927 E6.2642 F3600
+G1 X83.146 Y65.251 E6.2779 F3600
+G1 X83.405 Y65.592 E6.2920 F3600
+G1 X83.663 Y65.947 E6.3065 F3600
+G1 X83.919 Y66.316 E6.3214 F3600
+G1 X84.173 Y66.697 E6.3365 F3600
+G1 X84.423 Y67.089 E6.3518 F3600
+G1 X84.671 Y67.491 E6.3674 F3600
+G1 X84.914 Y67.900 E6.3831 F3600
+G1 X85.153 Y68.315 E6.3989 F3600
+G1 X85.387 Y68.734 E6.4147 F3600
+G1 X85.615 Y69.155 E6.4306 F3600
+G1 X85.838 Y69.577 E6.4463 F3600
+G1 X86.054 Y69.998 E6.4619 F3600
+G1 X86.264 Y70.416 E6.4773 F3600
+G1 X86.467 Y70.828 E6.4925 F3600
+G1 X86.664 Y71.233 E6.5074 F3600
+G1 X86.853 Y71.630 E6.5219 F3600
+G1 X87.036 Y72.016 E6.5360 F3600
+G1 X87.211 Y72.390 E6.5496 F3600
+G1 X87.379 Y72.749 E6.5627 F3600
+G1 X87.540 Y73.093 E6.5752 F3600
+G1 X87.693 Y73.420 E6.5871 F3600
+G1 X87.840 Y73.729 E6.5984 F3600
+G1 X87.981 Y74.017 E6.6090 F3600
+G1 X88.115 Y74.284 E6.6189 F3600
+G1 X88.243 Y74.528 E6.6280 F3600
+G1 X88.365 Y74.750 E6.6363 F3600
+G1 X88.482 Y74.947 E6.6439 F3600
+G1 X88.593 Y75.119 E6.6506 F3600
+G1 X88.700 Y75.265 E6.6566 F3600
+G1 X88.804 Y75.385 E6.6618 F3600
+G1 X88.903 Y75.479 E6.6663 F3600
+G1 X88.999 Y75.546 E6.6702 F3600
+G1 X89.093 Y75.587 E6.6736 F3600
+G1 X89.185 Y75.601 E6.6767 F3600
+G1 X89.275 Y75.589 E6.6797 F3600
+G1 X89.364 Y75.550 E6.6829 F3600
+G1 X89.453 Y75.487 E6.6864 F3600
+G1 X89.541 Y75.399 E6.6906 F3600
+G1 X89.630 Y75.287 E6.6953 F3600
+G1 X89.720 Y75.152 E6.7006 F3600
+G1 X89.811 Y74.995 E6.7066 F3600
+G1 X89.905 Y74.818 E6.7132 F3600
+G1 X90.000 Y74.621 E6.7205 F3600
+G1 X90.098 Y74.406 E6.7283 F3600
+G1 X90.199 Y74.174 E6.7366 F3600
+G1 X90.303 Y73.927 E6.7454 F3600
+G1 X90.411 Y73.667 E6.7547 F3600
+G1 X90.522 Y73.395 E6.7644 F3600
+G1 X90.637 Y73.112 E6.7745 F3600
+G1 X90.756 Y72.821 E6.7849 F3600
+G1 X90.879 Y72.523 E6.7955 F3600
+G1 X91.007 Y72.220 E6.8064 F3600
+G1 X91.138 Y71.914 E6.8174 F3600
+G1 X91.273 Y71.605 E6.8285 F3600
+G1 X91.413 Y71.297 E6.8396 F3600
+G1 X91.556 Y70.991 E6.8508 F3600
+G1 X91.703 Y70.688 E6.8619 F3600
+G1 X91.854 Y70.389 E6.8730 F3600
+G1 X92.008 Y70.097 E6.8839 F3600
+G1 X92.165 Y69.813 E6.8946 F3600
+G1 X92.324 Y69.537 E6.9051 F3600
+G1 X92.486 Y69.272 E6.9154 F3600
+G1 X92.651 Y69.018 E6.9253 F3600
+G1 X92.817 Y68.776 E6.9350 F3600
+G1 X92.984 Y68.547 E6.9444 F3600
+G1 X93.153 Y68.332 E6.9534 F3600
+G1 X93.323 Y68.132 E6.9621 F3600
+G1 X93.493 Y67.947 E6.9704 F3600
+G1 X93.663 Y67.777 E6.9783 F3600
+G1 X93.833 Y67.623 E6.9859 F3600
+G1 X94.003 Y67.484 E6.9931 F3600
+G1 X94.171 Y67.361 E7.0000 F3600
+G1 X94.339 Y67.254 E7.0065 F3600
+G1 X94.505 Y67.163 E7.0128 F3600
+G1 X94.670 Y67.086 E7.0188 F3600
+G1 X94.833 Y67.024 E7.0246 F3600
+G1 X94.995 Y66.975 E7.0301 F3600
+G1 X95.154 Y66.940 E7.0355 F3600
+G1 X95.312 Y66.917 E7.0408 F3600
+G1 X95.468 Y66.906 E7.0459 F3600
+G1 X95.622 Y66.904 E7.0510 F3600
+G1 X95.773 Y66.912 E7.0560 F3600
+G1 X95.924 Y66.929 E7.0610 F3600
+G1 X96.072 Y66.952 E7.0660 F3600
+G1 X96.220 Y66.981 E7.0709 F3600
+G1 X96.366 Y67.014 E7.0759 F3600
+G1 X96.511 Y67.051 E7.0808 F3600
+G1 X96.656 Y67.089 E7.0858 F3600
+G1 X96.801 Y67.127 E7.0907 F3600
+G1 X96.947 Y67.165 E7.0957 F3600
+G1 X97.093 Y67.200 E7.1006 F3600
+G1 X97.240 Y67.233 E7.1056 F3600
+G1 X97.389 Y67.260 E7.1106 F3600
+G1 X97.540 Y67.281 E7.1156 F3600
+G1 X97.694 Y67.296 E7.1208 F3600
+G1 X97.851 Y67.302 E7.1259 F3600
+G1 X98.012 Y67.299 E7.1313 F3600
+G1 X98.178 Y67.286 E7.1367 F3600
+G1 X98.348 Y67.262 E7.1424 F3600
+G1 X98.524 Y67.226 E7.1483 F3600
+G1 X98.705 Y67.179 E7.1545 F3600
+G1 X98.894 Y67.118 E7.1610 F3600
+G1 X99.089 Y67.045 E7.1679 F3600
+G1 X99.291 Y66.958 E7.1752 F3600
+G1 X99.501 Y66.858 E7.1829 F3600
+G1 X99.719 Y66.744 E7.1910 F3600
+G1 X99.945 Y66.616 E7.1996 F3600
+G1 X100.180 Y66.475 E7.2086 F3600
+G1 X100.424 Y66.321 E7.2181 F3600
+G1 X100.676 Y66.155 E7.2281 F3600
+G1 X100.938 Y65.977 E7.2385 F3600
+G1 X101.209 Y65.787 E7.2494 F3600
+G1 X101.488 Y65.587 E7.2608 F3600
+G1 X101.776 Y65.377 E7.2726 F3600
+G1 X102.073 Y65.159 E7.2847 F3600
+G1 X102.378 Y64.933 E7.2972 F3600
+G1 X102.691 Y64.700 E7.3101 F3600
+G1 X103.012 Y64.463 E7.3233 F3600
+G1 X103.339 Y64.222 E7.3367 F3600
+G1 X103.674 Y63.978 E7.3503 F3600
+G1 X104.013 Y63.733 E7.3642 F3600
+G1 X104.358 Y63.489 E7.3781 F3600
+G1 X104.708 Y63.246 E7.3922 F3600
+G1 X105.061 Y63.007 E7.4062 F3600
+G1 X105.417 Y62.774 E7.4203 F3600
+G1 X105.774 Y62.546 E7.4343 F3600
+G1 X106.132 Y62.327 E7.4481 F3600
+G1 X106.490 Y62.117 E7.4618 F3600
+G1 X106.847 Y61.918 E7.4753 F3600
+G1 X107.201 Y61.731 E7.4885 F3600
+G1 X107.552 Y61.558 E7.5014 F3600
+G1 X107.899 Y61.401 E7.5140 F3600
+G1 X108.239 Y61.259 E7.5261 F3600
+G1 X108.573 Y61.135 E7.5379 F3600
+G1 X108.900 Y61.030 E7.5492 F3600
+G1 X109.217 Y60.944 E7.5601 F3600
+G1 X109.524 Y60.879 E7.5704 F3600
+G1 X109.820 Y60.835 E7.5803 F3600
+G1 X110.104 Y60.813 E7.5897 F3600
+G1 X110.376 Y60.814 E7.5987 F3600
+G1 X110.633 Y60.838 E7.6072 F3600
+G1 X110.875 Y60.884 E7.6153 F3600
+G1 X111.103 Y60.955 E7.6232 F3600
+G1 X111.313 Y61.049 E7.6308 F3600
+G1 X111.507 Y61.167 E7.6383 F3600
+G1 X111.684 Y61.308 E7.6458 F3600
+G1 X111.843 Y61.472 E7.6533 F3600
+G1 X111.983 Y61.659 E7.6610 F3600
+G1 X112.105 Y61.869 E7.6690 F3600
+G1 X112.208 Y62.100 E7.6774 F3600
+G1 X112.293 Y62.352 E7.6862 F3600
+G1 X112.358 Y62.625 E7.6954 F3600
+G1 X112.405 Y62.917 E7.7051 F3600
+G1 X112.434 Y63.226 E7.7154 F3600
+G1 X112.444 Y63.553 E7.7262 F3600
+G1 X112.437 Y63.897 E7.7375 F3600
+G1 X112.412 Y64.254 E7.7494 F3600
+G1 X112.370 Y64.626 E7.7617 F3600
+G1 X112.313 Y65.009 E7.7745 F3600
+G1 X112.240 Y65.403 E7.7877 F3600
+G1 X112.153 Y65.807 E7.8014 F3600
+G1 X112.053 Y66.219 E7.8153 F3600
+G1 X111.940 Y66.637 E7.8296 F3600
+G1 X111.815 Y67.060 E7.8442 F3600
+G1 X111.680 Y67.486 E7.8589 F3600
+G1 X111.536 Y67.915 E7.8739 F3600
+G1 X111.385 Y68.345 E7.8889 F3600
+G1 X111.226 Y68.774 E7.9040 F3600
+G1 X111.062 Y69.201 E7.9191 F3600
+G1 X110.893 Y69.625 E7.9342 F3600
+G1 X110.722 Y70.045 E7.9491 F3600
+G1 X110.549 Y70.459 E7.9639 F3600
+G1 X110.376 Y70.866 E7.9785 F3600
+G1 X110.204 Y71.265 E7.9929 F3600
+G1 X110.033 Y71.656 E8.0069 F3600
+G1 X109.866 Y72.037 E8.0207 F3600
+G1 X109.703 Y72.408 E8.0340 F3600
+G1 X109.546 Y72.768 E8.0470 F3600
+G1 X109.396 Y73.116 E8.0595 F3600
+G1 X109.252 Y73.452 E8.0716 F3600
+G1 X109.117 Y73.776 E8.0832 F3600
+G1 X108.992 Y74.087 E8.0942 F3600
+G1 X108.876 Y74.384 E8.1048 F3600
+G1 X108.771 Y74.669 E8.1148 F3600
+G1 X108.676 Y74.941 E8.1243 F3600
+G1 X108.593 Y75.200 E8.1332 F3600
+G1 X108.522 Y75.445 E8.1417 F3600
+G1 X108.463 Y75.679 E8.1496 F3600
+G1 X108.416 Y75.900 E8.1571 F3600
+G1 X108.381 Y76.109 E8.1641 F3600
+G1 X108.358 Y76.306 E8.1706 F3600
+G1 X108.347 Y76.493 E8.1768 F3600
+G1 X108.347 Y76.670 E8.1827 F3600
+G1 X108.359 Y76.837 E8.1882 F3600
+G1 X108.381 Y76.995 E8.1935 F3600
+G1 X108.413 Y77.146 E8.1985 F3600
+G1 X108.454 Y77.288 E8.2034 F3600
+G1 X108.504 Y77.425 E8.2082 F3600
+G1 X108.561 Y77.556 E8.2129 F3600
+G1 X108.625 Y77.681 E8.2176 F3600
+G1 X108.695 Y77.803 E8.2222 F3600
+G1 X108.770 Y77.922 E8.2269 F3600
+G1 X108.848 Y78.038 E8.2315 F3600
+G1 X108.929 Y78.153 E8.2361 F3600
+G1 X109.011 Y78.267 E8.2408 F3600
+G1 X109.094 Y78.382 E8.2454 F3600
+G1 X109.175 Y78.497 E8.2501 F3600
+G1 X109.254 Y78.613 E8.2547 F3600
+G1 X109.330 Y78.732 E8.2594 F3600
+G1 X109.401 Y78.853 E8.2640 F3600
+G1 X109.467 Y78.977 E8.2686 F3600
+G1 X109.525 Y79.105 E8.2733 F3600
+G1 X109.576 Y79.238 E8.2780 F3600
+G1 X109.619 Y79.375 E8.2827 F3600
+G1 X109.651 Y79.516 E8.2875 F3600
+G1 X109.673 Y79.663 E8.2924 F3600
+G1 X109.684 Y79.814 E8.2974 F3600
+G1 X109.682 Y79.971 E8.3026 F3600
+G1 X109.668 Y80.134 E8.3079 F3600
+G1 X109.641 Y80.301 E8.3135 F3600
+G1 X109.601 Y80.474 E8.3194 F3600
+G1 X109.547 Y80.651 E8.3255 F3600
+G1 X109.479 Y80.834 E8.3320 F3600
+G1 X109.397 Y81.021 E8.3387 F3600
+G1 X109.302 Y81.212 E8.3457 F3600
+G1 X109.192 Y81.407 E8.3531 F3600
+G1 X109.070 Y81.605 E8.3608 F3600
+G1 X108.935 Y81.806 E8.3688 F3600
+G1 X108.787 Y82.010 E8.3771 F3600
+G1 X108.628 Y82.215 E8.3857 F3600
+G1 X108.458 Y82.422 E8.3945 F3600
+G1 X108.279 Y82.630 E8.4036 F3600
+G1 X108.090 Y82.837 E8.4128 F3600
+G1 X107.894 Y83.045 E8.4222 F3600
+G1 X107.692 Y83.251 E8.4318 F3600
+G1 X107.484 Y83.456 E8.4414 F3600
+G1 X107.272 Y83.659 E8.4511 F3600
+G1 X107.058 Y83.859 E8.4607 F3600
+G1 X106.843 Y84.056 E8.4704 F3600
+G1 X106.628 Y84.248 E8.4799 F3600
+G1 X106.416 Y84.437 E8.4893 F3600
+G1 X106.207 Y84.621 E8.4984 F3600
+G1 X106.004 Y84.800 E8.5074 F3600
+G1 X105.808 Y84.973 E8.5160 F3600
+G1 X105.620 Y85.141 E8.5243 F3600
+G1 X105.443 Y85.302 E8.5322 F3600
+G1 X105.277 Y85.457 E8.5397 F3600
+G1 X105.125 Y85.606 E8.5467 F3600
+G1 X104.988 Y85.747 E8.5532 F3600
+G1 X104.867 Y85.883 E8.5592 F3600
+G1 X104.764 Y86.011 E8.5646 F3600
+G1 X104.680 Y86.132 E8.5695 F3600
+G1 X104.616 Y86.247 E8.5739 F3600
+G1 X104.573 Y86.356 E8.5777 F3600
+G1 X104.553 Y86.458 E8.5811 F3600
+G1 X104.556 Y86.554 E8.5843 F3600
+G1 X104.583 Y86.644 E8.5874 F3600
+G1 X104.634 Y86.729 E8.5907 F3600
+G1 X104.711 Y86.809 E8.5943 F3600
+G1 X104.813 Y86.884 E8.5985 F3600
+G1 X104.941 Y86.955 E8.6034 F3600
+G1 X105.095 Y87.022 E8.6089 F3600
+G1 X105.274 Y87.086 E8.6152 F3600
+G1 X105.479 Y87.148 E8.6222 F3600
+G1 X105.710 Y87.207 E8.6301 F3600
+G1 X105.965 Y87.265 E8.6387 F3600
+G1 X106.244 Y87.322 E8.6481 F3600
+G1 X106.547 Y87.379 E8.6583 F3600
+G1 X106.872 Y87.436 E8.6692 F3600
+G1 X107.218 Y87.494 E8.6808 F3600
+G1 X107.585 Y87.554 E8.6931 F3600
+G1 X107.972 Y87.615 E8.7060 F3600
+G1 X108.375 Y87.679 E8.7195 F3600
+G1 X108.796 Y87.745 E8.7335 F3600
+G1 X109.230 Y87.816 E8.7480 F3600
+G1 X109.678 Y87.890 E8.7630 F3600
+G1 X110.137 Y87.969 E8.7784 F3600
+G1 X110.606 Y88.052 E8.7941 F3600
+G1 X111.083 Y88.141 E8.8101 F3600
+G1 X111.565 Y88.235 E8.8263 F3600
+G1 X112.052 Y88.334 E8.8427 F3600
+G1 X112.540 Y88.440 E8.8592 F3600
+G1 X113.029 Y88.551 E8.8757 F3600
+G1 X113.516 Y88.669 E8.8923 F3600
+G1 X113.999 Y88.793 E8.9087 F3600
+G1 X114.477 Y88.923 E8.9251 F3600
+G1 X114.948 Y89.059 E8.9412 F3600
+G1 X115.409 Y89.201 E8.9572 F3600
+G1 X115.860 Y89.350 E8.9728 F3600
+G1 X116.298 Y89.504 E8.9882 F3600
+G1 X116.723 Y89.664 E9.0031 F3600
+G1 X117.132 Y89.830 E9.0177 F3600
+G1 X117.524 Y90.000 E9.0318 F3600
+G1 X117.899 Y90.175 E9.0455 F3600
+G1 X118.255 Y90.355 E9.0586 F3600
+G1 X118.590 Y90.539 E9.0713 F3600
+G1 X118.905 Y90.727 E9.0833 F3600
+G1 X119.198 Y90.918 E9.0949 F3600
+G1 X119.468 Y91.111 E9.1059 F3600
+G1 X119.716 Y91.308 E9.1163 F3600
+G1 X119.941 Y91.506 E9.1262 F3600
+G1 X120.143 Y91.706 E9.1356 F3600
+G1 X120.322 Y91.908 E9.1445 F3600
+G1 X120.477 Y92.110 E9.1529 F3600
+G1 X120.610 Y92.312 E9.1609 F3600
+G1 X120.720 Y92.515 E9.1685 F3600
+G1 X120.808 Y92.717 E9.1758 F3600
+G1 X120.874 Y92.918 E9.1828 F3600
+G1 X120.920 Y93.119 E9.1895 F3600
+G1 X120.946 Y93.318 E9.1962 F3600
+G1 X120.954 Y93.516 E9.2027 F3600
+G1 X120.943 Y93.712 E9.2092 F3600
+G1 X120.916 Y93.906 E9.2156 F3600
+G1 X120.873 Y94.097 E9.2221 F3600
+G1 X120.816 Y94.287 E9.2287 F3600
+G1 X120.746 Y94.474 E9.2353 F3600
+G1 X120.665 Y94.660 E9.2419 F3600
+G1 X120.574 Y94.842 E9.2487 F3600
+G1 X120.474 Y95.023 E9.2555 F3600
+G1 X120.367 Y95.202 E9.2623 F3600
+G1 X120.255 Y95.378 E9.2693 F3600
+G1 X120.138 Y95.553 E9.2762 F3600
+G1 X120.019 Y95.726 E9.2831 F3600
+G1 X119.898 Y95.898 E9.2901 F3600
+G1 X119.778 Y96.069 E9.2970 F3600
+G1 X119.659 Y96.239 E9.3038 F3600
+G1 X119.542 Y96.409 E9.3106 F3600
+G1 X119.430 Y96.578 E9.3173 F3600
+G1 X119.322 Y96.748 E9.3239 F3600
+G1 X119.221 Y96.918 E9.3305 F3600
+G1 X119.126 Y97.089 E9.3369 F3600
+G1 X119.040 Y97.262 E9.3433 F3600
+G1 X118.961 Y97.436 E9.3496 F3600
+G1 X118.892 Y97.612 E9.3559 F3600
+G1 X118.833 Y97.791 E9.3621 F3600
+G1 X118.784 Y97.972 E9.3682 F3600
+G1 X118.745 Y98.156 E9.3745 F3600
+G1 X118.716 Y98.343 E9.3807 F3600
+G1 X118.698 Y98.533 E9.3870 F3600
+G1 X118.690 Y98.728 E9.3934 F3600
+G1 X118.693 Y98.926 E9.4000 F3600
+G1 X118.705 Y99.128 E9.4067 F3600
+G1 X118.727 Y99.334 E9.4135 F3600
+G1 X118.757 Y99.544 E9.4205 F3600
+G1 X118.795 Y99.758 E9.4277 F3600
+G1 X118.841 Y99.976 E9.4350 F3600
+G1 X118.893 Y100.197 E9.4425 F3600
+G1 X118.950 Y100.423 E9.4502 F3600
+G1 X119.012 Y100.651 E9.4580 F3600
+G1 X119.076 Y100.883 E9.4659 F3600
+G1 X119.143 Y101.117 E9.4740 F3600
+G1 X119.211 Y101.354 E9.4821 F3600
+G1 X119.278 Y101.592 E9.4903 F3600
+G1 X119.343 Y101.832 E9.4985 F3600
+G1 X119.405 Y102.072 E9.5067 F3600
+G1 X119.462 Y102.312 E9.5148 F3600
+G1 X119.514 Y102.552 E9.5229 F3600
+G1 X119.558 Y102.791 E9.5309 F3600
+G1 X119.593 Y103.027 E9.5388 F3600
+G1 X119.618 Y103.261 E9.5466 F3600
+G1 X119.631 Y103.491 E9.5542 F3600
+G1 X119.632 Y103.717 E9.5616 F3600
+G1 X119.620 Y103.938 E9.5689 F3600
+G1 X119.592 Y104.153 E9.5761 F3600
+G1 X119.548 Y104.360 E9.5831 F3600
+G1 X119.487 Y104.561 E9.5900 F3600
+G1 X119.408 Y104.752 E9.5968 F3600
+G1 X119.311 Y104.935 E9.6036 F3600
+G1 X119.194 Y105.107 E9.6105 F3600
+G1 X119.058 Y105.269 E9.6175 F3600
+G1 X118.901 Y105.419 E9.6247 F3600
+G1 X118.723 Y105.556 E9.6321 F3600
+G1 X118.524 Y105.681 E9.6398 F3600
+G1 X118.304 Y105.793 E9.6480 F3600
+G1 X118.064 Y105.891 E9.6565 F3600
+G1 X117.802 Y105.974 E9.6656 F3600
+G1 X117.519 Y106.042 E9.6752 F3600
+G1 X117.217 Y106.096 E9.6853 F3600
+G1 X116.894 Y106.134 E9.6961 F3600
+G1 X116.553 Y106.157 E9.7073 F3600
+G1 X116.193 Y106.164 E9.7192 F3600
+G1 X115.816 Y106.156 E9.7317 F3600
+G1 X115.422 Y106.133 E9.7447 F3600
+G1 X115.012 Y106.095 E9.7583 F3600
+G1 X114.588 Y106.041 E9.7724 F3600
+G1 X114.151 Y105.973 E9.7870 F3600
+G1 X113.703 Y105.891 E9.8020 F3600
+G1 X113.243 Y105.796 E9.8175 F3600
+G1 X112.775 Y105.688 E9.8334 F3600
+G1 X112.299 Y105.568 E9.8496 F3600
+G1 X111.817 Y105.436 E9.8660 F3600
+G1 X111.331 Y105.294 E9.8828 F3600
+G1 X110.841 Y105.142 E9.8997 F3600
+G1 X110.351 Y104.982 E9.9167 F3600
+G1 X109.860 Y104.814 E9.9338 F3600
+G1 X109.372 Y104.640 E9.9509 F3600
+G1 X108.887 Y104.461 E9.9680 F3600
+G1 X108.407 Y104.278 E9.9850 F3600
+G1 X107.933 Y104.091 E10.0017 F3600
+G1 X107.467 Y103.904 E10.0183 F3600
+G1 X107.010 Y103.716 E10.0346 F3600
+G1 X106.564 Y103.529 E10.0506 F3600
+G1 X106.130 Y103.344 E10.0662 F3600
+G1 X105.709 Y103.162 E10.0813 F3600
+G1 X105.301 Y102.986 E10.0959 F3600
+G1 X104.909 Y102.815 E10.1101 F3600
+G1 X104.533 Y102.651 E10.1236 F3600
+G1 X104.174 Y102.496 E10.1365 F3600
+G1 X103.832 Y102.350 E10.1488 F3600
+G1 X103.509 Y102.214 E10.1604 F3600
+G1 X103.203 Y102.090 E10.1712 F3600
+G1 X102.917 Y101.978 E10.1814 F3600
+G1 X102.650 Y101.880 E10.1908 F3600
+G1 X102.403 Y101.795 E10.1994 F3600
+G1 X102.175 Y101.724 E10.2073 F3600
+G1 X101.966 Y101.669 E10.2144 F3600
+G1 X101.776 Y101.629 E10.2208 F3600
+G1 X101.605 Y101.605 E10.2265 F3600
+G1 X101.452 Y101.597 E10.2315 F3600
+G1 X101.318 Y101.606 E10.2360 F3600
+G1 X101.201 Y101.631 E10.2399 F3600
+G1 X101.100 Y101.672 E10.2435 F3600
+G1 X101.015 Y101.730 E10.2469 F3600
+G1 X100.946 Y101.804 E10.2503 F3600
+G1 X100.890 Y101.893 E10.2537 F3600
+G1 X100.848 Y101.998 E10.2575 F3600
+G1 X100.819 Y102.117 E10.2615 F3600
+G1 X100.800 Y102.250 E10.2659 F3600
+G1 X100.791 Y102.397 E10.2708 F3600
+G1 X100.792 Y102.556 E10.2760 F3600
+G1 X100.800 Y102.726 E10.2817 F3600
+G1 X100.815 Y102.908 E10.2877 F3600
+G1 X100.836 Y103.099 E10.2940 F3600
+G1 X100.861 Y103.298 E10.3006 F3600
+G1 X100.889 Y103.505 E10.3075 F3600
+G1 X100.920 Y103.719 E10.3147 F3600
+G1 X100.952 Y103.937 E10.3219 F3600
+G1 X100.983 Y104.160 E10.3294 F3600
+G1 X101.014 Y104.385 E10.3369 F3600
+G1 X101.043 Y104.612 E10.3444 F3600
+G1 X101.069 Y104.839 E10.3520 F3600
+G1 X101.091 Y105.066 E10.3595 F3600
+G1 X101.109 Y105.290 E10.3669 F3600
+G1 X101.122 Y105.512 E10.3742 F3600
+G1 X101.129 Y105.729 E10.3814 F3600
+G1 X101.129 Y105.941 E10.3884 F3600
+G1 X101.123 Y106.148 E10.3952 F3600
+G1 X101.109 Y106.347 E10.4018 F3600
+G1 X101.088 Y106.538 E10.4082 F3600
+G1 X101.059 Y106.721 E10.4143 F3600
+G1 X101.021 Y106.894 E10.4201 F3600
+G1 X100.976 Y107.058 E10.4257 F3600
+G1 X100.923 Y107.211 E10.4311 F3600
+G1 X100.861 Y107.354 E10.4362 F3600
+G1 X100.791 Y107.486 E10.4412 F3600
+G1 X100.714 Y107.608 E10.4459 F3600
+G1 X100.629 Y107.718 E10.4505 F3600
+G1 X100.537 Y107.817 E10.4550 F3600
+G1 X100.438 Y107.906 E10.4593 F3600
+G1 X100.333 Y107.984 E10.4637 F3600
+G1 X100.222 Y108.053 E10.4680 F3600
+G1 X100.106 Y108.112 E10.4723 F3600
+G1 X99.985 Y108.162 E10.4766 F3600
+G1 X99.859 Y108.204 E10.4810 F3600
+G1 X99.731 Y108.239 E10.4854 F3600
+G1 X99.599 Y108.267 E10.4898 F3600
+G1 X99.465 Y108.291 E10.4943 F3600
+G1 X99.329 Y108.309 E10.4988 F3600
+G1 X99.193 Y108.325 E10.5034 F3600
+G1 X99.056 Y108.339 E10.5079 F3600
+G1 X98.919 Y108.352 E10.5124 F3600
+G1 X98.783 Y108.365 E10.5169 F3600
+G1 X98.649 Y108.380 E10.5214 F3600
+G1 X98.517 Y108.399 E10.5258 F3600
+G1 X98.387 Y108.422 E10.5301 F3600
+G1 X98.261 Y108.450 E10.5344 F3600
+G1 X98.138 Y108.486 E10.5386 F3600
+G1 X98.019 Y108.531 E10.5428 F3600
+G1 X97.904 Y108.585 E10.5470 F3600
+G1 X97.794 Y108.650 E10.5513 F3600
+G1 X97.688 Y108.727 E10.5556 F3600
+G1 X97.588 Y108.818 E10.5600 F3600
+G1 X97.492 Y108.923 E10.5647 F3600
+G1 X97.402 Y109.043 E10.5697 F3600
+G1 X97.316 Y109.180 E10.5750 F3600
+G1 X97.236 Y109.333 E10.5807 F3600
+G1 X97.161 Y109.504 E10.5869 F3600
+G1 X97.090 Y109.694 E10.5936 F3600
+G1 X97.024 Y109.902 E10.6008 F3600
+G1 X96.963 Y110.130 E10.6086 F3600
+G1 X96.905 Y110.376 E10.6169 F3600
+G1 X96.851 Y110.642 E10.6259 F3600
+G1 X96.800 Y110.928 E10.6354 F3600
+G1 X96.752 Y111.233 E10.6456 F3600
+G1 X96.706 Y111.556 E10.6564 F3600
+G1 X96.662 Y111.898 E10.6678 F3600
+G1 X96.619 Y112.258 E10.6798 F3600
+G1 X96.576 Y112.635 E10.6923 F3600
+G1 X96.534 Y113.029 E10.7053 F3600
+G1 X96.491 Y113.438 E10.7189 F3600
+G1 X96.447 Y113.861 E10.7329 F3600
+G1 X96.401 Y114.297 E10.7474 F3600
+G1 X96.353 Y114.745 E10.7623 F3600
+G1 X96.303 Y115.203 E10.7775 F3600
+G1 X96.248 Y115.671 E10.7930 F3600
+G1 X96.190 Y116.146 E10.8088 F3600
+G1 X96.128 Y116.626 E10.8248 F3600
+G1 X96.060 Y117.111 E10.8410 F3600
+G1 X95.987 Y117.597 E10.8572 F3600
+G1 X95.908 Y118.085 E10.8735 F3600
+G1 X95.823 Y118.570 E10.8898 F3600
+G1 X95.732 Y119.053 E10.9060 F3600
+G1 X95.633 Y119.530 E10.9220 F3600
+G1 X95.528 Y120.000 E10.9379 F3600
+G1 X95.415 Y120.462 E10.9536 F3600
+G1 X95.295 Y120.912 E10.9690 F3600
+G1 X95.168 Y121.350 E10.9841 F3600
+G1 X95.033 Y121.774 E10.9987 F3600
+G1 X94.890 Y122.182 E11.0130 F3600
+G1 X94.740 Y122.572 E11.0268 F3600
+G1 X94.583 Y122.943 E11.0401 F3600
+G1 X94.419 Y123.294 E11.0529 F3600
+G1 X94.248 Y123.623 E11.0651 F3600
+G1 X94.070 Y123.928 E11.0768 F3600
+G1 X93.886 Y124.209 E11.0878 F3600
+G1 X93.695 Y124.465 E11.0984 F3600
+G1 X93.500 Y124.694 E11.1083 F3600
+G1 X93.299 Y124.897 E11.1177 F3600
+G1 X93.093 Y125.072 E11.1266 F3600
+G1 X92.883 Y125.218 E11.1351 F3600
+G1 X92.669 Y125.337 E11.1432 F3600
+G1 X92.452 Y125.427 E11.1509 F3600
+G1 X92.233 Y125.488 E11.1584 F3600
+G1 X92.011 Y125.521 E11.1658 F3600
+G1 X91.787 Y125.525 E11.1732 F3600
+G1 X91.562 Y125.502 E11.1807 F3600
+G1 X91.337 Y125.451 E11.1883 F3600
+G1 X91.112 Y125.374 E11.1962 F3600
+G1 X90.887 Y125.271 E11.2043 F3600
+G1 X90.663 Y125.143 E11.2128 F3600
+G1 X90.440 Y124.991 E11.2217 F3600
+G1 X90.219 Y124.817 E11.2310 F3600
+G1 X90.000 Y124.621 E11.2407 F3600
+G1 X89.784 Y124.405 E11.2508 F3600
+G1 X89.571 Y124.170 E11.2613 F3600
+G1 X89.361 Y123.919 E11.2721 F3600
+G1 X89.154 Y123.651 E11.2832 F3600
+G1 X88.951 Y123.370 E11.2947 F3600
+G1 X88.752 Y123.077 E11.3064 F3600
+G1 X88.558 Y122.773 E11.3183 F3600
+G1 X88.367 Y122.460 E11.3304 F3600
+G1 X88.181 Y122.140 E11.3426 F3600
+G1 X87.998 Y121.815 E11.3549 F3600
+G1 X87.820 Y121.486 E11.3672 F3600
+G1 X87.646 Y121.155 E11.3796 F3600
+G1 X87.477 Y120.824 E11.3918 F3600
+G1 X87.311 Y120.494 E11.4040 F3600
+G1 X87.148 Y120.167 E11.4161 F3600
+G1 X86.990 Y119.845 E11.4279 F3600
+G1 X86.834 Y119.528 E11.4396 F3600
+G1 X86.681 Y119.218 E11.4510 F3600
+G1 X86.532 Y118.916 E11.4621 F3600
+G1 X86.384 Y118.623 E11.4729 F3600
+G1 X86.239 Y118.341 E11.4834 F3600
+G1 X86.095 Y118.070 E11.4935 F3600
+G1 X85.953 Y117.811 E11.5033 F3600
+G1 X85.812 Y117.564 E11.5127 F3600
+G1 X85.671 Y117.331 E11.5217 F3600
+G1 X85.531 Y117.111 E11.5303 F3600
+G1 X85.391 Y116.905 E11.5385 F3600
+G1 X85.251 Y116.712 E11.5463 F3600
+G1 X85.111 Y116.534 E11.5538 F3600
+G1 X84.970 Y116.369 E11.5610 F3600
+G1 X84.828 Y116.217 E11.5678 F3600
+G1 X84.685 Y116.079 E11.5744 F3600
+G1 X84.540 Y115.953 E11.5807 F3600
+G1 X84.395 Y115.839 E11.5868 F3600
+G1 X84.247 Y115.736 E11.5928 F3600
+G1 X84.099 Y115.644 E11.5986 F3600
+G1 X83.948 Y115.561 E11.6042 F3600
+G1 X83.797 Y115.486 E11.6098 F3600
+G1 X83.644 Y115.419 E11.6153 F3600
+G1 X83.489 Y115.358 E11.6208 F3600
+G1 X83.334 Y115.302 E11.6262 F3600
+G1 X83.178 Y115.250 E11.6317 F3600
+G1 X83.021 Y115.200 E11.6371 F3600
+G1 X82.864 Y115.152 E11.6425 F3600
+G1 X82.707 Y115.103 E11.6479 F3600
+G1 X82.550 Y115.053 E11.6534 F3600
+G1 X82.395 Y115.001 E11.6588 F3600
+G1 X82.240 Y114.944 E11.6642 F3600
+G1 X82.088 Y114.881 E11.6696 F3600
+G1 X81.938 Y114.813 E11.6751 F3600
+G1 X81.791 Y114.736 E11.6806 F3600
+G1 X81.647 Y114.650 E11.6861 F3600
+G1 X81.507 Y114.555 E11.6917 F3600
+G1 X81.371 Y114.448 E11.6974 F3600
+G1 X81.241 Y114.330 E11.7032 F3600
+G1 X81.116 Y114.199 E11.7092 F3600
+G1 X80.997 Y114.054 E11.7154 F3600
+G1 X80.885 Y113.895 E11.7218 F3600
+G1 X80.780 Y113.722 E11.7285 F3600
+G1 X80.682 Y113.534 E11.7354 F3600
+G1 X80.593 Y113.330 E11.7428 F3600
+G1 X80.512 Y113.112 E11.7505 F3600
+G1 X80.440 Y112.877 E11.7586 F3600
+G1 X80.376 Y112.628 E11.7671 F3600
+G1 X80.323 Y112.363 E11.7760 F3600
+G1 X80.278 Y112.083 E11.7853 F3600
+G1 X80.244 Y111.790 E11.7951 F3600
+G1 X80.219 Y111.482 E11.8053 F3600
+G1 X80.204 Y111.161 E11.8159 F3600
+G1 X80.199 Y110.828 E11.8269 F3600
+G1 X80.203 Y110.484 E11.8382 F3600
+G1 X80.217 Y110.129 E11.8499 F3600
+G1 X80.240 Y109.765 E11.8620 F3600
+G1 X80.272 Y109.392 E11.8743 F3600
+G1 X80.312 Y109.013 E11.8869 F3600
+G1 X80.360 Y108.628 E11.8997 F3600
+G1 X80.416 Y108.239 E11.9127 F3600
+G1 X80.478 Y107.848 E11.9258 F3600
+G1 X80.547 Y107.455 E11.9389 F3600
+G1 X80.620 Y107.062 E11.9521 F3600
+G1 X80.698 Y106.671 E11.9653 F3600
+G1 X80.780 Y106.283 E11.9784 F3600
+G1 X80.865 Y105.900 E11.9913 F3600
+G1 X80.951 Y105.523 E12.0041 F3600
+G1 X81.038 Y105.154 E12.0166 F3600
+G1 X81.125 Y104.794 E12.0288 F3600
+G1 X81.210 Y104.445 E12.0406 F3600
+G1 X81.293 Y104.108 E12.0521 F3600
+G1 X81.373 Y103.785 E12.0631 F3600
+G1 X81.448 Y103.476 E12.0736 F3600
+G1 X81.517 Y103.183 E12.0835 F3600
+G1 X81.580 Y102.907 E12.0929 F3600
+G1 X81.635 Y102.648 E12.1016 F3600
+G1 X81.680 Y102.409 E12.1096 F3600
+G1 X81.716 Y102.189 E12.1169 F3600
+G1 X81.741 Y101.990 E12.1236 F3600
+G1 X81.754 Y101.812 E12.1295 F3600
+G1 X81.754 Y101.654 E12.1347 F3600
+G1 X81.741 Y101.519 E12.1392 F3600
+G1 X81.713 Y101.406 E12.1430 F3600
+G1 X81.671 Y101.314 E12.1463 F3600
+G1 X81.612 Y101.245 E12.1493 F3600
+G1 X81.537 Y101.198 E12.1522 F3600
+G1 X81.446 Y101.172 E12.1554 F3600
+G1 X81.338 Y101.167 E12.1590 F3600
+G1 X81.212 Y101.183 E12.1631 F3600
+G1 X81.069 Y101.220 E12.1680 F3600
+G1 X80.908 Y101.276 E12.1736 F3600
+G1 X80.730 Y101.350 E12.1800 F3600
+G1 X80.534 Y101.442 E12.1871 F3600
+G1 X80.321 Y101.551 E12.1950 F3600
+G1 X80.091 Y101.676 E12.2037 F3600
+G1 X79.845 Y101.815 E12.2130 F3600
+G1 X79.583 Y101.967 E12.2230 F3600
+G1 X79.305 Y102.131 E12.2337 F3600
+G1 X79.012 Y102.306 E12.2449 F3600
+G1 X78.706 Y102.490 E12.2567 F3600
+G1 X78.387 Y102.683 E12.2690 F3600
+G1 X78.055 Y102.881 E12.2818 F3600
+G1 X77.712 Y103.085 E12.2949 F3600
+G1 X77.360 Y103.292 E12.3084 F3600
+G1 X76.998 Y103.502 E12.3222 F3600
+G1 X76.628 Y103.712 E12.3362 F3600
+G1 X76.252 Y103.922 E12.3505 F3600
+G1 X75.871 Y104.129 E12.3648 F3600
+G1 X75.485 Y104.334 E12.3792 F3600
+G1 X75.097 Y104.533 E12.3936 F3600
+G1 X74.707 Y104.727 E12.4080 F3600
+G1 X74.317 Y104.914 E12.4222 F3600
+G1 X73.928 Y105.093 E12.4364 F3600
+G1 X73.541 Y105.263 E12.4503 F3600
+G1 X73.158 Y105.422 E12.4640 F3600
+G1 X72.779 Y105.571 E12.4774 F3600
+G1 X72.406 Y105.708 E12.4905 F3600
+G1 X72.041 Y105.833 E12.5033 F3600
+G1 X71.683 Y105.945 E12.5157 F3600
+G1 X71.334 Y106.044 E12.5276 F3600
+G1 X70.995 Y106.129 E12.5391 F3600
+G1 X70.667 Y106.199 E12.5502 F3600
+G1 X70.350 Y106.256 E12.5609 F3600
+G1 X70.045 Y106.298 E12.5710 F3600
+G1 X69.753 Y106.326 E12.5807 F3600
+G1 X69.474 Y106.339 E12.5899 F3600
+G1 X69.208 Y106.338 E12.5987 F3600
+G1 X68.955 Y106.324 E12.6071 F3600
+G1 X68.716 Y106.296 E12.6150 F3600
+G1 X68.491 Y106.255 E12.6225 F3600
+G1 X68.280 Y106.202 E12.6297 F3600
+G1 X68.081 Y106.136 E12.6366 F3600
+G1 X67.896 Y106.059 E12.6432 F3600
+G1 X67.724 Y105.972 E12.6496 F3600
+G1 X67.564 Y105.874 E12.6558 F3600
+G1 X67.415 Y105.767 E12.6619 F3600
+G1 X67.277 Y105.652 E12.6678 F3600
+G1 X67.150 Y105.529 E12.6736 F3600
+G1 X67.031 Y105.399 E12.6794 F3600
+G1 X66.922 Y105.264 E12.6852 F3600
+G1 X66.819 Y105.123 E12.6909 F3600
+G1 X66.723 Y104.978 E12.6967 F3600
+G1 X66.632 Y104.830 E12.7024 F3600
+G1 X66.545 Y104.679 E12.7082 F3600
+G1 X66.462 Y104.526 E12.7139 F3600
+G1 X66.380 Y104.373 E12.7196 F3600
+G1 X66.299 Y104.219 E12.7254 F3600
+G1 X66.217 Y104.065 E12.7311 F3600
+G1 X66.134 Y103.913 E12.7368 F3600
+G1 X66.048 Y103.762 E12.7426 F3600
+G1 X65.957 Y103.614 E12.7483 F3600
+G1 X65.862 Y103.468 E12.7541 F3600
+G1 X65.761 Y103.325 E12.7598 F3600
+G1 X65.653 Y103.186 E12.7656 F3600
+G1 X65.537 Y103.051 E12.7715 F3600
+G1 X65.412 Y102.920 E12.7775 F3600
+G1 X65.277 Y102.793 E12.7836 F3600
+G1 X65.132 Y102.671 E12.7899 F3600
+G1 X64.976 Y102.553 E12.7963 F3600
+G1 X64.809 Y102.439 E12.8030 F3600
+G1 X64.631 Y102.330 E12.8099 F3600
+G1 X64.440 Y102.224 E12.8171 F3600
+G1 X64.238 Y102.123 E12.8246 F3600
+G1 X64.023 Y102.025 E12.8323 F3600
+G1 X63.796 Y101.931 E12.8404 F3600
+G1 X63.558 Y101.839 E12.8489 F3600
+G1 X63.308 Y101.750 E12.8576 F3600
+G1 X63.047 Y101.664 E12.8667 F3600
+G1 X62.776 Y101.579 E12.8761 F3600
+G1 X62.495 Y101.494 E12.8858 F3600
+G1 X62.205 Y101.411 E12.8957 F3600
+G1 X61.907 Y101.328 E12.9059 F3600
+G1 X61.602 Y101.244 E12.9164 F3600
+G1 X61.291 Y101.159 E12.9270 F3600
+G1 X60.975 Y101.072 E12.9378 F3600
+G1 X60.656 Y100.983 E12.9487 F3600
+G1 X60.335 Y100.891 E12.9597 F3600
+G1 X60.014 Y100.796 E12.9708 F3600
+G1 X59.693 Y100.696 E12.9819 F3600
+G1 X59.375 Y100.593 E12.9929 F3600
+G1 X59.061 Y100.484 E13.0039 F3600
+G1 X58.752 Y100.370 E13.0147 F3600
+G1 X58.451 Y100.251 E13.0254 F3600
+G1 X58.159 Y100.125 E13.0359 F3600
+G1 X57.877 Y99.993 E13.0462 F3600
+G1 X57.607 Y99.854 E13.0562 F3600
+G1 X57.351 Y99.708 E13.0660 F3600
+G1 X57.111 Y99.555 E13.0754 F3600
+G1 X56.887 Y99.395 E13.0844 F3600
+G1 X56.681 Y99.228 E13.0932 F3600
+G1 X56.495 Y99.053 E13.1016 F3600
+G1 X56.330 Y98.871 E13.1097 F3600
+G1 X56.187 Y98.682 E13.1176 F3600
+G1 X56.067 Y98.486 E13.1251 F3600
+G1 X55.972 Y98.283 E13.1325 F3600
+G1 X55.901 Y98.073 E13.1398 F3600
+G1 X55.857 Y97.858 E13.1471 F3600
+G1 X55.839 Y97.636 E13.1544 F3600
+G1 X55.848 Y97.409 E13.1619 F3600
+G1 X55.884 Y97.177 E13.1697 F3600
+G1 X55.948 Y96.940 E13.1778 F3600
+G1 X56.040 Y96.700 E13.1863 F3600
+G1 X56.160 Y96.455 E13.1953 F3600
+G1 X56.307 Y96.208 E13.2047 F3600
+G1 X56.481 Y95.959 E13.2148 F3600
+G1 X56.682 Y95.707 E13.2254 F3600
+G1 X56.910 Y95.454 E13.2366 F3600
+G1 X57.162 Y95.201 E13.2484 F3600
+G1 X57.439 Y94.948 E13.2608 F3600
+G1 X57.740 Y94.695 E13.2738 F3600
+G1 X58.062 Y94.443 E13.2873 F3600
+G1 X58.406 Y94.193 E13.3013 F3600
+G1 X58.770 Y93.945 E13.3158 F3600
+G1 X59.151 Y93.700 E13.3308 F3600
+G1 X59.550 Y93.459 E13.3462 F3600
+G1 X59.963 Y93.221 E13.3619 F3600
+G1 X60.390 Y92.987 E13.3780 F3600
+G1 X60.828 Y92.758 E13.3943 F3600
+G1 X61.276 Y92.533 E13.4108 F3600
+G1 X61.732 Y92.314 E13.4275 F3600
+G1 X62.194 Y92.101 E13.4443 F3600
+G1 X62.660 Y91.893 E13.4611 F3600
+G1 X63.127 Y91.691 E13.4780 F3600
+G1 X63.596 Y91.495 E13.4947 F3600
+G1 X64.062 Y91.305 E13.5113 F3600
+G1 X64.525 Y91.121 E13.5278 F3600
+G1 X64.983 Y90.944 E13.5440 F3600
+G1 X65.434 Y90.772 E13.5599 F3600
+G1 X65.876 Y90.606 E13.5755 F3600
+G1 X66.307 Y90.447 E13.5907 F3600
+G1 X66.727 Y90.292 E13.6054 F3600
+G1 X67.133 Y90.144 E13.6197 F3600
+G1 X67.524 Y90.000 E13.6334 F3600
+G1 X67.900 Y89.861 E13.6467 F3600
+G1 X68.258 Y89.727 E13.6593 F3600
+G1 X68.599 Y89.597 E13.6713 F3600
+G1 X68.920 Y89.470 E13.6827 F3600
+G1 X69.222 Y89.347 E13.6935 F3600
+G1 X69.504 Y89.227 E13.7036 F3600
+G1 X69.765 Y89.109 E13.7130 F3600
+G1 X70.005 Y88.994 E13.7218 F3600
+G1 X70.223 Y88.880 E13.7299 F3600
+G1 X70.421 Y88.768 E13.7374 F3600
+G1 X70.597 Y88.657 E13.7443 F3600
+G1 X70.752 Y88.546 E13.7506 F3600
+G1 X70.887 Y88.435 E13.7564 F3600
+G1 X71.001 Y88.324 E13.7616 F3600
+G1 X71.096 Y88.213 E13.7664 F3600
+G1 X71.173 Y88.101 E13.7709 F3600
+G1 X71.231 Y87.988 E13.7751 F3600
+G1 X71.273 Y87.873 E13.7792 F3600
+G1 X71.299 Y87.757 E13.7831 F3600
+G1 X71.310 Y87.639 E13.7870 F3600
+G1 X71.308 Y87.519 E13.7909 F3600
+G1 X71.293 Y87.398 E13.7950 F3600
+G1 X71.268 Y87.274 E13.7992 F3600
+G1 X71.233 Y87.148 E13.8035 F3600
+G1 X71.190 Y87.021 E13.8079 F3600
+G1 X71.140 Y86.891 E13.8125 F3600
+G1 X71.085 Y86.760 E13.8172 F3600
+G1 X71.027 Y86.627 E13.8220 F3600
+G1 X70.966 Y86.493 E13.8268 F3600
+G1 X70.905 Y86.357 E13.8317 F3600
+G1 X70.844 Y86.221 E13.8367 F3600
+G1 X70.785 Y86.084 E13.8416 F3600
+G1 X70.730 Y85.946 E13.8465 F3600
+G1 X70.679 Y85.809 E13.8513 F3600
+G1 X70.634 Y85.671 E13.8561 F3600
+G1 X70.596 Y85.534 E13.8608 F3600
+G1 X70.566 Y85.399 E13.8654 F3600
+G1 X70.545 Y85.265 E13.8698 F3600
+G1 X70.533 Y85.132 E13.8742 F3600
+G1 X70.532 Y85.002 E13.8785 F3600
+G1 X70.542 Y84.874 E13.8828 F3600
+G1 X70.564 Y84.748 E13.8870 F3600
+G1 X70.598 Y84.627 E13.8911 F3600
+G1 X70.643 Y84.508 E13.8953 F3600
+G1 X70.701 Y84.393 E13.8996 F3600
+G1 X70.772 Y84.282 E13.9039 F3600
+G1 X70.855 Y84.176 E13.9084 F3600
+G1 X70.950 Y84.074 E13.9130 F3600
+G1 X71.056 Y83.976 E13.9177 F3600
+G1 X71.174 Y83.883 E13.9227 F3600
+G1 X71.302 Y83.794 E13.9278 F3600
+G1 X71.440 Y83.711 E13.9332 F3600
+G1 X71.587 Y83.631 E13.9387 F3600
+G1 X71.743 Y83.556 E13.9444 F3600
+G1 X71.906 Y83.486 E13.9502 F3600
+G1 X72.075 Y83.419 E13.9562 F3600
+G1 X72.249 Y83.356 E13.9623 F3600
+G1 X72.427 Y83.297 E13.9685 F3600
+G1 X72.607 Y83.240 E13.9748 F3600
+G1 X72.789 Y83.186 E13.9810 F3600
+G1 X72.971 Y83.134 E13.9873 F3600
+G1 X73.151 Y83.083 E13.9935 F3600
+G1 X73.329 Y83.033 E13.9995 F3600
+G1 X73.502 Y82.983 E14.0055 F3600
+G1 X73.670 Y82.933 E14.0113 F3600
+G1 X73.831 Y82.882 E14.0168 F3600
+G1 X73.983 Y82.829 E14.0222 F3600
+G1 X74.126 Y82.773 E14.0272 F3600
+G1 X74.258 Y82.713 E14.0320 F3600
+G1 X74.378 Y82.649 E14.0365 F3600
+G1 X74.485 Y82.580 E14.0407 F3600
+G1 X74.578 Y82.505 E14.0446 F3600
+G1 X74.655 Y82.423 E14.0484 F3600
+G1 X74.716 Y82.333 E14.0519 F3600
+G1 X74.761 Y82.235 E14.0555 F3600
+G1 X74.788 Y82.128 E14.0591 F3600
+G1 X74.796 Y82.011 E14.0630 F3600
+G1 X74.786 Y81.883 E14.0672 F3600
+G1 X74.757 Y81.744 E14.0719 F3600
+G1 X74.709 Y81.594 E14.0771 F3600
+G1 X74.641 Y81.430 E14.0830 F3600
+G1 X74.554 Y81.254 E14.0895 F3600
+G1 X74.448 Y81.065 E14.0966 F3600
+G1 X74.323 Y80.861 E14.1045 F3600
+G1 X74.180 Y80.644 E14.1131 F3600
+G1 X74.018 Y80.412 E14.1224 F3600
+G1 X73.839 Y80.166 E14.1325 F3600
+G1 X73.643 Y79.906 E14.1432 F3600
+G1 X73.432 Y79.631 E14.1547 F3600
+G1 X73.205 Y79.342 E14.1668 F3600
+G1 X72.965 Y79.038 E14.1796 F3600
+G1 X72.712 Y78.721 E14.1929 F3600
+G1 X72.447 Y78.391 E14.2069 F3600
+G1 X72.173 Y78.048 E14.2214 F3600
+G1 X71.889 Y77.692 E14.2364 F3600
+G1 X71.598 Y77.324 E14.2519 F3600
+G1 X71.301 Y76.946 E14.2678 F3600
+G1 X71.000 Y76.557 E14.2840 F3600
+G1 X70.696 Y76.159 E14.3005 F3600
+G1 X70.391 Y75.753 E14.3173 F3600
+G1 X70.085 Y75.339 E14.3343 F3600
+G1 X69.782 Y74.919 E14.3514 F3600
+G1 X69.482 Y74.494 E14.3685 F3600
+G1 X69.187 Y74.064 E14.3857 F3600
+G1 X68.899 Y73.632 E14.4029 F3600
+G1 X68.618 Y73.199 E14.4199 F3600
+G1 X68.347 Y72.764 E14.4368 F3600
+G1 X68.087 Y72.331 E14.4535 F3600
+G1 X67.839 Y71.900 E14.4699 F3600
+G1 X67.604 Y71.473 E14.4860 F3600
+G1 X67.384 Y71.050 E14.5017 F3600
+G1 X67.179 Y70.633 E14.5171 F3600
+G1 X66.991 Y70.223 E14.5319 F3600
+G1 X66.821 Y69.822 E14.5463 F3600
+G1 X66.668 Y69.430 E14.5602 F3600
+G1 X66.535 Y69.049 E14.5735 F3600
+G1 X66.421 Y68.680 E14.5862 F3600
+G1 X66.328 Y68.324 E14.5984 F3600
+G1 X66.255 Y67.981 E14.6100 F3600
+G1 X66.202 Y67.652 E14.6210 F3600
+G1 X66.170 Y67.339 E14.6314 F3600
+G1 X66.159 Y67.041 E14.6412 F3600
+G1 X66.169 Y66.760 E14.6505 F3600
+G1 X66.199 Y66.496 E14.6592 F3600
+G1 X66.250 Y66.250 E14.6675 F3600
+G1 X66.320 Y66.021 E14.6754 F3600
+G1 X66.410 Y65.809 E14.6830 F3600
+G1 X66.518 Y65.616 E14.6903 F3600
+G1 X66.644 Y65.440 E14.6975 F3600
+G1 X66.788 Y65.282 E14.7045 F3600
+G1 X66.948 Y65.141 E14.7116 F3600
+G1 X67.124 Y65.018 E14.7187 F3600
+G1 X67.314 Y64.911 E14.7259 F3600
+G1 X67.518 Y64.820 E14.7332 F3600
+G1 X67.734 Y64.745 E14.7408 F3600
+G1 X67.962 Y64.684 E14.7486 F3600
+G1 X68.200 Y64.638 E14.7566 F3600
+G1 X68.448 Y64.604 E14.7648 F3600
+G1 X68.703 Y64.583 E14.7733 F3600
+G1 X68.965 Y64.573 E14.7819 F3600
+G1 X69.233 Y64.573 E14.7907 F3600
+G1 X69.505 Y64.582 E14.7997 F3600
+G1 X69.781 Y64.599 E14.8089 F3600
+G1 X70.059 Y64.623 E14.8181 F3600
+G1 X70.338 Y64.652 E14.8273 F3600
+G1 X70.618 Y64.686 E14.8366 F3600
+G1 X70.896 Y64.722 E14.8459 F3600
+G1 X71.174 Y64.761 E14.8551 F3600
+G1 X71.448 Y64.800 E14.8643 F3600
+G1 X71.720 Y64.840 E14.8734 F3600
+G1 X71.987 Y64.877 E14.8823 F3600
+G1 X72.250 Y64.912 E14.8910 F3600
+G1 X72.508 Y64.944 E14.8996 F3600
+G1 X72.759 Y64.971 E14.9079 F3600
+G1 X73.005 Y64.993 E14.9161 F3600
+G1 X73.244 Y65.008 E14.9240 F3600
+G1 X73.476 Y65.017 E14.9316 F3600
+G1 X73.702 Y65.018 E14.9391 F3600
+G1 X73.920 Y65.011 E14.9463 F3600
+G1 X74.131 Y64.995 E14.9533 F3600
+G1 X74.335 Y64.970 E14.9601 F3600
+G1 X74.533 Y64.937 E14.9667 F3600
+G1 X74.723 Y64.894 E14.9731 F3600
+G1 X74.907 Y64.842 E14.9794 F3600
+G1 X75.085 Y64.780 E14.9856 F3600
+G1 X75.257 Y64.710 E14.9918 F3600
+G1 X75.424 Y64.631 E14.9979 F3600
+G1 X75.586 Y64.544 E15.0039 F3600
+G1 X75.743 Y64.449 E15.0100 F3600
+G1 X75.897 Y64.347 E15.0161 F3600
+G1 X76.047 Y64.238 E15.0222 F3600
+G1 X76.195 Y64.124 E15.0284 F3600
+G1 X76.341 Y64.006 E15.0346 F3600
+G1 X76.486 Y63.884 E15.0408 F3600
+G1 X76.630 Y63.759 E15.0471 F3600
+G1 X76.773 Y63.633 E15.0534 F3600
+G1 X76.918 Y63.507 E15.0597 F3600
+G1 X77.063 Y63.381 E15.0661 F3600
+G1 X77.211 Y63.258 E15.0724 F3600
+G1 X77.360 Y63.139 E15.0787 F3600
+G1 X77.513 Y63.025 E15.0850 F3600
+G1 X77.669 Y62.916 E15.0913 F3600
+G1 X77.829 Y62.816 E15.0975 F3600
+G1 X77.993 Y62.724 E15.1037 F3600
+G1 X78.162 Y62.643 E15.1099 F3600
+G1 X78.335 Y62.573 E15.1161 F3600
+G1 X78.515 Y62.516 E15.1223 F3600
+G1 X78.699 Y62.473 E15.1285 F3600
+G1 X78.890 Y62.445 E15.1349 F3600
+G1 X79.086 Y62.434 E15.1414 F3600
+G1 X79.288 Y62.439 E15.1480 F3600
+G1 X79.496 Y62.463 E15.1549 F3600
+G1 X79.709 Y62.506 E15.1621 F3600
+G1 X79.929 Y62.568 E15.1697 F3600
+G1 X80.153 Y62.650 E15.1776 F3600
+G1 X80.383 Y62.753 E15.1859 F3600
+G1 X80.618 Y62.876 E15.1946 F3600
+G1 X80.858 Y63.021 E15.2039 F3600
+G1 X81.102 Y63.188 E15.2136 F3600
+G1 X81.349 Y63.375 E15.2239 F3600
+G1 X81.600 Y63.584 E15.2346 F3600
+G1 X81.854 Y63.813 E15.2459 F3600
+G1 X82.110 Y64.063 E15.2577 F3600
+G1 X82.368 Y64.332 E15.2700 F3600
+G1 X82.627 Y64.621 E15.2828 F3600
+G1 X82.886 Y64.927 E15.2961 F3600
+G1 X83.146 Y65.251 E15.3098 F3600
+G1 X83.405 Y65.592 E15.3239 F3600
+G1 X83.663 Y65.947 E15.3384 F3600
+G1 X83.919 Y66.316 E15.3532 F3600
+G1 X84.173 Y66.697 E15.3683 F3600
+G1 X84.423 Y67.089 E15.3837 F3600
+G1 X84.671 Y67.491 E15.3992 F3600
+G1 X84.914 Y67.900 E15.4149 F3600
+G1 X85.153 Y68.315 E15.4307 F3600
+G1 X85.387 Y68.734 E15.4466 F3600
+G1 X85.615 Y69.155 E15.4624 F3600
+G1 X85.838 Y69.577 E15.4781 F3600
+G1 X86.054 Y69.998 E15.4937 F3600
+G1 X86.264 Y70.416 E15.5092 F3600
+G1 X86.467 Y70.828 E15.5243 F3600
+G1 X86.664 Y71.233 E15.5392 F3600
+G1 X86.853 Y71.630 E15.5537 F3600
+G1 X87.036 Y72.016 E15.5678 F3600
+G1 X87.211 Y72.390 E15.5814 F3600
+G1 X87.379 Y72.749 E15.5945 F3600
+G1 X87.540 Y73.093 E15.6071 F3600
+G1 X87.693 Y73.420 E15.6190 F3600
+G1 X87.840 Y73.729 E15.6302 F3600
+G1 X87.981 Y74.017 E15.6408 F3600
+G1 X88.115 Y74.284 E15.6507 F3600
+G1 X88.243 Y74.528 E15.6598 F3600
+G1 X88.365 Y74.750 E15.6681 F3600
+G1 X88.482 Y74.947 E15.6757 F3600
+G1 X88.593 Y75.119 E15.6825 F3600
+G1 X88.700 Y75.265 E15.6884 F3600
+G1 X88.804 Y75.385 E15.6937 F3600
+G1 X88.903 Y75.479 E15.6982 F3600
+G1 X88.999 Y75.546 E15.7021 F3600
+G1 X89.093 Y75.587 E15.7054 F3600
+G1 X89.185 Y75.601 E15.7085 F3600
+G1 X89.275 Y75.589 E15.7115 F3600
+G1 X89.364 Y75.550 E15.7147 F3600
+G1 X89.453 Y75.487 E15.7183 F3600
+G1 X89.541 Y75.399 E15.7224 F3600
+G1 X89.630 Y75.287 E15.7271 F3600
+G1 X89.720 Y75.152 E15.7325 F3600
+G1 X89.811 Y74.995 E15.7385 F3600
+G1 X89.905 Y74.818 E15.7451 F3600
+G1 X90.000 Y74.621 E15.7523 F3600
+G1 X90.098 Y74.406 E15.7601 F3600
+G1 X90.199 Y74.174 E15.7684 F3600
+G1 X90.303 Y73.927 E15.7773 F3600
+G1 X90.411 Y73.667 E15.7866 F3600
+G1 X90.522 Y73.395 E15.7963 F3600
+G1 X90.637 Y73.112 E15.8063 F3600
+G1 X90.756 Y72.821 E15.8167 F3600
+G1 X90.879 Y72.523 E15.8274 F3600
+G1 X91.007 Y72.220 E15.8382 F3600
+G1 X91.138 Y71.914 E15.8492 F3600
+G1 X91.273 Y71.605 E15.8603 F3600
+G1 X91.413 Y71.297 E15.8715 F3600
+G1 X91.556 Y70.991 E15.8826 F3600
+G1 X91.703 Y70.688 E15.8938 F3600
+G1 X91.854 Y70.389 E15.9048 F3600
+G1 X92.008 Y70.097 E15.9157 F3600
+G1 X92.165 Y69.813 E15.9264 F3600
+G1 X92.324 Y69.537 E15.9369 F3600
+G1 X92.486 Y69.272 E15.9472 F3600
+G1 X92.651 Y69.018 E15.9572 F3600
+G1 X92.817 Y68.776 E15.9669 F3600
+G1 X92.984 Y68.547 E15.9762 F3600
+G1 X93.153 Y68.332 E15.9852 F3600
+G1 X93.323 Y68.132 E15.9939 F3600
+G1 X93.493 Y67.947 E16.0022 F3600
+G1 X93.663 Y67.777 E16.0101 F3600
+G1 X93.833 Y67.623 E16.0177 F3600
+G1 X94.003 Y67.484 E16.0249 F3600
+G1 X94.171 Y67.361 E16.0318 F3600
+G1 X94.339 Y67.254 E16.0384 F3600
+G1 X94.505 Y67.163 E16.0446 F3600
+G1 X94.670 Y67.086 E16.0506 F3600
+G1 X94.833 Y67.024 E16.0564 F3600
+G1 X94.995 Y66.975 E16.0620 F3600
+G1 X95.154 Y66.940 E16.0674 F3600
+G1 X95.312 Y66.917 E16.0726 F3600
+G1 X95.468 Y66.906 E16.0778 F3600
+G1 X95.622 Y66.904 E16.0828 F3600
+G1 X95.773 Y66.912 E16.0879 F3600
+G1 X95.924 Y66.929 E16.0928 F3600
+G1 X96.072 Y66.952 E16.0978 F3600
+G1 X96.220 Y66.981 E16.1028 F3600
+G1 X96.366 Y67.014 E16.1077 F3600
+G1 X96.511 Y67.051 E16.1127 F3600
+G1 X96.656 Y67.089 E16.1176 F3600
+G1 X96.801 Y67.127 E16.1226 F3600
+G1 X96.947 Y67.165 E16.1275 F3600
+G1 X97.093 Y67.200 E16.1325 F3600
+G1 X97.240 Y67.233 E16.1374 F3600
+G1 X97.389 Y67.260 E16.1424 F3600
+G1 X97.540 Y67.281 E16.1475 F3600
+G1 X97.694 Y67.296 E16.1526 F3600
+G1 X97.851 Y67.302 E16.1578 F3600
+G1 X98.012 Y67.299 E16.1631 F3600
+G1 X98.178 Y67.286 E16.1686 F3600
+G1 X98.348 Y67.262 E16.1742 F3600
+G1 X98.524 Y67.226 E16.1802 F3600
+G1 X98.705 Y67.179 E16.1864 F3600
+G1 X98.894 Y67.118 E16.1929 F3600
+G1 X99.089 Y67.045 E16.1998 F3600
+G1 X99.291 Y66.958 E16.2070 F3600
+G1 X99.501 Y66.858 E16.2147 F3600
+G1 X99.719 Y66.744 E16.2228 F3600
+G1 X99.945 Y66.616 E16.2314 F3600
+G1 X100.180 Y66.475 E16.2404 F3600
+G1 X100.424 Y66.321 E16.2499 F3600
+G1 X100.676 Y66.155 E16.2599 F3600
+G1 X100.938 Y65.977 E16.2704 F3600
+G1 X101.209 Y65.787 E16.2813 F3600
+G1 X101.488 Y65.587 E16.2926 F3600
+G1 X101.776 Y65.377 E16.3044 F3600
+G1 X102.073 Y65.159 E16.3165 F3600
+G1 X102.378 Y64.933 E16.3291 F3600
+G1 X102.691 Y64.700 E16.3419 F3600
+G1 X103.012 Y64.463 E16.3551 F3600
+G1 X103.339 Y64.222 E16.3685 F3600
+G1 X103.674 Y63.978 E16.3822 F3600
+G1 X104.013 Y63.733 E16.3960 F3600
+G1 X104.358 Y63.489 E16.4100 F3600
+G1 X104.708 Y63.246 E16.4240 F3600
+G1 X105.061 Y63.007 E16.4381 F3600
+G1 X105.417 Y62.774 E16.4521 F3600
+G1 X105.774 Y62.546 E16.4661 F3600
+G1 X106.132 Y62.327 E16.4799 F3600
+G1 X106.490 Y62.117 E16.4936 F3600
+G1 X106.847 Y61.918 E16.5071 F3600
+G1 X107.201 Y61.731 E16.5203 F3600
+G1 X107.552 Y61.558 E16.5332 F3600
+G1 X107.899 Y61.401 E16.5458 F3600
+G1 X108.239 Y61.259 E16.5580 F3600
+G1 X108.573 Y61.135 E16.5697 F3600
+G1 X108.900 Y61.030 E16.5810 F3600
+G1 X109.217 Y60.944 E16.5919 F3600
+G1 X109.524 Y60.879 E16.6023 F3600
+G1 X109.820 Y60.835 E16.6121 F3600
+G1 X110.104 Y60.813 E16.6215 F3600
+G1 X110.376 Y60.814 E16.6305 F3600
+G1 X110.633 Y60.838 E16.6390 F3600
+G1 X110.875 Y60.884 E16.6472 F3600
+G1 X111.103 Y60.955 E16.6550 F3600
+G1 X111.313 Y61.049 E16.6626 F3600
+G1 X111.507 Y61.167 E16.6701 F3600
+G1 X111.684 Y61.308 E16.6776 F3600
+G1 X111.843 Y61.472 E16.6851 F3600
+G1 X111.983 Y61.659 E16.6929 F3600
+G1 X112.105 Y61.869 E16.7009 F3600
+G1 X112.208 Y62.100 E16.7092 F3600
+G1 X112.293 Y62.352 E16.7180 F3600
+G1 X112.358 Y62.625 E16.7272 F3600
+G1 X112.405 Y62.917 E16.7370 F3600
+G1 X112.434 Y63.226 E16.7472 F3600
+G1 X112.444 Y63.553 E16.7580 F3600
+G1 X112.437 Y63.897 E16.7694 F3600
+G1 X112.412 Y64.254 E16.7812 F3600
+G1 X112.370 Y64.626 E16.7935 F3600
+G1 X112.313 Y65.009 E16.8063 F3600
+G1 X112.240 Y65.403 E16.8196 F3600
+G1 X112.153 Y65.807 E16.8332 F3600
+G1 X112.053 Y66.219 E16.8472 F3600
+G1 X111.940 Y66.637 E16.8615 F3600
+G1 X111.815 Y67.060 E16.8760 F3600
+G1 X111.680 Y67.486 E16.8908 F3600
+G1 X111.536 Y67.915 E16.9057 F3600
+G1 X111.385 Y68.345 E16.9208 F3600
+G1 X111.226 Y68.774 E16.9358 F3600
+G1 X111.062 Y69.201 E16.9509 F3600
+G1 X110.893 Y69.625 E16.9660 F3600
+G1 X110.722 Y70.045 E16.9810 F3600
+G1 X110.549 Y70.459 E16.9958 F3600
+G1 X110.376 Y70.866 E17.0104 F3600
+G1 X110.204 Y71.265 E17.0247 F3600
+G1 X110.033 Y71.656 E17.0388 F3600
+G1 X109.866 Y72.037 E17.0525 F3600
+G1 X109.703 Y72.408 E17.0659 F3600
+G1 X109.546 Y72.768 E17.0788 F3600
+G1 X109.396 Y73.116 E17.0914 F3600
+G1 X109.252 Y73.452 E17.1034 F3600
+G1 X109.117 Y73.776 E17.1150 F3600
+G1 X108.992 Y74.087 E17.1261 F3600
+G1 X108.876 Y74.384 E17.1366 F3600
+G1 X108.771 Y74.669 E17.1466 F3600
+G1 X108.676 Y74.941 E17.1561 F3600
+G1 X108.593 Y75.200 E17.1651 F3600
+G1 X108.522 Y75.445 E17.1735 F3600
+G1 X108.463 Y75.679 E17.1815 F3600
+G1 X108.416 Y75.900 E17.1889 F3600
+G1 X108.381 Y76.109 E17.1959 F3600
+G1 X108.358 Y76.306 E17.2025 F3600
+G1 X108.347 Y76.493 E17.2087 F3600
+G1 X108.347 Y76.670 E17.2145 F3600
+G1 X108.359 Y76.837 E17.2200 F3600
+G1 X108.381 Y76.995 E17.2253 F3600
+G1 X108.413 Y77.146 E17.2304 F3600
+G1 X108.454 Y77.288 E17.2353 F3600
+G1 X108.504 Y77.425 E17.2401 F3600
+G1 X108.561 Y77.556 E17.2448 F3600
+G1 X108.625 Y77.681 E17.2494 F3600
+G1 X108.695 Y77.803 E17.2541 F3600
+G1 X108.770 Y77.922 E17.2587 F3600
+G1 X108.848 Y78.038 E17.2633 F3600
+G1 X108.929 Y78.153 E17.2680 F3600
+G1 X109.011 Y78.267 E17.2726 F3600
+G1 X109.094 Y78.382 E17.2773 F3600
+G1 X109.175 Y78.497 E17.2819 F3600
+G1 X109.254 Y78.613 E17.2865 F3600
+G1 X109.330 Y78.732 E17.2912 F3600
+G1 X109.401 Y78.853 E17.2958 F3600
+G1 X109.467 Y78.977 E17.3005 F3600
+G1 X109.525 Y79.105 E17.3051 F3600
+G1 X109.576 Y79.238 E17.3098 F3600
+G1 X109.619 Y79.375 E17.3145 F3600
+G1 X109.651 Y79.516 E17.3193 F3600
+G1 X109.673 Y79.663 E17.3242 F3600
+G1 X109.684 Y79.814 E17.3292 F3600
+G1 X109.682 Y79.971 E17.3344 F3600
+G1 X109.668 Y80.134 E17.3398 F3600
+G1 X109.641 Y80.301 E17.3454 F3600
+G1 X109.601 Y80.474 E17.3512 F3600
+G1 X109.547 Y80.651 E17.3574 F3600
+G1 X109.479 Y80.834 E17.3638 F3600
+G1 X109.397 Y81.021 E17.3705 F3600
+G1 X109.302 Y81.212 E17.3776 F3600
+G1 X109.192 Y81.407 E17.3849 F3600
+G1 X109.070 Y81.605 E17.3926 F3600
+G1 X108.935 Y81.806 E17.4006 F3600
+G1 X108.787 Y82.010 E17.4089 F3600
+G1 X108.628 Y82.215 E17.4175 F3600
+G1 X108.458 Y82.422 E17.4263 F3600
+G1 X108.279 Y82.630 E17.4354 F3600
+G1 X108.090 Y82.837 E17.4446 F3600
+G1 X107.894 Y83.045 E17.4541 F3600
+G1 X107.692 Y83.251 E17.4636 F3600
+G1 X107.484 Y83.456 E17.4732 F3600
+G1 X107.272 Y83.659 E17.4829 F3600
+G1 X107.058 Y83.859 E17.4926 F3600
+G1 X106.843 Y84.056 E17.5022 F3600
+G1 X106.628 Y84.248 E17.5117 F3600
+G1 X106.416 Y84.437 E17.5211 F3600
+G1 X106.207 Y84.621 E17.5303 F3600
+G1 X106.004 Y84.800 E17.5392 F3600
+G1 X105.808 Y84.973 E17.5479 F3600
+G1 X105.620 Y85.141 E17.5562 F3600
+G1 X105.443 Y85.302 E17.5641 F3600
+G1 X105.277 Y85.457 E17.5715 F3600
+G1 X105.125 Y85.606 E17.5786 F3600
+G1 X104.988 Y85.747 E17.5851 F3600
+G1 X104.867 Y85.883 E17.5910 F3600
+G1 X104.764 Y86.011 E17.5965 F3600
+G1 X104.680 Y86.132 E17.6014 F3600
+G1 X104.616 Y86.247 E17.6057 F3600
+G1 X104.573 Y86.356 E17.6095 F3600
+G1 X104.553 Y86.458 E17.6130 F3600
+G1 X104.556 Y86.554 E17.6161 F3600
+G1 X104.583 Y86.644 E17.6193 F3600
+G1 X104.634 Y86.729 E17.6225 F3600
+G1 X104.711 Y86.809 E17.6262 F3600
+G1 X104.813 Y86.884 E17.6304 F3600
+G1 X104.941 Y86.955 E17.6352 F3600
+G1 X105.095 Y87.022 E17.6407 F3600
+G1 X105.274 Y87.086 E17.6470 F3600
+G1 X105.479 Y87.148 E17.6541 F3600
+G1 X105.710 Y87.207 E17.6619 F3600
+G1 X105.965 Y87.265 E17.6706 F3600
+G1 X106.244 Y87.322 E17.6800 F3600
+G1 X106.547 Y87.379 E17.6901 F3600
+G1 X106.872 Y87.436 E17.7010 F3600
+G1 X107.218 Y87.494 E17.7126 F3600
+G1 X107.585 Y87.554 E17.7249 F3600
+G1 X107.972 Y87.615 E17.7378 F3600
+G1 X108.375 Y87.679 E17.7513 F3600
+G1 X108.796 Y87.745 E17.7653 F3600
+G1 X109.230 Y87.816 E17.7799 F3600
+G1 X109.678 Y87.890 E17.7948 F3600
+G1 X110.137 Y87.969 E17.8102 F3600
+G1 X110.606 Y88.052 E17.8259 F3600
+G1 X111.083 Y88.141 E17.8419 F3600
+G1 X111.565 Y88.235 E17.8581 F3600
+G1 X112.052 Y88.334 E17.8745 F3600
+G1 X112.540 Y88.440 E17.8910 F3600
+G1 X113.029 Y88.551 E17.9076 F3600
+G1 X113.516 Y88.669 E17.9241 F3600
+G1 X113.999 Y88.793 E17.9406 F3600
+G1 X114.477 Y88.923 E17.9569 F3600
+G1 X114.948 Y89.059 E17.9731 F3600
+G1 X115.409 Y89.201 E17.9890 F3600
+G1 X115.860 Y89.350 E18.0047 F3600
+G1 X116.298 Y89.504 E18.0200 F3600
+G1 X116.723 Y89.664 E18.0350 F3600
+G1 X117.132 Y89.830 E18.0495 F3600
+G1 X117.524 Y90.000 E18.0637 F3600
+G1 X117.899 Y90.175 E18.0773 F3600
+G1 X118.255 Y90.355 E18.0905 F3600
+G1 X118.590 Y90.539 E18.1031 F3600
+G1 X118.905 Y90.727 E18.1152 F3600
+G1 X119.198 Y90.918 E18.1267 F3600
+G1 X119.468 Y91.111 E18.1377 F3600
+G1 X119.716 Y91.308 E18.1481 F3600
+G1 X119.941 Y91.506 E18.1580 F3600
+G1 X120.143 Y91.706 E18.1674 F3600
+G1 X120.322 Y91.908 E18.1763 F3600
+G1 X120.477 Y92.110 E18.1847 F3600
+G1 X120.610 Y92.312 E18.1927 F3600
+G1 X120.720 Y92.515 E18.2003 F3600
+G1 X120.808 Y92.717 E18.2076 F3600
+G1 X120.874 Y92.918 E18.2146 F3600
+G1 X120.920 Y93.119 E18.2214 F3600
+G1 X120.946 Y93.318 E18.2280 F3600
+G1 X120.954 Y93.516 E18.2345 F3600
+G1 X120.943 Y93.712 E18.2410 F3600
+G1 X120.916 Y93.906 E18.2475 F3600
+G1 X120.873 Y94.097 E18.2540 F3600
+G1 X120.816 Y94.287 E18.2605 F3600
+G1 X120.746 Y94.474 E18.2671 F3600
+G1 X120.665 Y94.660 E18.2738 F3600
+G1 X120.574 Y94.842 E18.2805 F3600
+G1 X120.474 Y95.023 E18.2873 F3600
+G1 X120.367 Y95.202 E18.2942 F3600
+G1 X120.255 Y95.378 E18.3011 F3600
+G1 X120.138 Y95.553 E18.3080 F3600
+G1 X120.019 Y95.726 E18.3150 F3600
+G1 X119.898 Y95.898 E18.3219 F3600
+G1 X119.778 Y96.069 E18.3288 F3600
+G1 X119.659 Y96.239 E18.3356 F3600
+G1 X119.542 Y96.409 E18.3424 F3600
+G1 X119.430 Y96.578 E18.3492 F3600
+G1 X119.322 Y96.748 E18.3558 F3600
+G1 X119.221 Y96.918 E18.3623 F3600
+G1 X119.126 Y97.089 E18.3688 F3600
+G1 X119.040 Y97.262 E18.3751 F3600
+G1 X118.961 Y97.436 E18.3814 F3600
+G1 X118.892 Y97.612 E18.3877 F3600
+G1 X118.833 Y97.791 E18.3939 F3600
+G1 X118.784 Y97.972 E18.4001 F3600
+G1 X118.745 Y98.156 E18.4063 F3600
+G1 X118.716 Y98.343 E18.4125 F3600
+G1 X118.698 Y98.533 E18.4189 F3600
+G1 X118.690 Y98.728 E18.4253 F3600
+G1 X118.693 Y98.926 E18.4318 F3600
+G1 X118.705 Y99.128 E18.4385 F3600
+G1 X118.727 Y99.334 E18.4453 F3600
+G1 X118.757 Y99.544 E18.4523 F3600
+G1 X118.795 Y99.758 E18.4595 F3600
+G1 X118.841 Y99.976 E18.4668 F3600
+G1 X118.893 Y100.197 E18.4744 F3600
+G1 X118.950 Y100.423 E18.4820 F3600
+G1 X119.012 Y100.651 E18.4898 F3600
+G1 X119.076 Y100.883 E18.4978 F3600
+G1 X119.143 Y101.117 E18.5058 F3600
+G1 X119.211 Y101.354 E18.5139 F3600
+G1 X119.278 Y101.592 E18.5221 F3600
+G1 X119.343 Y101.832 E18.5303 F3600
+G1 X119.405 Y102.072 E18.5385 F3600
+G1 X119.462 Y102.312 E18.5466 F3600
+G1 X119.514 Y102.552 E18.5547 F3600
+G1 X119.558 Y102.791 E18.5627 F3600
+G1 X119.593 Y103.027 E18.5706 F3600
+G1 X119.618 Y103.261 E18.5784 F3600
+G1 X119.631 Y103.491 E18.5860 F3600
+G1 X119.632 Y103.717 E18.5935 F3600
+G1 X119.620 Y103.938 E18.6008 F3600
+G1 X119.592 Y104.153 E18.6079 F3600
+G1 X119.548 Y104.360 E18.6149 F3600
+G1 X119.487 Y104.561 E18.6218 F3600
+G1 X119.408 Y104.752 E18.6287 F3600
+G1 X119.311 Y104.935 E18.6355 F3600
+G1 X119.194 Y105.107 E18.6423 F3600
+G1 X119.058 Y105.269 E18.6493 F3600
+G1 X118.901 Y105.419 E18.6565 F3600
+G1 X118.723 Y105.556 E18.6639 F3600
+G1 X118.524 Y105.681 E18.6717 F3600
+G1 X118.304 Y105.793 E18.6798 F3600
+G1 X118.064 Y105.891 E18.6884 F3600
+G1 X117.802 Y105.974 E18.6974 F3600
+G1 X117.519 Y106.042 E18.7070 F3600
+G1 X117.217 Y106.096 E18.7172 F3600
+G1 X116.894 Y106.134 E18.7279 F3600
+G1 X116.553 Y106.157 E18.7392 F3600
+G1 X116.193 Y106.164 E18.7511 F3600
+G1 X115.816 Y106.156 E18.7635 F3600
+G1 X115.422 Y106.133 E18.7765 F3600
+G1 X115.012 Y106.095 E18.7901 F3600
+G1 X114.588 Y106.041 E18.8042 F3600
+G1 X114.151 Y105.973 E18.8188 F3600
+G1 X113.703 Y105.891 E18.8339 F3600
+G1 X113.243 Y105.796 E18.8493 F3600
+G1 X112.775 Y105.688 E18.8652 F3600
+G1 X112.299 Y105.568 E18.8814 F3600
+G1 X111.817 Y105.436 E18.8979 F3600
+G1 X111.331 Y105.294 E18.9146 F3600
+G1 X110.841 Y105.142 E18.9315 F3600
+G1 X110.351 Y104.982 E18.9485 F3600
+G1 X109.860 Y104.814 E18.9656 F3600
+G1 X109.372 Y104.640 E18.9828 F3600
+G1 X108.887 Y104.461 E18.9998 F3600
+G1 X108.407 Y104.278 E19.0168 F3600
+G1 X107.933 Y104.091 E19.0336 F3600
+G1 X107.467 Y103.904 E19.0502 F3600
+G1 X107.010 Y103.716 E19.0665 F3600
+G1 X106.564 Y103.529 E19.0824 F3600
+G1 X106.130 Y103.344 E19.0980 F3600
+G1 X105.709 Y103.162 E19.1131 F3600
+G1 X105.301 Y102.986 E19.1278 F3600
+G1 X104.909 Y102.815 E19.1419 F3600
+G1 X104.533 Y102.651 E19.1554 F3600
+G1 X104.174 Y102.496 E19.1683 F3600
+G1 X103.832 Y102.350 E19.1806 F3600
+G1 X103.509 Y102.214 E19.1922 F3600
+G1 X103.203 Y102.090 E19.2031 F3600
+G1 X102.917 Y101.978 E19.2132 F3600
+G1 X102.650 Y101.880 E19.2226 F3600
+G1 X102.403 Y101.795 E19.2312 F3600
+G1 X102.175 Y101.724 E19.2391 F3600
+G1 X101.966 Y101.669 E19.2462 F3600
+G1 X101.776 Y101.629 E19.2526 F3600
+G1 X101.605 Y101.605 E19.2583 F3600
+G1 X101.452 Y101.597 E19.2634 F3600
+G1 X101.318 Y101.606 E19.2678 F3600
+G1 X101.201 Y101.631 E19.2718 F3600
+G1 X101.100 Y101.672 E19.2754 F3600
+G1 X101.015 Y101.730 E19.2788 F3600
+G1 X100.946 Y101.804 E19.2821 F3600
+G1 X100.890 Y101.893 E19.2856 F3600
+G1 X100.848 Y101.998 E19.2893 F3600
+G1 X100.819 Y102.117 E19.2933 F3600
+G1 X100.800 Y102.250 E19.2978 F3600
+G1 X100.791 Y102.397 E19.3026 F3600
+G1 X100.792 Y102.556 E19.3079 F3600
+G1 X100.800 Y102.726 E19.3135 F3600
+G1 X100.815 Y102.908 E19.3195 F3600
+G1 X100.836 Y103.099 E19.3258 F3600
+G1 X100.861 Y103.298 E19.3325 F3600
+G1 X100.889 Y103.505 E19.3394 F3600
+G1 X100.920 Y103.719 E19.3465 F3600
+G1 X100.952 Y103.937 E19.3538 F3600
+G1 X100.983 Y104.160 E19.3612 F3600
+G1 X101.014 Y104.385 E19.3687 F3600
+G1 X101.043 Y104.612 E19.3763 F3600
+G1 X101.069 Y104.839 E19.3838 F3600
+G1 X101.091 Y105.066 E19.3913 F3600
+G1 X101.109 Y105.290 E19.3988 F3600
+G1 X101.122 Y105.512 E19.4061 F3600
+G1 X101.129 Y105.729 E19.4132 F3600
+G1 X101.129 Y105.941 E19.4203 F3600
+G1 X101.123 Y106.148 E19.4271 F3600
+G1 X101.109 Y106.347 E19.4336 F3600
+G1 X101.088 Y106.538 E19.4400 F3600
+G1 X101.059 Y106.721 E19.4461 F3600
+G1 X101.021 Y106.894 E19.4520 F3600
+G1 X100.976 Y107.058 E19.4576 F3600
+G1 X100.923 Y107.211 E19.4629 F3600
+G1 X100.861 Y107.354 E19.4681 F3600
+G1 X100.791 Y107.486 E19.4730 F3600
+G1 X100.714 Y107.608 E19.4777 F3600
+G1 X100.629 Y107.718 E19.4823 F3600
+G1 X100.537 Y107.817 E19.4868 F3600
+G1 X100.438 Y107.906 E19.4912 F3600
+G1 X100.333 Y107.984 E19.4955 F3600
+G1 X100.222 Y108.053 E19.4998 F3600
+G1 X100.106 Y108.112 E19.5041 F3600
+G1 X99.985 Y108.162 E19.5084 F3600
+G1 X99.859 Y108.204 E19.5128 F3600
+G1 X99.731 Y108.239 E19.5172 F3600
+G1 X99.599 Y108.267 E19.5217 F3600
+G1 X99.465 Y108.291 E19.5261 F3600
+G1 X99.329 Y108.309 E19.5307 F3600
+G1 X99.193 Y108.325 E19.5352 F3600
+G1 X99.056 Y108.339 E19.5397 F3600
+G1 X98.919 Y108.352 E19.5443 F3600
+G1 X98.783 Y108.365 E19.5488 F3600
+G1 X98.649 Y108.380 E19.5532 F3600
+G1 X98.517 Y108.399 E19.5576 F3600
+G1 X98.387 Y108.422 E19.5620 F3600
+G1 X98.261 Y108.450 E19.5663 F3600
+G1 X98.138 Y108.486 E19.5705 F3600
+G1 X98.019 Y108.531 E19.5747 F3600
+G1 X97.904 Y108.585 E19.5789 F3600
+G1 X97.794 Y108.650 E19.5831 F3600
+G1 X97.688 Y108.727 E19.5874 F3600
+G1 X97.588 Y108.818 E19.5919 F3600
+G1 X97.492 Y108.923 E19.5966 F3600
+G1 X97.402 Y109.043 E19.6015 F3600
+G1 X97.316 Y109.180 E19.6068 F3600
+G1 X97.236 Y109.333 E19.6126 F3600
+G1 X97.161 Y109.504 E19.6187 F3600
+G1 X97.090 Y109.694 E19.6254 F3600
+G1 X97.024 Y109.902 E19.6326 F3600
+G1 X96.963 Y110.130 E19.6404 F3600
+G1 X96.905 Y110.376 E19.6487 F3600
+G1 X96.851 Y110.642 E19.6577 F3600
+G1 X96.800 Y110.928 E19.6673 F3600
+G1 X96.752 Y111.233 E19.6775 F3600
+G1 X96.706 Y111.556 E19.6882 F3600
+G1 X96.662 Y111.898 E19.6996 F3600
+G1 X96.619 Y112.258 E19.7116 F3600
+G1 X96.576 Y112.635 E19.7241 F3600
+G1 X96.534 Y113.029 E19.7372 F3600
+G1 X96.491 Y113.438 E19.7507 F3600
+G1 X96.447 Y113.861 E19.7648 F3600
+G1 X96.401 Y114.297 E19.7792 F3600
+G1 X96.353 Y114.745 E19.7941 F3600
+G1 X96.303 Y115.203 E19.8093 F3600
+G1 X96.248 Y115.671 E19.8249 F3600
+G1 X96.190 Y116.146 E19.8407 F3600
+G1 X96.128 Y116.626 E19.8566 F3600
+G1 X96.060 Y117.111 E19.8728 F3600
+G1 X95.987 Y117.597 E19.8890 F3600
+G1 X95.908 Y118.085 E19.9053 F3600
+G1 X95.823 Y118.570 E19.9216 F3600
+G1 X95.732 Y119.053 E19.9378 F3600
+G1 X95.633 Y119.530 E19.9539 F3600
+G1 X95.528 Y120.000 E19.9698 F3600
+G1 X95.415 Y120.462 E19.9855 F3600
+G1 X95.295 Y120.912 E20.0008 F3600
+G1 X95.168 Y121.350 E20.0159 F3600
+G1 X95.033 Y121.774 E20.0306 F3600
+G1 X94.890 Y122.182 E20.0448 F3600
+G1 X94.740 Y122.572 E20.0586 F3600
+G1 X94.583 Y122.943 E20.0719 F3600
+G1 X94.419 Y123.294 E20.0847 F3600
+G1 X94.248 Y123.623 E20.0969 F3600
+G1 X94.070 Y123.928 E20.1086 F3600
+G1 X93.886 Y124.209 E20.1197 F3600
+G1 X93.695 Y124.465 E20.1302 F3600
+G1 X93.500 Y124.694 E20.1402 F3600
+G1 X93.299 Y124.897 E20.1496 F3600
+G1 X93.093 Y125.072 E20.1585 F3600
+G1 X92.883 Y125.218 E20.1669 F3600
+G1 X92.669 Y125.337 E20.1750 F3600
+G1 X92.452 Y125.427 E20.1827 F3600
+G1 X92.233 Y125.488 E20.1903 F3600
+G1 X92.011 Y125.521 E20.1977 F3600
+G1 X91.787 Y125.525 E20.2051 F3600
+G1 X91.562 Y125.502 E20.2125 F3600
+G1 X91.337 Y125.451 E20.2201 F3600
+G1 X91.112 Y125.374 E20.2280 F3600
+G1 X90.887 Y125.271 E20.2362 F3600
+G1 X90.663 Y125.143 E20.2447 F3600
+G1 X90.440 Y124.991 E20.2536 F3600
+G1 X90.219 Y124.817 E20.2629 F3600
+G1 X90.000 Y124.621 E20.2726 F3600
+G1 X89.784 Y124.405 E20.2826 F3600
+G1 X89.571 Y124.170 E20.2931 F3600
+G1 X89.361 Y123.919 E20.3039 F3600
+G1 X89.154 Y123.651 E20.3151 F3600
+G1 X88.951 Y123.370 E20.3265 F3600
+G1 X88.752 Y123.077 E20.3382 F3600
+G1 X88.558 Y122.773 E20.3501 F3600
+G1 X88.367 Y122.460 E20.3622 F3600
+G1 X88.181 Y122.140 E20.3744 F3600
+G1 X87.998 Y121.815 E20.3867 F3600
+G1 X87.820 Y121.486 E20.3991 F3600
+G1 X87.646 Y121.155 E20.4114 F3600
+G1 X87.477 Y120.824 E20.4237 F3600
+G1 X87.311 Y120.494 E20.4359 F3600
+G1 X87.148 Y120.167 E20.4479 F3600
+G1 X86.990 Y119.845 E20.4598 F3600
+G1 X86.834 Y119.528 E20.4714 F3600
+G1 X86.681 Y119.218 E20.4828 F3600
+G1 X86.532 Y118.916 E20.4940 F3600
+G1 X86.384 Y118.623 E20.5048 F3600
+G1 X86.239 Y118.341 E20.5152 F3600
+G1 X86.095 Y118.070 E20.5254 F3600
+G1 X85.953 Y117.811 E20.5351 F3600
+G1 X85.812 Y117.564 E20.5445 F3600
+G1 X85.671 Y117.331 E20.5535 F3600
+G1 X85.531 Y117.111 E20.5621 F3600
+G1 X85.391 Y116.905 E20.5703 F3600
+G1 X85.251 Y116.712 E20.5782 F3600
+G1 X85.111 Y116.534 E20.5857 F3600
+G1 X84.970 Y116.369 E20.5928 F3600
+G1 X84.828 Y116.217 E20.5997 F3600
+G1 X84.685 Y116.079 E20.6063 F3600
+G1 X84.540 Y115.953 E20.6126 F3600
+G1 X84.395 Y115.839 E20.6187 F3600
+G1 X84.247 Y115.736 E20.6246 F3600
+G1 X84.099 Y115.644 E20.6304 F3600
+G1 X83.948 Y115.561 E20.6361 F3600
+G1 X83.797 Y115.486 E20.6416 F3600
+G1 X83.644 Y115.419 E20.6471 F3600
+G1 X83.489 Y115.358 E20.6526 F3600
+G1 X83.334 Y115.302 E20.6581 F3600
+G1 X83.178 Y115.250 E20.6635 F3600
+G1 X83.021 Y115.200 E20.6689 F3600
+G1 X82.864 Y115.152 E20.6744 F3600
+G1 X82.707 Y115.103 E20.6798 F3600
+G1 X82.550 Y115.053 E20.6852 F3600
+G1 X82.395 Y115.001 E20.6906 F3600
+G1 X82.240 Y114.944 E20.6960 F3600
+G1 X82.088 Y114.881 E20.7015 F3600
+G1 X81.938 Y114.813 E20.7069 F3600
+G1 X81.791 Y114.736 E20.7124 F3600
+G1 X81.647 Y114.650 E20.7179 F3600
+G1 X81.507 Y114.555 E20.7235 F3600
+G1 X81.371 Y114.448 E20.7292 F3600
+G1 X81.241 Y114.330 E20.7350 F3600
+G1 X81.116 Y114.199 E20.7410 F3600
+G1 X80.997 Y114.054 E20.7472 F3600
+G1 X80.885 Y113.895 E20.7536 F3600
+G1 X80.780 Y113.722 E20.7603 F3600
+G1 X80.682 Y113.534 E20.7673 F3600
+G1 X80.593 Y113.330 E20.7746 F3600
+G1 X80.512 Y113.112 E20.7823 F3600
+G1 X80.440 Y112.877 E20.7904 F3600
+G1 X80.376 Y112.628 E20.7989 F3600
+G1 X80.323 Y112.363 E20.8078 F3600
+G1 X80.278 Y112.083 E20.8172 F3600
+G1 X80.244 Y111.790 E20.8269 F3600
+G1 X80.219 Y111.482 E20.8371 F3600
+G1 X80.204 Y111.161 E20.8477 F3600
+G1 X80.199 Y110.828 E20.8587 F3600
+G1 X80.203 Y110.484 E20.8701 F3600
+G1 X80.217 Y110.129 E20.8818 F3600
+G1 X80.240 Y109.765 E20.8938 F3600
+G1 X80.272 Y109.392 E20.9061 F3600
+G1 X80.312 Y109.013 E20.9187 F3600
+G1 X80.360 Y108.628 E20.9315 F3600
+G1 X80.416 Y108.239 E20.9445 F3600
+G1 X80.478 Y107.848 E20.9576 F3600
+G1 X80.547 Y107.455 E20.9708 F3600
+G1 X80.620 Y107.062 E20.9839 F3600
+G1 X80.698 Y106.671 E20.9971 F3600
+G1 X80.780 Y106.283 E21.0102 F3600
+G1 X80.865 Y105.900 E21.0231 F3600
+G1 X80.951 Y105.523 E21.0359 F3600
+G1 X81.038 Y105.154 E21.0484 F3600
+G1 X81.125 Y104.794 E21.0606 F3600
+G1 X81.210 Y104.445 E21.0725 F3600
+G1 X81.293 Y104.108 E21.0839 F3600
+G1 X81.373 Y103.785 E21.0949 F3600
+G1 X81.448 Y103.476 E21.1054 F3600
+G1 X81.517 Y103.183 E21.1153 F3600
+G1 X81.580 Y102.907 E21.1247 F3600
+G1 X81.635 Y102.648 E21.1334 F3600
+G1 X81.680 Y102.409 E21.1414 F3600
+G1 X81.716 Y102.189 E21.1488 F3600
+G1 X81.741 Y101.990 E21.1554 F3600
+G1 X81.754 Y101.812 E21.1613 F3600
+G1 X81.754 Y101.654 E21.1665 F3600
+G1 X81.741 Y101.519 E21.1710 F3600
+G1 X81.713 Y101.406 E21.1748 F3600
+G1 X81.671 Y101.314 E21.1782 F3600
+G1 X81.612 Y101.245 E21.1812 F3600
+G1 X81.537 Y101.198 E21.1841 F3600
+G1 X81.446 Y101.172 E21.1872 F3600
+G1 X81.338 Y101.167 E21.1908 F3600
+G1 X81.212 Y101.183 E21.1950 F3600
+G1 X81.069 Y101.220 E21.1998 F3600
+G1 X80.908 Y101.276 E21.2055 F3600
+G1 X80.730 Y101.350 E21.2118 F3600
+G1 X80.534 Y101.442 E21.2190 F3600
+G1 X80.321 Y101.551 E21.2269 F3600
+G1 X80.091 Y101.676 E21.2355 F3600
+G1 X79.845 Y101.815 E21.2448 F3600
+G1 X79.583 Y101.967 E21.2548 F3600
+G1 X79.305 Y102.131 E21.2655 F3600
+G1 X79.012 Y102.306 E21.2767 F3600
+G1 X78.706 Y102.490 E21.2885 F3600
+G1 X78.387 Y102.683 E21.3008 F3600
+G1 X78.055 Y102.881 E21.3136 F3600
+G1 X77.712 Y103.085 E21.3268 F3600
+G1 X77.360 Y103.292 E21.3403 F3600
+G1 X76.998 Y103.502 E21.3541 F3600
+G1 X76.628 Y103.712 E21.3681 F3600
+G1 X76.252 Y103.922 E21.3823 F3600
+G1 X75.871 Y104.129 E21.3966 F3600
+G1 X75.485 Y104.334 E21.4110 F3600
+G1 X75.097 Y104.533 E21.4254 F3600
+G1 X74.707 Y104.727 E21.4398 F3600
+G1 X74.317 Y104.914 E21.4541 F3600
+G1 X73.928 Y105.093 E21.4682 F3600
+G1 X73.541 Y105.263 E21.4821 F3600
+G1 X73.158 Y105.422 E21.4958 F3600
+G1 X72.779 Y105.571 E21.5093 F3600
+G1 X72.406 Y105.708 E21.5224 F3600
+G1 X72.041 Y105.833 E21.5351 F3600
+G1 X71.683 Y105.945 E21.5475 F3600
+G1 X71.334 Y106.044 E21.5595 F3600
+G1 X70.995 Y106.129 E21.5710 F3600
+G1 X70.667 Y106.199 E21.5821 F3600
+G1 X70.350 Y106.256 E21.5927 F3600
+G1 X70.045 Y106.298 E21.6028 F3600
+G1 X69.753 Y106.326 E21.6125 F3600
+G1 X69.474 Y106.339 E21.6218 F3600
+G1 X69.208 Y106.338 E21.6305 F3600
+G1 X68.955 Y106.324 E21.6389 F3600
+G1 X68.716 Y106.296 E21.6468 F3600
+G1 X68.491 Y106.255 E21.6544 F3600
+G1 X68.280 Y106.202 E21.6616 F3600
+G1 X68.081 Y106.136 E21.6685 F3600
+G1 X67.896 Y106.059 E21.6751 F3600
+G1 X67.724 Y105.972 E21.6815 F3600
+G1 X67.564 Y105.874 E21.6877 F3600
+G1 X67.415 Y105.767 E21.6937 F3600
+G1 X67.277 Y105.652 E21.6996 F3600
+G1 X67.150 Y105.529 E21.7055 F3600
+G1 X67.031 Y105.399 E21.7113 F3600
+G1 X66.922 Y105.264 E21.7170 F3600
+G1 X66.819 Y105.123 E21.7228 F3600
+G1 X66.723 Y104.978 E21.7285 F3600
+G1 X66.632 Y104.830 E21.7342 F3600
+G1 X66.545 Y104.679 E21.7400 F3600
+G1 X66.462 Y104.526 E21.7457 F3600
+G1 X66.380 Y104.373 E21.7515 F3600
+G1 X66.299 Y104.219 E21.7572 F3600
+G1 X66.217 Y104.065 E21.7630 F3600
+G1 X66.134 Y103.913 E21.7687 F3600
+G1 X66.048 Y103.762 E21.7744 F3600
+G1 X65.957 Y103.614 E21.7801 F3600
+G1 X65.862 Y103.468 E21.7859 F3600
+G1 X65.761 Y103.325 E21.7917 F3600
+G1 X65.653 Y103.186 E21.7975 F3600
+G1 X65.537 Y103.051 E21.8034 F3600
+G1 X65.412 Y102.920 E21.8093 F3600
+G1 X65.277 Y102.793 E21.8154 F3600
+G1 X65.132 Y102.671 E21.8217 F3600
+G1 X64.976 Y102.553 E21.8281 F3600
+G1 X64.809 Y102.439 E21.8348 F3600
+G1 X64.631 Y102.330 E21.8417 F3600
+G1 X64.440 Y102.224 E21.8489 F3600
+G1 X64.238 Y102.123 E21.8564 F3600
+G1 X64.023 Y102.025 E21.8642 F3600
+G1 X63.796 Y101.931 E21.8723 F3600
+G1 X63.558 Y101.839 E21.8807 F3600
+G1 X63.308 Y101.750 E21.8895 F3600
+G1 X63.047 Y101.664 E21.8985 F3600
+G1 X62.776 Y101.579 E21.9079 F3600
+G1 X62.495 Y101.494 E21.9176 F3600
+G1 X62.205 Y101.411 E21.9275 F3600
+G1 X61.907 Y101.328 E21.9378 F3600
+G1 X61.602 Y101.244 E21.9482 F3600
+G1 X61.291 Y101.159 E21.9588 F3600
+G1 X60.975 Y101.072 E21.9696 F3600
+G1 X60.656 Y100.983 E21.9806 F3600
+G1 X60.335 Y100.891 E21.9916 F3600
+G1 X60.014 Y100.796 E22.0026 F3600
+G1 X59.693 Y100.696 E22.0137 F3600
+G1 X59.375 Y100.593 E22.0248 F3600
+G1 X59.061 Y100.484 E22.0357 F3600
+G1 X58.752 Y100.370 E22.0466 F3600
+G1 X58.451 Y100.251 E22.0573 F3600
+G1 X58.159 Y100.125 E22.0678 F3600
+G1 X57.877 Y99.993 E22.0781 F3600
+G1 X57.607 Y99.854 E22.0881 F3600
+G1 X57.351 Y99.708 E22.0978 F3600
+G1 X57.111 Y99.555 E22.1072 F3600
+G1 X56.887 Y99.395 E22.1163 F3600
+G1 X56.681 Y99.228 E22.1250 F3600
+G1 X56.495 Y99.053 E22.1335 F3600
+G1 X56.330 Y98.871 E22.1416 F3600
+G1 X56.187 Y98.682 E22.1494 F3600
+G1 X56.067 Y98.486 E22.1570 F3600
+G1 X55.972 Y98.283 E22.1644 F3600
+G1 X55.901 Y98.073 E22.1717 F3600
+G1 X55.857 Y97.858 E22.1789 F3600
+G1 X55.839 Y97.636 E22.1863 F3600
+G1 X55.848 Y97.409 E22.1938 F3600
+G1 X55.884 Y97.177 E22.2015 F3600
+G1 X55.948 Y96.940 E22.2096 F3600
+G1 X56.040 Y96.700 E22.2181 F3600
+G1 X56.160 Y96.455 E22.2271 F3600
+G1 X56.307 Y96.208 E22.2366 F3600
+G1 X56.481 Y95.959 E22.2466 F3600
+G1 X56.682 Y95.707 E22.2573 F3600
+G1 X56.910 Y95.454 E22.2685 F3600
+G1 X57.162 Y95.201 E22.2803 F3600
+G1 X57.439 Y94.948 E22.2927 F3600
+G1 X57.740 Y94.695 E22.3056 F3600
+G1 X58.062 Y94.443 E22.3191 F3600
+G1 X58.406 Y94.193 E22.3332 F3600
+G1 X58.770 Y93.945 E22.3477 F3600
+G1 X59.151 Y93.700 E22.3626 F3600
+G1 X59.550 Y93.459 E22.3780 F3600
+G1 X59.963 Y93.221 E22.3938 F3600
+G1 X60.390 Y92.987 E22.4098 F3600
+G1 X60.828 Y92.758 E22.4261 F3600
+G1 X61.276 Y92.533 E22.4427 F3600
+G1 X61.732 Y92.314 E22.4594 F3600
+G1 X62.194 Y92.101 E22.4761 F3600
+G1 X62.660 Y91.893 E22.4930 F3600
+G1 X63.127 Y91.691 E22.5098 F3600
+G1 X63.596 Y91.495 E22.5266 F3600
+G1 X64.062 Y91.305 E22.5432 F3600
+G1 X64.525 Y91.121 E22.5596 F3600
+G1 X64.983 Y90.944 E22.5758 F3600
+G1 X65.434 Y90.772 E22.5917 F3600
+G1 X65.876 Y90.606 E22.6073 F3600
+G1 X66.307 Y90.447 E22.6225 F3600
+G1 X66.727 Y90.292 E22.6372 F3600
+G1 X67.133 Y90.144 E22.6515 F3600
+G1 X67.524 Y90.000 E22.6653 F3600
+G1 X67.900 Y89.861 E22.6785 F3600
+G1 X68.258 Y89.727 E22.6911 F3600
+G1 X68.599 Y89.597 E22.7032 F3600
+G1 X68.920 Y89.470 E22.7146 F3600
+G1 X69.222 Y89.347 E22.7253 F3600
+G1 X69.504 Y89.227 E22.7354 F3600
+G1 X69.765 Y89.109 E22.7449 F3600
+G1 X70.005 Y88.994 E22.7536 F3600
+G1 X70.223 Y88.880 E22.7618 F3600
+G1 X70.421 Y88.768 E22.7693 F3600
+G1 X70.597 Y88.657 E22.7761 F3600
+G1 X70.752 Y88.546 E22.7824 F3600
+G1 X70.887 Y88.435 E22.7882 F3600
+G1 X71.001 Y88.324 E22.7934 F3600
+G1 X71.096 Y88.213 E22.7983 F3600
+G1 X71.173 Y88.101 E22.8028 F3600
+G1 X71.231 Y87.988 E22.8070 F3600
+G1 X71.273 Y87.873 E22.8110 F3600
+G1 X71.299 Y87.757 E22.8149 F3600
+G1 X71.310 Y87.639 E22.8188 F3600
+G1 X71.308 Y87.519 E22.8228 F3600
+G1 X71.293 Y87.398 E22.8268 F3600
+G1 X71.268 Y87.274 E22.8310 F3600
+G1 X71.233 Y87.148 E22.8353 F3600
+G1 X71.190 Y87.021 E22.8397 F3600
+G1 X71.140 Y86.891 E22.8443 F3600
+G1 X71.085 Y86.760 E22.8490 F3600
+G1 X71.027 Y86.627 E22.8538 F3600
+G1 X70.966 Y86.493 E22.8587 F3600
+G1 X70.905 Y86.357 E22.8636 F3600
+G1 X70.844 Y86.221 E22.8685 F3600
+G1 X70.785 Y86.084 E22.8734 F3600
+G1 X70.730 Y85.946 E22.8783 F3600
+G1 X70.679 Y85.809 E22.8832 F3600
+G1 X70.634 Y85.671 E22.8879 F3600
+G1 X70.596 Y85.534 E22.8926 F3600
+G1 X70.566 Y85.399 E22.8972 F3600
+G1 X70.545 Y85.265 E22.9017 F3600
+G1 X70.533 Y85.132 E22.9061 F3600
+G1 X70.532 Y85.002 E22.9104 F3600
+G1 X70.542 Y84.874 E22.9146 F3600
+G1 X70.564 Y84.748 E22.9188 F3600
+G1 X70.598 Y84.627 E22.9230 F3600
+G1 X70.643 Y84.508 E22.9272 F3600
+G1 X70.701 Y84.393 E22.9314 F3600
+G1 X70.772 Y84.282 E22.9357 F3600
+G1 X70.855 Y84.176 E22.9402 F3600
+G1 X70.950 Y84.074 E22.9448 F3600
+G1 X71.056 Y83.976 E22.9496 F3600
+G1 X71.174 Y83.883 E22.9545 F3600
+G1 X71.302 Y83.794 E22.9597 F3600
+G1 X71.440 Y83.711 E22.9650 F3600
+G1 X71.587 Y83.631 E22.9705 F3600
+G1 X71.743 Y83.556 E22.9762 F3600
+G1 X71.906 Y83.486 E22.9821 F3600
+G1 X72.075 Y83.419 E22.9881 F3600
+G1 X72.249 Y83.356 E22.9942 F3600
+G1 X72.427 Y83.297 E23.0004 F3600
+G1 X72.607 Y83.240 E23.0066 F3600
+G1 X72.789 Y83.186 E23.0129 F3600
+G1 X72.971 Y83.134 E23.0191 F3600
+G1 X73.151 Y83.083 E23.0253 F3600
+G1 X73.329 Y83.033 E23.0314 F3600
+G1 X73.502 Y82.983 E23.0373 F3600
+G1 X73.670 Y82.933 E23.0431 F3600
+G1 X73.831 Y82.882 E23.0487 F3600
+G1 X73.983 Y82.829 E23.0540 F3600
+G1 X74.126 Y82.773 E23.0591 F3600
+G1 X74.258 Y82.713 E23.0639 F3600
+G1 X74.378 Y82.649 E23.0683 F3600
+G1 X74.485 Y82.580 E23.0725 F3600
+G1 X74.578 Y82.505 E23.0765 F3600
+G1 X74.655 Y82.423 E23.0802 F3600
+G1 X74.716 Y82.333 E23.0838 F3600
+G1 X74.761 Y82.235 E23.0873 F3600
+G1 X74.788 Y82.128 E23.0910 F3600
+G1 X74.796 Y82.011 E23.0948 F3600
+G1 X74.786 Y81.883 E23.0991 F3600
+G1 X74.757 Y81.744 E23.1038 F3600
+G1 X74.709 Y81.594 E23.1090 F3600
+G1 X74.641 Y81.430 E23.1148 F3600
+G1 X74.554 Y81.254 E23.1213 F3600
+G1 X74.448 Y81.065 E23.1285 F3600
+G1 X74.323 Y80.861 E23.1363 F3600
+G1 X74.180 Y80.644 E23.1449 F3600
+G1 X74.018 Y80.412 E23.1543 F3600
+G1 X73.839 Y80.166 E23.1643 F3600
+G1 X73.643 Y79.906 E23.1751 F3600
+G1 X73.432 Y79.631 E23.1865 F3600
+G1 X73.205 Y79.342 E23.1986 F3600
+G1 X72.965 Y79.038 E23.2114 F3600
+G1 X72.712 Y78.721 E23.2248 F3600
+G1 X72.447 Y78.391 E23.2387 F3600
+G1 X72.173 Y78.048 E23.2532 F3600
+G1 X71.889 Y77.692 E23.2683 F3600
+G1 X71.598 Y77.324 E23.2837 F3600
+G1 X71.301 Y76.946 E23.2996 F3600
+G1 X71.000 Y76.557 E23.3158 F3600
+G1 X70.696 Y76.159 E23.3324 F3600
+G1 X70.391 Y75.753 E23.3491 F3600
+G1 X70.085 Y75.339 E23.3661 F3600
+G1 X69.782 Y74.919 E23.3832 F3600
+G1 X69.482 Y74.494 E23.4004 F3600
+G1 X69.187 Y74.064 E23.4176 F3600
+G1 X68.899 Y73.632 E23.4347 F3600
+G1 X68.618 Y73.199 E23.4518 F3600
+G1 X68.347 Y72.764 E23.4686 F3600
+G1 X68.087 Y72.331 E23.4853 F3600
+G1 X67.839 Y71.900 E23.5017 F3600
+G1 X67.604 Y71.473 E23.5178 F3600
+G1 X67.384 Y71.050 E23.5336 F3600
+G1 X67.179 Y70.633 E23.5489 F3600
+G1 X66.991 Y70.223 E23.5638 F3600
+G1 X66.821 Y69.822 E23.5781 F3600
+G1 X66.668 Y69.430 E23.5920 F3600
+G1 X66.535 Y69.049 E23.6053 F3600
+G1 X66.421 Y68.680 E23.6181 F3600
+G1 X66.328 Y68.324 E23.6302 F3600
+G1 X66.255 Y67.981 E23.6418 F3600
+G1 X66.202 Y67.652 E23.6528 F3600
+G1 X66.170 Y67.339 E23.6632 F3600
+G1 X66.159 Y67.041 E23.6730 F3600
+G1 X66.169 Y66.760 E23.6823 F3600
+G1 X66.199 Y66.496 E23.6911 F3600
+G1 X66.250 Y66.250 E23.6994 F3600
+G1 X66.320 Y66.021 E23.7073 F3600
+G1 X66.410 Y65.809 E23.7149 F3600
+G1 X66.518 Y65.616 E23.7222 F3600
+G1 X66.644 Y65.440 E23.7293 F3600
+G1 X66.788 Y65.282 E23.7364 F3600
+G1 X66.948 Y65.141 E23.7434 F3600
+G1 X67.124 Y65.018 E23.7505 F3600
+G1 X67.314 Y64.911 E23.7577 F3600
+G1 X67.518 Y64.820 E23.7651 F3600
+G1 X67.734 Y64.745 E23.7726 F3600
+G1 X67.962 Y64.684 E23.7804 F3600
+G1 X68.200 Y64.638 E23.7884 F3600
+G1 X68.448 Y64.604 E23.7966 F3600
+G1 X68.703 Y64.583 E23.8051 F3600
+G1 X68.965 Y64.573 E23.8137 F3600
+G1 X69.233 Y64.573 E23.8226 F3600
+G1 X69.505 Y64.582 E23.8316 F3600
+G1 X69.781 Y64.599 E23.8407 F3600
+G1 X70.059 Y64.623 E23.8499 F3600
+G1 X70.338 Y64.652 E23.8592 F3600
+G1 X70.618 Y64.686 E23.8685 F3600
+G1 X70.896 Y64.722 E23.8777 F3600
+G1 X71.174 Y64.761 E23.8870 F3600
+G1 X71.448 Y64.800 E23.8961 F3600
+G1 X71.720 Y64.840 E23.9052 F3600
+G1 X71.987 Y64.877 E23.9141 F3600
+G1 X72.250 Y64.912 E23.9228 F3600
+G1 X72.508 Y64.944 E23.9314 F3600
+G1 X72.759 Y64.971 E23.9398 F3600
+G1 X73.005 Y64.993 E23.9479 F3600
+G1 X73.244 Y65.008 E23.9558 F3600
+G1 X73.476 Y65.017 E23.9635 F3600
+G1 X73.702 Y65.018 E23.9709 F3600
+G1 X73.920 Y65.011 E23.9781 F3600
+G1 X74.131 Y64.995 E23.9851 F3600
+G1 X74.335 Y64.970 E23.9919 F3600
+G1 X74.533 Y64.937 E23.9985 F3600
+G1 X74.723 Y64.894 E24.0049 F3600
+G1 X74.907 Y64.842 E24.0113 F3600
+G1 X75.085 Y64.780 E24.0175 F3600
+G1 X75.257 Y64.710 E24.0236 F3600
+G1 X75.424 Y64.631 E24.0297 F3600
+G1 X75.586 Y64.544 E24.0358 F3600
+G1 X75.743 Y64.449 E24.0418 F3600
+G1 X75.897 Y64.347 E24.0479 F3600
+G1 X76.047 Y64.238 E24.0540 F3600
+G1 X76.195 Y64.124 E24.0602 F3600
+G1 X76.341 Y64.006 E24.0664 F3600
+G1 X76.486 Y63.884 E24.0726 F3600
+G1 X76.630 Y63.759 E24.0789 F3600
+G1 X76.773 Y63.633 E24.0852 F3600
+G1 X76.918 Y63.507 E24.0916 F3600
+G1 X77.063 Y63.381 E24.0979 F3600
+G1 X77.211 Y63.258 E24.1042 F3600
+G1 X77.360 Y63.139 E24.1106 F3600
+G1 X77.513 Y63.025 E24.1168 F3600
+G1 X77.669 Y62.916 E24.1231 F3600
+G1 X77.829 Y62.816 E24.1293 F3600
+G1 X77.993 Y62.724 E24.1355 F3600
+G1 X78.162 Y62.643 E24.1417 F3600
+G1 X78.335 Y62.573 E24.1479 F3600
+G1 X78.515 Y62.516 E24.1541 F3600
+G1 X78.699 Y62.473 E24.1604 F3600
+G1 X78.890 Y62.445 E24.1667 F3600
+G1 X79.086 Y62.434 E24.1732 F3600
+G1 X79.288 Y62.439 E24.1799 F3600
+G1 X79.496 Y62.463 E24.1868 F3600
+G1 X79.709 Y62.506 E24.1940 F3600
+G1 X79.929 Y62.568 E24.2015 F3600
+G1 X80.153 Y62.650 E24.2094 F3600
+G1 X80.383 Y62.753 E24.2177 F3600
+G1 X80.618 Y62.876 E24.2265 F3600
+G1 X80.858 Y63.021 E24.2357 F3600
+G1 X81.102 Y63.188 E24.2454 F3600
+G1 X81.349 Y63.375 E24.2557 F3600
+G1 X81.600 Y63.584 E24.2665 F3600
+G1 X81.854 Y63.813 E24.2777 F3600
+G1 X82.110 Y64.063 E24.2895 F3600
+G1 X82.368 Y64.332 E24.3018 F3600
+G1 X82.627 Y64.621 E24.3146 F3600
+G1 X82.886 Y64.927 E24.3279 F3600
+G1 X83.146 Y65.251 E24.3416 F3600
+G1 X83.405 Y65.592 E24.3557 F3600
+G1 X83.663 Y65.947 E24.3702 F3600
+G1 X83.919 Y66.316 E24.3850 F3600
+G1 X84.173 Y66.697 E24.4001 F3600
+G1 X84.423 Y67.089 E24.4155 F3600
+G1 X84.671 Y67.491 E24.4311 F3600
+G1 X84.914 Y67.900 E24.4468 F3600
+G1 X85.153 Y68.315 E24.4626 F3600
+G1 X85.387 Y68.734 E24.4784 F3600
+G1 X85.615 Y69.155 E24.4942 F3600
+G1 X85.838 Y69.577 E24.5100 F3600
+G1 X86.054 Y69.998 E24.5256 F3600
+G1 X86.264 Y70.416 E24.5410 F3600
+G1 X86.467 Y70.828 E24.5562 F3600
+G1 X86.664 Y71.233 E24.5710 F3600
+G1 X86.853 Y71.630 E24.5855 F3600
+G1 X87.036 Y72.016 E24.5996 F3600
+G1 X87.211 Y72.390 E24.6133 F3600
+G1 X87.379 Y72.749 E24.6264 F3600
+G1 X87.540 Y73.093 E24.6389 F3600
+G1 X87.693 Y73.420 E24.6508 F3600
+G1 X87.840 Y73.729 E24.6621 F3600
+G1 X87.981 Y74.017 E24.6727 F3600
+G1 X88.115 Y74.284 E24.6825 F3600
+G1 X88.243 Y74.528 E24.6916 F3600
+G1 X88.365 Y74.750 E24.7000 F3600
+G1 X88.482 Y74.947 E24.7075 F3600
+G1 X88.593 Y75.119 E24.7143 F3600
+G1 X88.700 Y75.265 E24.7203 F3600
+G1 X88.804 Y75.385 E24.7255 F3600
+G1 X88.903 Y75.479 E24.7300 F3600
+G1 X88.999 Y75.546 E24.7339 F3600
+G1 X89.093 Y75.587 E24.7373 F3600
+G1 X89.185 Y75.601 E24.7403 F3600
+G1 X89.275 Y75.589 E24.7433 F3600
+G1 X89.364 Y75.550 E24.7465 F3600
+G1 X89.453 Y75.487 E24.7501 F3600
+G1 X89.541 Y75.399 E24.7542 F3600
+G1 X89.630 Y75.287 E24.7590 F3600
+G1 X89.720 Y75.152 E24.7643 F3600
+G1 X89.811 Y74.995 E24.7703 F3600
+G1 X89.905 Y74.818 E24.7769 F3600
+G1 X90.000 Y74.621 E24.7841 F3600
+G1 X90.098 Y74.406 E24.7919 F3600
+G1 X90.199 Y74.174 E24.8003 F3600
+G1 X90.303 Y73.927 E24.8091 F3600
+G1 X90.411 Y73.667 E24.8184 F3600
+G1 X90.522 Y73.395 E24.8281 F3600
+G1 X90.637 Y73.112 E24.8382 F3600
+G1 X90.756 Y72.821 E24.8486 F3600
+G1 X90.879 Y72.523 E24.8592 F3600
+G1 X91.007 Y72.220 E24.8700 F3600
+G1 X91.138 Y71.914 E24.8810 F3600
+G1 X91.273 Y71.605 E24.8922 F3600
+G1 X91.413 Y71.297 E24.9033 F3600
+G1 X91.556 Y70.991 E24.9145 F3600
+G1 X91.703 Y70.688 E24.9256 F3600
+G1 X91.854 Y70.389 E24.9366 F3600
+G1 X92.008 Y70.097 E24.9475 F3600
+G1 X92.165 Y69.813 E24.9582 F3600
+G1 X92.324 Y69.537 E24.9688 F3600
+G1 X92.486 Y69.272 E24.9790 F3600
+G1 X92.651 Y69.018 E24.9890 F3600
+G1 X92.817 Y68.776 E24.9987 F3600
+G1 X92.984 Y68.547 E25.0080 F3600
+G1 X93.153 Y68.332 E25.0171 F3600
+G1 X93.323 Y68.132 E25.0257 F3600
+G1 X93.493 Y67.947 E25.0340 F3600
+G1 X93.663 Y67.777 E25.0420 F3600
+G1 X93.833 Y67.623 E25.0495 F3600
+G1 X94.003 Y67.484 E25.0568 F3600
+G1 X94.171 Y67.361 E25.0636 F3600
+G1 X94.339 Y67.254 E25.0702 F3600
+G1 X94.505 Y67.163 E25.0765 F3600
+G1 X94.670 Y67.086 E25.0825 F3600
+G1 X94.833 Y67.024 E25.0882 F3600
+G1 X94.995 Y66.975 E25.0938 F3600
+G1 X95.154 Y66.940 E25.0992 F3600
+G1 X95.312 Y66.917 E25.1044 F3600
+G1 X95.468 Y66.906 E25.1096 F3600
+G1 X95.622 Y66.904 E25.1147 F3600
+G1 X95.773 Y66.912 E25.1197 F3600
+G1 X95.924 Y66.929 E25.1247 F3600
+G1 X96.072 Y66.952 E25.1296 F3600
+G1 X96.220 Y66.981 E25.1346 F3600
+G1 X96.366 Y67.014 E25.1395 F3600
+G1 X96.511 Y67.051 E25.1445 F3600
+G1 X96.656 Y67.089 E25.1494 F3600
+G1 X96.801 Y67.127 E25.1544 F3600
+G1 X96.947 Y67.165 E25.1593 F3600
+G1 X97.093 Y67.200 E25.1643 F3600
+G1 X97.240 Y67.233 E25.1693 F3600
+G1 X97.389 Y67.260 E25.1743 F3600
+G1 X97.540 Y67.281 E25.1793 F3600
+G1 X97.694 Y67.296 E25.1844 F3600
+G1 X97.851 Y67.302 E25.1896 F3600
+G1 X98.012 Y67.299 E25.1949 F3600
+G1 X98.178 Y67.286 E25.2004 F3600
+G1 X98.348 Y67.262 E25.2061 F3600
+G1 X98.524 Y67.226 E25.2120 F3600
+G1 X98.705 Y67.179 E25.2182 F3600
+G1 X98.894 Y67.118 E25.2247 F3600
+G1 X99.089 Y67.045 E25.2316 F3600
+G1 X99.291 Y66.958 E25.2389 F3600
+G1 X99.501 Y66.858 E25.2465 F3600
+G1 X99.719 Y66.744 E25.2547 F3600
+G1 X99.945 Y66.616 E25.2632 F3600
+G1 X100.180 Y66.475 E25.2723 F3600
+G1 X100.424 Y66.321 E25.2818 F3600
+G1 X100.676 Y66.155 E25.2918 F3600
+G1 X100.938 Y65.977 E25.3022 F3600
+G1 X101.209 Y65.787 E25.3131 F3600
+G1 X101.488 Y65.587 E25.3245 F3600
+G1 X101.776 Y65.377 E25.3362 F3600
+G1 X102.073 Y65.159 E25.3484 F3600
+G1 X102.378 Y64.933 E25.3609 F3600
+G1 X102.691 Y64.700 E25.3738 F3600
+G1 X103.012 Y64.463 E25.3869 F3600
+G1 X103.339 Y64.222 E25.4004 F3600
+G1 X103.674 Y63.978 E25.4140 F3600
+G1 X104.013 Y63.733 E25.4278 F3600
+G1 X104.358 Y63.489 E25.4418 F3600
+G1 X104.708 Y63.246 E25.4558 F3600
+G1 X105.061 Y63.007 E25.4699 F3600
+G1 X105.417 Y62.774 E25.4839 F3600
+G1 X105.774 Y62.546 E25.4979 F3600
+G1 X106.132 Y62.327 E25.5118 F3600
+G1 X106.490 Y62.117 E25.5255 F3600
+G1 X106.847 Y61.918 E25.5390 F3600
+G1 X107.201 Y61.731 E25.5522 F3600
+G1 X107.552 Y61.558 E25.5651 F3600
+G1 X107.899 Y61.401 E25.5776 F3600
+G1 X108.239 Y61.259 E25.5898 F3600
+G1 X108.573 Y61.135 E25.6016 F3600
+G1 X108.900 Y61.030 E25.6129 F3600
+G1 X109.217 Y60.944 E25.6237 F3600
+G1 X109.524 Y60.879 E25.6341 F3600
+G1 X109.820 Y60.835 E25.6440 F3600
+G1 X110.104 Y60.813 E25.6534 F3600
+G1 X110.376 Y60.814 E25.6623 F3600
+G1 X110.633 Y60.838 E25.6709 F3600
+G1 X110.875 Y60.884 E25.6790 F3600
+G1 X111.103 Y60.955 E25.6869 F3600
+G1 X111.313 Y61.049 E25.6945 F3600
+G1 X111.507 Y61.167 E25.7020 F3600
+G1 X111.684 Y61.308 E25.7094 F3600
+G1 X111.843 Y61.472 E25.7170 F3600
+G1 X111.983 Y61.659 E25.7247 F3600
+G1 X112.105 Y61.869 E25.7327 F3600
+G1 X112.208 Y62.100 E25.7410 F3600
+G1 X112.293 Y62.352 E25.7498 F3600
+G1 X112.358 Y62.625 E25.7591 F3600
+G1 X112.405 Y62.917 E25.7688 F3600
+G1 X112.434 Y63.226 E25.7791 F3600
+G1 X112.444 Y63.553 E25.7899 F3600
+G1 X112.437 Y63.897 E25.8012 F3600
+G1 X112.412 Y64.254 E25.8130 F3600
+G1 X112.370 Y64.626 E25.8254 F3600
+G1 X112.313 Y65.009 E25.8382 F3600
+G1 X112.240 Y65.403 E25.8514 F3600
+G1 X112.153 Y65.807 E25.8650 F3600
+G1 X112.053 Y66.219 E25.8790 F3600
+G1 X111.940 Y66.637 E25.8933 F3600
+G1 X111.815 Y67.060 E25.9078 F3600
+G1 X111.680 Y67.486 E25.9226 F3600
+G1 X111.536 Y67.915 E25.9375 F3600
+G1 X111.385 Y68.345 E25.9526 F3600
+G1 X111.226 Y68.774 E25.9677 F3600
+G1 X111.062 Y69.201 E25.9828 F3600
+G1 X110.893 Y69.625 E25.9978 F3600
+G1 X110.722 Y70.045 E26.0128 F3600
+G1 X110.549 Y70.459 E26.0276 F3600
+G1 X110.376 Y70.866 E26.0422 F3600
+G1 X110.204 Y71.265 E26.0565 F3600
+G1 X110.033 Y71.656 E26.0706 F3600
+G1 X109.866 Y72.037 E26.0843 F3600
+G1 X109.703 Y72.408 E26.0977 F3600
+G1 X109.546 Y72.768 E26.1107 F3600
+G1 X109.396 Y73.116 E26.1232 F3600
+G1 X109.252 Y73.452 E26.1352 F3600
+G1 X109.117 Y73.776 E26.1468 F3600
+G1 X108.992 Y74.087 E26.1579 F3600
+G1 X108.876 Y74.384 E26.1684 F3600
+G1 X108.771 Y74.669 E26.1785 F3600
+G1 X108.676 Y74.941 E26.1879 F3600
+G1 X108.593 Y75.200 E26.1969 F3600
+G1 X108.522 Y75.445 E26.2054 F3600
+G1 X108.463 Y75.679 E26.2133 F3600
+G1 X108.416 Y75.900 E26.2207 F3600
+G1 X108.381 Y76.109 E26.2277 F3600
+G1 X108.358 Y76.306 E26.2343 F3600
+G1 X108.347 Y76.493 E26.2405 F3600
+G1 X108.347 Y76.670 E26.2463 F3600
+G1 X108.359 Y76.837 E26.2519 F3600
+G1 X108.381 Y76.995 E26.2571 F3600
+G1 X108.413 Y77.146 E26.2622 F3600
+G1 X108.454 Y77.288 E26.2671 F3600
+G1 X108.504 Y77.425 E26.2719 F3600
+G1 X108.561 Y77.556 E26.2766 F3600
+G1 X108.625 Y77.681 E26.2813 F3600
+G1 X108.695 Y77.803 E26.2859 F3600
+G1 X108.770 Y77.922 E26.2905 F3600
+G1 X108.848 Y78.038 E26.2952 F3600
+G1 X108.929 Y78.153 E26.2998 F3600
+G1 X109.011 Y78.267 E26.3044 F3600
+G1 X109.094 Y78.382 E26.3091 F3600
+G1 X109.175 Y78.497 E26.3137 F3600
+G1 X109.254 Y78.613 E26.3184 F3600
+G1 X109.330 Y78.732 E26.3230 F3600
+G1 X109.401 Y78.853 E26.3277 F3600
+G1 X109.467 Y78.977 E26.3323 F3600
+G1 X109.525 Y79.105 E26.3370 F3600
+G1 X109.576 Y79.238 E26.3416 F3600
+G1 X109.619 Y79.375 E26.3464 F3600
+G1 X109.651 Y79.516 E26.3511 F3600
+G1 X109.673 Y79.663 E26.3560 F3600
+G1 X109.684 Y79.814 E26.3611 F3600
+G1 X109.682 Y79.971 E26.3662 F3600
+G1 X109.668 Y80.134 E26.3716 F3600
+G1 X109.641 Y80.301 E26.3772 F3600
+G1 X109.601 Y80.474 E26.3831 F3600
+G1 X109.547 Y80.651 E26.3892 F3600
+G1 X109.479 Y80.834 E26.3956 F3600
+G1 X109.397 Y81.021 E26.4024 F3600
+G1 X109.302 Y81.212 E26.4094 F3600
+G1 X109.192 Y81.407 E26.4168 F3600
+G1 X109.070 Y81.605 E26.4245 F3600
+G1 X108.935 Y81.806 E26.4325 F3600
+G1 X108.787 Y82.010 E26.4408 F3600
+G1 X108.628 Y82.215 E26.4493 F3600
+G1 X108.458 Y82.422 E26.4582 F3600
+G1 X108.279 Y82.630 E26.4672 F3600
+G1 X108.090 Y82.837 E26.4765 F3600
+G1 X107.894 Y83.045 E26.4859 F3600
+G1 X107.692 Y83.251 E26.4954 F3600
+G1 X107.484 Y83.456 E26.5051 F3600
+G1 X107.272 Y83.659 E26.5147 F3600
+G1 X107.058 Y83.859 E26.5244 F3600
+G1 X106.843 Y84.056 E26.5340 F3600
+G1 X106.628 Y84.248 E26.5436 F3600
+G1 X106.416 Y84.437 E26.5529 F3600
+G1 X106.207 Y84.621 E26.5621 F3600
+G1 X106.004 Y84.800 E26.5710 F3600
+G1 X105.808 Y84.973 E26.5797 F3600
+G1 X105.620 Y85.141 E26.5880 F3600
+G1 X105.443 Y85.302 E26.5959 F3600
+G1 X105.277 Y85.457 E26.6034 F3600
+G1 X105.125 Y85.606 E26.6104 F3600
+G1 X104.988 Y85.747 E26.6169 F3600
+G1 X104.867 Y85.883 E26.6229 F3600
+G1 X104.764 Y86.011 E26.6283 F3600
+G1 X104.680 Y86.132 E26.6332 F3600
+G1 X104.616 Y86.247 E26.6375 F3600
+G1 X104.573 Y86.356 E26.6414 F3600
+G1 X104.553 Y86.458 E26.6448 F3600
+G1 X104.556 Y86.554 E26.6480 F3600
+G1 X104.583 Y86.644 E26.6511 F3600
+G1 X104.634 Y86.729 E26.6544 F3600
+G1 X104.711 Y86.809 E26.6580 F3600
+G1 X104.813 Y86.884 E26.6622 F3600
+G1 X104.941 Y86.955 E26.6670 F3600
+G1 X105.095 Y87.022 E26.6726 F3600
+G1 X105.274 Y87.086 E26.6788 F3600
+G1 X105.479 Y87.148 E26.6859 F3600
+G1 X105.710 Y87.207 E26.6938 F3600
+G1 X105.965 Y87.265 E26.7024 F3600
+G1 X106.244 Y87.322 E26.7118 F3600
+G1 X106.547 Y87.379 E26.7220 F3600
+G1 X106.872 Y87.436 E26.7329 F3600
+G1 X107.218 Y87.494 E26.7445 F3600
+G1 X107.585 Y87.554 E26.7567 F3600
+G1 X107.972 Y87.615 E26.7696 F3600
+G1 X108.375 Y87.679 E26.7831 F3600
+G1 X108.796 Y87.745 E26.7972 F3600
+G1 X109.230 Y87.816 E26.8117 F3600
+G1 X109.678 Y87.890 E26.8267 F3600
+G1 X110.137 Y87.969 E26.8421 F3600
+G1 X110.606 Y88.052 E26.8578 F3600
+G1 X111.083 Y88.141 E26.8738 F3600
+G1 X111.565 Y88.235 E26.8900 F3600
+G1 X112.052 Y88.334 E26.9064 F3600
+G1 X112.540 Y88.440 E26.9229 F3600
+G1 X113.029 Y88.551 E26.9394 F3600
+G1 X113.516 Y88.669 E26.9559 F3600
+G1 X113.999 Y88.793 E26.9724 F3600
+G1 X114.477 Y88.923 E26.9887 F3600
+G1 X114.948 Y89.059 E27.0049 F3600
+G1 X115.409 Y89.201 E27.0208 F3600
+G1 X115.860 Y89.350 E27.0365 F3600
+G1 X116.298 Y89.504 E27.0518 F3600
+G1 X116.723 Y89.664 E27.0668 F3600
+G1 X117.132 Y89.830 E27.0814 F3600
+G1 X117.524 Y90.000 E27.0955 F3600
+M400
+M3202
+M104 S0
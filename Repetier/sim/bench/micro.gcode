@@ -0,0 +1,4011 @@
+; Planner benchmark: 0.1 mm segments along a wavy line with extrusion.
+G28
+M109 S200
+G92 E0
+G1 Z0.3 F600
+M400
+M3202 S1
+G1 X60 Y90 F6000
+G1 X60.100 Y90.100 E0.0047 F3000
+G1 X60.200 Y90.200 E0.0093 F3000
+G1 X60.300 Y90.299 E0.0140 F3000
+G1 X60.400 Y90.397 E0.0186 F3000
+G1 X60.500 Y90.495 E0.0232 F3000
+G1 X60.600 Y90.591 E0.0278 F3000
+G1 X60.700 Y90.686 E0.0323 F3000
+G1 X60.800 Y90.779 E0.0368 F3000
+G1 X60.900 Y90.870 E0.0413 F3000
+G1 X61.000 Y90.959 E0.0457 F3000
+G1 X61.100 Y91.045 E0.0501 F3000
+G1 X61.200 Y91.129 E0.0544 F3000
+G1 X61.300 Y91.210 E0.0586 F3000
+G1 X61.400 Y91.288 E0.0628 F3000
+G1 X61.500 Y91.363 E0.0670 F3000
+G1 X61.600 Y91.435 E0.0710 F3000
+G1 X61.700 Y91.503 E0.0750 F3000
+G1 X61.800 Y91.567 E0.0789 F3000
+G1 X61.900 Y91.627 E0.0828 F3000
+G1 X62.000 Y91.683 E0.0866 F3000
+G1 X62.100 Y91.735 E0.0903 F3000
+G1 X62.200 Y91.782 E0.0939 F3000
+G1 X62.300 Y91.826 E0.0975 F3000
+G1 X62.400 Y91.864 E0.1011 F3000
+G1 X62.500 Y91.898 E0.1045 F3000
+G1 X62.600 Y91.927 E0.1080 F3000
+G1 X62.700 Y91.951 E0.1114 F3000
+G1 X62.800 Y91.971 E0.1147 F3000
+G1 X62.900 Y91.985 E0.1181 F3000
+G1 X63.000 Y91.995 E0.1214 F3000
+G1 X63.100 Y92.000 E0.1247 F3000
+G1 X63.200 Y91.999 E0.1280 F3000
+G1 X63.300 Y91.994 E0.1313 F3000
+G1 X63.400 Y91.983 E0.1346 F3000
+G1 X63.500 Y91.968 E0.1380 F3000
+G1 X63.600 Y91.948 E0.1413 F3000
+G1 X63.700 Y91.923 E0.1447 F3000
+G1 X63.800 Y91.893 E0.1482 F3000
+G1 X63.900 Y91.858 E0.1517 F3000
+G1 X64.000 Y91.819 E0.1552 F3000
+G1 X64.100 Y91.775 E0.1588 F3000
+G1 X64.200 Y91.726 E0.1625 F3000
+G1 X64.300 Y91.674 E0.1662 F3000
+G1 X64.400 Y91.617 E0.1700 F3000
+G1 X64.500 Y91.556 E0.1739 F3000
+G1 X64.600 Y91.491 E0.1778 F3000
+G1 X64.700 Y91.423 E0.1818 F3000
+G1 X64.800 Y91.351 E0.1859 F3000
+G1 X64.900 Y91.276 E0.1900 F3000
+G1 X65.000 Y91.197 E0.1942 F3000
+G1 X65.100 Y91.115 E0.1984 F3000
+G1 X65.200 Y91.031 E0.2028 F3000
+G1 X65.300 Y90.944 E0.2071 F3000
+G1 X65.400 Y90.855 E0.2116 F3000
+G1 X65.500 Y90.763 E0.2160 F3000
+G1 X65.600 Y90.670 E0.2205 F3000
+G1 X65.700 Y90.575 E0.2251 F3000
+G1 X65.800 Y90.478 E0.2297 F3000
+G1 X65.900 Y90.381 E0.2343 F3000
+G1 X66.000 Y90.282 E0.2389 F3000
+G1 X66.100 Y90.183 E0.2436 F3000
+G1 X66.200 Y90.083 E0.2482 F3000
+G1 X66.300 Y89.983 E0.2529 F3000
+G1 X66.400 Y89.883 E0.2576 F3000
+G1 X66.500 Y89.784 E0.2622 F3000
+G1 X66.600 Y89.685 E0.2669 F3000
+G1 X66.700 Y89.586 E0.2715 F3000
+G1 X66.800 Y89.489 E0.2761 F3000
+G1 X66.900 Y89.393 E0.2807 F3000
+G1 X67.000 Y89.298 E0.2852 F3000
+G1 X67.100 Y89.206 E0.2897 F3000
+G1 X67.200 Y89.115 E0.2942 F3000
+G1 X67.300 Y89.026 E0.2986 F3000
+G1 X67.400 Y88.940 E0.3029 F3000
+G1 X67.500 Y88.857 E0.3072 F3000
+G1 X67.600 Y88.776 E0.3115 F3000
+G1 X67.700 Y88.699 E0.3157 F3000
+G1 X67.800 Y88.624 E0.3198 F3000
+G1 X67.900 Y88.554 E0.3238 F3000
+G1 X68.000 Y88.486 E0.3278 F3000
+G1 X68.100 Y88.423 E0.3317 F3000
+G1 X68.200 Y88.363 E0.3355 F3000
+G1 X68.300 Y88.308 E0.3393 F3000
+G1 X68.400 Y88.257 E0.3430 F3000
+G1 X68.500 Y88.210 E0.3467 F3000
+G1 X68.600 Y88.168 E0.3502 F3000
+G1 X68.700 Y88.130 E0.3538 F3000
+G1 X68.800 Y88.097 E0.3572 F3000
+G1 X68.900 Y88.068 E0.3607 F3000
+G1 X69.000 Y88.045 E0.3641 F3000
+G1 X69.100 Y88.026 E0.3674 F3000
+G1 X69.200 Y88.013 E0.3708 F3000
+G1 X69.300 Y88.004 E0.3741 F3000
+G1 X69.400 Y88.000 E0.3774 F3000
+G1 X69.500 Y88.001 E0.3807 F3000
+G1 X69.600 Y88.008 E0.3840 F3000
+G1 X69.700 Y88.019 E0.3873 F3000
+G1 X69.800 Y88.035 E0.3906 F3000
+G1 X69.900 Y88.056 E0.3940 F3000
+G1 X70.000 Y88.082 E0.3974 F3000
+G1 X70.100 Y88.113 E0.4009 F3000
+G1 X70.200 Y88.148 E0.4044 F3000
+G1 X70.300 Y88.188 E0.4079 F3000
+G1 X70.400 Y88.233 E0.4115 F3000
+G1 X70.500 Y88.282 E0.4152 F3000
+G1 X70.600 Y88.335 E0.4190 F3000
+G1 X70.700 Y88.393 E0.4228 F3000
+G1 X70.800 Y88.454 E0.4266 F3000
+G1 X70.900 Y88.520 E0.4306 F3000
+G1 X71.000 Y88.589 E0.4346 F3000
+G1 X71.100 Y88.662 E0.4387 F3000
+G1 X71.200 Y88.737 E0.4428 F3000
+G1 X71.300 Y88.817 E0.4470 F3000
+G1 X71.400 Y88.899 E0.4513 F3000
+G1 X71.500 Y88.983 E0.4556 F3000
+G1 X71.600 Y89.071 E0.4600 F3000
+G1 X71.700 Y89.160 E0.4644 F3000
+G1 X71.800 Y89.252 E0.4689 F3000
+G1 X71.900 Y89.346 E0.4734 F3000
+G1 X72.000 Y89.441 E0.4780 F3000
+G1 X72.100 Y89.538 E0.4826 F3000
+G1 X72.200 Y89.636 E0.4872 F3000
+G1 X72.300 Y89.734 E0.4918 F3000
+G1 X72.400 Y89.834 E0.4965 F3000
+G1 X72.500 Y89.934 E0.5012 F3000
+G1 X72.600 Y90.034 E0.5058 F3000
+G1 X72.700 Y90.134 E0.5105 F3000
+G1 X72.800 Y90.233 E0.5151 F3000
+G1 X72.900 Y90.332 E0.5198 F3000
+G1 X73.000 Y90.430 E0.5244 F3000
+G1 X73.100 Y90.527 E0.5290 F3000
+G1 X73.200 Y90.623 E0.5336 F3000
+G1 X73.300 Y90.717 E0.5381 F3000
+G1 X73.400 Y90.810 E0.5426 F3000
+G1 X73.500 Y90.900 E0.5471 F3000
+G1 X73.600 Y90.988 E0.5515 F3000
+G1 X73.700 Y91.074 E0.5558 F3000
+G1 X73.800 Y91.157 E0.5601 F3000
+G1 X73.900 Y91.237 E0.5643 F3000
+G1 X74.000 Y91.314 E0.5685 F3000
+G1 X74.100 Y91.388 E0.5726 F3000
+G1 X74.200 Y91.458 E0.5766 F3000
+G1 X74.300 Y91.525 E0.5806 F3000
+G1 X74.400 Y91.587 E0.5845 F3000
+G1 X74.500 Y91.646 E0.5883 F3000
+G1 X74.600 Y91.701 E0.5921 F3000
+G1 X74.700 Y91.751 E0.5958 F3000
+G1 X74.800 Y91.797 E0.5994 F3000
+G1 X74.900 Y91.839 E0.6030 F3000
+G1 X75.000 Y91.876 E0.6065 F3000
+G1 X75.100 Y91.908 E0.6100 F3000
+G1 X75.200 Y91.936 E0.6134 F3000
+G1 X75.300 Y91.959 E0.6168 F3000
+G1 X75.400 Y91.976 E0.6201 F3000
+G1 X75.500 Y91.989 E0.6234 F3000
+G1 X75.600 Y91.997 E0.6267 F3000
+G1 X75.700 Y92.000 E0.6300 F3000
+G1 X75.800 Y91.998 E0.6334 F3000
+G1 X75.900 Y91.991 E0.6367 F3000
+G1 X76.000 Y91.979 E0.6400 F3000
+G1 X76.100 Y91.962 E0.6433 F3000
+G1 X76.200 Y91.940 E0.6467 F3000
+G1 X76.300 Y91.913 E0.6501 F3000
+G1 X76.400 Y91.881 E0.6536 F3000
+G1 X76.500 Y91.845 E0.6571 F3000
+G1 X76.600 Y91.804 E0.6607 F3000
+G1 X76.700 Y91.759 E0.6643 F3000
+G1 X76.800 Y91.709 E0.6680 F3000
+G1 X76.900 Y91.655 E0.6717 F3000
+G1 X77.000 Y91.597 E0.6755 F3000
+G1 X77.100 Y91.535 E0.6794 F3000
+G1 X77.200 Y91.469 E0.6834 F3000
+G1 X77.300 Y91.399 E0.6874 F3000
+G1 X77.400 Y91.326 E0.6915 F3000
+G1 X77.500 Y91.249 E0.6956 F3000
+G1 X77.600 Y91.170 E0.6999 F3000
+G1 X77.700 Y91.087 E0.7041 F3000
+G1 X77.800 Y91.002 E0.7085 F3000
+G1 X77.900 Y90.914 E0.7129 F3000
+G1 X78.000 Y90.824 E0.7173 F3000
+G1 X78.100 Y90.732 E0.7218 F3000
+G1 X78.200 Y90.638 E0.7263 F3000
+G1 X78.300 Y90.543 E0.7309 F3000
+G1 X78.400 Y90.446 E0.7355 F3000
+G1 X78.500 Y90.348 E0.7401 F3000
+G1 X78.600 Y90.249 E0.7447 F3000
+G1 X78.700 Y90.149 E0.7494 F3000
+G1 X78.800 Y90.050 E0.7541 F3000
+G1 X78.900 Y89.950 E0.7587 F3000
+G1 X79.000 Y89.850 E0.7634 F3000
+G1 X79.100 Y89.750 E0.7680 F3000
+G1 X79.200 Y89.651 E0.7727 F3000
+G1 X79.300 Y89.553 E0.7773 F3000
+G1 X79.400 Y89.456 E0.7819 F3000
+G1 X79.500 Y89.361 E0.7865 F3000
+G1 X79.600 Y89.267 E0.7910 F3000
+G1 X79.700 Y89.175 E0.7955 F3000
+G1 X79.800 Y89.085 E0.7999 F3000
+G1 X79.900 Y88.997 E0.8043 F3000
+G1 X80.000 Y88.912 E0.8086 F3000
+G1 X80.100 Y88.829 E0.8129 F3000
+G1 X80.200 Y88.750 E0.8171 F3000
+G1 X80.300 Y88.673 E0.8213 F3000
+G1 X80.400 Y88.600 E0.8254 F3000
+G1 X80.500 Y88.531 E0.8294 F3000
+G1 X80.600 Y88.465 E0.8334 F3000
+G1 X80.700 Y88.402 E0.8372 F3000
+G1 X80.800 Y88.344 E0.8411 F3000
+G1 X80.900 Y88.290 E0.8448 F3000
+G1 X81.000 Y88.241 E0.8485 F3000
+G1 X81.100 Y88.195 E0.8521 F3000
+G1 X81.200 Y88.154 E0.8557 F3000
+G1 X81.300 Y88.118 E0.8592 F3000
+G1 X81.400 Y88.087 E0.8627 F3000
+G1 X81.500 Y88.060 E0.8661 F3000
+G1 X81.600 Y88.038 E0.8694 F3000
+G1 X81.700 Y88.021 E0.8728 F3000
+G1 X81.800 Y88.009 E0.8761 F3000
+G1 X81.900 Y88.002 E0.8794 F3000
+G1 X82.000 Y88.000 E0.8827 F3000
+G1 X82.100 Y88.003 E0.8860 F3000
+G1 X82.200 Y88.011 E0.8893 F3000
+G1 X82.300 Y88.024 E0.8927 F3000
+G1 X82.400 Y88.042 E0.8960 F3000
+G1 X82.500 Y88.064 E0.8994 F3000
+G1 X82.600 Y88.092 E0.9028 F3000
+G1 X82.700 Y88.124 E0.9063 F3000
+G1 X82.800 Y88.161 E0.9098 F3000
+G1 X82.900 Y88.203 E0.9134 F3000
+G1 X83.000 Y88.249 E0.9170 F3000
+G1 X83.100 Y88.300 E0.9207 F3000
+G1 X83.200 Y88.354 E0.9245 F3000
+G1 X83.300 Y88.413 E0.9283 F3000
+G1 X83.400 Y88.476 E0.9322 F3000
+G1 X83.500 Y88.543 E0.9362 F3000
+G1 X83.600 Y88.613 E0.9402 F3000
+G1 X83.700 Y88.687 E0.9443 F3000
+G1 X83.800 Y88.764 E0.9485 F3000
+G1 X83.900 Y88.844 E0.9527 F3000
+G1 X84.000 Y88.927 E0.9570 F3000
+G1 X84.100 Y89.013 E0.9613 F3000
+G1 X84.200 Y89.101 E0.9657 F3000
+G1 X84.300 Y89.191 E0.9702 F3000
+G1 X84.400 Y89.284 E0.9747 F3000
+G1 X84.500 Y89.378 E0.9792 F3000
+G1 X84.600 Y89.474 E0.9838 F3000
+G1 X84.700 Y89.571 E0.9884 F3000
+G1 X84.800 Y89.669 E0.9930 F3000
+G1 X84.900 Y89.768 E0.9976 F3000
+G1 X85.000 Y89.867 E1.0023 F3000
+G1 X85.100 Y89.967 E1.0070 F3000
+G1 X85.200 Y90.067 E1.0116 F3000
+G1 X85.300 Y90.167 E1.0163 F3000
+G1 X85.400 Y90.266 E1.0210 F3000
+G1 X85.500 Y90.365 E1.0256 F3000
+G1 X85.600 Y90.463 E1.0302 F3000
+G1 X85.700 Y90.560 E1.0348 F3000
+G1 X85.800 Y90.655 E1.0394 F3000
+G1 X85.900 Y90.749 E1.0439 F3000
+G1 X86.000 Y90.840 E1.0484 F3000
+G1 X86.100 Y90.930 E1.0528 F3000
+G1 X86.200 Y91.017 E1.0572 F3000
+G1 X86.300 Y91.102 E1.0615 F3000
+G1 X86.400 Y91.184 E1.0658 F3000
+G1 X86.500 Y91.263 E1.0700 F3000
+G1 X86.600 Y91.339 E1.0741 F3000
+G1 X86.700 Y91.412 E1.0782 F3000
+G1 X86.800 Y91.481 E1.0822 F3000
+G1 X86.900 Y91.546 E1.0861 F3000
+G1 X87.000 Y91.608 E1.0900 F3000
+G1 X87.100 Y91.665 E1.0938 F3000
+G1 X87.200 Y91.718 E1.0976 F3000
+G1 X87.300 Y91.767 E1.1012 F3000
+G1 X87.400 Y91.812 E1.1048 F3000
+G1 X87.500 Y91.852 E1.1084 F3000
+G1 X87.600 Y91.887 E1.1119 F3000
+G1 X87.700 Y91.918 E1.1154 F3000
+G1 X87.800 Y91.944 E1.1188 F3000
+G1 X87.900 Y91.965 E1.1221 F3000
+G1 X88.000 Y91.981 E1.1255 F3000
+G1 X88.100 Y91.992 E1.1288 F3000
+G1 X88.200 Y91.999 E1.1321 F3000
+G1 X88.300 Y92.000 E1.1354 F3000
+G1 X88.400 Y91.996 E1.1387 F3000
+G1 X88.500 Y91.987 E1.1420 F3000
+G1 X88.600 Y91.974 E1.1454 F3000
+G1 X88.700 Y91.955 E1.1487 F3000
+G1 X88.800 Y91.931 E1.1521 F3000
+G1 X88.900 Y91.903 E1.1555 F3000
+G1 X89.000 Y91.870 E1.1590 F3000
+G1 X89.100 Y91.832 E1.1625 F3000
+G1 X89.200 Y91.790 E1.1661 F3000
+G1 X89.300 Y91.743 E1.1698 F3000
+G1 X89.400 Y91.691 E1.1735 F3000
+G1 X89.500 Y91.636 E1.1772 F3000
+G1 X89.600 Y91.577 E1.1811 F3000
+G1 X89.700 Y91.513 E1.1850 F3000
+G1 X89.800 Y91.446 E1.1890 F3000
+G1 X89.900 Y91.375 E1.1930 F3000
+G1 X90.000 Y91.301 E1.1971 F3000
+G1 X90.100 Y91.223 E1.2013 F3000
+G1 X90.200 Y91.142 E1.2055 F3000
+G1 X90.300 Y91.059 E1.2098 F3000
+G1 X90.400 Y90.973 E1.2142 F3000
+G1 X90.500 Y90.884 E1.2186 F3000
+G1 X90.600 Y90.793 E1.2231 F3000
+G1 X90.700 Y90.701 E1.2276 F3000
+G1 X90.800 Y90.606 E1.2321 F3000
+G1 X90.900 Y90.510 E1.2367 F3000
+G1 X91.000 Y90.413 E1.2413 F3000
+G1 X91.100 Y90.315 E1.2459 F3000
+G1 X91.200 Y90.216 E1.2506 F3000
+G1 X91.300 Y90.116 E1.2552 F3000
+G1 X91.400 Y90.016 E1.2599 F3000
+G1 X91.500 Y89.916 E1.2645 F3000
+G1 X91.600 Y89.816 E1.2692 F3000
+G1 X91.700 Y89.717 E1.2739 F3000
+G1 X91.800 Y89.618 E1.2785 F3000
+G1 X91.900 Y89.521 E1.2831 F3000
+G1 X92.000 Y89.424 E1.2877 F3000
+G1 X92.100 Y89.329 E1.2922 F3000
+G1 X92.200 Y89.236 E1.2968 F3000
+G1 X92.300 Y89.144 E1.3012 F3000
+G1 X92.400 Y89.055 E1.3057 F3000
+G1 X92.500 Y88.968 E1.3100 F3000
+G1 X92.600 Y88.884 E1.3143 F3000
+G1 X92.700 Y88.802 E1.3186 F3000
+G1 X92.800 Y88.724 E1.3228 F3000
+G1 X92.900 Y88.648 E1.3269 F3000
+G1 X93.000 Y88.576 E1.3310 F3000
+G1 X93.100 Y88.508 E1.3350 F3000
+G1 X93.200 Y88.443 E1.3389 F3000
+G1 X93.300 Y88.382 E1.3428 F3000
+G1 X93.400 Y88.326 E1.3466 F3000
+G1 X93.500 Y88.273 E1.3503 F3000
+G1 X93.600 Y88.225 E1.3540 F3000
+G1 X93.700 Y88.181 E1.3576 F3000
+G1 X93.800 Y88.142 E1.3611 F3000
+G1 X93.900 Y88.107 E1.3646 F3000
+G1 X94.000 Y88.077 E1.3681 F3000
+G1 X94.100 Y88.052 E1.3715 F3000
+G1 X94.200 Y88.032 E1.3748 F3000
+G1 X94.300 Y88.017 E1.3782 F3000
+G1 X94.400 Y88.006 E1.3815 F3000
+G1 X94.500 Y88.001 E1.3848 F3000
+G1 X94.600 Y88.000 E1.3881 F3000
+G1 X94.700 Y88.005 E1.3914 F3000
+G1 X94.800 Y88.015 E1.3947 F3000
+G1 X94.900 Y88.029 E1.3980 F3000
+G1 X95.000 Y88.049 E1.4014 F3000
+G1 X95.100 Y88.073 E1.4048 F3000
+G1 X95.200 Y88.102 E1.4082 F3000
+G1 X95.300 Y88.136 E1.4117 F3000
+G1 X95.400 Y88.175 E1.4153 F3000
+G1 X95.500 Y88.218 E1.4189 F3000
+G1 X95.600 Y88.266 E1.4225 F3000
+G1 X95.700 Y88.318 E1.4262 F3000
+G1 X95.800 Y88.374 E1.4300 F3000
+G1 X95.900 Y88.434 E1.4339 F3000
+G1 X96.000 Y88.498 E1.4378 F3000
+G1 X96.100 Y88.566 E1.4418 F3000
+G1 X96.200 Y88.637 E1.4458 F3000
+G1 X96.300 Y88.712 E1.4500 F3000
+G1 X96.400 Y88.790 E1.4541 F3000
+G1 X96.500 Y88.871 E1.4584 F3000
+G1 X96.600 Y88.955 E1.4627 F3000
+G1 X96.700 Y89.042 E1.4671 F3000
+G1 X96.800 Y89.131 E1.4715 F3000
+G1 X96.900 Y89.222 E1.4759 F3000
+G1 X97.000 Y89.315 E1.4804 F3000
+G1 X97.100 Y89.410 E1.4850 F3000
+G1 X97.200 Y89.506 E1.4896 F3000
+G1 X97.300 Y89.604 E1.4942 F3000
+G1 X97.400 Y89.702 E1.4988 F3000
+G1 X97.500 Y89.801 E1.5035 F3000
+G1 X97.600 Y89.901 E1.5081 F3000
+G1 X97.700 Y90.001 E1.5128 F3000
+G1 X97.800 Y90.101 E1.5175 F3000
+G1 X97.900 Y90.201 E1.5221 F3000
+G1 X98.000 Y90.300 E1.5268 F3000
+G1 X98.100 Y90.398 E1.5314 F3000
+G1 X98.200 Y90.496 E1.5360 F3000
+G1 X98.300 Y90.592 E1.5406 F3000
+G1 X98.400 Y90.687 E1.5451 F3000
+G1 X98.500 Y90.780 E1.5496 F3000
+G1 X98.600 Y90.871 E1.5541 F3000
+G1 X98.700 Y90.960 E1.5585 F3000
+G1 X98.800 Y91.046 E1.5629 F3000
+G1 X98.900 Y91.130 E1.5672 F3000
+G1 X99.000 Y91.211 E1.5714 F3000
+G1 X99.100 Y91.289 E1.5756 F3000
+G1 X99.200 Y91.364 E1.5797 F3000
+G1 X99.300 Y91.435 E1.5838 F3000
+G1 X99.400 Y91.503 E1.5878 F3000
+G1 X99.500 Y91.567 E1.5917 F3000
+G1 X99.600 Y91.627 E1.5956 F3000
+G1 X99.700 Y91.683 E1.5993 F3000
+G1 X99.800 Y91.735 E1.6031 F3000
+G1 X99.900 Y91.783 E1.6067 F3000
+G1 X100.000 Y91.826 E1.6103 F3000
+G1 X100.100 Y91.864 E1.6138 F3000
+G1 X100.200 Y91.898 E1.6173 F3000
+G1 X100.300 Y91.927 E1.6208 F3000
+G1 X100.400 Y91.952 E1.6242 F3000
+G1 X100.500 Y91.971 E1.6275 F3000
+G1 X100.600 Y91.986 E1.6308 F3000
+G1 X100.700 Y91.995 E1.6342 F3000
+G1 X100.800 Y92.000 E1.6375 F3000
+G1 X100.900 Y91.999 E1.6408 F3000
+G1 X101.000 Y91.994 E1.6441 F3000
+G1 X101.100 Y91.983 E1.6474 F3000
+G1 X101.200 Y91.968 E1.6507 F3000
+G1 X101.300 Y91.947 E1.6541 F3000
+G1 X101.400 Y91.922 E1.6575 F3000
+G1 X101.500 Y91.892 E1.6609 F3000
+G1 X101.600 Y91.858 E1.6644 F3000
+G1 X101.700 Y91.818 E1.6680 F3000
+G1 X101.800 Y91.774 E1.6716 F3000
+G1 X101.900 Y91.726 E1.6753 F3000
+G1 X102.000 Y91.673 E1.6790 F3000
+G1 X102.100 Y91.616 E1.6828 F3000
+G1 X102.200 Y91.556 E1.6866 F3000
+G1 X102.300 Y91.491 E1.6906 F3000
+G1 X102.400 Y91.422 E1.6946 F3000
+G1 X102.500 Y91.350 E1.6986 F3000
+G1 X102.600 Y91.275 E1.7028 F3000
+G1 X102.700 Y91.196 E1.7070 F3000
+G1 X102.800 Y91.115 E1.7112 F3000
+G1 X102.900 Y91.030 E1.7156 F3000
+G1 X103.000 Y90.943 E1.7199 F3000
+G1 X103.100 Y90.854 E1.7243 F3000
+G1 X103.200 Y90.763 E1.7288 F3000
+G1 X103.300 Y90.669 E1.7333 F3000
+G1 X103.400 Y90.574 E1.7379 F3000
+G1 X103.500 Y90.478 E1.7425 F3000
+G1 X103.600 Y90.380 E1.7471 F3000
+G1 X103.700 Y90.281 E1.7517 F3000
+G1 X103.800 Y90.182 E1.7564 F3000
+G1 X103.900 Y90.082 E1.7610 F3000
+G1 X104.000 Y89.982 E1.7657 F3000
+G1 X104.100 Y89.882 E1.7704 F3000
+G1 X104.200 Y89.783 E1.7750 F3000
+G1 X104.300 Y89.684 E1.7797 F3000
+G1 X104.400 Y89.585 E1.7843 F3000
+G1 X104.500 Y89.488 E1.7889 F3000
+G1 X104.600 Y89.392 E1.7935 F3000
+G1 X104.700 Y89.298 E1.7980 F3000
+G1 X104.800 Y89.205 E1.8025 F3000
+G1 X104.900 Y89.114 E1.8070 F3000
+G1 X105.000 Y89.026 E1.8114 F3000
+G1 X105.100 Y88.940 E1.8157 F3000
+G1 X105.200 Y88.856 E1.8200 F3000
+G1 X105.300 Y88.776 E1.8243 F3000
+G1 X105.400 Y88.698 E1.8284 F3000
+G1 X105.500 Y88.624 E1.8326 F3000
+G1 X105.600 Y88.553 E1.8366 F3000
+G1 X105.700 Y88.486 E1.8406 F3000
+G1 X105.800 Y88.422 E1.8445 F3000
+G1 X105.900 Y88.363 E1.8483 F3000
+G1 X106.000 Y88.308 E1.8521 F3000
+G1 X106.100 Y88.256 E1.8558 F3000
+G1 X106.200 Y88.210 E1.8594 F3000
+G1 X106.300 Y88.167 E1.8630 F3000
+G1 X106.400 Y88.130 E1.8666 F3000
+G1 X106.500 Y88.097 E1.8700 F3000
+G1 X106.600 Y88.068 E1.8735 F3000
+G1 X106.700 Y88.045 E1.8768 F3000
+G1 X106.800 Y88.026 E1.8802 F3000
+G1 X106.900 Y88.013 E1.8835 F3000
+G1 X107.000 Y88.004 E1.8868 F3000
+G1 X107.100 Y88.000 E1.8901 F3000
+G1 X107.200 Y88.001 E1.8934 F3000
+G1 X107.300 Y88.008 E1.8968 F3000
+G1 X107.400 Y88.019 E1.9001 F3000
+G1 X107.500 Y88.035 E1.9034 F3000
+G1 X107.600 Y88.056 E1.9068 F3000
+G1 X107.700 Y88.082 E1.9102 F3000
+G1 X107.800 Y88.113 E1.9137 F3000
+G1 X107.900 Y88.149 E1.9172 F3000
+G1 X108.000 Y88.189 E1.9207 F3000
+G1 X108.100 Y88.234 E1.9243 F3000
+G1 X108.200 Y88.283 E1.9280 F3000
+G1 X108.300 Y88.336 E1.9317 F3000
+G1 X108.400 Y88.393 E1.9356 F3000
+G1 X108.500 Y88.455 E1.9394 F3000
+G1 X108.600 Y88.520 E1.9434 F3000
+G1 X108.700 Y88.590 E1.9474 F3000
+G1 X108.800 Y88.662 E1.9515 F3000
+G1 X108.900 Y88.738 E1.9556 F3000
+G1 X109.000 Y88.817 E1.9598 F3000
+G1 X109.100 Y88.899 E1.9641 F3000
+G1 X109.200 Y88.984 E1.9684 F3000
+G1 X109.300 Y89.072 E1.9728 F3000
+G1 X109.400 Y89.161 E1.9772 F3000
+G1 X109.500 Y89.253 E1.9817 F3000
+G1 X109.600 Y89.347 E1.9862 F3000
+G1 X109.700 Y89.442 E1.9908 F3000
+G1 X109.800 Y89.539 E1.9954 F3000
+G1 X109.900 Y89.637 E2.0000 F3000
+G1 X110.000 Y89.735 E2.0046 F3000
+G1 X110.100 Y89.835 E2.0093 F3000
+G1 X110.200 Y89.935 E2.0139 F3000
+G1 X110.300 Y90.035 E2.0186 F3000
+G1 X110.400 Y90.134 E2.0233 F3000
+G1 X110.500 Y90.234 E2.0279 F3000
+G1 X110.600 Y90.333 E2.0326 F3000
+G1 X110.700 Y90.431 E2.0372 F3000
+G1 X110.800 Y90.528 E2.0418 F3000
+G1 X110.900 Y90.624 E2.0464 F3000
+G1 X111.000 Y90.718 E2.0509 F3000
+G1 X111.100 Y90.811 E2.0554 F3000
+G1 X111.200 Y90.901 E2.0598 F3000
+G1 X111.300 Y90.989 E2.0642 F3000
+G1 X111.400 Y91.075 E2.0686 F3000
+G1 X111.500 Y91.158 E2.0729 F3000
+G1 X111.600 Y91.238 E2.0771 F3000
+G1 X111.700 Y91.315 E2.0813 F3000
+G1 X111.800 Y91.388 E2.0854 F3000
+G1 X111.900 Y91.459 E2.0894 F3000
+G1 X112.000 Y91.525 E2.0934 F3000
+G1 X112.100 Y91.588 E2.0973 F3000
+G1 X112.200 Y91.647 E2.1011 F3000
+G1 X112.300 Y91.701 E2.1048 F3000
+G1 X112.400 Y91.752 E2.1085 F3000
+G1 X112.500 Y91.798 E2.1122 F3000
+G1 X112.600 Y91.839 E2.1157 F3000
+G1 X112.700 Y91.876 E2.1193 F3000
+G1 X112.800 Y91.909 E2.1227 F3000
+G1 X112.900 Y91.936 E2.1262 F3000
+G1 X113.000 Y91.959 E2.1295 F3000
+G1 X113.100 Y91.976 E2.1329 F3000
+G1 X113.200 Y91.989 E2.1362 F3000
+G1 X113.300 Y91.997 E2.1395 F3000
+G1 X113.400 Y92.000 E2.1428 F3000
+G1 X113.500 Y91.998 E2.1461 F3000
+G1 X113.600 Y91.991 E2.1494 F3000
+G1 X113.700 Y91.979 E2.1528 F3000
+G1 X113.800 Y91.962 E2.1561 F3000
+G1 X113.900 Y91.940 E2.1595 F3000
+G1 X114.000 Y91.913 E2.1629 F3000
+G1 X114.100 Y91.881 E2.1664 F3000
+G1 X114.200 Y91.845 E2.1699 F3000
+G1 X114.300 Y91.804 E2.1734 F3000
+G1 X114.400 Y91.759 E2.1771 F3000
+G1 X114.500 Y91.709 E2.1808 F3000
+G1 X114.600 Y91.655 E2.1845 F3000
+G1 X114.700 Y91.596 E2.1883 F3000
+G1 X114.800 Y91.534 E2.1922 F3000
+G1 X114.900 Y91.468 E2.1962 F3000
+G1 X115.000 Y91.398 E2.2002 F3000
+G1 X115.100 Y91.325 E2.2043 F3000
+G1 X115.200 Y91.249 E2.2084 F3000
+G1 X115.300 Y91.169 E2.2126 F3000
+G1 X115.400 Y91.087 E2.2169 F3000
+G1 X115.500 Y91.001 E2.2213 F3000
+G1 X115.600 Y90.913 E2.2257 F3000
+G1 X115.700 Y90.823 E2.2301 F3000
+G1 X115.800 Y90.731 E2.2346 F3000
+G1 X115.900 Y90.637 E2.2391 F3000
+G1 X116.000 Y90.542 E2.2437 F3000
+G1 X116.100 Y90.445 E2.2483 F3000
+G1 X116.200 Y90.347 E2.2529 F3000
+G1 X116.300 Y90.248 E2.2575 F3000
+G1 X116.400 Y90.149 E2.2622 F3000
+G1 X116.500 Y90.049 E2.2669 F3000
+G1 X116.600 Y89.949 E2.2715 F3000
+G1 X116.700 Y89.849 E2.2762 F3000
+G1 X116.800 Y89.749 E2.2808 F3000
+G1 X116.900 Y89.650 E2.2855 F3000
+G1 X117.000 Y89.552 E2.2901 F3000
+G1 X117.100 Y89.456 E2.2947 F3000
+G1 X117.200 Y89.360 E2.2993 F3000
+G1 X117.300 Y89.266 E2.3038 F3000
+G1 X117.400 Y89.174 E2.3083 F3000
+G1 X117.500 Y89.084 E2.3127 F3000
+G1 X117.600 Y88.996 E2.3171 F3000
+G1 X117.700 Y88.911 E2.3214 F3000
+G1 X117.800 Y88.829 E2.3257 F3000
+G1 X117.900 Y88.749 E2.3299 F3000
+G1 X118.000 Y88.673 E2.3341 F3000
+G1 X118.100 Y88.600 E2.3382 F3000
+G1 X118.200 Y88.530 E2.3422 F3000
+G1 X118.300 Y88.464 E2.3461 F3000
+G1 X118.400 Y88.402 E2.3500 F3000
+G1 X118.500 Y88.344 E2.3538 F3000
+G1 X118.600 Y88.290 E2.3576 F3000
+G1 X118.700 Y88.240 E2.3613 F3000
+G1 X118.800 Y88.195 E2.3649 F3000
+G1 X118.900 Y88.154 E2.3685 F3000
+G1 X119.000 Y88.118 E2.3720 F3000
+G1 X119.100 Y88.086 E2.3754 F3000
+G1 X119.200 Y88.060 E2.3789 F3000
+G1 X119.300 Y88.038 E2.3822 F3000
+G1 X119.400 Y88.021 E2.3856 F3000
+G1 X119.500 Y88.009 E2.3889 F3000
+G1 X119.600 Y88.002 E2.3922 F3000
+G1 X119.700 Y88.000 E2.3955 F3000
+G1 X119.800 Y88.003 E2.3988 F3000
+G1 X119.900 Y88.011 E2.4021 F3000
+G1 X120.000 Y88.024 E2.4054 F3000
+G1 X120.100 Y88.042 E2.4088 F3000
+G1 X120.200 Y88.065 E2.4122 F3000
+G1 X120.300 Y88.092 E2.4156 F3000
+G1 X120.400 Y88.125 E2.4191 F3000
+G1 X120.500 Y88.162 E2.4226 F3000
+G1 X120.600 Y88.203 E2.4262 F3000
+G1 X120.700 Y88.250 E2.4298 F3000
+G1 X120.800 Y88.300 E2.4335 F3000
+G1 X120.900 Y88.355 E2.4373 F3000
+G1 X121.000 Y88.414 E2.4411 F3000
+G1 X121.100 Y88.477 E2.4450 F3000
+G1 X121.200 Y88.543 E2.4490 F3000
+G1 X121.300 Y88.614 E2.4530 F3000
+G1 X121.400 Y88.687 E2.4571 F3000
+G1 X121.500 Y88.764 E2.4613 F3000
+G1 X121.600 Y88.845 E2.4655 F3000
+G1 X121.700 Y88.928 E2.4698 F3000
+G1 X121.800 Y89.013 E2.4741 F3000
+G1 X121.900 Y89.101 E2.4785 F3000
+G1 X122.000 Y89.192 E2.4830 F3000
+G1 X122.100 Y89.284 E2.4875 F3000
+G1 X122.200 Y89.379 E2.4920 F3000
+G1 X122.300 Y89.474 E2.4966 F3000
+G1 X122.400 Y89.571 E2.5012 F3000
+G1 X122.500 Y89.670 E2.5058 F3000
+G1 X122.600 Y89.769 E2.5104 F3000
+G1 X122.700 Y89.868 E2.5151 F3000
+G1 X122.800 Y89.968 E2.5198 F3000
+G1 X122.900 Y90.068 E2.5244 F3000
+G1 X123.000 Y90.168 E2.5291 F3000
+G1 X123.100 Y90.267 E2.5337 F3000
+G1 X123.200 Y90.366 E2.5384 F3000
+G1 X123.300 Y90.464 E2.5430 F3000
+G1 X123.400 Y90.561 E2.5476 F3000
+G1 X123.500 Y90.656 E2.5521 F3000
+G1 X123.600 Y90.749 E2.5567 F3000
+G1 X123.700 Y90.841 E2.5611 F3000
+G1 X123.800 Y90.931 E2.5656 F3000
+G1 X123.900 Y91.018 E2.5700 F3000
+G1 X124.000 Y91.103 E2.5743 F3000
+G1 X124.100 Y91.185 E2.5785 F3000
+G1 X124.200 Y91.264 E2.5828 F3000
+G1 X124.300 Y91.340 E2.5869 F3000
+G1 X124.400 Y91.412 E2.5910 F3000
+G1 X124.500 Y91.481 E2.5950 F3000
+G1 X124.600 Y91.547 E2.5989 F3000
+G1 X124.700 Y91.608 E2.6028 F3000
+G1 X124.800 Y91.666 E2.6066 F3000
+G1 X124.900 Y91.719 E2.6103 F3000
+G1 X125.000 Y91.768 E2.6140 F3000
+G1 X125.100 Y91.812 E2.6176 F3000
+G1 X125.200 Y91.852 E2.6212 F3000
+G1 X125.300 Y91.888 E2.6247 F3000
+G1 X125.400 Y91.918 E2.6281 F3000
+G1 X125.500 Y91.944 E2.6315 F3000
+G1 X125.600 Y91.965 E2.6349 F3000
+G1 X125.700 Y91.981 E2.6383 F3000
+G1 X125.800 Y91.992 E2.6416 F3000
+G1 X125.900 Y91.999 E2.6449 F3000
+G1 X126.000 Y92.000 E2.6482 F3000
+G1 X126.100 Y91.996 E2.6515 F3000
+G1 X126.200 Y91.987 E2.6548 F3000
+G1 X126.300 Y91.973 E2.6581 F3000
+G1 X126.400 Y91.955 E2.6615 F3000
+G1 X126.500 Y91.931 E2.6649 F3000
+G1 X126.600 Y91.903 E2.6683 F3000
+G1 X126.700 Y91.869 E2.6718 F3000
+G1 X126.800 Y91.832 E2.6753 F3000
+G1 X126.900 Y91.789 E2.6789 F3000
+G1 X127.000 Y91.742 E2.6825 F3000
+G1 X127.100 Y91.691 E2.6863 F3000
+G1 X127.200 Y91.636 E2.6900 F3000
+G1 X127.300 Y91.576 E2.6939 F3000
+G1 X127.400 Y91.512 E2.6978 F3000
+G1 X127.500 Y91.445 E2.7018 F3000
+G1 X127.600 Y91.374 E2.7058 F3000
+G1 X127.700 Y91.300 E2.7099 F3000
+G1 X127.800 Y91.222 E2.7141 F3000
+G1 X127.900 Y91.142 E2.7183 F3000
+G1 X128.000 Y91.058 E2.7226 F3000
+G1 X128.100 Y90.972 E2.7270 F3000
+G1 X128.200 Y90.883 E2.7314 F3000
+G1 X128.300 Y90.793 E2.7359 F3000
+G1 X128.400 Y90.700 E2.7404 F3000
+G1 X128.500 Y90.605 E2.7449 F3000
+G1 X128.600 Y90.509 E2.7495 F3000
+G1 X128.700 Y90.412 E2.7541 F3000
+G1 X128.800 Y90.314 E2.7587 F3000
+G1 X128.900 Y90.215 E2.7633 F3000
+G1 X129.000 Y90.115 E2.7680 F3000
+G1 X129.100 Y90.015 E2.7727 F3000
+G1 X129.200 Y89.915 E2.7773 F3000
+G1 X129.300 Y89.815 E2.7820 F3000
+G1 X129.400 Y89.716 E2.7866 F3000
+G1 X129.500 Y89.617 E2.7913 F3000
+G1 X129.600 Y89.520 E2.7959 F3000
+G1 X129.700 Y89.423 E2.8005 F3000
+G1 X129.800 Y89.328 E2.8050 F3000
+G1 X129.900 Y89.235 E2.8095 F3000
+G1 X130.000 Y89.144 E2.8140 F3000
+G1 X130.100 Y89.054 E2.8184 F3000
+G1 X130.200 Y88.967 E2.8228 F3000
+G1 X130.300 Y88.883 E2.8271 F3000
+G1 X130.400 Y88.802 E2.8314 F3000
+G1 X130.500 Y88.723 E2.8356 F3000
+G1 X130.600 Y88.648 E2.8397 F3000
+G1 X130.700 Y88.576 E2.8438 F3000
+G1 X130.800 Y88.507 E2.8478 F3000
+G1 X130.900 Y88.443 E2.8517 F3000
+G1 X131.000 Y88.382 E2.8556 F3000
+G1 X131.100 Y88.325 E2.8594 F3000
+G1 X131.200 Y88.273 E2.8631 F3000
+G1 X131.300 Y88.224 E2.8668 F3000
+G1 X131.400 Y88.181 E2.8704 F3000
+G1 X131.500 Y88.141 E2.8739 F3000
+G1 X131.600 Y88.107 E2.8774 F3000
+G1 X131.700 Y88.077 E2.8808 F3000
+G1 X131.800 Y88.052 E2.8842 F3000
+G1 X131.900 Y88.032 E2.8876 F3000
+G1 X132.000 Y88.016 E2.8909 F3000
+G1 X132.100 Y88.006 E2.8943 F3000
+G1 X132.200 Y88.001 E2.8976 F3000
+G1 X132.300 Y88.000 E2.9009 F3000
+G1 X132.400 Y88.005 E2.9042 F3000
+G1 X132.500 Y88.015 E2.9075 F3000
+G1 X132.600 Y88.029 E2.9108 F3000
+G1 X132.700 Y88.049 E2.9142 F3000
+G1 X132.800 Y88.073 E2.9176 F3000
+G1 X132.900 Y88.103 E2.9210 F3000
+G1 X133.000 Y88.137 E2.9245 F3000
+G1 X133.100 Y88.175 E2.9280 F3000
+G1 X133.200 Y88.218 E2.9316 F3000
+G1 X133.300 Y88.266 E2.9353 F3000
+G1 X133.400 Y88.318 E2.9390 F3000
+G1 X133.500 Y88.374 E2.9428 F3000
+G1 X133.600 Y88.434 E2.9466 F3000
+G1 X133.700 Y88.499 E2.9506 F3000
+G1 X133.800 Y88.567 E2.9546 F3000
+G1 X133.900 Y88.638 E2.9586 F3000
+G1 X134.000 Y88.713 E2.9627 F3000
+G1 X134.100 Y88.791 E2.9669 F3000
+G1 X134.200 Y88.872 E2.9712 F3000
+G1 X134.300 Y88.956 E2.9755 F3000
+G1 X134.400 Y89.043 E2.9798 F3000
+G1 X134.500 Y89.132 E2.9843 F3000
+G1 X134.600 Y89.223 E2.9887 F3000
+G1 X134.700 Y89.316 E2.9932 F3000
+G1 X134.800 Y89.411 E2.9978 F3000
+G1 X134.900 Y89.507 E3.0024 F3000
+G1 X135.000 Y89.604 E3.0070 F3000
+G1 X135.100 Y89.703 E3.0116 F3000
+G1 X135.200 Y89.802 E3.0163 F3000
+G1 X135.300 Y89.902 E3.0209 F3000
+G1 X135.400 Y90.002 E3.0256 F3000
+G1 X135.500 Y90.102 E3.0302 F3000
+G1 X135.600 Y90.201 E3.0349 F3000
+G1 X135.700 Y90.301 E3.0396 F3000
+G1 X135.800 Y90.399 E3.0442 F3000
+G1 X135.900 Y90.497 E3.0488 F3000
+G1 X136.000 Y90.593 E3.0534 F3000
+G1 X136.100 Y90.687 E3.0579 F3000
+G1 X136.200 Y90.780 E3.0624 F3000
+G1 X136.300 Y90.872 E3.0669 F3000
+G1 X136.400 Y90.960 E3.0713 F3000
+G1 X136.500 Y91.047 E3.0757 F3000
+G1 X136.600 Y91.131 E3.0800 F3000
+G1 X136.700 Y91.212 E3.0842 F3000
+G1 X136.800 Y91.290 E3.0884 F3000
+G1 X136.900 Y91.365 E3.0925 F3000
+G1 X137.000 Y91.436 E3.0966 F3000
+G1 X137.100 Y91.504 E3.1006 F3000
+G1 X137.200 Y91.568 E3.1045 F3000
+G1 X137.300 Y91.628 E3.1083 F3000
+G1 X137.400 Y91.684 E3.1121 F3000
+G1 X137.500 Y91.736 E3.1158 F3000
+G1 X137.600 Y91.783 E3.1195 F3000
+G1 X137.700 Y91.826 E3.1231 F3000
+G1 X137.800 Y91.865 E3.1266 F3000
+G1 X137.900 Y91.899 E3.1301 F3000
+G1 X138.000 Y91.928 E3.1335 F3000
+G1 X138.100 Y91.952 E3.1369 F3000
+G1 X138.200 Y91.971 E3.1403 F3000
+G1 X138.300 Y91.986 E3.1436 F3000
+G1 X138.400 Y91.995 E3.1469 F3000
+G1 X138.500 Y92.000 E3.1502 F3000
+G1 X138.600 Y91.999 E3.1535 F3000
+G1 X138.700 Y91.994 E3.1569 F3000
+G1 X138.800 Y91.983 E3.1602 F3000
+G1 X138.900 Y91.968 E3.1635 F3000
+G1 X139.000 Y91.947 E3.1669 F3000
+G1 X139.100 Y91.922 E3.1703 F3000
+G1 X139.200 Y91.892 E3.1737 F3000
+G1 X139.300 Y91.857 E3.1772 F3000
+G1 X139.400 Y91.818 E3.1808 F3000
+G1 X139.500 Y91.774 E3.1844 F3000
+G1 X139.600 Y91.726 E3.1880 F3000
+G1 X139.700 Y91.673 E3.1918 F3000
+G1 X139.800 Y91.616 E3.1956 F3000
+G1 X139.900 Y91.555 E3.1994 F3000
+G1 X140.000 Y91.490 E3.2034 F3000
+G1 X140.100 Y91.422 E3.2074 F3000
+G1 X140.200 Y91.350 E3.2114 F3000
+G1 X140.300 Y91.274 E3.2156 F3000
+G1 X140.400 Y91.196 E3.2198 F3000
+G1 X140.500 Y91.114 E3.2240 F3000
+G1 X140.600 Y91.029 E3.2283 F3000
+G1 X140.700 Y90.942 E3.2327 F3000
+G1 X140.800 Y90.853 E3.2371 F3000
+G1 X140.900 Y90.762 E3.2416 F3000
+G1 X141.000 Y90.668 E3.2461 F3000
+G1 X141.100 Y90.573 E3.2507 F3000
+G1 X141.200 Y90.477 E3.2553 F3000
+G1 X141.300 Y90.379 E3.2599 F3000
+G1 X141.400 Y90.280 E3.2645 F3000
+G1 X141.500 Y90.181 E3.2692 F3000
+G1 X141.600 Y90.081 E3.2738 F3000
+G1 X141.700 Y89.981 E3.2785 F3000
+G1 X141.800 Y89.881 E3.2832 F3000
+G1 X141.900 Y89.782 E3.2878 F3000
+G1 X142.000 Y89.683 E3.2925 F3000
+G1 X142.100 Y89.584 E3.2971 F3000
+G1 X142.200 Y89.487 E3.3017 F3000
+G1 X142.300 Y89.391 E3.3063 F3000
+G1 X142.400 Y89.297 E3.3108 F3000
+G1 X142.500 Y89.204 E3.3153 F3000
+G1 X142.600 Y89.113 E3.3198 F3000
+G1 X142.700 Y89.025 E3.3242 F3000
+G1 X142.800 Y88.939 E3.3285 F3000
+G1 X142.900 Y88.855 E3.3328 F3000
+G1 X143.000 Y88.775 E3.3371 F3000
+G1 X143.100 Y88.697 E3.3412 F3000
+G1 X143.200 Y88.623 E3.3453 F3000
+G1 X143.300 Y88.552 E3.3494 F3000
+G1 X143.400 Y88.485 E3.3534 F3000
+G1 X143.500 Y88.422 E3.3573 F3000
+G1 X143.600 Y88.362 E3.3611 F3000
+G1 X143.700 Y88.307 E3.3649 F3000
+G1 X143.800 Y88.256 E3.3686 F3000
+G1 X143.900 Y88.209 E3.3722 F3000
+G1 X144.000 Y88.167 E3.3758 F3000
+G1 X144.100 Y88.129 E3.3793 F3000
+G1 X144.200 Y88.096 E3.3828 F3000
+G1 X144.300 Y88.068 E3.3862 F3000
+G1 X144.400 Y88.045 E3.3896 F3000
+G1 X144.500 Y88.026 E3.3930 F3000
+G1 X144.600 Y88.012 E3.3963 F3000
+G1 X144.700 Y88.004 E3.3996 F3000
+G1 X144.800 Y88.000 E3.4029 F3000
+G1 X144.900 Y88.001 E3.4062 F3000
+G1 X145.000 Y88.008 E3.4095 F3000
+G1 X145.100 Y88.019 E3.4129 F3000
+G1 X145.200 Y88.035 E3.4162 F3000
+G1 X145.300 Y88.057 E3.4196 F3000
+G1 X145.400 Y88.083 E3.4230 F3000
+G1 X145.500 Y88.113 E3.4264 F3000
+G1 X145.600 Y88.149 E3.4299 F3000
+G1 X145.700 Y88.189 E3.4335 F3000
+G1 X145.800 Y88.234 E3.4371 F3000
+G1 X145.900 Y88.283 E3.4408 F3000
+G1 X146.000 Y88.336 E3.4445 F3000
+G1 X146.100 Y88.394 E3.4483 F3000
+G1 X146.200 Y88.456 E3.4522 F3000
+G1 X146.300 Y88.521 E3.4562 F3000
+G1 X146.400 Y88.590 E3.4602 F3000
+G1 X146.500 Y88.663 E3.4642 F3000
+G1 X146.600 Y88.739 E3.4684 F3000
+G1 X146.700 Y88.818 E3.4726 F3000
+G1 X146.800 Y88.900 E3.4769 F3000
+G1 X146.900 Y88.985 E3.4812 F3000
+G1 X147.000 Y89.072 E3.4856 F3000
+G1 X147.100 Y89.162 E3.4900 F3000
+G1 X147.200 Y89.254 E3.4945 F3000
+G1 X147.300 Y89.348 E3.4990 F3000
+G1 X147.400 Y89.443 E3.5036 F3000
+G1 X147.500 Y89.540 E3.5082 F3000
+G1 X147.600 Y89.637 E3.5128 F3000
+G1 X147.700 Y89.736 E3.5174 F3000
+G1 X147.800 Y89.836 E3.5221 F3000
+G1 X147.900 Y89.935 E3.5267 F3000
+G1 X148.000 Y90.035 E3.5314 F3000
+G1 X148.100 Y90.135 E3.5361 F3000
+G1 X148.200 Y90.235 E3.5407 F3000
+G1 X148.300 Y90.334 E3.5454 F3000
+G1 X148.400 Y90.432 E3.5500 F3000
+G1 X148.500 Y90.529 E3.5546 F3000
+G1 X148.600 Y90.625 E3.5592 F3000
+G1 X148.700 Y90.719 E3.5637 F3000
+G1 X148.800 Y90.811 E3.5682 F3000
+G1 X148.900 Y90.902 E3.5726 F3000
+G1 X149.000 Y90.990 E3.5770 F3000
+G1 X149.100 Y91.075 E3.5814 F3000
+G1 X149.200 Y91.158 E3.5857 F3000
+G1 X149.300 Y91.238 E3.5899 F3000
+G1 X149.400 Y91.315 E3.5940 F3000
+G1 X149.500 Y91.389 E3.5981 F3000
+G1 X149.600 Y91.459 E3.6022 F3000
+G1 X149.700 Y91.526 E3.6061 F3000
+G1 X149.800 Y91.588 E3.6100 F3000
+G1 X149.900 Y91.647 E3.6139 F3000
+G1 X150.000 Y91.702 E3.6176 F3000
+G1 X150.100 Y91.752 E3.6213 F3000
+G1 X150.200 Y91.798 E3.6250 F3000
+G1 X150.300 Y91.840 E3.6285 F3000
+G1 X150.400 Y91.877 E3.6320 F3000
+G1 X150.500 Y91.909 E3.6355 F3000
+G1 X150.600 Y91.936 E3.6389 F3000
+G1 X150.700 Y91.959 E3.6423 F3000
+G1 X150.800 Y91.977 E3.6457 F3000
+G1 X150.900 Y91.989 E3.6490 F3000
+G1 X151.000 Y91.997 E3.6523 F3000
+G1 X151.100 Y92.000 E3.6556 F3000
+G1 X151.200 Y91.998 E3.6589 F3000
+G1 X151.300 Y91.991 E3.6622 F3000
+G1 X151.400 Y91.978 E3.6655 F3000
+G1 X151.500 Y91.961 E3.6689 F3000
+G1 X151.600 Y91.939 E3.6723 F3000
+G1 X151.700 Y91.912 E3.6757 F3000
+G1 X151.800 Y91.881 E3.6791 F3000
+G1 X151.900 Y91.845 E3.6827 F3000
+G1 X152.000 Y91.804 E3.6862 F3000
+G1 X152.100 Y91.758 E3.6898 F3000
+G1 X152.200 Y91.708 E3.6935 F3000
+G1 X152.300 Y91.654 E3.6973 F3000
+G1 X152.400 Y91.596 E3.7011 F3000
+G1 X152.500 Y91.534 E3.7050 F3000
+G1 X152.600 Y91.468 E3.7089 F3000
+G1 X152.700 Y91.398 E3.7130 F3000
+G1 X152.800 Y91.325 E3.7171 F3000
+G1 X152.900 Y91.248 E3.7212 F3000
+G1 X153.000 Y91.168 E3.7254 F3000
+G1 X153.100 Y91.086 E3.7297 F3000
+G1 X153.200 Y91.001 E3.7341 F3000
+G1 X153.300 Y90.913 E3.7384 F3000
+G1 X153.400 Y90.823 E3.7429 F3000
+G1 X153.500 Y90.730 E3.7474 F3000
+G1 X153.600 Y90.637 E3.7519 F3000
+G1 X153.700 Y90.541 E3.7565 F3000
+G1 X153.800 Y90.444 E3.7611 F3000
+G1 X153.900 Y90.346 E3.7657 F3000
+G1 X154.000 Y90.247 E3.7703 F3000
+G1 X154.100 Y90.148 E3.7750 F3000
+G1 X154.200 Y90.048 E3.7796 F3000
+G1 X154.300 Y89.948 E3.7843 F3000
+G1 X154.400 Y89.848 E3.7890 F3000
+G1 X154.500 Y89.748 E3.7936 F3000
+G1 X154.600 Y89.650 E3.7983 F3000
+G1 X154.700 Y89.552 E3.8029 F3000
+G1 X154.800 Y89.455 E3.8075 F3000
+G1 X154.900 Y89.359 E3.8120 F3000
+G1 X155.000 Y89.265 E3.8166 F3000
+G1 X155.100 Y89.173 E3.8211 F3000
+G1 X155.200 Y89.083 E3.8255 F3000
+G1 X155.300 Y88.996 E3.8299 F3000
+G1 X155.400 Y88.910 E3.8342 F3000
+G1 X155.500 Y88.828 E3.8385 F3000
+G1 X155.600 Y88.748 E3.8427 F3000
+G1 X155.700 Y88.672 E3.8469 F3000
+G1 X155.800 Y88.599 E3.8510 F3000
+G1 X155.900 Y88.529 E3.8550 F3000
+G1 X156.000 Y88.463 E3.8589 F3000
+G1 X156.100 Y88.401 E3.8628 F3000
+G1 X156.200 Y88.343 E3.8666 F3000
+G1 X156.300 Y88.289 E3.8704 F3000
+G1 X156.400 Y88.240 E3.8741 F3000
+G1 X156.500 Y88.195 E3.8777 F3000
+G1 X156.600 Y88.154 E3.8812 F3000
+G1 X156.700 Y88.118 E3.8848 F3000
+G1 X156.800 Y88.086 E3.8882 F3000
+G1 X156.900 Y88.060 E3.8916 F3000
+G1 X157.000 Y88.038 E3.8950 F3000
+G1 X157.100 Y88.021 E3.8984 F3000
+G1 X157.200 Y88.009 E3.9017 F3000
+G1 X157.300 Y88.002 E3.9050 F3000
+G1 X157.400 Y88.000 E3.9083 F3000
+G1 X157.500 Y88.003 E3.9116 F3000
+G1 X157.600 Y88.011 E3.9149 F3000
+G1 X157.700 Y88.024 E3.9182 F3000
+G1 X157.800 Y88.042 E3.9216 F3000
+G1 X157.900 Y88.065 E3.9250 F3000
+G1 X158.000 Y88.092 E3.9284 F3000
+G1 X158.100 Y88.125 E3.9319 F3000
+G1 X158.200 Y88.162 E3.9354 F3000
+G1 X158.300 Y88.204 E3.9390 F3000
+G1 X158.400 Y88.250 E3.9426 F3000
+G1 X158.500 Y88.301 E3.9463 F3000
+G1 X158.600 Y88.355 E3.9500 F3000
+G1 X158.700 Y88.414 E3.9539 F3000
+G1 X158.800 Y88.477 E3.9578 F3000
+G1 X158.900 Y88.544 E3.9617 F3000
+G1 X159.000 Y88.614 E3.9658 F3000
+G1 X159.100 Y88.688 E3.9699 F3000
+G1 X159.200 Y88.765 E3.9740 F3000
+G1 X159.300 Y88.845 E3.9783 F3000
+G1 X159.400 Y88.928 E3.9826 F3000
+G1 X159.500 Y89.014 E3.9869 F3000
+G1 X159.600 Y89.102 E3.9913 F3000
+G1 X159.700 Y89.193 E3.9958 F3000
+G1 X159.800 Y89.285 E4.0003 F3000
+G1 X159.900 Y89.379 E4.0048 F3000
+G1 X160.000 Y91.475 E4.0740 F3000
+G1 X159.900 Y91.572 E4.0786 F3000
+G1 X159.800 Y91.671 E4.0833 F3000
+G1 X159.700 Y91.770 E4.0879 F3000
+G1 X159.600 Y91.869 E4.0926 F3000
+G1 X159.500 Y91.969 E4.0972 F3000
+G1 X159.400 Y92.069 E4.1019 F3000
+G1 X159.300 Y92.169 E4.1066 F3000
+G1 X159.200 Y92.268 E4.1112 F3000
+G1 X159.100 Y92.367 E4.1158 F3000
+G1 X159.000 Y92.465 E4.1205 F3000
+G1 X158.900 Y92.561 E4.1250 F3000
+G1 X158.800 Y92.657 E4.1296 F3000
+G1 X158.700 Y92.750 E4.1341 F3000
+G1 X158.600 Y92.842 E4.1386 F3000
+G1 X158.500 Y92.932 E4.1430 F3000
+G1 X158.400 Y93.019 E4.1474 F3000
+G1 X158.300 Y93.104 E4.1517 F3000
+G1 X158.200 Y93.186 E4.1560 F3000
+G1 X158.100 Y93.265 E4.1602 F3000
+G1 X158.000 Y93.340 E4.1644 F3000
+G1 X157.900 Y93.413 E4.1684 F3000
+G1 X157.800 Y93.482 E4.1724 F3000
+G1 X157.700 Y93.547 E4.1764 F3000
+G1 X157.600 Y93.609 E4.1803 F3000
+G1 X157.500 Y93.666 E4.1841 F3000
+G1 X157.400 Y93.719 E4.1878 F3000
+G1 X157.300 Y93.768 E4.1915 F3000
+G1 X157.200 Y93.813 E4.1951 F3000
+G1 X157.100 Y93.853 E4.1986 F3000
+G1 X157.000 Y93.888 E4.2021 F3000
+G1 X156.900 Y93.919 E4.2056 F3000
+G1 X156.800 Y93.944 E4.2090 F3000
+G1 X156.700 Y93.965 E4.2124 F3000
+G1 X156.600 Y93.981 E4.2157 F3000
+G1 X156.500 Y93.993 E4.2190 F3000
+G1 X156.400 Y93.999 E4.2223 F3000
+G1 X156.300 Y94.000 E4.2256 F3000
+G1 X156.200 Y93.996 E4.2289 F3000
+G1 X156.100 Y93.987 E4.2323 F3000
+G1 X156.000 Y93.973 E4.2356 F3000
+G1 X155.900 Y93.954 E4.2389 F3000
+G1 X155.800 Y93.931 E4.2423 F3000
+G1 X155.700 Y93.902 E4.2458 F3000
+G1 X155.600 Y93.869 E4.2492 F3000
+G1 X155.500 Y93.831 E4.2528 F3000
+G1 X155.400 Y93.789 E4.2564 F3000
+G1 X155.300 Y93.742 E4.2600 F3000
+G1 X155.200 Y93.691 E4.2637 F3000
+G1 X155.100 Y93.635 E4.2675 F3000
+G1 X155.000 Y93.575 E4.2713 F3000
+G1 X154.900 Y93.512 E4.2752 F3000
+G1 X154.800 Y93.445 E4.2792 F3000
+G1 X154.700 Y93.374 E4.2833 F3000
+G1 X154.600 Y93.299 E4.2874 F3000
+G1 X154.500 Y93.222 E4.2915 F3000
+G1 X154.400 Y93.141 E4.2958 F3000
+G1 X154.300 Y93.057 E4.3001 F3000
+G1 X154.200 Y92.971 E4.3044 F3000
+G1 X154.100 Y92.883 E4.3089 F3000
+G1 X154.000 Y92.792 E4.3133 F3000
+G1 X153.900 Y92.699 E4.3178 F3000
+G1 X153.800 Y92.605 E4.3224 F3000
+G1 X153.700 Y92.509 E4.3269 F3000
+G1 X153.600 Y92.411 E4.3315 F3000
+G1 X153.500 Y92.313 E4.3362 F3000
+G1 X153.400 Y92.214 E4.3408 F3000
+G1 X153.300 Y92.114 E4.3455 F3000
+G1 X153.200 Y92.014 E4.3501 F3000
+G1 X153.100 Y91.914 E4.3548 F3000
+G1 X153.000 Y91.814 E4.3595 F3000
+G1 X152.900 Y91.715 E4.3641 F3000
+G1 X152.800 Y91.617 E4.3687 F3000
+G1 X152.700 Y91.519 E4.3734 F3000
+G1 X152.600 Y91.422 E4.3779 F3000
+G1 X152.500 Y91.328 E4.3825 F3000
+G1 X152.400 Y91.234 E4.3870 F3000
+G1 X152.300 Y91.143 E4.3915 F3000
+G1 X152.200 Y91.054 E4.3959 F3000
+G1 X152.100 Y90.967 E4.4003 F3000
+G1 X152.000 Y90.882 E4.4046 F3000
+G1 X151.900 Y90.801 E4.4088 F3000
+G1 X151.800 Y90.722 E4.4130 F3000
+G1 X151.700 Y90.647 E4.4172 F3000
+G1 X151.600 Y90.575 E4.4212 F3000
+G1 X151.500 Y90.507 E4.4252 F3000
+G1 X151.400 Y90.442 E4.4292 F3000
+G1 X151.300 Y90.381 E4.4330 F3000
+G1 X151.200 Y90.325 E4.4368 F3000
+G1 X151.100 Y90.272 E4.4405 F3000
+G1 X151.000 Y90.224 E4.4442 F3000
+G1 X150.900 Y90.180 E4.4478 F3000
+G1 X150.800 Y90.141 E4.4514 F3000
+G1 X150.700 Y90.107 E4.4548 F3000
+G1 X150.600 Y90.077 E4.4583 F3000
+G1 X150.500 Y90.052 E4.4617 F3000
+G1 X150.400 Y90.032 E4.4651 F3000
+G1 X150.300 Y90.016 E4.4684 F3000
+G1 X150.200 Y90.006 E4.4717 F3000
+G1 X150.100 Y90.001 E4.4750 F3000
+G1 X150.000 Y90.000 E4.4783 F3000
+G1 X149.900 Y90.005 E4.4816 F3000
+G1 X149.800 Y90.015 E4.4849 F3000
+G1 X149.700 Y90.030 E4.4883 F3000
+G1 X149.600 Y90.049 E4.4916 F3000
+G1 X149.500 Y90.074 E4.4950 F3000
+G1 X149.400 Y90.103 E4.4985 F3000
+G1 X149.300 Y90.137 E4.5020 F3000
+G1 X149.200 Y90.176 E4.5055 F3000
+G1 X149.100 Y90.219 E4.5091 F3000
+G1 X149.000 Y90.266 E4.5127 F3000
+G1 X148.900 Y90.318 E4.5165 F3000
+G1 X148.800 Y90.375 E4.5202 F3000
+G1 X148.700 Y90.435 E4.5241 F3000
+G1 X148.600 Y90.499 E4.5280 F3000
+G1 X148.500 Y90.567 E4.5320 F3000
+G1 X148.400 Y90.639 E4.5361 F3000
+G1 X148.300 Y90.714 E4.5402 F3000
+G1 X148.200 Y90.792 E4.5444 F3000
+G1 X148.100 Y90.873 E4.5486 F3000
+G1 X148.000 Y90.957 E4.5529 F3000
+G1 X147.900 Y91.043 E4.5573 F3000
+G1 X147.800 Y91.132 E4.5617 F3000
+G1 X147.700 Y91.224 E4.5662 F3000
+G1 X147.600 Y91.317 E4.5707 F3000
+G1 X147.500 Y91.412 E4.5752 F3000
+G1 X147.400 Y91.508 E4.5798 F3000
+G1 X147.300 Y91.605 E4.5844 F3000
+G1 X147.200 Y91.704 E4.5891 F3000
+G1 X147.100 Y91.803 E4.5937 F3000
+G1 X147.000 Y91.903 E4.5984 F3000
+G1 X146.900 Y92.003 E4.6030 F3000
+G1 X146.800 Y92.103 E4.6077 F3000
+G1 X146.700 Y92.202 E4.6124 F3000
+G1 X146.600 Y92.302 E4.6170 F3000
+G1 X146.500 Y92.400 E4.6216 F3000
+G1 X146.400 Y92.497 E4.6263 F3000
+G1 X146.300 Y92.594 E4.6308 F3000
+G1 X146.200 Y92.688 E4.6354 F3000
+G1 X146.100 Y92.781 E4.6399 F3000
+G1 X146.000 Y92.872 E4.6443 F3000
+G1 X145.900 Y92.961 E4.6488 F3000
+G1 X145.800 Y93.048 E4.6531 F3000
+G1 X145.700 Y93.131 E4.6574 F3000
+G1 X145.600 Y93.212 E4.6617 F3000
+G1 X145.500 Y93.290 E4.6659 F3000
+G1 X145.400 Y93.365 E4.6700 F3000
+G1 X145.300 Y93.437 E4.6740 F3000
+G1 X145.200 Y93.504 E4.6780 F3000
+G1 X145.100 Y93.568 E4.6819 F3000
+G1 X145.000 Y93.628 E4.6858 F3000
+G1 X144.900 Y93.684 E4.6896 F3000
+G1 X144.800 Y93.736 E4.6933 F3000
+G1 X144.700 Y93.784 E4.6969 F3000
+G1 X144.600 Y93.827 E4.7005 F3000
+G1 X144.500 Y93.865 E4.7041 F3000
+G1 X144.400 Y93.899 E4.7076 F3000
+G1 X144.300 Y93.928 E4.7110 F3000
+G1 X144.200 Y93.952 E4.7144 F3000
+G1 X144.100 Y93.971 E4.7177 F3000
+G1 X144.000 Y93.986 E4.7211 F3000
+G1 X143.900 Y93.995 E4.7244 F3000
+G1 X143.800 Y94.000 E4.7277 F3000
+G1 X143.700 Y93.999 E4.7310 F3000
+G1 X143.600 Y93.994 E4.7343 F3000
+G1 X143.500 Y93.983 E4.7376 F3000
+G1 X143.400 Y93.967 E4.7410 F3000
+G1 X143.300 Y93.947 E4.7443 F3000
+G1 X143.200 Y93.922 E4.7477 F3000
+G1 X143.100 Y93.892 E4.7512 F3000
+G1 X143.000 Y93.857 E4.7547 F3000
+G1 X142.900 Y93.817 E4.7582 F3000
+G1 X142.800 Y93.773 E4.7618 F3000
+G1 X142.700 Y93.725 E4.7655 F3000
+G1 X142.600 Y93.672 E4.7692 F3000
+G1 X142.500 Y93.615 E4.7730 F3000
+G1 X142.400 Y93.554 E4.7769 F3000
+G1 X142.300 Y93.490 E4.7808 F3000
+G1 X142.200 Y93.421 E4.7848 F3000
+G1 X142.100 Y93.349 E4.7889 F3000
+G1 X142.000 Y93.273 E4.7930 F3000
+G1 X141.900 Y93.195 E4.7972 F3000
+G1 X141.800 Y93.113 E4.8015 F3000
+G1 X141.700 Y93.029 E4.8058 F3000
+G1 X141.600 Y92.942 E4.8102 F3000
+G1 X141.500 Y92.852 E4.8146 F3000
+G1 X141.400 Y92.761 E4.8191 F3000
+G1 X141.300 Y92.667 E4.8236 F3000
+G1 X141.200 Y92.572 E4.8281 F3000
+G1 X141.100 Y92.476 E4.8327 F3000
+G1 X141.000 Y92.378 E4.8373 F3000
+G1 X140.900 Y92.280 E4.8420 F3000
+G1 X140.800 Y92.180 E4.8466 F3000
+G1 X140.700 Y92.080 E4.8513 F3000
+G1 X140.600 Y91.981 E4.8560 F3000
+G1 X140.500 Y91.881 E4.8606 F3000
+G1 X140.400 Y91.781 E4.8653 F3000
+G1 X140.300 Y91.682 E4.8699 F3000
+G1 X140.200 Y91.584 E4.8745 F3000
+G1 X140.100 Y91.486 E4.8792 F3000
+G1 X140.000 Y91.390 E4.8837 F3000
+G1 X139.900 Y91.296 E4.8883 F3000
+G1 X139.800 Y91.203 E4.8928 F3000
+G1 X139.700 Y91.113 E4.8972 F3000
+G1 X139.600 Y91.024 E4.9016 F3000
+G1 X139.500 Y90.938 E4.9060 F3000
+G1 X139.400 Y90.855 E4.9103 F3000
+G1 X139.300 Y90.774 E4.9145 F3000
+G1 X139.200 Y90.697 E4.9187 F3000
+G1 X139.100 Y90.623 E4.9228 F3000
+G1 X139.000 Y90.552 E4.9268 F3000
+G1 X138.900 Y90.485 E4.9308 F3000
+G1 X138.800 Y90.421 E4.9347 F3000
+G1 X138.700 Y90.362 E4.9386 F3000
+G1 X138.600 Y90.307 E4.9423 F3000
+G1 X138.500 Y90.256 E4.9460 F3000
+G1 X138.400 Y90.209 E4.9497 F3000
+G1 X138.300 Y90.167 E4.9533 F3000
+G1 X138.200 Y90.129 E4.9568 F3000
+G1 X138.100 Y90.096 E4.9603 F3000
+G1 X138.000 Y90.068 E4.9637 F3000
+G1 X137.900 Y90.044 E4.9671 F3000
+G1 X137.800 Y90.026 E4.9704 F3000
+G1 X137.700 Y90.012 E4.9738 F3000
+G1 X137.600 Y90.004 E4.9771 F3000
+G1 X137.500 Y90.000 E4.9804 F3000
+G1 X137.400 Y90.002 E4.9837 F3000
+G1 X137.300 Y90.008 E4.9870 F3000
+G1 X137.200 Y90.019 E4.9903 F3000
+G1 X137.100 Y90.036 E4.9936 F3000
+G1 X137.000 Y90.057 E4.9970 F3000
+G1 X136.900 Y90.083 E5.0004 F3000
+G1 X136.800 Y90.114 E5.0039 F3000
+G1 X136.700 Y90.149 E5.0074 F3000
+G1 X136.600 Y90.190 E5.0109 F3000
+G1 X136.500 Y90.234 E5.0146 F3000
+G1 X136.400 Y90.283 E5.0182 F3000
+G1 X136.300 Y90.337 E5.0220 F3000
+G1 X136.200 Y90.395 E5.0258 F3000
+G1 X136.100 Y90.456 E5.0297 F3000
+G1 X136.000 Y90.522 E5.0336 F3000
+G1 X135.900 Y90.591 E5.0376 F3000
+G1 X135.800 Y90.664 E5.0417 F3000
+G1 X135.700 Y90.740 E5.0458 F3000
+G1 X135.600 Y90.819 E5.0501 F3000
+G1 X135.500 Y90.901 E5.0543 F3000
+G1 X135.400 Y90.986 E5.0587 F3000
+G1 X135.300 Y91.073 E5.0630 F3000
+G1 X135.200 Y91.163 E5.0675 F3000
+G1 X135.100 Y91.255 E5.0720 F3000
+G1 X135.000 Y91.348 E5.0765 F3000
+G1 X134.900 Y91.444 E5.0810 F3000
+G1 X134.800 Y91.540 E5.0856 F3000
+G1 X134.700 Y91.638 E5.0902 F3000
+G1 X134.600 Y91.737 E5.0949 F3000
+G1 X134.500 Y91.836 E5.0995 F3000
+G1 X134.400 Y91.936 E5.1042 F3000
+G1 X134.300 Y92.036 E5.1089 F3000
+G1 X134.200 Y92.136 E5.1135 F3000
+G1 X134.100 Y92.236 E5.1182 F3000
+G1 X134.000 Y92.335 E5.1228 F3000
+G1 X133.900 Y92.433 E5.1274 F3000
+G1 X133.800 Y92.530 E5.1320 F3000
+G1 X133.700 Y92.626 E5.1366 F3000
+G1 X133.600 Y92.720 E5.1411 F3000
+G1 X133.500 Y92.812 E5.1456 F3000
+G1 X133.400 Y92.902 E5.1501 F3000
+G1 X133.300 Y92.991 E5.1545 F3000
+G1 X133.200 Y93.076 E5.1588 F3000
+G1 X133.100 Y93.159 E5.1631 F3000
+G1 X133.000 Y93.239 E5.1673 F3000
+G1 X132.900 Y93.316 E5.1715 F3000
+G1 X132.800 Y93.390 E5.1756 F3000
+G1 X132.700 Y93.460 E5.1796 F3000
+G1 X132.600 Y93.526 E5.1836 F3000
+G1 X132.500 Y93.589 E5.1875 F3000
+G1 X132.400 Y93.648 E5.1913 F3000
+G1 X132.300 Y93.702 E5.1951 F3000
+G1 X132.200 Y93.753 E5.1988 F3000
+G1 X132.100 Y93.799 E5.2024 F3000
+G1 X132.000 Y93.840 E5.2060 F3000
+G1 X131.900 Y93.877 E5.2095 F3000
+G1 X131.800 Y93.909 E5.2130 F3000
+G1 X131.700 Y93.937 E5.2164 F3000
+G1 X131.600 Y93.959 E5.2198 F3000
+G1 X131.500 Y93.977 E5.2231 F3000
+G1 X131.400 Y93.989 E5.2264 F3000
+G1 X131.300 Y93.997 E5.2298 F3000
+G1 X131.200 Y94.000 E5.2331 F3000
+G1 X131.100 Y93.998 E5.2364 F3000
+G1 X131.000 Y93.991 E5.2397 F3000
+G1 X130.900 Y93.978 E5.2430 F3000
+G1 X130.800 Y93.961 E5.2463 F3000
+G1 X130.700 Y93.939 E5.2497 F3000
+G1 X130.600 Y93.912 E5.2531 F3000
+G1 X130.500 Y93.881 E5.2566 F3000
+G1 X130.400 Y93.844 E5.2601 F3000
+G1 X130.300 Y93.803 E5.2637 F3000
+G1 X130.200 Y93.758 E5.2673 F3000
+G1 X130.100 Y93.708 E5.2710 F3000
+G1 X130.000 Y93.654 E5.2747 F3000
+G1 X129.900 Y93.595 E5.2786 F3000
+G1 X129.800 Y93.533 E5.2824 F3000
+G1 X129.700 Y93.467 E5.2864 F3000
+G1 X129.600 Y93.397 E5.2904 F3000
+G1 X129.500 Y93.324 E5.2945 F3000
+G1 X129.400 Y93.247 E5.2987 F3000
+G1 X129.300 Y93.168 E5.3029 F3000
+G1 X129.200 Y93.085 E5.3072 F3000
+G1 X129.100 Y93.000 E5.3115 F3000
+G1 X129.000 Y92.912 E5.3159 F3000
+G1 X128.900 Y92.822 E5.3203 F3000
+G1 X128.800 Y92.730 E5.3248 F3000
+G1 X128.700 Y92.636 E5.3294 F3000
+G1 X128.600 Y92.540 E5.3339 F3000
+G1 X128.500 Y92.443 E5.3385 F3000
+G1 X128.400 Y92.345 E5.3431 F3000
+G1 X128.300 Y92.246 E5.3478 F3000
+G1 X128.200 Y92.147 E5.3524 F3000
+G1 X128.100 Y92.047 E5.3571 F3000
+G1 X128.000 Y91.947 E5.3618 F3000
+G1 X127.900 Y91.847 E5.3664 F3000
+G1 X127.800 Y91.748 E5.3711 F3000
+G1 X127.700 Y91.649 E5.3757 F3000
+G1 X127.600 Y91.551 E5.3803 F3000
+G1 X127.500 Y91.454 E5.3849 F3000
+G1 X127.400 Y91.358 E5.3895 F3000
+G1 X127.300 Y91.265 E5.3940 F3000
+G1 X127.200 Y91.173 E5.3985 F3000
+G1 X127.100 Y91.083 E5.4030 F3000
+G1 X127.000 Y90.995 E5.4073 F3000
+G1 X126.900 Y90.910 E5.4117 F3000
+G1 X126.800 Y90.827 E5.4160 F3000
+G1 X126.700 Y90.748 E5.4202 F3000
+G1 X126.600 Y90.671 E5.4243 F3000
+G1 X126.500 Y90.598 E5.4284 F3000
+G1 X126.400 Y90.529 E5.4324 F3000
+G1 X126.300 Y90.463 E5.4364 F3000
+G1 X126.200 Y90.401 E5.4403 F3000
+G1 X126.100 Y90.343 E5.4441 F3000
+G1 X126.000 Y90.289 E5.4478 F3000
+G1 X125.900 Y90.239 E5.4515 F3000
+G1 X125.800 Y90.194 E5.4551 F3000
+G1 X125.700 Y90.153 E5.4587 F3000
+G1 X125.600 Y90.117 E5.4622 F3000
+G1 X125.500 Y90.086 E5.4657 F3000
+G1 X125.400 Y90.059 E5.4691 F3000
+G1 X125.300 Y90.038 E5.4725 F3000
+G1 X125.200 Y90.021 E5.4758 F3000
+G1 X125.100 Y90.009 E5.4791 F3000
+G1 X125.000 Y90.002 E5.4824 F3000
+G1 X124.900 Y90.000 E5.4857 F3000
+G1 X124.800 Y90.003 E5.4890 F3000
+G1 X124.700 Y90.011 E5.4923 F3000
+G1 X124.600 Y90.024 E5.4957 F3000
+G1 X124.500 Y90.042 E5.4990 F3000
+G1 X124.400 Y90.065 E5.5024 F3000
+G1 X124.300 Y90.093 E5.5058 F3000
+G1 X124.200 Y90.125 E5.5093 F3000
+G1 X124.100 Y90.162 E5.5128 F3000
+G1 X124.000 Y90.204 E5.5164 F3000
+G1 X123.900 Y90.250 E5.5200 F3000
+G1 X123.800 Y90.301 E5.5237 F3000
+G1 X123.700 Y90.356 E5.5275 F3000
+G1 X123.600 Y90.415 E5.5313 F3000
+G1 X123.500 Y90.478 E5.5352 F3000
+G1 X123.400 Y90.544 E5.5392 F3000
+G1 X123.300 Y90.615 E5.5432 F3000
+G1 X123.200 Y90.689 E5.5473 F3000
+G1 X123.100 Y90.766 E5.5515 F3000
+G1 X123.000 Y90.846 E5.5557 F3000
+G1 X122.900 Y90.929 E5.5600 F3000
+G1 X122.800 Y91.015 E5.5644 F3000
+G1 X122.700 Y91.103 E5.5688 F3000
+G1 X122.600 Y91.194 E5.5732 F3000
+G1 X122.500 Y91.286 E5.5777 F3000
+G1 X122.400 Y91.380 E5.5823 F3000
+G1 X122.300 Y91.476 E5.5868 F3000
+G1 X122.200 Y91.573 E5.5914 F3000
+G1 X122.100 Y91.671 E5.5960 F3000
+G1 X122.000 Y91.770 E5.6007 F3000
+G1 X121.900 Y91.870 E5.6053 F3000
+G1 X121.800 Y91.970 E5.6100 F3000
+G1 X121.700 Y92.070 E5.6147 F3000
+G1 X121.600 Y92.170 E5.6193 F3000
+G1 X121.500 Y92.269 E5.6240 F3000
+G1 X121.400 Y92.368 E5.6286 F3000
+G1 X121.300 Y92.466 E5.6332 F3000
+G1 X121.200 Y92.562 E5.6378 F3000
+G1 X121.100 Y92.657 E5.6424 F3000
+G1 X121.000 Y92.751 E5.6469 F3000
+G1 X120.900 Y92.843 E5.6514 F3000
+G1 X120.800 Y92.932 E5.6558 F3000
+G1 X120.700 Y93.020 E5.6602 F3000
+G1 X120.600 Y93.104 E5.6645 F3000
+G1 X120.500 Y93.186 E5.6688 F3000
+G1 X120.400 Y93.265 E5.6730 F3000
+G1 X120.300 Y93.341 E5.6771 F3000
+G1 X120.200 Y93.414 E5.6812 F3000
+G1 X120.100 Y93.483 E5.6852 F3000
+G1 X120.000 Y93.548 E5.6892 F3000
+G1 X119.900 Y93.609 E5.6930 F3000
+G1 X119.800 Y93.667 E5.6968 F3000
+G1 X119.700 Y93.720 E5.7006 F3000
+G1 X119.600 Y93.769 E5.7043 F3000
+G1 X119.500 Y93.813 E5.7079 F3000
+G1 X119.400 Y93.853 E5.7114 F3000
+G1 X119.300 Y93.888 E5.7149 F3000
+G1 X119.200 Y93.919 E5.7184 F3000
+G1 X119.100 Y93.945 E5.7218 F3000
+G1 X119.000 Y93.966 E5.7251 F3000
+G1 X118.900 Y93.982 E5.7285 F3000
+G1 X118.800 Y93.993 E5.7318 F3000
+G1 X118.700 Y93.999 E5.7351 F3000
+G1 X118.600 Y94.000 E5.7384 F3000
+G1 X118.500 Y93.996 E5.7417 F3000
+G1 X118.400 Y93.987 E5.7450 F3000
+G1 X118.300 Y93.973 E5.7484 F3000
+G1 X118.200 Y93.954 E5.7517 F3000
+G1 X118.100 Y93.931 E5.7551 F3000
+G1 X118.000 Y93.902 E5.7585 F3000
+G1 X117.900 Y93.869 E5.7620 F3000
+G1 X117.800 Y93.831 E5.7655 F3000
+G1 X117.700 Y93.788 E5.7691 F3000
+G1 X117.600 Y93.741 E5.7728 F3000
+G1 X117.500 Y93.690 E5.7765 F3000
+G1 X117.400 Y93.635 E5.7803 F3000
+G1 X117.300 Y93.575 E5.7841 F3000
+G1 X117.200 Y93.511 E5.7880 F3000
+G1 X117.100 Y93.444 E5.7920 F3000
+G1 X117.000 Y93.373 E5.7960 F3000
+G1 X116.900 Y93.299 E5.8002 F3000
+G1 X116.800 Y93.221 E5.8043 F3000
+G1 X116.700 Y93.140 E5.8086 F3000
+G1 X116.600 Y93.057 E5.8129 F3000
+G1 X116.500 Y92.970 E5.8172 F3000
+G1 X116.400 Y92.882 E5.8216 F3000
+G1 X116.300 Y92.791 E5.8261 F3000
+G1 X116.200 Y92.698 E5.8306 F3000
+G1 X116.100 Y92.604 E5.8351 F3000
+G1 X116.000 Y92.508 E5.8397 F3000
+G1 X115.900 Y92.410 E5.8443 F3000
+G1 X115.800 Y92.312 E5.8490 F3000
+G1 X115.700 Y92.213 E5.8536 F3000
+G1 X115.600 Y92.113 E5.8583 F3000
+G1 X115.500 Y92.013 E5.8629 F3000
+G1 X115.400 Y91.913 E5.8676 F3000
+G1 X115.300 Y91.814 E5.8722 F3000
+G1 X115.200 Y91.714 E5.8769 F3000
+G1 X115.100 Y91.616 E5.8815 F3000
+G1 X115.000 Y91.518 E5.8861 F3000
+G1 X114.900 Y91.422 E5.8907 F3000
+G1 X114.800 Y91.327 E5.8953 F3000
+G1 X114.700 Y91.233 E5.8998 F3000
+G1 X114.600 Y91.142 E5.9043 F3000
+G1 X114.500 Y91.053 E5.9087 F3000
+G1 X114.400 Y90.966 E5.9131 F3000
+G1 X114.300 Y90.882 E5.9174 F3000
+G1 X114.200 Y90.800 E5.9216 F3000
+G1 X114.100 Y90.722 E5.9258 F3000
+G1 X114.000 Y90.646 E5.9300 F3000
+G1 X113.900 Y90.575 E5.9340 F3000
+G1 X113.800 Y90.506 E5.9380 F3000
+G1 X113.700 Y90.442 E5.9419 F3000
+G1 X113.600 Y90.381 E5.9458 F3000
+G1 X113.500 Y90.324 E5.9496 F3000
+G1 X113.400 Y90.272 E5.9533 F3000
+G1 X113.300 Y90.224 E5.9570 F3000
+G1 X113.200 Y90.180 E5.9606 F3000
+G1 X113.100 Y90.141 E5.9641 F3000
+G1 X113.000 Y90.106 E5.9676 F3000
+G1 X112.900 Y90.076 E5.9711 F3000
+G1 X112.800 Y90.052 E5.9745 F3000
+G1 X112.700 Y90.031 E5.9778 F3000
+G1 X112.600 Y90.016 E5.9812 F3000
+G1 X112.500 Y90.006 E5.9845 F3000
+G1 X112.400 Y90.001 E5.9878 F3000
+G1 X112.300 Y90.001 E5.9911 F3000
+G1 X112.200 Y90.005 E5.9944 F3000
+G1 X112.100 Y90.015 E5.9977 F3000
+G1 X112.000 Y90.030 E6.0010 F3000
+G1 X111.900 Y90.049 E6.0044 F3000
+G1 X111.800 Y90.074 E6.0078 F3000
+G1 X111.700 Y90.103 E6.0112 F3000
+G1 X111.600 Y90.137 E6.0147 F3000
+G1 X111.500 Y90.176 E6.0183 F3000
+G1 X111.400 Y90.219 E6.0219 F3000
+G1 X111.300 Y90.267 E6.0255 F3000
+G1 X111.200 Y90.319 E6.0292 F3000
+G1 X111.100 Y90.375 E6.0330 F3000
+G1 X111.000 Y90.436 E6.0369 F3000
+G1 X110.900 Y90.500 E6.0408 F3000
+G1 X110.800 Y90.568 E6.0448 F3000
+G1 X110.700 Y90.639 E6.0489 F3000
+G1 X110.600 Y90.714 E6.0530 F3000
+G1 X110.500 Y90.792 E6.0572 F3000
+G1 X110.400 Y90.874 E6.0614 F3000
+G1 X110.300 Y90.958 E6.0657 F3000
+G1 X110.200 Y91.044 E6.0701 F3000
+G1 X110.100 Y91.133 E6.0745 F3000
+G1 X110.000 Y91.224 E6.0790 F3000
+G1 X109.900 Y91.318 E6.0835 F3000
+G1 X109.800 Y91.412 E6.0880 F3000
+G1 X109.700 Y91.509 E6.0926 F3000
+G1 X109.600 Y91.606 E6.0972 F3000
+G1 X109.500 Y91.705 E6.1019 F3000
+G1 X109.400 Y91.804 E6.1065 F3000
+G1 X109.300 Y91.904 E6.1112 F3000
+G1 X109.200 Y92.004 E6.1158 F3000
+G1 X109.100 Y92.104 E6.1205 F3000
+G1 X109.000 Y92.203 E6.1252 F3000
+G1 X108.900 Y92.302 E6.1298 F3000
+G1 X108.800 Y92.401 E6.1344 F3000
+G1 X108.700 Y92.498 E6.1390 F3000
+G1 X108.600 Y92.594 E6.1436 F3000
+G1 X108.500 Y92.689 E6.1482 F3000
+G1 X108.400 Y92.782 E6.1527 F3000
+G1 X108.300 Y92.873 E6.1571 F3000
+G1 X108.200 Y92.962 E6.1615 F3000
+G1 X108.100 Y93.048 E6.1659 F3000
+G1 X108.000 Y93.132 E6.1702 F3000
+G1 X107.900 Y93.213 E6.1745 F3000
+G1 X107.800 Y93.291 E6.1786 F3000
+G1 X107.700 Y93.366 E6.1828 F3000
+G1 X107.600 Y93.437 E6.1868 F3000
+G1 X107.500 Y93.505 E6.1908 F3000
+G1 X107.400 Y93.569 E6.1947 F3000
+G1 X107.300 Y93.629 E6.1986 F3000
+G1 X107.200 Y93.685 E6.2024 F3000
+G1 X107.100 Y93.737 E6.2061 F3000
+G1 X107.000 Y93.784 E6.2097 F3000
+G1 X106.900 Y93.827 E6.2133 F3000
+G1 X106.800 Y93.865 E6.2168 F3000
+G1 X106.700 Y93.899 E6.2203 F3000
+G1 X106.600 Y93.928 E6.2238 F3000
+G1 X106.500 Y93.952 E6.2272 F3000
+G1 X106.400 Y93.972 E6.2305 F3000
+G1 X106.300 Y93.986 E6.2339 F3000
+G1 X106.200 Y93.995 E6.2372 F3000
+G1 X106.100 Y94.000 E6.2405 F3000
+G1 X106.000 Y93.999 E6.2438 F3000
+G1 X105.900 Y93.993 E6.2471 F3000
+G1 X105.800 Y93.983 E6.2504 F3000
+G1 X105.700 Y93.967 E6.2537 F3000
+G1 X105.600 Y93.947 E6.2571 F3000
+G1 X105.500 Y93.922 E6.2605 F3000
+G1 X105.400 Y93.891 E6.2640 F3000
+G1 X105.300 Y93.857 E6.2674 F3000
+G1 X105.200 Y93.817 E6.2710 F3000
+G1 X105.100 Y93.773 E6.2746 F3000
+G1 X105.000 Y93.725 E6.2783 F3000
+G1 X104.900 Y93.672 E6.2820 F3000
+G1 X104.800 Y93.615 E6.2858 F3000
+G1 X104.700 Y93.554 E6.2897 F3000
+G1 X104.600 Y93.489 E6.2936 F3000
+G1 X104.500 Y93.420 E6.2976 F3000
+G1 X104.400 Y93.348 E6.3017 F3000
+G1 X104.300 Y93.273 E6.3058 F3000
+G1 X104.200 Y93.194 E6.3100 F3000
+G1 X104.100 Y93.112 E6.3143 F3000
+G1 X104.000 Y93.028 E6.3186 F3000
+G1 X103.900 Y92.941 E6.3230 F3000
+G1 X103.800 Y92.852 E6.3274 F3000
+G1 X103.700 Y92.760 E6.3319 F3000
+G1 X103.600 Y92.667 E6.3364 F3000
+G1 X103.500 Y92.572 E6.3409 F3000
+G1 X103.400 Y92.475 E6.3455 F3000
+G1 X103.300 Y92.377 E6.3501 F3000
+G1 X103.200 Y92.279 E6.3548 F3000
+G1 X103.100 Y92.179 E6.3594 F3000
+G1 X103.000 Y92.080 E6.3641 F3000
+G1 X102.900 Y91.980 E6.3687 F3000
+G1 X102.800 Y91.880 E6.3734 F3000
+G1 X102.700 Y91.780 E6.3781 F3000
+G1 X102.600 Y91.681 E6.3827 F3000
+G1 X102.500 Y91.583 E6.3873 F3000
+G1 X102.400 Y91.485 E6.3919 F3000
+G1 X102.300 Y91.390 E6.3965 F3000
+G1 X102.200 Y91.295 E6.4011 F3000
+G1 X102.100 Y91.202 E6.4056 F3000
+G1 X102.000 Y91.112 E6.4100 F3000
+G1 X101.900 Y91.023 E6.4144 F3000
+G1 X101.800 Y90.937 E6.4188 F3000
+G1 X101.700 Y90.854 E6.4231 F3000
+G1 X101.600 Y90.773 E6.4273 F3000
+G1 X101.500 Y90.696 E6.4315 F3000
+G1 X101.400 Y90.622 E6.4356 F3000
+G1 X101.300 Y90.551 E6.4396 F3000
+G1 X101.200 Y90.484 E6.4436 F3000
+G1 X101.100 Y90.421 E6.4475 F3000
+G1 X101.000 Y90.361 E6.4513 F3000
+G1 X100.900 Y90.306 E6.4551 F3000
+G1 X100.800 Y90.255 E6.4588 F3000
+G1 X100.700 Y90.208 E6.4625 F3000
+G1 X100.600 Y90.166 E6.4660 F3000
+G1 X100.500 Y90.129 E6.4696 F3000
+G1 X100.400 Y90.096 E6.4730 F3000
+G1 X100.300 Y90.068 E6.4765 F3000
+G1 X100.200 Y90.044 E6.4799 F3000
+G1 X100.100 Y90.026 E6.4832 F3000
+G1 X100.000 Y90.012 E6.4865 F3000
+G1 X99.900 Y90.004 E6.4899 F3000
+G1 X99.800 Y90.000 E6.4932 F3000
+G1 X99.700 Y90.002 E6.4965 F3000
+G1 X99.600 Y90.008 E6.4998 F3000
+G1 X99.500 Y90.019 E6.5031 F3000
+G1 X99.400 Y90.036 E6.5064 F3000
+G1 X99.300 Y90.057 E6.5098 F3000
+G1 X99.200 Y90.083 E6.5132 F3000
+G1 X99.100 Y90.114 E6.5167 F3000
+G1 X99.000 Y90.150 E6.5202 F3000
+G1 X98.900 Y90.190 E6.5237 F3000
+G1 X98.800 Y90.235 E6.5273 F3000
+G1 X98.700 Y90.284 E6.5310 F3000
+G1 X98.600 Y90.337 E6.5348 F3000
+G1 X98.500 Y90.395 E6.5386 F3000
+G1 X98.400 Y90.457 E6.5424 F3000
+G1 X98.300 Y90.522 E6.5464 F3000
+G1 X98.200 Y90.591 E6.5504 F3000
+G1 X98.100 Y90.664 E6.5545 F3000
+G1 X98.000 Y90.740 E6.5586 F3000
+G1 X97.900 Y90.819 E6.5628 F3000
+G1 X97.800 Y90.902 E6.5671 F3000
+G1 X97.700 Y90.987 E6.5714 F3000
+G1 X97.600 Y91.074 E6.5758 F3000
+G1 X97.500 Y91.164 E6.5803 F3000
+G1 X97.400 Y91.256 E6.5847 F3000
+G1 X97.300 Y91.349 E6.5893 F3000
+G1 X97.200 Y91.445 E6.5938 F3000
+G1 X97.100 Y91.541 E6.5984 F3000
+G1 X97.000 Y91.639 E6.6030 F3000
+G1 X96.900 Y91.738 E6.6077 F3000
+G1 X96.800 Y91.837 E6.6123 F3000
+G1 X96.700 Y91.937 E6.6170 F3000
+G1 X96.600 Y92.037 E6.6217 F3000
+G1 X96.500 Y92.137 E6.6263 F3000
+G1 X96.400 Y92.237 E6.6310 F3000
+G1 X96.300 Y92.336 E6.6356 F3000
+G1 X96.200 Y92.434 E6.6402 F3000
+G1 X96.100 Y92.531 E6.6448 F3000
+G1 X96.000 Y92.626 E6.6494 F3000
+G1 X95.900 Y92.721 E6.6539 F3000
+G1 X95.800 Y92.813 E6.6584 F3000
+G1 X95.700 Y92.903 E6.6629 F3000
+G1 X95.600 Y92.991 E6.6673 F3000
+G1 X95.500 Y93.077 E6.6716 F3000
+G1 X95.400 Y93.160 E6.6759 F3000
+G1 X95.300 Y93.240 E6.6801 F3000
+G1 X95.200 Y93.317 E6.6843 F3000
+G1 X95.100 Y93.390 E6.6884 F3000
+G1 X95.000 Y93.460 E6.6924 F3000
+G1 X94.900 Y93.527 E6.6964 F3000
+G1 X94.800 Y93.589 E6.7003 F3000
+G1 X94.700 Y93.648 E6.7041 F3000
+G1 X94.600 Y93.703 E6.7079 F3000
+G1 X94.500 Y93.753 E6.7116 F3000
+G1 X94.400 Y93.799 E6.7152 F3000
+G1 X94.300 Y93.840 E6.7188 F3000
+G1 X94.200 Y93.877 E6.7223 F3000
+G1 X94.100 Y93.909 E6.7257 F3000
+G1 X94.000 Y93.937 E6.7292 F3000
+G1 X93.900 Y93.959 E6.7325 F3000
+G1 X93.800 Y93.977 E6.7359 F3000
+G1 X93.700 Y93.990 E6.7392 F3000
+G1 X93.600 Y93.997 E6.7425 F3000
+G1 X93.500 Y94.000 E6.7458 F3000
+G1 X93.400 Y93.998 E6.7491 F3000
+G1 X93.300 Y93.990 E6.7524 F3000
+G1 X93.200 Y93.978 E6.7558 F3000
+G1 X93.100 Y93.961 E6.7591 F3000
+G1 X93.000 Y93.939 E6.7625 F3000
+G1 X92.900 Y93.912 E6.7659 F3000
+G1 X92.800 Y93.880 E6.7694 F3000
+G1 X92.700 Y93.844 E6.7729 F3000
+G1 X92.600 Y93.803 E6.7765 F3000
+G1 X92.500 Y93.757 E6.7801 F3000
+G1 X92.400 Y93.707 E6.7838 F3000
+G1 X92.300 Y93.653 E6.7875 F3000
+G1 X92.200 Y93.595 E6.7913 F3000
+G1 X92.100 Y93.533 E6.7952 F3000
+G1 X92.000 Y93.466 E6.7992 F3000
+G1 X91.900 Y93.397 E6.8032 F3000
+G1 X91.800 Y93.323 E6.8073 F3000
+G1 X91.700 Y93.247 E6.8115 F3000
+G1 X91.600 Y93.167 E6.8157 F3000
+G1 X91.500 Y93.084 E6.8200 F3000
+G1 X91.400 Y92.999 E6.8243 F3000
+G1 X91.300 Y92.911 E6.8287 F3000
+G1 X91.200 Y92.821 E6.8331 F3000
+G1 X91.100 Y92.729 E6.8376 F3000
+G1 X91.000 Y92.635 E6.8422 F3000
+G1 X90.900 Y92.539 E6.8467 F3000
+G1 X90.800 Y92.442 E6.8513 F3000
+G1 X90.700 Y92.344 E6.8559 F3000
+G1 X90.600 Y92.245 E6.8606 F3000
+G1 X90.500 Y92.146 E6.8652 F3000
+G1 X90.400 Y92.046 E6.8699 F3000
+G1 X90.300 Y91.946 E6.8746 F3000
+G1 X90.200 Y91.846 E6.8792 F3000
+G1 X90.100 Y91.747 E6.8839 F3000
+G1 X90.000 Y91.648 E6.8885 F3000
+G1 X89.900 Y91.550 E6.8931 F3000
+G1 X89.800 Y91.453 E6.8977 F3000
+G1 X89.700 Y91.358 E6.9023 F3000
+G1 X89.600 Y91.264 E6.9068 F3000
+G1 X89.500 Y91.172 E6.9113 F3000
+G1 X89.400 Y91.082 E6.9157 F3000
+G1 X89.300 Y90.994 E6.9201 F3000
+G1 X89.200 Y90.909 E6.9245 F3000
+G1 X89.100 Y90.827 E6.9287 F3000
+G1 X89.000 Y90.747 E6.9330 F3000
+G1 X88.900 Y90.671 E6.9371 F3000
+G1 X88.800 Y90.598 E6.9412 F3000
+G1 X88.700 Y90.528 E6.9452 F3000
+G1 X88.600 Y90.462 E6.9492 F3000
+G1 X88.500 Y90.400 E6.9530 F3000
+G1 X88.400 Y90.342 E6.9569 F3000
+G1 X88.300 Y90.289 E6.9606 F3000
+G1 X88.200 Y90.239 E6.9643 F3000
+G1 X88.100 Y90.194 E6.9679 F3000
+G1 X88.000 Y90.153 E6.9715 F3000
+G1 X87.900 Y90.117 E6.9750 F3000
+G1 X87.800 Y90.086 E6.9784 F3000
+G1 X87.700 Y90.059 E6.9819 F3000
+G1 X87.600 Y90.037 E6.9852 F3000
+G1 X87.500 Y90.021 E6.9886 F3000
+G1 X87.400 Y90.009 E6.9919 F3000
+G1 X87.300 Y90.002 E6.9952 F3000
+G1 X87.200 Y90.000 E6.9985 F3000
+G1 X87.100 Y90.003 E7.0018 F3000
+G1 X87.000 Y90.011 E7.0051 F3000
+G1 X86.900 Y90.024 E7.0085 F3000
+G1 X86.800 Y90.042 E7.0118 F3000
+G1 X86.700 Y90.065 E7.0152 F3000
+G1 X86.600 Y90.093 E7.0186 F3000
+G1 X86.500 Y90.126 E7.0221 F3000
+G1 X86.400 Y90.163 E7.0256 F3000
+G1 X86.300 Y90.205 E7.0292 F3000
+G1 X86.200 Y90.251 E7.0328 F3000
+G1 X86.100 Y90.301 E7.0365 F3000
+G1 X86.000 Y90.356 E7.0403 F3000
+G1 X85.900 Y90.415 E7.0441 F3000
+G1 X85.800 Y90.478 E7.0480 F3000
+G1 X85.700 Y90.545 E7.0520 F3000
+G1 X85.600 Y90.616 E7.0560 F3000
+G1 X85.500 Y90.689 E7.0601 F3000
+G1 X85.400 Y90.767 E7.0643 F3000
+G1 X85.300 Y90.847 E7.0685 F3000
+G1 X85.200 Y90.930 E7.0728 F3000
+G1 X85.100 Y91.016 E7.0772 F3000
+G1 X85.000 Y91.104 E7.0816 F3000
+G1 X84.900 Y91.194 E7.0860 F3000
+G1 X84.800 Y91.287 E7.0905 F3000
+G1 X84.700 Y91.381 E7.0950 F3000
+G1 X84.600 Y91.477 E7.0996 F3000
+G1 X84.500 Y91.574 E7.1042 F3000
+G1 X84.400 Y91.672 E7.1088 F3000
+G1 X84.300 Y91.771 E7.1135 F3000
+G1 X84.200 Y91.871 E7.1181 F3000
+G1 X84.100 Y91.971 E7.1228 F3000
+G1 X84.000 Y92.071 E7.1275 F3000
+G1 X83.900 Y92.171 E7.1321 F3000
+G1 X83.800 Y92.270 E7.1368 F3000
+G1 X83.700 Y92.369 E7.1414 F3000
+G1 X83.600 Y92.466 E7.1460 F3000
+G1 X83.500 Y92.563 E7.1506 F3000
+G1 X83.400 Y92.658 E7.1552 F3000
+G1 X83.300 Y92.752 E7.1597 F3000
+G1 X83.200 Y92.844 E7.1642 F3000
+G1 X83.100 Y92.933 E7.1686 F3000
+G1 X83.000 Y93.020 E7.1730 F3000
+G1 X82.900 Y93.105 E7.1773 F3000
+G1 X82.800 Y93.187 E7.1816 F3000
+G1 X82.700 Y93.266 E7.1858 F3000
+G1 X82.600 Y93.342 E7.1899 F3000
+G1 X82.500 Y93.414 E7.1940 F3000
+G1 X82.400 Y93.483 E7.1980 F3000
+G1 X82.300 Y93.548 E7.2019 F3000
+G1 X82.200 Y93.610 E7.2058 F3000
+G1 X82.100 Y93.667 E7.2096 F3000
+G1 X82.000 Y93.720 E7.2134 F3000
+G1 X81.900 Y93.769 E7.2170 F3000
+G1 X81.800 Y93.813 E7.2206 F3000
+G1 X81.700 Y93.853 E7.2242 F3000
+G1 X81.600 Y93.889 E7.2277 F3000
+G1 X81.500 Y93.919 E7.2311 F3000
+G1 X81.400 Y93.945 E7.2346 F3000
+G1 X81.300 Y93.966 E7.2379 F3000
+G1 X81.200 Y93.982 E7.2413 F3000
+G1 X81.100 Y93.993 E7.2446 F3000
+G1 X81.000 Y93.999 E7.2479 F3000
+G1 X80.900 Y94.000 E7.2512 F3000
+G1 X80.800 Y93.996 E7.2545 F3000
+G1 X80.700 Y93.987 E7.2578 F3000
+G1 X80.600 Y93.973 E7.2611 F3000
+G1 X80.500 Y93.954 E7.2645 F3000
+G1 X80.400 Y93.930 E7.2679 F3000
+G1 X80.300 Y93.902 E7.2713 F3000
+G1 X80.200 Y93.869 E7.2748 F3000
+G1 X80.100 Y93.831 E7.2783 F3000
+G1 X80.000 Y93.788 E7.2819 F3000
+G1 X79.900 Y93.741 E7.2856 F3000
+G1 X79.800 Y93.690 E7.2893 F3000
+G1 X79.700 Y93.634 E7.2930 F3000
+G1 X79.600 Y93.574 E7.2969 F3000
+G1 X79.500 Y93.511 E7.3008 F3000
+G1 X79.400 Y93.443 E7.3048 F3000
+G1 X79.300 Y93.372 E7.3088 F3000
+G1 X79.200 Y93.298 E7.3129 F3000
+G1 X79.100 Y93.220 E7.3171 F3000
+G1 X79.000 Y93.139 E7.3214 F3000
+G1 X78.900 Y93.056 E7.3257 F3000
+G1 X78.800 Y92.970 E7.3300 F3000
+G1 X78.700 Y92.881 E7.3344 F3000
+G1 X78.600 Y92.790 E7.3389 F3000
+G1 X78.500 Y92.697 E7.3434 F3000
+G1 X78.400 Y92.603 E7.3479 F3000
+G1 X78.300 Y92.507 E7.3525 F3000
+G1 X78.200 Y92.409 E7.3571 F3000
+G1 X78.100 Y92.311 E7.3617 F3000
+G1 X78.000 Y92.212 E7.3664 F3000
+G1 X77.900 Y92.112 E7.3710 F3000
+G1 X77.800 Y92.012 E7.3757 F3000
+G1 X77.700 Y91.912 E7.3804 F3000
+G1 X77.600 Y91.813 E7.3850 F3000
+G1 X77.500 Y91.713 E7.3897 F3000
+G1 X77.400 Y91.615 E7.3943 F3000
+G1 X77.300 Y91.517 E7.3989 F3000
+G1 X77.200 Y91.421 E7.4035 F3000
+G1 X77.100 Y91.326 E7.4081 F3000
+G1 X77.000 Y91.233 E7.4126 F3000
+G1 X76.900 Y91.141 E7.4171 F3000
+G1 X76.800 Y91.052 E7.4215 F3000
+G1 X76.700 Y90.965 E7.4258 F3000
+G1 X76.600 Y90.881 E7.4302 F3000
+G1 X76.500 Y90.800 E7.4344 F3000
+G1 X76.400 Y90.721 E7.4386 F3000
+G1 X76.300 Y90.646 E7.4427 F3000
+G1 X76.200 Y90.574 E7.4468 F3000
+G1 X76.100 Y90.506 E7.4508 F3000
+G1 X76.000 Y90.441 E7.4547 F3000
+G1 X75.900 Y90.380 E7.4586 F3000
+G1 X75.800 Y90.324 E7.4624 F3000
+G1 X75.700 Y90.271 E7.4661 F3000
+G1 X75.600 Y90.223 E7.4698 F3000
+G1 X75.500 Y90.180 E7.4734 F3000
+G1 X75.400 Y90.140 E7.4769 F3000
+G1 X75.300 Y90.106 E7.4804 F3000
+G1 X75.200 Y90.076 E7.4838 F3000
+G1 X75.100 Y90.051 E7.4872 F3000
+G1 X75.000 Y90.031 E7.4906 F3000
+G1 X74.900 Y90.016 E7.4939 F3000
+G1 X74.800 Y90.006 E7.4973 F3000
+G1 X74.700 Y90.001 E7.5006 F3000
+G1 X74.600 Y90.001 E7.5039 F3000
+G1 X74.500 Y90.005 E7.5072 F3000
+G1 X74.400 Y90.015 E7.5105 F3000
+G1 X74.300 Y90.030 E7.5138 F3000
+G1 X74.200 Y90.050 E7.5172 F3000
+G1 X74.100 Y90.074 E7.5206 F3000
+G1 X74.000 Y90.103 E7.5240 F3000
+G1 X73.900 Y90.138 E7.5275 F3000
+G1 X73.800 Y90.176 E7.5311 F3000
+G1 X73.700 Y90.220 E7.5346 F3000
+G1 X73.600 Y90.267 E7.5383 F3000
+G1 X73.500 Y90.319 E7.5420 F3000
+G1 X73.400 Y90.376 E7.5458 F3000
+G1 X73.300 Y90.436 E7.5497 F3000
+G1 X73.200 Y90.500 E7.5536 F3000
+G1 X73.100 Y90.568 E7.5576 F3000
+G1 X73.000 Y90.640 E7.5616 F3000
+G1 X72.900 Y90.715 E7.5658 F3000
+G1 X72.800 Y90.793 E7.5700 F3000
+G1 X72.700 Y90.874 E7.5742 F3000
+G1 X72.600 Y90.958 E7.5785 F3000
+G1 X72.500 Y91.045 E7.5829 F3000
+G1 X72.400 Y91.134 E7.5873 F3000
+G1 X72.300 Y91.225 E7.5918 F3000
+G1 X72.200 Y91.318 E7.5963 F3000
+G1 X72.100 Y91.413 E7.6008 F3000
+G1 X72.000 Y91.509 E7.6054 F3000
+G1 X71.900 Y91.607 E7.6100 F3000
+G1 X71.800 Y91.706 E7.6146 F3000
+G1 X71.700 Y91.805 E7.6193 F3000
+G1 X71.600 Y91.904 E7.6240 F3000
+G1 X71.500 Y92.004 E7.6286 F3000
+G1 X71.400 Y92.104 E7.6333 F3000
+G1 X71.300 Y92.204 E7.6379 F3000
+G1 X71.200 Y92.303 E7.6426 F3000
+G1 X71.100 Y92.402 E7.6472 F3000
+G1 X71.000 Y92.499 E7.6518 F3000
+G1 X70.900 Y92.595 E7.6564 F3000
+G1 X70.800 Y92.690 E7.6610 F3000
+G1 X70.700 Y92.783 E7.6655 F3000
+G1 X70.600 Y92.874 E7.6699 F3000
+G1 X70.500 Y92.963 E7.6743 F3000
+G1 X70.400 Y93.049 E7.6787 F3000
+G1 X70.300 Y93.133 E7.6830 F3000
+G1 X70.200 Y93.214 E7.6872 F3000
+G1 X70.100 Y93.292 E7.6914 F3000
+G1 X70.000 Y93.367 E7.6956 F3000
+G1 X69.900 Y93.438 E7.6996 F3000
+G1 X69.800 Y93.505 E7.7036 F3000
+G1 X69.700 Y93.569 E7.7075 F3000
+G1 X69.600 Y93.629 E7.7114 F3000
+G1 X69.500 Y93.685 E7.7151 F3000
+G1 X69.400 Y93.737 E7.7189 F3000
+G1 X69.300 Y93.784 E7.7225 F3000
+G1 X69.200 Y93.827 E7.7261 F3000
+G1 X69.100 Y93.866 E7.7296 F3000
+G1 X69.000 Y93.899 E7.7331 F3000
+G1 X68.900 Y93.928 E7.7365 F3000
+G1 X68.800 Y93.952 E7.7399 F3000
+G1 X68.700 Y93.972 E7.7433 F3000
+G1 X68.600 Y93.986 E7.7466 F3000
+G1 X68.500 Y93.995 E7.7499 F3000
+G1 X68.400 Y94.000 E7.7533 F3000
+G1 X68.300 Y93.999 E7.7566 F3000
+G1 X68.200 Y93.993 E7.7599 F3000
+G1 X68.100 Y93.983 E7.7632 F3000
+G1 X68.000 Y93.967 E7.7665 F3000
+G1 X67.900 Y93.947 E7.7699 F3000
+G1 X67.800 Y93.921 E7.7733 F3000
+G1 X67.700 Y93.891 E7.7767 F3000
+G1 X67.600 Y93.856 E7.7802 F3000
+G1 X67.500 Y93.817 E7.7838 F3000
+G1 X67.400 Y93.773 E7.7874 F3000
+G1 X67.300 Y93.724 E7.7911 F3000
+G1 X67.200 Y93.671 E7.7948 F3000
+G1 X67.100 Y93.614 E7.7986 F3000
+G1 X67.000 Y93.553 E7.8024 F3000
+G1 X66.900 Y93.488 E7.8064 F3000
+G1 X66.800 Y93.420 E7.8104 F3000
+G1 X66.700 Y93.348 E7.8145 F3000
+G1 X66.600 Y93.272 E7.8186 F3000
+G1 X66.500 Y93.193 E7.8228 F3000
+G1 X66.400 Y93.112 E7.8271 F3000
+G1 X66.300 Y93.027 E7.8314 F3000
+G1 X66.200 Y92.940 E7.8357 F3000
+G1 X66.100 Y92.851 E7.8402 F3000
+G1 X66.000 Y92.759 E7.8446 F3000
+G1 X65.900 Y92.666 E7.8492 F3000
+G1 X65.800 Y92.571 E7.8537 F3000
+G1 X65.700 Y92.474 E7.8583 F3000
+G1 X65.600 Y92.376 E7.8629 F3000
+G1 X65.500 Y92.278 E7.8676 F3000
+G1 X65.400 Y92.179 E7.8722 F3000
+G1 X65.300 Y92.079 E7.8769 F3000
+G1 X65.200 Y91.979 E7.8815 F3000
+G1 X65.100 Y91.879 E7.8862 F3000
+G1 X65.000 Y91.779 E7.8909 F3000
+G1 X64.900 Y91.680 E7.8955 F3000
+G1 X64.800 Y91.582 E7.9001 F3000
+G1 X64.700 Y91.485 E7.9047 F3000
+G1 X64.600 Y91.389 E7.9093 F3000
+G1 X64.500 Y91.294 E7.9138 F3000
+G1 X64.400 Y91.202 E7.9183 F3000
+G1 X64.300 Y91.111 E7.9228 F3000
+G1 X64.200 Y91.023 E7.9272 F3000
+G1 X64.100 Y90.937 E7.9316 F3000
+G1 X64.000 Y90.853 E7.9358 F3000
+G1 X63.900 Y90.773 E7.9401 F3000
+G1 X63.800 Y90.695 E7.9443 F3000
+G1 X63.700 Y90.621 E7.9484 F3000
+G1 X63.600 Y90.551 E7.9524 F3000
+G1 X63.500 Y90.483 E7.9564 F3000
+G1 X63.400 Y90.420 E7.9603 F3000
+G1 X63.300 Y90.361 E7.9641 F3000
+G1 X63.200 Y90.306 E7.9679 F3000
+G1 X63.100 Y90.255 E7.9716 F3000
+G1 X63.000 Y90.208 E7.9752 F3000
+G1 X62.900 Y90.166 E7.9788 F3000
+G1 X62.800 Y90.128 E7.9823 F3000
+G1 X62.700 Y90.095 E7.9858 F3000
+G1 X62.600 Y90.067 E7.9892 F3000
+G1 X62.500 Y90.044 E7.9926 F3000
+G1 X62.400 Y90.026 E7.9960 F3000
+G1 X62.300 Y90.012 E7.9993 F3000
+G1 X62.200 Y90.004 E8.0026 F3000
+G1 X62.100 Y90.000 E8.0059 F3000
+G1 X62.000 Y90.002 E8.0092 F3000
+G1 X61.900 Y90.008 E8.0125 F3000
+G1 X61.800 Y90.020 E8.0159 F3000
+G1 X61.700 Y90.036 E8.0192 F3000
+G1 X61.600 Y90.057 E8.0226 F3000
+G1 X61.500 Y90.083 E8.0260 F3000
+G1 X61.400 Y90.114 E8.0294 F3000
+G1 X61.300 Y90.150 E8.0329 F3000
+G1 X61.200 Y90.190 E8.0365 F3000
+G1 X61.100 Y90.235 E8.0401 F3000
+G1 X61.000 Y90.284 E8.0438 F3000
+G1 X60.900 Y90.338 E8.0475 F3000
+G1 X60.800 Y90.396 E8.0514 F3000
+G1 X60.700 Y90.457 E8.0552 F3000
+G1 X60.600 Y90.523 E8.0592 F3000
+G1 X60.500 Y90.592 E8.0632 F3000
+G1 X60.400 Y90.665 E8.0673 F3000
+G1 X60.300 Y90.741 E8.0714 F3000
+G1 X60.200 Y90.820 E8.0756 F3000
+G1 X60.100 Y90.902 E8.0799 F3000
+G1 X60.000 Y92.987 E8.1488 F3000
+G1 X60.100 Y93.075 E8.1532 F3000
+G1 X60.200 Y93.165 E8.1576 F3000
+G1 X60.300 Y93.256 E8.1621 F3000
+G1 X60.400 Y93.350 E8.1666 F3000
+G1 X60.500 Y93.445 E8.1712 F3000
+G1 X60.600 Y93.542 E8.1758 F3000
+G1 X60.700 Y93.640 E8.1804 F3000
+G1 X60.800 Y93.739 E8.1850 F3000
+G1 X60.900 Y93.838 E8.1897 F3000
+G1 X61.000 Y93.938 E8.1943 F3000
+G1 X61.100 Y94.038 E8.1990 F3000
+G1 X61.200 Y94.138 E8.2037 F3000
+G1 X61.300 Y94.238 E8.2083 F3000
+G1 X61.400 Y94.336 E8.2130 F3000
+G1 X61.500 Y94.435 E8.2176 F3000
+G1 X61.600 Y94.532 E8.2222 F3000
+G1 X61.700 Y94.627 E8.2267 F3000
+G1 X61.800 Y94.721 E8.2313 F3000
+G1 X61.900 Y94.814 E8.2358 F3000
+G1 X62.000 Y94.904 E8.2402 F3000
+G1 X62.100 Y94.992 E8.2446 F3000
+G1 X62.200 Y95.078 E8.2490 F3000
+G1 X62.300 Y95.160 E8.2532 F3000
+G1 X62.400 Y95.240 E8.2575 F3000
+G1 X62.500 Y95.317 E8.2616 F3000
+G1 X62.600 Y95.391 E8.2657 F3000
+G1 X62.700 Y95.461 E8.2698 F3000
+G1 X62.800 Y95.527 E8.2737 F3000
+G1 X62.900 Y95.590 E8.2776 F3000
+G1 X63.000 Y95.649 E8.2814 F3000
+G1 X63.100 Y95.703 E8.2852 F3000
+G1 X63.200 Y95.753 E8.2889 F3000
+G1 X63.300 Y95.799 E8.2925 F3000
+G1 X63.400 Y95.841 E8.2961 F3000
+G1 X63.500 Y95.878 E8.2996 F3000
+G1 X63.600 Y95.910 E8.3031 F3000
+G1 X63.700 Y95.937 E8.3065 F3000
+G1 X63.800 Y95.959 E8.3099 F3000
+G1 X63.900 Y95.977 E8.3132 F3000
+G1 X64.000 Y95.990 E8.3166 F3000
+G1 X64.100 Y95.997 E8.3199 F3000
+G1 X64.200 Y96.000 E8.3232 F3000
+G1 X64.300 Y95.998 E8.3265 F3000
+G1 X64.400 Y95.990 E8.3298 F3000
+G1 X64.500 Y95.978 E8.3331 F3000
+G1 X64.600 Y95.961 E8.3364 F3000
+G1 X64.700 Y95.939 E8.3398 F3000
+G1 X64.800 Y95.912 E8.3432 F3000
+G1 X64.900 Y95.880 E8.3467 F3000
+G1 X65.000 Y95.843 E8.3502 F3000
+G1 X65.100 Y95.802 E8.3538 F3000
+G1 X65.200 Y95.757 E8.3574 F3000
+G1 X65.300 Y95.707 E8.3611 F3000
+G1 X65.400 Y95.653 E8.3649 F3000
+G1 X65.500 Y95.594 E8.3687 F3000
+G1 X65.600 Y95.532 E8.3726 F3000
+G1 X65.700 Y95.466 E8.3765 F3000
+G1 X65.800 Y95.396 E8.3805 F3000
+G1 X65.900 Y95.323 E8.3846 F3000
+G1 X66.000 Y95.246 E8.3888 F3000
+G1 X66.100 Y95.166 E8.3930 F3000
+G1 X66.200 Y95.084 E8.3973 F3000
+G1 X66.300 Y94.998 E8.4016 F3000
+G1 X66.400 Y94.910 E8.4060 F3000
+G1 X66.500 Y94.820 E8.4105 F3000
+G1 X66.600 Y94.728 E8.4150 F3000
+G1 X66.700 Y94.634 E8.4195 F3000
+G1 X66.800 Y94.538 E8.4241 F3000
+G1 X66.900 Y94.441 E8.4287 F3000
+G1 X67.000 Y94.343 E8.4333 F3000
+G1 X67.100 Y94.245 E8.4379 F3000
+G1 X67.200 Y94.145 E8.4426 F3000
+G1 X67.300 Y94.045 E8.4472 F3000
+G1 X67.400 Y93.945 E8.4519 F3000
+G1 X67.500 Y93.845 E8.4566 F3000
+G1 X67.600 Y93.746 E8.4612 F3000
+G1 X67.700 Y93.647 E8.4659 F3000
+G1 X67.800 Y93.549 E8.4705 F3000
+G1 X67.900 Y93.452 E8.4751 F3000
+G1 X68.000 Y93.357 E8.4796 F3000
+G1 X68.100 Y93.263 E8.4842 F3000
+G1 X68.200 Y93.171 E8.4886 F3000
+G1 X68.300 Y93.081 E8.4931 F3000
+G1 X68.400 Y92.993 E8.4975 F3000
+G1 X68.500 Y92.908 E8.5018 F3000
+G1 X68.600 Y92.826 E8.5061 F3000
+G1 X68.700 Y92.746 E8.5103 F3000
+G1 X68.800 Y92.670 E8.5144 F3000
+G1 X68.900 Y92.597 E8.5185 F3000
+G1 X69.000 Y92.528 E8.5225 F3000
+G1 X69.100 Y92.462 E8.5265 F3000
+G1 X69.200 Y92.400 E8.5304 F3000
+G1 X69.300 Y92.342 E8.5342 F3000
+G1 X69.400 Y92.288 E8.5379 F3000
+G1 X69.500 Y92.239 E8.5416 F3000
+G1 X69.600 Y92.193 E8.5452 F3000
+G1 X69.700 Y92.153 E8.5488 F3000
+G1 X69.800 Y92.117 E8.5523 F3000
+G1 X69.900 Y92.085 E8.5558 F3000
+G1 X70.000 Y92.059 E8.5592 F3000
+G1 X70.100 Y92.037 E8.5626 F3000
+G1 X70.200 Y92.021 E8.5659 F3000
+G1 X70.300 Y92.009 E8.5692 F3000
+G1 X70.400 Y92.002 E8.5725 F3000
+G1 X70.500 Y92.000 E8.5758 F3000
+G1 X70.600 Y92.003 E8.5791 F3000
+G1 X70.700 Y92.011 E8.5825 F3000
+G1 X70.800 Y92.024 E8.5858 F3000
+G1 X70.900 Y92.043 E8.5891 F3000
+G1 X71.000 Y92.066 E8.5925 F3000
+G1 X71.100 Y92.093 E8.5959 F3000
+G1 X71.200 Y92.126 E8.5994 F3000
+G1 X71.300 Y92.163 E8.6029 F3000
+G1 X71.400 Y92.205 E8.6065 F3000
+G1 X71.500 Y92.251 E8.6102 F3000
+G1 X71.600 Y92.302 E8.6139 F3000
+G1 X71.700 Y92.357 E8.6176 F3000
+G1 X71.800 Y92.416 E8.6215 F3000
+G1 X71.900 Y92.479 E8.6254 F3000
+G1 X72.000 Y92.546 E8.6293 F3000
+G1 X72.100 Y92.616 E8.6334 F3000
+G1 X72.200 Y92.690 E8.6375 F3000
+G1 X72.300 Y92.767 E8.6416 F3000
+G1 X72.400 Y92.847 E8.6459 F3000
+G1 X72.500 Y92.931 E8.6502 F3000
+G1 X72.600 Y93.016 E8.6545 F3000
+G1 X72.700 Y93.105 E8.6589 F3000
+G1 X72.800 Y93.195 E8.6634 F3000
+G1 X72.900 Y93.288 E8.6678 F3000
+G1 X73.000 Y93.382 E8.6724 F3000
+G1 X73.100 Y93.478 E8.6770 F3000
+G1 X73.200 Y93.575 E8.6816 F3000
+G1 X73.300 Y93.673 E8.6862 F3000
+G1 X73.400 Y93.772 E8.6908 F3000
+G1 X73.500 Y93.872 E8.6955 F3000
+G1 X73.600 Y93.972 E8.7001 F3000
+G1 X73.700 Y94.072 E8.7048 F3000
+G1 X73.800 Y94.171 E8.7095 F3000
+G1 X73.900 Y94.271 E8.7141 F3000
+G1 X74.000 Y94.370 E8.7188 F3000
+G1 X74.100 Y94.467 E8.7234 F3000
+G1 X74.200 Y94.564 E8.7280 F3000
+G1 X74.300 Y94.659 E8.7325 F3000
+G1 X74.400 Y94.753 E8.7370 F3000
+G1 X74.500 Y94.844 E8.7415 F3000
+G1 X74.600 Y94.934 E8.7459 F3000
+G1 X74.700 Y95.021 E8.7503 F3000
+G1 X74.800 Y95.106 E8.7547 F3000
+G1 X74.900 Y95.188 E8.7589 F3000
+G1 X75.000 Y95.267 E8.7631 F3000
+G1 X75.100 Y95.342 E8.7673 F3000
+G1 X75.200 Y95.415 E8.7713 F3000
+G1 X75.300 Y95.484 E8.7753 F3000
+G1 X75.400 Y95.549 E8.7793 F3000
+G1 X75.500 Y95.610 E8.7832 F3000
+G1 X75.600 Y95.667 E8.7870 F3000
+G1 X75.700 Y95.721 E8.7907 F3000
+G1 X75.800 Y95.769 E8.7944 F3000
+G1 X75.900 Y95.814 E8.7980 F3000
+G1 X76.000 Y95.854 E8.8015 F3000
+G1 X76.100 Y95.889 E8.8050 F3000
+G1 X76.200 Y95.919 E8.8085 F3000
+G1 X76.300 Y95.945 E8.8119 F3000
+G1 X76.400 Y95.966 E8.8153 F3000
+G1 X76.500 Y95.982 E8.8186 F3000
+G1 X76.600 Y95.993 E8.8219 F3000
+G1 X76.700 Y95.999 E8.8252 F3000
+G1 X76.800 Y96.000 E8.8285 F3000
+G1 X76.900 Y95.996 E8.8318 F3000
+G1 X77.000 Y95.987 E8.8351 F3000
+G1 X77.100 Y95.973 E8.8385 F3000
+G1 X77.200 Y95.954 E8.8418 F3000
+G1 X77.300 Y95.930 E8.8452 F3000
+G1 X77.400 Y95.902 E8.8487 F3000
+G1 X77.500 Y95.868 E8.8521 F3000
+G1 X77.600 Y95.830 E8.8557 F3000
+G1 X77.700 Y95.788 E8.8592 F3000
+G1 X77.800 Y95.741 E8.8629 F3000
+G1 X77.900 Y95.689 E8.8666 F3000
+G1 X78.000 Y95.633 E8.8704 F3000
+G1 X78.100 Y95.574 E8.8742 F3000
+G1 X78.200 Y95.510 E8.8781 F3000
+G1 X78.300 Y95.443 E8.8821 F3000
+G1 X78.400 Y95.372 E8.8862 F3000
+G1 X78.500 Y95.297 E8.8903 F3000
+G1 X78.600 Y95.219 E8.8945 F3000
+G1 X78.700 Y95.139 E8.8987 F3000
+G1 X78.800 Y95.055 E8.9030 F3000
+G1 X78.900 Y94.969 E8.9074 F3000
+G1 X79.000 Y94.880 E8.9118 F3000
+G1 X79.100 Y94.789 E8.9162 F3000
+G1 X79.200 Y94.697 E8.9207 F3000
+G1 X79.300 Y94.602 E8.9253 F3000
+G1 X79.400 Y94.506 E8.9298 F3000
+G1 X79.500 Y94.409 E8.9345 F3000
+G1 X79.600 Y94.310 E8.9391 F3000
+G1 X79.700 Y94.211 E8.9437 F3000
+G1 X79.800 Y94.111 E8.9484 F3000
+G1 X79.900 Y94.011 E8.9531 F3000
+G1 X80.000 Y93.912 E8.9577 F3000
+G1 X80.100 Y93.812 E8.9624 F3000
+G1 X80.200 Y93.712 E8.9670 F3000
+G1 X80.300 Y93.614 E8.9717 F3000
+G1 X80.400 Y93.516 E8.9763 F3000
+G1 X80.500 Y93.420 E8.9809 F3000
+G1 X80.600 Y93.325 E8.9854 F3000
+G1 X80.700 Y93.232 E8.9899 F3000
+G1 X80.800 Y93.140 E8.9944 F3000
+G1 X80.900 Y93.051 E8.9988 F3000
+G1 X81.000 Y92.964 E9.0032 F3000
+G1 X81.100 Y92.880 E9.0075 F3000
+G1 X81.200 Y92.799 E9.0118 F3000
+G1 X81.300 Y92.720 E9.0159 F3000
+G1 X81.400 Y92.645 E9.0201 F3000
+G1 X81.500 Y92.573 E9.0241 F3000
+G1 X81.600 Y92.505 E9.0281 F3000
+G1 X81.700 Y92.441 E9.0321 F3000
+G1 X81.800 Y92.380 E9.0359 F3000
+G1 X81.900 Y92.323 E9.0397 F3000
+G1 X82.000 Y92.271 E9.0434 F3000
+G1 X82.100 Y92.223 E9.0471 F3000
+G1 X82.200 Y92.179 E9.0507 F3000
+G1 X82.300 Y92.140 E9.0542 F3000
+G1 X82.400 Y92.106 E9.0577 F3000
+G1 X82.500 Y92.076 E9.0612 F3000
+G1 X82.600 Y92.051 E9.0646 F3000
+G1 X82.700 Y92.031 E9.0679 F3000
+G1 X82.800 Y92.016 E9.0713 F3000
+G1 X82.900 Y92.006 E9.0746 F3000
+G1 X83.000 Y92.001 E9.0779 F3000
+G1 X83.100 Y92.001 E9.0812 F3000
+G1 X83.200 Y92.005 E9.0845 F3000
+G1 X83.300 Y92.015 E9.0878 F3000
+G1 X83.400 Y92.030 E9.0912 F3000
+G1 X83.500 Y92.050 E9.0945 F3000
+G1 X83.600 Y92.074 E9.0979 F3000
+G1 X83.700 Y92.104 E9.1014 F3000
+G1 X83.800 Y92.138 E9.1048 F3000
+G1 X83.900 Y92.177 E9.1084 F3000
+G1 X84.000 Y92.220 E9.1120 F3000
+G1 X84.100 Y92.268 E9.1156 F3000
+G1 X84.200 Y92.320 E9.1194 F3000
+G1 X84.300 Y92.376 E9.1231 F3000
+G1 X84.400 Y92.437 E9.1270 F3000
+G1 X84.500 Y92.501 E9.1309 F3000
+G1 X84.600 Y92.569 E9.1349 F3000
+G1 X84.700 Y92.641 E9.1390 F3000
+G1 X84.800 Y92.716 E9.1431 F3000
+G1 X84.900 Y92.794 E9.1473 F3000
+G1 X85.000 Y92.875 E9.1515 F3000
+G1 X85.100 Y92.959 E9.1559 F3000
+G1 X85.200 Y93.046 E9.1602 F3000
+G1 X85.300 Y93.135 E9.1646 F3000
+G1 X85.400 Y93.226 E9.1691 F3000
+G1 X85.500 Y93.319 E9.1736 F3000
+G1 X85.600 Y93.414 E9.1782 F3000
+G1 X85.700 Y93.510 E9.1827 F3000
+G1 X85.800 Y93.608 E9.1874 F3000
+G1 X85.900 Y93.706 E9.1920 F3000
+G1 X86.000 Y93.806 E9.1966 F3000
+G1 X86.100 Y93.905 E9.2013 F3000
+G1 X86.200 Y94.005 E9.2060 F3000
+G1 X86.300 Y94.105 E9.2106 F3000
+G1 X86.400 Y94.205 E9.2153 F3000
+G1 X86.500 Y94.304 E9.2199 F3000
+G1 X86.600 Y94.403 E9.2246 F3000
+G1 X86.700 Y94.500 E9.2292 F3000
+G1 X86.800 Y94.596 E9.2338 F3000
+G1 X86.900 Y94.691 E9.2383 F3000
+G1 X87.000 Y94.784 E9.2428 F3000
+G1 X87.100 Y94.875 E9.2473 F3000
+G1 X87.200 Y94.964 E9.2517 F3000
+G1 X87.300 Y95.050 E9.2560 F3000
+G1 X87.400 Y95.134 E9.2603 F3000
+G1 X87.500 Y95.215 E9.2646 F3000
+G1 X87.600 Y95.293 E9.2688 F3000
+G1 X87.700 Y95.367 E9.2729 F3000
+G1 X87.800 Y95.438 E9.2769 F3000
+G1 X87.900 Y95.506 E9.2809 F3000
+G1 X88.000 Y95.570 E9.2848 F3000
+G1 X88.100 Y95.630 E9.2887 F3000
+G1 X88.200 Y95.686 E9.2925 F3000
+G1 X88.300 Y95.737 E9.2962 F3000
+G1 X88.400 Y95.785 E9.2998 F3000
+G1 X88.500 Y95.828 E9.3034 F3000
+G1 X88.600 Y95.866 E9.3070 F3000
+G1 X88.700 Y95.900 E9.3104 F3000
+G1 X88.800 Y95.929 E9.3139 F3000
+G1 X88.900 Y95.953 E9.3173 F3000
+G1 X89.000 Y95.972 E9.3206 F3000
+G1 X89.100 Y95.986 E9.3240 F3000
+G1 X89.200 Y95.995 E9.3273 F3000
+G1 X89.300 Y96.000 E9.3306 F3000
+G1 X89.400 Y95.999 E9.3339 F3000
+G1 X89.500 Y95.993 E9.3372 F3000
+G1 X89.600 Y95.983 E9.3405 F3000
+G1 X89.700 Y95.967 E9.3438 F3000
+G1 X89.800 Y95.946 E9.3472 F3000
+G1 X89.900 Y95.921 E9.3506 F3000
+G1 X90.000 Y95.891 E9.3541 F3000
+G1 X90.100 Y95.856 E9.3576 F3000
+G1 X90.200 Y95.816 E9.3611 F3000
+G1 X90.300 Y95.772 E9.3647 F3000
+G1 X90.400 Y95.724 E9.3684 F3000
+G1 X90.500 Y95.671 E9.3721 F3000
+G1 X90.600 Y95.614 E9.3759 F3000
+G1 X90.700 Y95.553 E9.3798 F3000
+G1 X90.800 Y95.488 E9.3837 F3000
+G1 X90.900 Y95.419 E9.3877 F3000
+G1 X91.000 Y95.347 E9.3918 F3000
+G1 X91.100 Y95.271 E9.3959 F3000
+G1 X91.200 Y95.193 E9.4001 F3000
+G1 X91.300 Y95.111 E9.4044 F3000
+G1 X91.400 Y95.026 E9.4087 F3000
+G1 X91.500 Y94.939 E9.4131 F3000
+G1 X91.600 Y94.850 E9.4175 F3000
+G1 X91.700 Y94.758 E9.4220 F3000
+G1 X91.800 Y94.665 E9.4265 F3000
+G1 X91.900 Y94.570 E9.4311 F3000
+G1 X92.000 Y94.473 E9.4356 F3000
+G1 X92.100 Y94.376 E9.4403 F3000
+G1 X92.200 Y94.277 E9.4449 F3000
+G1 X92.300 Y94.178 E9.4495 F3000
+G1 X92.400 Y94.078 E9.4542 F3000
+G1 X92.500 Y93.978 E9.4589 F3000
+G1 X92.600 Y93.878 E9.4635 F3000
+G1 X92.700 Y93.778 E9.4682 F3000
+G1 X92.800 Y93.679 E9.4728 F3000
+G1 X92.900 Y93.581 E9.4775 F3000
+G1 X93.000 Y93.484 E9.4821 F3000
+G1 X93.100 Y93.388 E9.4866 F3000
+G1 X93.200 Y93.293 E9.4912 F3000
+G1 X93.300 Y93.201 E9.4957 F3000
+G1 X93.400 Y93.110 E9.5001 F3000
+G1 X93.500 Y93.022 E9.5045 F3000
+G1 X93.600 Y92.936 E9.5089 F3000
+G1 X93.700 Y92.853 E9.5132 F3000
+G1 X93.800 Y92.772 E9.5174 F3000
+G1 X93.900 Y92.695 E9.5216 F3000
+G1 X94.000 Y92.621 E9.5257 F3000
+G1 X94.100 Y92.550 E9.5297 F3000
+G1 X94.200 Y92.483 E9.5337 F3000
+G1 X94.300 Y92.420 E9.5376 F3000
+G1 X94.400 Y92.360 E9.5415 F3000
+G1 X94.500 Y92.305 E9.5452 F3000
+G1 X94.600 Y92.254 E9.5489 F3000
+G1 X94.700 Y92.208 E9.5526 F3000
+G1 X94.800 Y92.166 E9.5561 F3000
+G1 X94.900 Y92.128 E9.5597 F3000
+G1 X95.000 Y92.095 E9.5631 F3000
+G1 X95.100 Y92.067 E9.5666 F3000
+G1 X95.200 Y92.044 E9.5700 F3000
+G1 X95.300 Y92.025 E9.5733 F3000
+G1 X95.400 Y92.012 E9.5766 F3000
+G1 X95.500 Y92.004 E9.5800 F3000
+G1 X95.600 Y92.000 E9.5833 F3000
+G1 X95.700 Y92.002 E9.5866 F3000
+G1 X95.800 Y92.008 E9.5899 F3000
+G1 X95.900 Y92.020 E9.5932 F3000
+G1 X96.000 Y92.036 E9.5965 F3000
+G1 X96.100 Y92.057 E9.5999 F3000
+G1 X96.200 Y92.084 E9.6033 F3000
+G1 X96.300 Y92.115 E9.6068 F3000
+G1 X96.400 Y92.150 E9.6103 F3000
+G1 X96.500 Y92.191 E9.6138 F3000
+G1 X96.600 Y92.236 E9.6175 F3000
+G1 X96.700 Y92.285 E9.6211 F3000
+G1 X96.800 Y92.338 E9.6249 F3000
+G1 X96.900 Y92.396 E9.6287 F3000
+G1 X97.000 Y92.458 E9.6326 F3000
+G1 X97.100 Y92.523 E9.6365 F3000
+G1 X97.200 Y92.593 E9.6405 F3000
+G1 X97.300 Y92.665 E9.6446 F3000
+G1 X97.400 Y92.742 E9.6488 F3000
+G1 X97.500 Y92.821 E9.6530 F3000
+G1 X97.600 Y92.903 E9.6572 F3000
+G1 X97.700 Y92.988 E9.6616 F3000
+G1 X97.800 Y93.076 E9.6660 F3000
+G1 X97.900 Y93.165 E9.6704 F3000
+G1 X98.000 Y93.257 E9.6749 F3000
+G1 X98.100 Y93.351 E9.6794 F3000
+G1 X98.200 Y93.446 E9.6840 F3000
+G1 X98.300 Y93.543 E9.6885 F3000
+G1 X98.400 Y93.641 E9.6932 F3000
+G1 X98.500 Y93.740 E9.6978 F3000
+G1 X98.600 Y93.839 E9.7025 F3000
+G1 X98.700 Y93.939 E9.7071 F3000
+G1 X98.800 Y94.039 E9.7118 F3000
+G1 X98.900 Y94.139 E9.7164 F3000
+G1 X99.000 Y94.238 E9.7211 F3000
+G1 X99.100 Y94.337 E9.7257 F3000
+G1 X99.200 Y94.435 E9.7304 F3000
+G1 X99.300 Y94.532 E9.7350 F3000
+G1 X99.400 Y94.628 E9.7395 F3000
+G1 X99.500 Y94.722 E9.7441 F3000
+G1 X99.600 Y94.815 E9.7486 F3000
+G1 X99.700 Y94.905 E9.7530 F3000
+G1 X99.800 Y94.993 E9.7574 F3000
+G1 X99.900 Y95.078 E9.7617 F3000
+G1 X100.000 Y95.161 E9.7660 F3000
+G1 X100.100 Y95.241 E9.7703 F3000
+G1 X100.200 Y95.318 E9.7744 F3000
+G1 X100.300 Y95.392 E9.7785 F3000
+G1 X100.400 Y95.462 E9.7825 F3000
+G1 X100.500 Y95.528 E9.7865 F3000
+G1 X100.600 Y95.591 E9.7904 F3000
+G1 X100.700 Y95.649 E9.7942 F3000
+G1 X100.800 Y95.704 E9.7980 F3000
+G1 X100.900 Y95.754 E9.8017 F3000
+G1 X101.000 Y95.800 E9.8053 F3000
+G1 X101.100 Y95.841 E9.8089 F3000
+G1 X101.200 Y95.878 E9.8124 F3000
+G1 X101.300 Y95.910 E9.8159 F3000
+G1 X101.400 Y95.937 E9.8193 F3000
+G1 X101.500 Y95.960 E9.8227 F3000
+G1 X101.600 Y95.977 E9.8260 F3000
+G1 X101.700 Y95.990 E9.8293 F3000
+G1 X101.800 Y95.997 E9.8326 F3000
+G1 X101.900 Y96.000 E9.8359 F3000
+G1 X102.000 Y95.998 E9.8392 F3000
+G1 X102.100 Y95.990 E9.8426 F3000
+G1 X102.200 Y95.978 E9.8459 F3000
+G1 X102.300 Y95.961 E9.8492 F3000
+G1 X102.400 Y95.938 E9.8526 F3000
+G1 X102.500 Y95.911 E9.8560 F3000
+G1 X102.600 Y95.880 E9.8595 F3000
+G1 X102.700 Y95.843 E9.8630 F3000
+G1 X102.800 Y95.802 E9.8666 F3000
+G1 X102.900 Y95.756 E9.8702 F3000
+G1 X103.000 Y95.706 E9.8739 F3000
+G1 X103.100 Y95.652 E9.8776 F3000
+G1 X103.200 Y95.594 E9.8815 F3000
+G1 X103.300 Y95.531 E9.8853 F3000
+G1 X103.400 Y95.465 E9.8893 F3000
+G1 X103.500 Y95.395 E9.8933 F3000
+G1 X103.600 Y95.322 E9.8974 F3000
+G1 X103.700 Y95.245 E9.9016 F3000
+G1 X103.800 Y95.166 E9.9058 F3000
+G1 X103.900 Y95.083 E9.9101 F3000
+G1 X104.000 Y94.997 E9.9144 F3000
+G1 X104.100 Y94.910 E9.9188 F3000
+G1 X104.200 Y94.819 E9.9233 F3000
+G1 X104.300 Y94.727 E9.9278 F3000
+G1 X104.400 Y94.633 E9.9323 F3000
+G1 X104.500 Y94.538 E9.9368 F3000
+G1 X104.600 Y94.441 E9.9414 F3000
+G1 X104.700 Y94.343 E9.9461 F3000
+G1 X104.800 Y94.244 E9.9507 F3000
+G1 X104.900 Y94.144 E9.9554 F3000
+G1 X105.000 Y94.044 E9.9600 F3000
+G1 X105.100 Y93.944 E9.9647 F3000
+G1 X105.200 Y93.844 E9.9694 F3000
+G1 X105.300 Y93.745 E9.9740 F3000
+G1 X105.400 Y93.646 E9.9787 F3000
+G1 X105.500 Y93.548 E9.9833 F3000
+G1 X105.600 Y93.451 E9.9879 F3000
+G1 X105.700 Y93.356 E9.9924 F3000
+G1 X105.800 Y93.262 E9.9969 F3000
+G1 X105.900 Y93.170 E10.0014 F3000
+G1 X106.000 Y93.080 E10.0059 F3000
+G1 X106.100 Y92.993 E10.0103 F3000
+G1 X106.200 Y92.907 E10.0146 F3000
+G1 X106.300 Y92.825 E10.0189 F3000
+G1 X106.400 Y92.746 E10.0231 F3000
+G1 X106.500 Y92.669 E10.0272 F3000
+G1 X106.600 Y92.596 E10.0313 F3000
+G1 X106.700 Y92.527 E10.0353 F3000
+G1 X106.800 Y92.461 E10.0393 F3000
+G1 X106.900 Y92.399 E10.0432 F3000
+G1 X107.000 Y92.341 E10.0470 F3000
+G1 X107.100 Y92.288 E10.0507 F3000
+G1 X107.200 Y92.238 E10.0544 F3000
+G1 X107.300 Y92.193 E10.0580 F3000
+G1 X107.400 Y92.152 E10.0616 F3000
+G1 X107.500 Y92.116 E10.0651 F3000
+G1 X107.600 Y92.085 E10.0686 F3000
+G1 X107.700 Y92.059 E10.0720 F3000
+G1 X107.800 Y92.037 E10.0753 F3000
+G1 X107.900 Y92.020 E10.0787 F3000
+G1 X108.000 Y92.009 E10.0820 F3000
+G1 X108.100 Y92.002 E10.0853 F3000
+G1 X108.200 Y92.000 E10.0886 F3000
+G1 X108.300 Y92.003 E10.0919 F3000
+G1 X108.400 Y92.011 E10.0952 F3000
+G1 X108.500 Y92.025 E10.0986 F3000
+G1 X108.600 Y92.043 E10.1019 F3000
+G1 X108.700 Y92.066 E10.1053 F3000
+G1 X108.800 Y92.094 E10.1087 F3000
+G1 X108.900 Y92.126 E10.1122 F3000
+G1 X109.000 Y92.163 E10.1157 F3000
+G1 X109.100 Y92.205 E10.1193 F3000
+G1 X109.200 Y92.252 E10.1229 F3000
+G1 X109.300 Y92.302 E10.1266 F3000
+G1 X109.400 Y92.357 E10.1304 F3000
+G1 X109.500 Y92.416 E10.1342 F3000
+G1 X109.600 Y92.479 E10.1381 F3000
+G1 X109.700 Y92.546 E10.1421 F3000
+G1 X109.800 Y92.617 E10.1461 F3000
+G1 X109.900 Y92.691 E10.1502 F3000
+G1 X110.000 Y92.768 E10.1544 F3000
+G1 X110.100 Y92.848 E10.1586 F3000
+G1 X110.200 Y92.931 E10.1629 F3000
+G1 X110.300 Y93.017 E10.1673 F3000
+G1 X110.400 Y93.105 E10.1717 F3000
+G1 X110.500 Y93.196 E10.1761 F3000
+G1 X110.600 Y93.289 E10.1806 F3000
+G1 X110.700 Y93.383 E10.1852 F3000
+G1 X110.800 Y93.479 E10.1897 F3000
+G1 X110.900 Y93.576 E10.1943 F3000
+G1 X111.000 Y93.674 E10.1990 F3000
+G1 X111.100 Y93.773 E10.2036 F3000
+G1 X111.200 Y93.873 E10.2083 F3000
+G1 X111.300 Y93.973 E10.2129 F3000
+G1 X111.400 Y94.073 E10.2176 F3000
+G1 X111.500 Y94.172 E10.2223 F3000
+G1 X111.600 Y94.272 E10.2269 F3000
+G1 X111.700 Y94.370 E10.2316 F3000
+G1 X111.800 Y94.468 E10.2362 F3000
+G1 X111.900 Y94.565 E10.2408 F3000
+G1 X112.000 Y94.660 E10.2453 F3000
+G1 X112.100 Y94.754 E10.2498 F3000
+G1 X112.200 Y94.845 E10.2543 F3000
+G1 X112.300 Y94.935 E10.2587 F3000
+G1 X112.400 Y95.022 E10.2631 F3000
+G1 X112.500 Y95.107 E10.2674 F3000
+G1 X112.600 Y95.188 E10.2717 F3000
+G1 X112.700 Y95.267 E10.2759 F3000
+G1 X112.800 Y95.343 E10.2800 F3000
+G1 X112.900 Y95.415 E10.2841 F3000
+G1 X113.000 Y95.484 E10.2881 F3000
+G1 X113.100 Y95.549 E10.2921 F3000
+G1 X113.200 Y95.611 E10.2959 F3000
+G1 X113.300 Y95.668 E10.2997 F3000
+G1 X113.400 Y95.721 E10.3035 F3000
+G1 X113.500 Y95.770 E10.3071 F3000
+G1 X113.600 Y95.814 E10.3108 F3000
+G1 X113.700 Y95.854 E10.3143 F3000
+G1 X113.800 Y95.889 E10.3178 F3000
+G1 X113.900 Y95.920 E10.3213 F3000
+G1 X114.000 Y95.945 E10.3247 F3000
+G1 X114.100 Y95.966 E10.3280 F3000
+G1 X114.200 Y95.982 E10.3314 F3000
+G1 X114.300 Y95.993 E10.3347 F3000
+G1 X114.400 Y95.999 E10.3380 F3000
+G1 X114.500 Y96.000 E10.3413 F3000
+G1 X114.600 Y95.996 E10.3446 F3000
+G1 X114.700 Y95.987 E10.3479 F3000
+G1 X114.800 Y95.973 E10.3512 F3000
+G1 X114.900 Y95.954 E10.3546 F3000
+G1 X115.000 Y95.930 E10.3580 F3000
+G1 X115.100 Y95.901 E10.3614 F3000
+G1 X115.200 Y95.868 E10.3649 F3000
+G1 X115.300 Y95.830 E10.3684 F3000
+G1 X115.400 Y95.787 E10.3720 F3000
+G1 X115.500 Y95.740 E10.3757 F3000
+G1 X115.600 Y95.689 E10.3794 F3000
+G1 X115.700 Y95.633 E10.3832 F3000
+G1 X115.800 Y95.573 E10.3870 F3000
+G1 X115.900 Y95.510 E10.3909 F3000
+G1 X116.000 Y95.442 E10.3949 F3000
+G1 X116.100 Y95.371 E10.3990 F3000
+G1 X116.200 Y95.297 E10.4031 F3000
+G1 X116.300 Y95.219 E10.4072 F3000
+G1 X116.400 Y95.138 E10.4115 F3000
+G1 X116.500 Y95.054 E10.4158 F3000
+G1 X116.600 Y94.968 E10.4201 F3000
+G1 X116.700 Y94.879 E10.4246 F3000
+G1 X116.800 Y94.789 E10.4290 F3000
+G1 X116.900 Y94.696 E10.4335 F3000
+G1 X117.000 Y94.601 E10.4381 F3000
+G1 X117.100 Y94.505 E10.4426 F3000
+G1 X117.200 Y94.408 E10.4472 F3000
+G1 X117.300 Y94.309 E10.4519 F3000
+G1 X117.400 Y94.210 E10.4565 F3000
+G1 X117.500 Y94.111 E10.4612 F3000
+G1 X117.600 Y94.011 E10.4658 F3000
+G1 X117.700 Y93.911 E10.4705 F3000
+G1 X117.800 Y93.811 E10.4752 F3000
+G1 X117.900 Y93.712 E10.4798 F3000
+G1 X118.000 Y93.613 E10.4845 F3000
+G1 X118.100 Y93.515 E10.4891 F3000
+G1 X118.200 Y93.419 E10.4936 F3000
+G1 X118.300 Y93.324 E10.4982 F3000
+G1 X118.400 Y93.231 E10.5027 F3000
+G1 X118.500 Y93.140 E10.5072 F3000
+G1 X118.600 Y93.050 E10.5116 F3000
+G1 X118.700 Y92.964 E10.5160 F3000
+G1 X118.800 Y92.879 E10.5203 F3000
+G1 X118.900 Y92.798 E10.5245 F3000
+G1 X119.000 Y92.720 E10.5287 F3000
+G1 X119.100 Y92.644 E10.5329 F3000
+G1 X119.200 Y92.573 E10.5369 F3000
+G1 X119.300 Y92.504 E10.5409 F3000
+G1 X119.400 Y92.440 E10.5448 F3000
+G1 X119.500 Y92.379 E10.5487 F3000
+G1 X119.600 Y92.323 E10.5525 F3000
+G1 X119.700 Y92.270 E10.5562 F3000
+G1 X119.800 Y92.222 E10.5599 F3000
+G1 X119.900 Y92.179 E10.5635 F3000
+G1 X120.000 Y92.140 E10.5670 F3000
+G1 X120.100 Y92.105 E10.5705 F3000
+G1 X120.200 Y92.076 E10.5740 F3000
+G1 X120.300 Y92.051 E10.5774 F3000
+G1 X120.400 Y92.031 E10.5807 F3000
+G1 X120.500 Y92.016 E10.5841 F3000
+G1 X120.600 Y92.006 E10.5874 F3000
+G1 X120.700 Y92.001 E10.5907 F3000
+G1 X120.800 Y92.001 E10.5940 F3000
+G1 X120.900 Y92.005 E10.5973 F3000
+G1 X121.000 Y92.015 E10.6006 F3000
+G1 X121.100 Y92.030 E10.6039 F3000
+G1 X121.200 Y92.050 E10.6073 F3000
+G1 X121.300 Y92.075 E10.6107 F3000
+G1 X121.400 Y92.104 E10.6141 F3000
+G1 X121.500 Y92.138 E10.6176 F3000
+G1 X121.600 Y92.177 E10.6212 F3000
+G1 X121.700 Y92.220 E10.6248 F3000
+G1 X121.800 Y92.268 E10.6284 F3000
+G1 X121.900 Y92.320 E10.6321 F3000
+G1 X122.000 Y92.377 E10.6359 F3000
+G1 X122.100 Y92.437 E10.6398 F3000
+G1 X122.200 Y92.502 E10.6437 F3000
+G1 X122.300 Y92.570 E10.6477 F3000
+G1 X122.400 Y92.641 E10.6518 F3000
+G1 X122.500 Y92.716 E10.6559 F3000
+G1 X122.600 Y92.795 E10.6601 F3000
+G1 X122.700 Y92.876 E10.6643 F3000
+G1 X122.800 Y92.960 E10.6686 F3000
+G1 X122.900 Y93.047 E10.6730 F3000
+G1 X123.000 Y93.136 E10.6774 F3000
+G1 X123.100 Y93.227 E10.6819 F3000
+G1 X123.200 Y93.320 E10.6864 F3000
+G1 X123.300 Y93.415 E10.6910 F3000
+G1 X123.400 Y93.511 E10.6955 F3000
+G1 X123.500 Y93.609 E10.7001 F3000
+G1 X123.600 Y93.707 E10.7048 F3000
+G1 X123.700 Y93.807 E10.7094 F3000
+G1 X123.800 Y93.906 E10.7141 F3000
+G1 X123.900 Y94.006 E10.7188 F3000
+G1 X124.000 Y94.106 E10.7234 F3000
+G1 X124.100 Y94.206 E10.7281 F3000
+G1 X124.200 Y94.305 E10.7327 F3000
+G1 X124.300 Y94.403 E10.7374 F3000
+G1 X124.400 Y94.501 E10.7420 F3000
+G1 X124.500 Y94.597 E10.7465 F3000
+G1 X124.600 Y94.692 E10.7511 F3000
+G1 X124.700 Y94.785 E10.7556 F3000
+G1 X124.800 Y94.876 E10.7601 F3000
+G1 X124.900 Y94.964 E10.7645 F3000
+G1 X125.000 Y95.051 E10.7688 F3000
+G1 X125.100 Y95.134 E10.7731 F3000
+G1 X125.200 Y95.215 E10.7774 F3000
+G1 X125.300 Y95.293 E10.7816 F3000
+G1 X125.400 Y95.368 E10.7857 F3000
+G1 X125.500 Y95.439 E10.7897 F3000
+G1 X125.600 Y95.507 E10.7937 F3000
+G1 X125.700 Y95.571 E10.7976 F3000
+G1 X125.800 Y95.630 E10.8015 F3000
+G1 X125.900 Y95.686 E10.8053 F3000
+G1 X126.000 Y95.738 E10.8090 F3000
+G1 X126.100 Y95.785 E10.8126 F3000
+G1 X126.200 Y95.828 E10.8162 F3000
+G1 X126.300 Y95.866 E10.8197 F3000
+G1 X126.400 Y95.900 E10.8232 F3000
+G1 X126.500 Y95.929 E10.8267 F3000
+G1 X126.600 Y95.953 E10.8300 F3000
+G1 X126.700 Y95.972 E10.8334 F3000
+G1 X126.800 Y95.986 E10.8367 F3000
+G1 X126.900 Y95.995 E10.8401 F3000
+G1 X127.000 Y96.000 E10.8434 F3000
+G1 X127.100 Y95.999 E10.8467 F3000
+G1 X127.200 Y95.993 E10.8500 F3000
+G1 X127.300 Y95.983 E10.8533 F3000
+G1 X127.400 Y95.967 E10.8566 F3000
+G1 X127.500 Y95.946 E10.8600 F3000
+G1 X127.600 Y95.921 E10.8634 F3000
+G1 X127.700 Y95.891 E10.8668 F3000
+G1 X127.800 Y95.856 E10.8703 F3000
+G1 X127.900 Y95.816 E10.8739 F3000
+G1 X128.000 Y95.772 E10.8775 F3000
+G1 X128.100 Y95.723 E10.8812 F3000
+G1 X128.200 Y95.670 E10.8849 F3000
+G1 X128.300 Y95.613 E10.8887 F3000
+G1 X128.400 Y95.552 E10.8926 F3000
+G1 X128.500 Y95.487 E10.8965 F3000
+G1 X128.600 Y95.419 E10.9005 F3000
+G1 X128.700 Y95.346 E10.9046 F3000
+G1 X128.800 Y95.271 E10.9087 F3000
+G1 X128.900 Y95.192 E10.9129 F3000
+G1 X129.000 Y95.110 E10.9172 F3000
+G1 X129.100 Y95.026 E10.9215 F3000
+G1 X129.200 Y94.939 E10.9259 F3000
+G1 X129.300 Y94.849 E10.9303 F3000
+G1 X129.400 Y94.758 E10.9348 F3000
+G1 X129.500 Y94.664 E10.9393 F3000
+G1 X129.600 Y94.569 E10.9438 F3000
+G1 X129.700 Y94.472 E10.9484 F3000
+G1 X129.800 Y94.375 E10.9530 F3000
+G1 X129.900 Y94.276 E10.9577 F3000
+G1 X130.000 Y94.177 E10.9623 F3000
+G1 X130.100 Y94.077 E10.9670 F3000
+G1 X130.200 Y93.977 E10.9717 F3000
+G1 X130.300 Y93.877 E10.9763 F3000
+G1 X130.400 Y93.777 E10.9810 F3000
+G1 X130.500 Y93.678 E10.9856 F3000
+G1 X130.600 Y93.580 E10.9903 F3000
+G1 X130.700 Y93.483 E10.9949 F3000
+G1 X130.800 Y93.387 E10.9994 F3000
+G1 X130.900 Y93.293 E11.0040 F3000
+G1 X131.000 Y93.200 E11.0085 F3000
+G1 X131.100 Y93.109 E11.0129 F3000
+G1 X131.200 Y93.021 E11.0173 F3000
+G1 X131.300 Y92.935 E11.0217 F3000
+G1 X131.400 Y92.852 E11.0260 F3000
+G1 X131.500 Y92.771 E11.0302 F3000
+G1 X131.600 Y92.694 E11.0344 F3000
+G1 X131.700 Y92.620 E11.0385 F3000
+G1 X131.800 Y92.549 E11.0425 F3000
+G1 X131.900 Y92.482 E11.0465 F3000
+G1 X132.000 Y92.419 E11.0504 F3000
+G1 X132.100 Y92.360 E11.0542 F3000
+G1 X132.200 Y92.305 E11.0580 F3000
+G1 X132.300 Y92.254 E11.0617 F3000
+G1 X132.400 Y92.207 E11.0653 F3000
+G1 X132.500 Y92.165 E11.0689 F3000
+G1 X132.600 Y92.128 E11.0725 F3000
+G1 X132.700 Y92.095 E11.0759 F3000
+G1 X132.800 Y92.067 E11.0794 F3000
+G1 X132.900 Y92.044 E11.0827 F3000
+G1 X133.000 Y92.025 E11.0861 F3000
+G1 X133.100 Y92.012 E11.0894 F3000
+G1 X133.200 Y92.004 E11.0927 F3000
+G1 X133.300 Y92.000 E11.0960 F3000
+G1 X133.400 Y92.002 E11.0993 F3000
+G1 X133.500 Y92.008 E11.1026 F3000
+G1 X133.600 Y92.020 E11.1060 F3000
+G1 X133.700 Y92.036 E11.1093 F3000
+G1 X133.800 Y92.058 E11.1127 F3000
+G1 X133.900 Y92.084 E11.1161 F3000
+G1 X134.000 Y92.115 E11.1196 F3000
+G1 X134.100 Y92.151 E11.1231 F3000
+G1 X134.200 Y92.191 E11.1266 F3000
+G1 X134.300 Y92.236 E11.1302 F3000
+G1 X134.400 Y92.285 E11.1339 F3000
+G1 X134.500 Y92.339 E11.1377 F3000
+G1 X134.600 Y92.397 E11.1415 F3000
+G1 X134.700 Y92.458 E11.1453 F3000
+G1 X134.800 Y92.524 E11.1493 F3000
+G1 X134.900 Y92.593 E11.1533 F3000
+G1 X135.000 Y92.666 E11.1574 F3000
+G1 X135.100 Y92.742 E11.1615 F3000
+G1 X135.200 Y92.822 E11.1658 F3000
+G1 X135.300 Y92.904 E11.1700 F3000
+G1 X135.400 Y92.989 E11.1744 F3000
+G1 X135.500 Y93.076 E11.1787 F3000
+G1 X135.600 Y93.166 E11.1832 F3000
+G1 X135.700 Y93.258 E11.1877 F3000
+G1 X135.800 Y93.352 E11.1922 F3000
+G1 X135.900 Y93.447 E11.1967 F3000
+G1 X136.000 Y93.544 E11.2013 F3000
+G1 X136.100 Y93.642 E11.2060 F3000
+G1 X136.200 Y93.741 E11.2106 F3000
+G1 X136.300 Y93.840 E11.2152 F3000
+G1 X136.400 Y93.940 E11.2199 F3000
+G1 X136.500 Y94.040 E11.2246 F3000
+G1 X136.600 Y94.140 E11.2292 F3000
+G1 X136.700 Y94.239 E11.2339 F3000
+G1 X136.800 Y94.338 E11.2385 F3000
+G1 X136.900 Y94.436 E11.2432 F3000
+G1 X137.000 Y94.533 E11.2478 F3000
+G1 X137.100 Y94.629 E11.2523 F3000
+G1 X137.200 Y94.723 E11.2569 F3000
+G1 X137.300 Y94.815 E11.2613 F3000
+G1 X137.400 Y94.906 E11.2658 F3000
+G1 X137.500 Y94.994 E11.2702 F3000
+G1 X137.600 Y95.079 E11.2745 F3000
+G1 X137.700 Y95.162 E11.2788 F3000
+G1 X137.800 Y95.242 E11.2830 F3000
+G1 X137.900 Y95.319 E11.2872 F3000
+G1 X138.000 Y95.392 E11.2913 F3000
+G1 X138.100 Y95.462 E11.2953 F3000
+G1 X138.200 Y95.529 E11.2993 F3000
+G1 X138.300 Y95.591 E11.3032 F3000
+G1 X138.400 Y95.650 E11.3070 F3000
+G1 X138.500 Y95.704 E11.3108 F3000
+G1 X138.600 Y95.754 E11.3145 F3000
+G1 X138.700 Y95.800 E11.3181 F3000
+G1 X138.800 Y95.841 E11.3217 F3000
+G1 X138.900 Y95.878 E11.3252 F3000
+G1 X139.000 Y95.910 E11.3286 F3000
+G1 X139.100 Y95.937 E11.3321 F3000
+G1 X139.200 Y95.960 E11.3354 F3000
+G1 X139.300 Y95.977 E11.3388 F3000
+G1 X139.400 Y95.990 E11.3421 F3000
+G1 X139.500 Y95.997 E11.3454 F3000
+G1 X139.600 Y96.000 E11.3487 F3000
+G1 X139.700 Y95.998 E11.3520 F3000
+G1 X139.800 Y95.990 E11.3553 F3000
+G1 X139.900 Y95.978 E11.3587 F3000
+G1 X140.000 Y95.960 E11.3620 F3000
+G1 X140.100 Y95.938 E11.3654 F3000
+G1 X140.200 Y95.911 E11.3688 F3000
+G1 X140.300 Y95.879 E11.3723 F3000
+G1 X140.400 Y95.843 E11.3758 F3000
+G1 X140.500 Y95.802 E11.3793 F3000
+G1 X140.600 Y95.756 E11.3830 F3000
+G1 X140.700 Y95.706 E11.3867 F3000
+G1 X140.800 Y95.652 E11.3904 F3000
+G1 X140.900 Y95.593 E11.3942 F3000
+G1 X141.000 Y95.531 E11.3981 F3000
+G1 X141.100 Y95.465 E11.4021 F3000
+G1 X141.200 Y95.395 E11.4061 F3000
+G1 X141.300 Y95.321 E11.4102 F3000
+G1 X141.400 Y95.245 E11.4144 F3000
+G1 X141.500 Y95.165 E11.4186 F3000
+G1 X141.600 Y95.082 E11.4229 F3000
+G1 X141.700 Y94.997 E11.4272 F3000
+G1 X141.800 Y94.909 E11.4316 F3000
+G1 X141.900 Y94.819 E11.4361 F3000
+G1 X142.000 Y94.726 E11.4405 F3000
+G1 X142.100 Y94.632 E11.4451 F3000
+G1 X142.200 Y94.537 E11.4496 F3000
+G1 X142.300 Y94.440 E11.4542 F3000
+G1 X142.400 Y94.342 E11.4589 F3000
+G1 X142.500 Y94.243 E11.4635 F3000
+G1 X142.600 Y94.143 E11.4682 F3000
+G1 X142.700 Y94.043 E11.4728 F3000
+G1 X142.800 Y93.943 E11.4775 F3000
+G1 X142.900 Y93.843 E11.4821 F3000
+G1 X143.000 Y93.744 E11.4868 F3000
+G1 X143.100 Y93.645 E11.4914 F3000
+G1 X143.200 Y93.547 E11.4961 F3000
+G1 X143.300 Y93.450 E11.5007 F3000
+G1 X143.400 Y93.355 E11.5052 F3000
+G1 X143.500 Y93.261 E11.5097 F3000
+G1 X143.600 Y93.169 E11.5142 F3000
+G1 X143.700 Y93.079 E11.5187 F3000
+G1 X143.800 Y92.992 E11.5230 F3000
+G1 X143.900 Y92.907 E11.5274 F3000
+G1 X144.000 Y92.824 E11.5317 F3000
+G1 X144.100 Y92.745 E11.5359 F3000
+G1 X144.200 Y92.669 E11.5400 F3000
+G1 X144.300 Y92.596 E11.5441 F3000
+G1 X144.400 Y92.526 E11.5481 F3000
+G1 X144.500 Y92.461 E11.5521 F3000
+G1 X144.600 Y92.399 E11.5559 F3000
+G1 X144.700 Y92.341 E11.5598 F3000
+G1 X144.800 Y92.287 E11.5635 F3000
+G1 X144.900 Y92.238 E11.5672 F3000
+G1 X145.000 Y92.193 E11.5708 F3000
+G1 X145.100 Y92.152 E11.5744 F3000
+G1 X145.200 Y92.116 E11.5779 F3000
+G1 X145.300 Y92.085 E11.5813 F3000
+G1 X145.400 Y92.059 E11.5847 F3000
+G1 X145.500 Y92.037 E11.5881 F3000
+G1 X145.600 Y92.020 E11.5915 F3000
+G1 X145.700 Y92.009 E11.5948 F3000
+G1 X145.800 Y92.002 E11.5981 F3000
+G1 X145.900 Y92.000 E11.6014 F3000
+G1 X146.000 Y92.003 E11.6047 F3000
+G1 X146.100 Y92.012 E11.6080 F3000
+G1 X146.200 Y92.025 E11.6113 F3000
+G1 X146.300 Y92.043 E11.6147 F3000
+G1 X146.400 Y92.066 E11.6181 F3000
+G1 X146.500 Y92.094 E11.6215 F3000
+G1 X146.600 Y92.126 E11.6250 F3000
+G1 X146.700 Y92.164 E11.6285 F3000
+G1 X146.800 Y92.206 E11.6321 F3000
+G1 X146.900 Y92.252 E11.6357 F3000
+G1 X147.000 Y92.303 E11.6394 F3000
+G1 X147.100 Y92.358 E11.6432 F3000
+G1 X147.200 Y92.417 E11.6470 F3000
+G1 X147.300 Y92.480 E11.6509 F3000
+G1 X147.400 Y92.547 E11.6549 F3000
+G1 X147.500 Y92.617 E11.6589 F3000
+G1 X147.600 Y92.691 E11.6630 F3000
+G1 X147.700 Y92.769 E11.6672 F3000
+G1 X147.800 Y92.849 E11.6714 F3000
+G1 X147.900 Y92.932 E11.6757 F3000
+G1 X148.000 Y93.018 E11.6801 F3000
+G1 X148.100 Y93.106 E11.6845 F3000
+G1 X148.200 Y93.197 E11.6889 F3000
+G1 X148.300 Y93.289 E11.6934 F3000
+G1 X148.400 Y93.384 E11.6980 F3000
+G1 X148.500 Y93.480 E11.7025 F3000
+G1 X148.600 Y93.577 E11.7071 F3000
+G1 X148.700 Y93.675 E11.7118 F3000
+G1 X148.800 Y93.774 E11.7164 F3000
+G1 X148.900 Y93.874 E11.7211 F3000
+G1 X149.000 Y93.973 E11.7257 F3000
+G1 X149.100 Y94.073 E11.7304 F3000
+G1 X149.200 Y94.173 E11.7351 F3000
+G1 X149.300 Y94.273 E11.7397 F3000
+G1 X149.400 Y94.371 E11.7443 F3000
+G1 X149.500 Y94.469 E11.7490 F3000
+G1 X149.600 Y94.566 E11.7535 F3000
+G1 X149.700 Y94.661 E11.7581 F3000
+G1 X149.800 Y94.754 E11.7626 F3000
+G1 X149.900 Y94.846 E11.7671 F3000
+G1 X150.000 Y94.935 E11.7715 F3000
+G1 X150.100 Y95.023 E11.7759 F3000
+G1 X150.200 Y95.107 E11.7802 F3000
+G1 X150.300 Y95.189 E11.7845 F3000
+G1 X150.400 Y95.268 E11.7887 F3000
+G1 X150.500 Y95.344 E11.7928 F3000
+G1 X150.600 Y95.416 E11.7969 F3000
+G1 X150.700 Y95.485 E11.8009 F3000
+G1 X150.800 Y95.550 E11.8048 F3000
+G1 X150.900 Y95.611 E11.8087 F3000
+G1 X151.000 Y95.668 E11.8125 F3000
+G1 X151.100 Y95.721 E11.8163 F3000
+G1 X151.200 Y95.770 E11.8199 F3000
+G1 X151.300 Y95.815 E11.8235 F3000
+G1 X151.400 Y95.854 E11.8271 F3000
+G1 X151.500 Y95.889 E11.8306 F3000
+G1 X151.600 Y95.920 E11.8340 F3000
+G1 X151.700 Y95.945 E11.8374 F3000
+G1 X151.800 Y95.966 E11.8408 F3000
+G1 X151.900 Y95.982 E11.8442 F3000
+G1 X152.000 Y95.993 E11.8475 F3000
+G1 X152.100 Y95.999 E11.8508 F3000
+G1 X152.200 Y96.000 E11.8541 F3000
+G1 X152.300 Y95.996 E11.8574 F3000
+G1 X152.400 Y95.987 E11.8607 F3000
+G1 X152.500 Y95.973 E11.8640 F3000
+G1 X152.600 Y95.954 E11.8674 F3000
+G1 X152.700 Y95.930 E11.8708 F3000
+G1 X152.800 Y95.901 E11.8742 F3000
+G1 X152.900 Y95.868 E11.8777 F3000
+G1 X153.000 Y95.829 E11.8812 F3000
+G1 X153.100 Y95.787 E11.8848 F3000
+G1 X153.200 Y95.740 E11.8885 F3000
+G1 X153.300 Y95.688 E11.8922 F3000
+G1 X153.400 Y95.632 E11.8959 F3000
+G1 X153.500 Y95.573 E11.8998 F3000
+G1 X153.600 Y95.509 E11.9037 F3000
+G1 X153.700 Y95.441 E11.9077 F3000
+G1 X153.800 Y95.370 E11.9117 F3000
+G1 X153.900 Y95.296 E11.9159 F3000
+G1 X154.000 Y95.218 E11.9200 F3000
+G1 X154.100 Y95.137 E11.9243 F3000
+G1 X154.200 Y95.054 E11.9286 F3000
+G1 X154.300 Y94.967 E11.9329 F3000
+G1 X154.400 Y94.879 E11.9373 F3000
+G1 X154.500 Y94.788 E11.9418 F3000
+G1 X154.600 Y94.695 E11.9463 F3000
+G1 X154.700 Y94.600 E11.9509 F3000
+G1 X154.800 Y94.504 E11.9554 F3000
+G1 X154.900 Y94.407 E11.9600 F3000
+G1 X155.000 Y94.308 E11.9647 F3000
+G1 X155.100 Y94.209 E11.9693 F3000
+G1 X155.200 Y94.110 E11.9740 F3000
+G1 X155.300 Y94.010 E11.9786 F3000
+G1 X155.400 Y93.910 E11.9833 F3000
+G1 X155.500 Y93.810 E11.9880 F3000
+G1 X155.600 Y93.711 E11.9926 F3000
+G1 X155.700 Y93.612 E11.9972 F3000
+G1 X155.800 Y93.515 E12.0019 F3000
+G1 X155.900 Y93.418 E12.0064 F3000
+G1 X156.000 Y93.323 E12.0110 F3000
+G1 X156.100 Y93.230 E12.0155 F3000
+G1 X156.200 Y93.139 E12.0200 F3000
+G1 X156.300 Y93.050 E12.0244 F3000
+G1 X156.400 Y92.963 E12.0288 F3000
+G1 X156.500 Y92.879 E12.0331 F3000
+G1 X156.600 Y92.797 E12.0373 F3000
+G1 X156.700 Y92.719 E12.0415 F3000
+G1 X156.800 Y92.644 E12.0456 F3000
+G1 X156.900 Y92.572 E12.0497 F3000
+G1 X157.000 Y92.504 E12.0537 F3000
+G1 X157.100 Y92.439 E12.0576 F3000
+G1 X157.200 Y92.379 E12.0615 F3000
+G1 X157.300 Y92.322 E12.0653 F3000
+G1 X157.400 Y92.270 E12.0690 F3000
+G1 X157.500 Y92.222 E12.0727 F3000
+G1 X157.600 Y92.178 E12.0763 F3000
+G1 X157.700 Y92.139 E12.0798 F3000
+G1 X157.800 Y92.105 E12.0833 F3000
+G1 X157.900 Y92.076 E12.0867 F3000
+G1 X158.000 Y92.051 E12.0901 F3000
+G1 X158.100 Y92.031 E12.0935 F3000
+G1 X158.200 Y92.016 E12.0968 F3000
+G1 X158.300 Y92.006 E12.1002 F3000
+G1 X158.400 Y92.001 E12.1035 F3000
+G1 X158.500 Y92.001 E12.1068 F3000
+G1 X158.600 Y92.006 E12.1101 F3000
+G1 X158.700 Y92.015 E12.1134 F3000
+G1 X158.800 Y92.030 E12.1167 F3000
+G1 X158.900 Y92.050 E12.1201 F3000
+G1 X159.000 Y92.075 E12.1235 F3000
+G1 X159.100 Y92.104 E12.1269 F3000
+G1 X159.200 Y92.139 E12.1304 F3000
+G1 X159.300 Y92.177 E12.1339 F3000
+G1 X159.400 Y92.221 E12.1375 F3000
+G1 X159.500 Y92.269 E12.1412 F3000
+G1 X159.600 Y92.321 E12.1449 F3000
+G1 X159.700 Y92.377 E12.1487 F3000
+G1 X159.800 Y92.438 E12.1526 F3000
+G1 X159.900 Y92.502 E12.1565 F3000
+G1 X160.000 Y94.570 E12.2248 F3000
+G1 X159.900 Y94.642 E12.2289 F3000
+G1 X159.800 Y94.717 E12.2330 F3000
+G1 X159.700 Y94.795 E12.2372 F3000
+G1 X159.600 Y94.877 E12.2415 F3000
+G1 X159.500 Y94.961 E12.2458 F3000
+G1 X159.400 Y95.047 E12.2501 F3000
+G1 X159.300 Y95.136 E12.2546 F3000
+G1 X159.200 Y95.228 E12.2590 F3000
+G1 X159.100 Y95.321 E12.2635 F3000
+G1 X159.000 Y95.416 E12.2681 F3000
+G1 X158.900 Y95.512 E12.2727 F3000
+G1 X158.800 Y95.610 E12.2773 F3000
+G1 X158.700 Y95.708 E12.2819 F3000
+G1 X158.600 Y95.807 E12.2866 F3000
+G1 X158.500 Y95.907 E12.2912 F3000
+G1 X158.400 Y96.007 E12.2959 F3000
+G1 X158.300 Y96.107 E12.3005 F3000
+G1 X158.200 Y96.207 E12.3052 F3000
+G1 X158.100 Y96.306 E12.3099 F3000
+G1 X158.000 Y96.404 E12.3145 F3000
+G1 X157.900 Y96.502 E12.3191 F3000
+G1 X157.800 Y96.598 E12.3237 F3000
+G1 X157.700 Y96.692 E12.3282 F3000
+G1 X157.600 Y96.785 E12.3327 F3000
+G1 X157.500 Y96.876 E12.3372 F3000
+G1 X157.400 Y96.965 E12.3416 F3000
+G1 X157.300 Y97.051 E12.3459 F3000
+G1 X157.200 Y97.135 E12.3503 F3000
+G1 X157.100 Y97.216 E12.3545 F3000
+G1 X157.000 Y97.294 E12.3587 F3000
+G1 X156.900 Y97.368 E12.3628 F3000
+G1 X156.800 Y97.440 E12.3668 F3000
+G1 X156.700 Y97.507 E12.3708 F3000
+G1 X156.600 Y97.571 E12.3747 F3000
+G1 X156.500 Y97.631 E12.3786 F3000
+G1 X156.400 Y97.687 E12.3824 F3000
+G1 X156.300 Y97.738 E12.3861 F3000
+G1 X156.200 Y97.786 E12.3897 F3000
+G1 X156.100 Y97.828 E12.3933 F3000
+G1 X156.000 Y97.867 E12.3969 F3000
+G1 X155.900 Y97.900 E12.4003 F3000
+G1 X155.800 Y97.929 E12.4038 F3000
+G1 X155.700 Y97.953 E12.4072 F3000
+G1 X155.600 Y97.972 E12.4105 F3000
+G1 X155.500 Y97.986 E12.4139 F3000
+G1 X155.400 Y97.995 E12.4172 F3000
+G1 X155.300 Y98.000 E12.4205 F3000
+G1 X155.200 Y97.999 E12.4238 F3000
+G1 X155.100 Y97.993 E12.4271 F3000
+G1 X155.000 Y97.982 E12.4304 F3000
+G1 X154.900 Y97.967 E12.4337 F3000
+G1 X154.800 Y97.946 E12.4371 F3000
+G1 X154.700 Y97.921 E12.4405 F3000
+G1 X154.600 Y97.890 E12.4440 F3000
+G1 X154.500 Y97.855 E12.4475 F3000
+G1 X154.400 Y97.816 E12.4510 F3000
+G1 X154.300 Y97.771 E12.4546 F3000
+G1 X154.200 Y97.723 E12.4583 F3000
+G1 X154.100 Y97.670 E12.4620 F3000
+G1 X154.000 Y97.613 E12.4658 F3000
+G1 X153.900 Y97.552 E12.4697 F3000
+G1 X153.800 Y97.487 E12.4736 F3000
+G1 X153.700 Y97.418 E12.4776 F3000
+G1 X153.600 Y97.346 E12.4817 F3000
+G1 X153.500 Y97.270 E12.4858 F3000
+G1 X153.400 Y97.191 E12.4900 F3000
+G1 X153.300 Y97.109 E12.4943 F3000
+G1 X153.200 Y97.025 E12.4986 F3000
+G1 X153.100 Y96.938 E12.5030 F3000
+G1 X153.000 Y96.848 E12.5074 F3000
+G1 X152.900 Y96.757 E12.5119 F3000
+G1 X152.800 Y96.663 E12.5164 F3000
+G1 X152.700 Y96.568 E12.5210 F3000
+G1 X152.600 Y96.472 E12.5256 F3000
+G1 X152.500 Y96.374 E12.5302 F3000
+G1 X152.400 Y96.275 E12.5348 F3000
+G1 X152.300 Y96.176 E12.5395 F3000
+G1 X152.200 Y96.076 E12.5441 F3000
+G1 X152.100 Y95.976 E12.5488 F3000
+G1 X152.000 Y95.876 E12.5535 F3000
+G1 X151.900 Y95.777 E12.5581 F3000
+G1 X151.800 Y95.677 E12.5628 F3000
+G1 X151.700 Y95.579 E12.5674 F3000
+G1 X151.600 Y95.482 E12.5720 F3000
+G1 X151.500 Y95.386 E12.5766 F3000
+G1 X151.400 Y95.292 E12.5811 F3000
+G1 X151.300 Y95.199 E12.5856 F3000
+G1 X151.200 Y95.109 E12.5900 F3000
+G1 X151.100 Y95.020 E12.5944 F3000
+G1 X151.000 Y94.934 E12.5988 F3000
+G1 X150.900 Y94.851 E12.6031 F3000
+G1 X150.800 Y94.771 E12.6073 F3000
+G1 X150.700 Y94.693 E12.6115 F3000
+G1 X150.600 Y94.619 E12.6156 F3000
+G1 X150.500 Y94.549 E12.6196 F3000
+G1 X150.400 Y94.482 E12.6236 F3000
+G1 X150.300 Y94.419 E12.6275 F3000
+G1 X150.200 Y94.359 E12.6314 F3000
+G1 X150.100 Y94.304 E12.6351 F3000
+G1 X150.000 Y94.253 E12.6388 F3000
+G1 X149.900 Y94.207 E12.6425 F3000
+G1 X149.800 Y94.165 E12.6460 F3000
+G1 X149.700 Y94.127 E12.6496 F3000
+G1 X149.600 Y94.095 E12.6530 F3000
+G1 X149.500 Y94.067 E12.6565 F3000
+G1 X149.400 Y94.043 E12.6599 F3000
+G1 X149.300 Y94.025 E12.6632 F3000
+G1 X149.200 Y94.012 E12.6665 F3000
+G1 X149.100 Y94.003 E12.6699 F3000
+G1 X149.000 Y94.000 E12.6732 F3000
+G1 X148.900 Y94.002 E12.6765 F3000
+G1 X148.800 Y94.008 E12.6798 F3000
+G1 X148.700 Y94.020 E12.6831 F3000
+G1 X148.600 Y94.036 E12.6864 F3000
+G1 X148.500 Y94.058 E12.6898 F3000
+G1 X148.400 Y94.084 E12.6932 F3000
+G1 X148.300 Y94.115 E12.6967 F3000
+G1 X148.200 Y94.151 E12.7002 F3000
+G1 X148.100 Y94.191 E12.7037 F3000
+G1 X148.000 Y94.236 E12.7074 F3000
+G1 X147.900 Y94.286 E12.7110 F3000
+G1 X147.800 Y94.339 E12.7148 F3000
+G1 X147.700 Y94.397 E12.7186 F3000
+G1 X147.600 Y94.459 E12.7225 F3000
+G1 X147.500 Y94.525 E12.7264 F3000
+G1 X147.400 Y94.594 E12.7304 F3000
+G1 X147.300 Y94.667 E12.7345 F3000
+G1 X147.200 Y94.743 E12.7387 F3000
+G1 X147.100 Y94.822 E12.7429 F3000
+G1 X147.000 Y94.905 E12.7471 F3000
+G1 X146.900 Y94.990 E12.7515 F3000
+G1 X146.800 Y95.077 E12.7559 F3000
+G1 X146.700 Y95.167 E12.7603 F3000
+G1 X146.600 Y95.259 E12.7648 F3000
+G1 X146.500 Y95.353 E12.7693 F3000
+G1 X146.400 Y95.448 E12.7739 F3000
+G1 X146.300 Y95.545 E12.7785 F3000
+G1 X146.200 Y95.643 E12.7831 F3000
+G1 X146.100 Y95.741 E12.7877 F3000
+G1 X146.000 Y95.841 E12.7924 F3000
+G1 X145.900 Y95.941 E12.7970 F3000
+G1 X145.800 Y96.041 E12.8017 F3000
+G1 X145.700 Y96.141 E12.8064 F3000
+G1 X145.600 Y96.240 E12.8110 F3000
+G1 X145.500 Y96.339 E12.8157 F3000
+G1 X145.400 Y96.437 E12.8203 F3000
+G1 X145.300 Y96.534 E12.8249 F3000
+G1 X145.200 Y96.630 E12.8294 F3000
+G1 X145.100 Y96.724 E12.8340 F3000
+G1 X145.000 Y96.816 E12.8385 F3000
+G1 X144.900 Y96.906 E12.8429 F3000
+G1 X144.800 Y96.994 E12.8473 F3000
+G1 X144.700 Y97.080 E12.8517 F3000
+G1 X144.600 Y97.163 E12.8559 F3000
+G1 X144.500 Y97.243 E12.8602 F3000
+G1 X144.400 Y97.319 E12.8643 F3000
+G1 X144.300 Y97.393 E12.8684 F3000
+G1 X144.200 Y97.463 E12.8724 F3000
+G1 X144.100 Y97.529 E12.8764 F3000
+G1 X144.000 Y97.592 E12.8803 F3000
+G1 X143.900 Y97.650 E12.8841 F3000
+G1 X143.800 Y97.705 E12.8879 F3000
+G1 X143.700 Y97.755 E12.8916 F3000
+G1 X143.600 Y97.801 E12.8952 F3000
+G1 X143.500 Y97.842 E12.8988 F3000
+G1 X143.400 Y97.878 E12.9023 F3000
+G1 X143.300 Y97.910 E12.9057 F3000
+G1 X143.200 Y97.938 E12.9092 F3000
+G1 X143.100 Y97.960 E12.9125 F3000
+G1 X143.000 Y97.977 E12.9159 F3000
+G1 X142.900 Y97.990 E12.9192 F3000
+G1 X142.800 Y97.997 E12.9225 F3000
+G1 X142.700 Y98.000 E12.9258 F3000
+G1 X142.600 Y97.998 E12.9291 F3000
+G1 X142.500 Y97.990 E12.9324 F3000
+G1 X142.400 Y97.978 E12.9358 F3000
+G1 X142.300 Y97.960 E12.9391 F3000
+G1 X142.200 Y97.938 E12.9425 F3000
+G1 X142.100 Y97.911 E12.9459 F3000
+G1 X142.000 Y97.879 E12.9494 F3000
+G1 X141.900 Y97.842 E12.9529 F3000
+G1 X141.800 Y97.801 E12.9565 F3000
+G1 X141.700 Y97.756 E12.9601 F3000
+G1 X141.600 Y97.705 E12.9638 F3000
+G1 X141.500 Y97.651 E12.9675 F3000
+G1 X141.400 Y97.593 E12.9714 F3000
+G1 X141.300 Y97.530 E12.9753 F3000
+G1 X141.200 Y97.464 E12.9792 F3000
+G1 X141.100 Y97.394 E12.9832 F3000
+G1 X141.000 Y97.321 E12.9873 F3000
+G1 X140.900 Y97.244 E12.9915 F3000
+G1 X140.800 Y97.164 E12.9957 F3000
+G1 X140.700 Y97.081 E13.0000 F3000
+G1 X140.600 Y96.996 E13.0043 F3000
+G1 X140.500 Y96.908 E13.0087 F3000
+G1 X140.400 Y96.818 E13.0132 F3000
+G1 X140.300 Y96.726 E13.0177 F3000
+G1 X140.200 Y96.631 E13.0222 F3000
+G1 X140.100 Y96.536 E13.0268 F3000
+G1 X140.000 Y96.439 E13.0314 F3000
+G1 X139.900 Y96.341 E13.0360 F3000
+G1 X139.800 Y96.242 E13.0406 F3000
+G1 X139.700 Y96.142 E13.0453 F3000
+G1 X139.600 Y96.042 E13.0499 F3000
+G1 X139.500 Y95.942 E13.0546 F3000
+G1 X139.400 Y95.843 E13.0593 F3000
+G1 X139.300 Y95.743 E13.0639 F3000
+G1 X139.200 Y95.644 E13.0686 F3000
+G1 X139.100 Y95.546 E13.0732 F3000
+G1 X139.000 Y95.450 E13.0778 F3000
+G1 X138.900 Y95.354 E13.0823 F3000
+G1 X138.800 Y95.260 E13.0869 F3000
+G1 X138.700 Y95.168 E13.0913 F3000
+G1 X138.600 Y95.079 E13.0958 F3000
+G1 X138.500 Y94.991 E13.1002 F3000
+G1 X138.400 Y94.906 E13.1045 F3000
+G1 X138.300 Y94.824 E13.1088 F3000
+G1 X138.200 Y94.744 E13.1130 F3000
+G1 X138.100 Y94.668 E13.1171 F3000
+G1 X138.000 Y94.595 E13.1212 F3000
+G1 X137.900 Y94.526 E13.1252 F3000
+G1 X137.800 Y94.460 E13.1292 F3000
+G1 X137.700 Y94.398 E13.1331 F3000
+G1 X137.600 Y94.340 E13.1369 F3000
+G1 X137.500 Y94.287 E13.1406 F3000
+G1 X137.400 Y94.237 E13.1443 F3000
+G1 X137.300 Y94.192 E13.1479 F3000
+G1 X137.200 Y94.152 E13.1515 F3000
+G1 X137.100 Y94.116 E13.1550 F3000
+G1 X137.000 Y94.085 E13.1584 F3000
+G1 X136.900 Y94.058 E13.1619 F3000
+G1 X136.800 Y94.037 E13.1652 F3000
+G1 X136.700 Y94.020 E13.1686 F3000
+G1 X136.600 Y94.008 E13.1719 F3000
+G1 X136.500 Y94.002 E13.1752 F3000
+G1 X136.400 Y94.000 E13.1785 F3000
+G1 X136.300 Y94.003 E13.1818 F3000
+G1 X136.200 Y94.012 E13.1851 F3000
+G1 X136.100 Y94.025 E13.1885 F3000
+G1 X136.000 Y94.043 E13.1918 F3000
+G1 X135.900 Y94.066 E13.1952 F3000
+G1 X135.800 Y94.094 E13.1986 F3000
+G1 X135.700 Y94.127 E13.2021 F3000
+G1 X135.600 Y94.164 E13.2056 F3000
+G1 X135.500 Y94.206 E13.2092 F3000
+G1 X135.400 Y94.253 E13.2128 F3000
+G1 X135.300 Y94.303 E13.2165 F3000
+G1 X135.200 Y94.358 E13.2203 F3000
+G1 X135.100 Y94.418 E13.2241 F3000
+G1 X135.000 Y94.481 E13.2280 F3000
+G1 X134.900 Y94.548 E13.2320 F3000
+G1 X134.800 Y94.618 E13.2360 F3000
+G1 X134.700 Y94.692 E13.2402 F3000
+G1 X134.600 Y94.769 E13.2443 F3000
+G1 X134.500 Y94.850 E13.2486 F3000
+G1 X134.400 Y94.933 E13.2528 F3000
+G1 X134.300 Y95.019 E13.2572 F3000
+G1 X134.200 Y95.107 E13.2616 F3000
+G1 X134.100 Y95.198 E13.2661 F3000
+G1 X134.000 Y95.290 E13.2705 F3000
+G1 X133.900 Y95.385 E13.2751 F3000
+G1 X133.800 Y95.480 E13.2797 F3000
+G1 X133.700 Y95.578 E13.2843 F3000
+G1 X133.600 Y95.676 E13.2889 F3000
+G1 X133.500 Y95.775 E13.2935 F3000
+G1 X133.400 Y95.874 E13.2982 F3000
+G1 X133.300 Y95.974 E13.3029 F3000
+G1 X133.200 Y96.074 E13.3075 F3000
+G1 X133.100 Y96.174 E13.3122 F3000
+G1 X133.000 Y96.274 E13.3168 F3000
+G1 X132.900 Y96.372 E13.3215 F3000
+G1 X132.800 Y96.470 E13.3261 F3000
+G1 X132.700 Y96.567 E13.3307 F3000
+G1 X132.600 Y96.662 E13.3352 F3000
+G1 X132.500 Y96.755 E13.3397 F3000
+G1 X132.400 Y96.847 E13.3442 F3000
+G1 X132.300 Y96.936 E13.3486 F3000
+G1 X132.200 Y97.023 E13.3530 F3000
+G1 X132.100 Y97.108 E13.3573 F3000
+G1 X132.000 Y97.190 E13.3616 F3000
+G1 X131.900 Y97.269 E13.3658 F3000
+G1 X131.800 Y97.344 E13.3700 F3000
+G1 X131.700 Y97.417 E13.3740 F3000
+G1 X131.600 Y97.486 E13.3780 F3000
+G1 X131.500 Y97.551 E13.3820 F3000
+G1 X131.400 Y97.612 E13.3858 F3000
+G1 X131.300 Y97.669 E13.3896 F3000
+G1 X131.200 Y97.722 E13.3934 F3000
+G1 X131.100 Y97.771 E13.3970 F3000
+G1 X131.000 Y97.815 E13.4007 F3000
+G1 X130.900 Y97.855 E13.4042 F3000
+G1 X130.800 Y97.890 E13.4077 F3000
+G1 X130.700 Y97.920 E13.4111 F3000
+G1 X130.600 Y97.946 E13.4146 F3000
+G1 X130.500 Y97.966 E13.4179 F3000
+G1 X130.400 Y97.982 E13.4213 F3000
+G1 X130.300 Y97.993 E13.4246 F3000
+G1 X130.200 Y97.999 E13.4279 F3000
+G1 X130.100 Y98.000 E13.4312 F3000
+G1 X130.000 Y97.996 E13.4345 F3000
+G1 X129.900 Y97.986 E13.4378 F3000
+G1 X129.800 Y97.972 E13.4411 F3000
+G1 X129.700 Y97.953 E13.4445 F3000
+G1 X129.600 Y97.929 E13.4479 F3000
+G1 X129.500 Y97.901 E13.4513 F3000
+G1 X129.400 Y97.867 E13.4548 F3000
+G1 X129.300 Y97.829 E13.4583 F3000
+G1 X129.200 Y97.786 E13.4619 F3000
+G1 X129.100 Y97.739 E13.4656 F3000
+G1 X129.000 Y97.688 E13.4693 F3000
+G1 X128.900 Y97.632 E13.4731 F3000
+G1 X128.800 Y97.572 E13.4769 F3000
+G1 X128.700 Y97.508 E13.4808 F3000
+G1 X128.600 Y97.441 E13.4848 F3000
+G1 X128.500 Y97.370 E13.4889 F3000
+G1 X128.400 Y97.295 E13.4930 F3000
+G1 X128.300 Y97.217 E13.4972 F3000
+G1 X128.200 Y97.137 E13.5014 F3000
+G1 X128.100 Y97.053 E13.5057 F3000
+G1 X128.000 Y96.967 E13.5101 F3000
+G1 X127.900 Y96.878 E13.5145 F3000
+G1 X127.800 Y96.787 E13.5189 F3000
+G1 X127.700 Y96.694 E13.5234 F3000
+G1 X127.600 Y96.599 E13.5280 F3000
+G1 X127.500 Y96.503 E13.5326 F3000
+G1 X127.400 Y96.406 E13.5372 F3000
+G1 X127.300 Y96.308 E13.5418 F3000
+G1 X127.200 Y96.208 E13.5464 F3000
+G1 X127.100 Y96.109 E13.5511 F3000
+G1 X127.000 Y96.009 E13.5558 F3000
+G1 X126.900 Y95.909 E13.5604 F3000
+G1 X126.800 Y95.809 E13.5651 F3000
+G1 X126.700 Y95.710 E13.5697 F3000
+G1 X126.600 Y95.611 E13.5744 F3000
+G1 X126.500 Y95.514 E13.5790 F3000
+G1 X126.400 Y95.417 E13.5836 F3000
+G1 X126.300 Y95.322 E13.5881 F3000
+G1 X126.200 Y95.229 E13.5926 F3000
+G1 X126.100 Y95.138 E13.5971 F3000
+G1 X126.000 Y95.049 E13.6015 F3000
+G1 X125.900 Y94.962 E13.6059 F3000
+G1 X125.800 Y94.878 E13.6102 F3000
+G1 X125.700 Y94.797 E13.6144 F3000
+G1 X125.600 Y94.718 E13.6186 F3000
+G1 X125.500 Y94.643 E13.6228 F3000
+G1 X125.400 Y94.571 E13.6268 F3000
+G1 X125.300 Y94.503 E13.6308 F3000
+G1 X125.200 Y94.439 E13.6347 F3000
+G1 X125.100 Y94.378 E13.6386 F3000
+G1 X125.000 Y94.322 E13.6424 F3000
+G1 X124.900 Y94.270 E13.6461 F3000
+G1 X124.800 Y94.222 E13.6498 F3000
+G1 X124.700 Y94.178 E13.6534 F3000
+G1 X124.600 Y94.139 E13.6569 F3000
+G1 X124.500 Y94.105 E13.6604 F3000
+G1 X124.400 Y94.075 E13.6638 F3000
+G1 X124.300 Y94.051 E13.6672 F3000
+G1 X124.200 Y94.031 E13.6706 F3000
+G1 X124.100 Y94.016 E13.6740 F3000
+G1 X124.000 Y94.006 E13.6773 F3000
+G1 X123.900 Y94.001 E13.6806 F3000
+G1 X123.800 Y94.001 E13.6839 F3000
+G1 X123.700 Y94.006 E13.6872 F3000
+G1 X123.600 Y94.016 E13.6905 F3000
+G1 X123.500 Y94.030 E13.6938 F3000
+G1 X123.400 Y94.050 E13.6972 F3000
+G1 X123.300 Y94.075 E13.7006 F3000
+G1 X123.200 Y94.105 E13.7040 F3000
+G1 X123.100 Y94.139 E13.7075 F3000
+G1 X123.000 Y94.178 E13.7111 F3000
+G1 X122.900 Y94.221 E13.7147 F3000
+G1 X122.800 Y94.269 E13.7183 F3000
+G1 X122.700 Y94.321 E13.7220 F3000
+G1 X122.600 Y94.378 E13.7258 F3000
+G1 X122.500 Y94.438 E13.7297 F3000
+G1 X122.400 Y94.503 E13.7336 F3000
+G1 X122.300 Y94.571 E13.7376 F3000
+G1 X122.200 Y94.643 E13.7417 F3000
+G1 X122.100 Y94.718 E13.7458 F3000
+G1 X122.000 Y94.796 E13.7500 F3000
+G1 X121.900 Y94.877 E13.7542 F3000
+G1 X121.800 Y94.961 E13.7586 F3000
+G1 X121.700 Y95.048 E13.7629 F3000
+G1 X121.600 Y95.137 E13.7673 F3000
+G1 X121.500 Y95.229 E13.7718 F3000
+G1 X121.400 Y95.322 E13.7763 F3000
+G1 X121.300 Y95.417 E13.7809 F3000
+G1 X121.200 Y95.513 E13.7855 F3000
+G1 X121.100 Y95.610 E13.7901 F3000
+G1 X121.000 Y95.709 E13.7947 F3000
+G1 X120.900 Y95.808 E13.7993 F3000
+G1 X120.800 Y95.908 E13.8040 F3000
+G1 X120.700 Y96.008 E13.8087 F3000
+G1 X120.600 Y96.108 E13.8133 F3000
+G1 X120.500 Y96.208 E13.8180 F3000
+G1 X120.400 Y96.307 E13.8226 F3000
+G1 X120.300 Y96.405 E13.8273 F3000
+G1 X120.200 Y96.503 E13.8319 F3000
+G1 X120.100 Y96.599 E13.8365 F3000
+G1 X120.000 Y96.693 E13.8410 F3000
+G1 X119.900 Y96.786 E13.8455 F3000
+G1 X119.800 Y96.877 E13.8500 F3000
+G1 X119.700 Y96.966 E13.8544 F3000
+G1 X119.600 Y97.052 E13.8587 F3000
+G1 X119.500 Y97.136 E13.8630 F3000
+G1 X119.400 Y97.217 E13.8673 F3000
+G1 X119.300 Y97.295 E13.8715 F3000
+G1 X119.200 Y97.369 E13.8756 F3000
+G1 X119.100 Y97.440 E13.8796 F3000
+G1 X119.000 Y97.508 E13.8836 F3000
+G1 X118.900 Y97.572 E13.8875 F3000
+G1 X118.800 Y97.631 E13.8914 F3000
+G1 X118.700 Y97.687 E13.8952 F3000
+G1 X118.600 Y97.739 E13.8989 F3000
+G1 X118.500 Y97.786 E13.9025 F3000
+G1 X118.400 Y97.829 E13.9061 F3000
+G1 X118.300 Y97.867 E13.9096 F3000
+G1 X118.200 Y97.900 E13.9131 F3000
+G1 X118.100 Y97.929 E13.9165 F3000
+G1 X118.000 Y97.953 E13.9199 F3000
+G1 X117.900 Y97.972 E13.9233 F3000
+G1 X117.800 Y97.986 E13.9266 F3000
+G1 X117.700 Y97.996 E13.9299 F3000
+G1 X117.600 Y98.000 E13.9333 F3000
+G1 X117.500 Y97.999 E13.9366 F3000
+G1 X117.400 Y97.993 E13.9399 F3000
+G1 X117.300 Y97.982 E13.9432 F3000
+G1 X117.200 Y97.967 E13.9465 F3000
+G1 X117.100 Y97.946 E13.9499 F3000
+G1 X117.000 Y97.920 E13.9533 F3000
+G1 X116.900 Y97.890 E13.9567 F3000
+G1 X116.800 Y97.855 E13.9602 F3000
+G1 X116.700 Y97.815 E13.9638 F3000
+G1 X116.600 Y97.771 E13.9674 F3000
+G1 X116.500 Y97.722 E13.9711 F3000
+G1 X116.400 Y97.669 E13.9748 F3000
+G1 X116.300 Y97.612 E13.9786 F3000
+G1 X116.200 Y97.551 E13.9825 F3000
+G1 X116.100 Y97.486 E13.9864 F3000
+G1 X116.000 Y97.417 E13.9904 F3000
+G1 X115.900 Y97.345 E13.9945 F3000
+G1 X115.800 Y97.269 E13.9986 F3000
+G1 X115.700 Y97.191 E14.0028 F3000
+G1 X115.600 Y97.109 E14.0071 F3000
+G1 X115.500 Y97.024 E14.0114 F3000
+G1 X115.400 Y96.937 E14.0158 F3000
+G1 X115.300 Y96.848 E14.0202 F3000
+G1 X115.200 Y96.756 E14.0247 F3000
+G1 X115.100 Y96.662 E14.0292 F3000
+G1 X115.000 Y96.567 E14.0338 F3000
+G1 X114.900 Y96.471 E14.0383 F3000
+G1 X114.800 Y96.373 E14.0430 F3000
+G1 X114.700 Y96.274 E14.0476 F3000
+G1 X114.600 Y96.175 E14.0523 F3000
+G1 X114.500 Y96.075 E14.0569 F3000
+G1 X114.400 Y95.975 E14.0616 F3000
+G1 X114.300 Y95.875 E14.0662 F3000
+G1 X114.200 Y95.776 E14.0709 F3000
+G1 X114.100 Y95.677 E14.0755 F3000
+G1 X114.000 Y95.578 E14.0802 F3000
+G1 X113.900 Y95.481 E14.0848 F3000
+G1 X113.800 Y95.385 E14.0893 F3000
+G1 X113.700 Y95.291 E14.0939 F3000
+G1 X113.600 Y95.198 E14.0984 F3000
+G1 X113.500 Y95.108 E14.1028 F3000
+G1 X113.400 Y95.019 E14.1072 F3000
+G1 X113.300 Y94.934 E14.1116 F3000
+G1 X113.200 Y94.850 E14.1159 F3000
+G1 X113.100 Y94.770 E14.1201 F3000
+G1 X113.000 Y94.693 E14.1243 F3000
+G1 X112.900 Y94.619 E14.1284 F3000
+G1 X112.800 Y94.548 E14.1324 F3000
+G1 X112.700 Y94.481 E14.1364 F3000
+G1 X112.600 Y94.418 E14.1403 F3000
+G1 X112.500 Y94.359 E14.1441 F3000
+G1 X112.400 Y94.304 E14.1479 F3000
+G1 X112.300 Y94.253 E14.1516 F3000
+G1 X112.200 Y94.206 E14.1552 F3000
+G1 X112.100 Y94.164 E14.1588 F3000
+G1 X112.000 Y94.127 E14.1623 F3000
+G1 X111.900 Y94.094 E14.1658 F3000
+G1 X111.800 Y94.066 E14.1692 F3000
+G1 X111.700 Y94.043 E14.1726 F3000
+G1 X111.600 Y94.025 E14.1760 F3000
+G1 X111.500 Y94.012 E14.1793 F3000
+G1 X111.400 Y94.003 E14.1826 F3000
+G1 X111.300 Y94.000 E14.1859 F3000
+G1 X111.200 Y94.002 E14.1892 F3000
+G1 X111.100 Y94.008 E14.1925 F3000
+G1 X111.000 Y94.020 E14.1959 F3000
+G1 X110.900 Y94.037 E14.1992 F3000
+G1 X110.800 Y94.058 E14.2026 F3000
+G1 X110.700 Y94.084 E14.2060 F3000
+G1 X110.600 Y94.116 E14.2094 F3000
+G1 X110.500 Y94.151 E14.2130 F3000
+G1 X110.400 Y94.192 E14.2165 F3000
+G1 X110.300 Y94.237 E14.2201 F3000
+G1 X110.200 Y94.286 E14.2238 F3000
+G1 X110.100 Y94.340 E14.2276 F3000
+G1 X110.000 Y94.398 E14.2314 F3000
+G1 X109.900 Y94.460 E14.2353 F3000
+G1 X109.800 Y94.525 E14.2392 F3000
+G1 X109.700 Y94.595 E14.2432 F3000
+G1 X109.600 Y94.667 E14.2473 F3000
+G1 X109.500 Y94.744 E14.2514 F3000
+G1 X109.400 Y94.823 E14.2557 F3000
+G1 X109.300 Y94.905 E14.2599 F3000
+G1 X109.200 Y94.990 E14.2643 F3000
+G1 X109.100 Y95.078 E14.2687 F3000
+G1 X109.000 Y95.168 E14.2731 F3000
+G1 X108.900 Y95.260 E14.2776 F3000
+G1 X108.800 Y95.353 E14.2821 F3000
+G1 X108.700 Y95.449 E14.2867 F3000
+G1 X108.600 Y95.546 E14.2912 F3000
+G1 X108.500 Y95.644 E14.2959 F3000
+G1 X108.400 Y95.742 E14.3005 F3000
+G1 X108.300 Y95.842 E14.3052 F3000
+G1 X108.200 Y95.942 E14.3098 F3000
+G1 X108.100 Y96.042 E14.3145 F3000
+G1 X108.000 Y96.142 E14.3192 F3000
+G1 X107.900 Y96.241 E14.3238 F3000
+G1 X107.800 Y96.340 E14.3285 F3000
+G1 X107.700 Y96.438 E14.3331 F3000
+G1 X107.600 Y96.535 E14.3377 F3000
+G1 X107.500 Y96.631 E14.3422 F3000
+G1 X107.400 Y96.725 E14.3468 F3000
+G1 X107.300 Y96.817 E14.3513 F3000
+G1 X107.200 Y96.907 E14.3557 F3000
+G1 X107.100 Y96.995 E14.3601 F3000
+G1 X107.000 Y97.081 E14.3644 F3000
+G1 X106.900 Y97.163 E14.3687 F3000
+G1 X106.800 Y97.243 E14.3729 F3000
+G1 X106.700 Y97.320 E14.3771 F3000
+G1 X106.600 Y97.393 E14.3812 F3000
+G1 X106.500 Y97.463 E14.3852 F3000
+G1 X106.400 Y97.530 E14.3892 F3000
+G1 X106.300 Y97.592 E14.3931 F3000
+G1 X106.200 Y97.651 E14.3969 F3000
+G1 X106.100 Y97.705 E14.4007 F3000
+G1 X106.000 Y97.755 E14.4043 F3000
+G1 X105.900 Y97.801 E14.4080 F3000
+G1 X105.800 Y97.842 E14.4115 F3000
+G1 X105.700 Y97.879 E14.4151 F3000
+G1 X105.600 Y97.911 E14.4185 F3000
+G1 X105.500 Y97.938 E14.4219 F3000
+G1 X105.400 Y97.960 E14.4253 F3000
+G1 X105.300 Y97.978 E14.4287 F3000
+G1 X105.200 Y97.990 E14.4320 F3000
+G1 X105.100 Y97.998 E14.4353 F3000
+G1 X105.000 Y98.000 E14.4386 F3000
+G1 X104.900 Y97.997 E14.4419 F3000
+G1 X104.800 Y97.990 E14.4452 F3000
+G1 X104.700 Y97.978 E14.4485 F3000
+G1 X104.600 Y97.960 E14.4519 F3000
+G1 X104.500 Y97.938 E14.4553 F3000
+G1 X104.400 Y97.911 E14.4587 F3000
+G1 X104.300 Y97.879 E14.4622 F3000
+G1 X104.200 Y97.842 E14.4657 F3000
+G1 X104.100 Y97.801 E14.4692 F3000
+G1 X104.000 Y97.755 E14.4729 F3000
+G1 X103.900 Y97.705 E14.4766 F3000
+G1 X103.800 Y97.651 E14.4803 F3000
+G1 X103.700 Y97.592 E14.4841 F3000
+G1 X103.600 Y97.530 E14.4880 F3000
+G1 X103.500 Y97.463 E14.4920 F3000
+G1 X103.400 Y97.393 E14.4960 F3000
+G1 X103.300 Y97.320 E14.5001 F3000
+G1 X103.200 Y97.243 E14.5043 F3000
+G1 X103.100 Y97.163 E14.5085 F3000
+G1 X103.000 Y97.081 E14.5128 F3000
+G1 X102.900 Y96.995 E14.5171 F3000
+G1 X102.800 Y96.907 E14.5215 F3000
+G1 X102.700 Y96.817 E14.5260 F3000
+G1 X102.600 Y96.725 E14.5305 F3000
+G1 X102.500 Y96.631 E14.5350 F3000
+G1 X102.400 Y96.535 E14.5396 F3000
+G1 X102.300 Y96.438 E14.5441 F3000
+G1 X102.200 Y96.340 E14.5488 F3000
+G1 X102.100 Y96.241 E14.5534 F3000
+G1 X102.000 Y96.141 E14.5581 F3000
+G1 X101.900 Y96.042 E14.5627 F3000
+G1 X101.800 Y95.942 E14.5674 F3000
+G1 X101.700 Y95.842 E14.5721 F3000
+G1 X101.600 Y95.742 E14.5767 F3000
+G1 X101.500 Y95.643 E14.5814 F3000
+G1 X101.400 Y95.546 E14.5860 F3000
+G1 X101.300 Y95.449 E14.5906 F3000
+G1 X101.200 Y95.353 E14.5951 F3000
+G1 X101.100 Y95.260 E14.5997 F3000
+G1 X101.000 Y95.168 E14.6041 F3000
+G1 X100.900 Y95.078 E14.6086 F3000
+G1 X100.800 Y94.990 E14.6130 F3000
+G1 X100.700 Y94.905 E14.6173 F3000
+G1 X100.600 Y94.823 E14.6216 F3000
+G1 X100.500 Y94.744 E14.6258 F3000
+G1 X100.400 Y94.667 E14.6299 F3000
+G1 X100.300 Y94.595 E14.6340 F3000
+G1 X100.200 Y94.525 E14.6380 F3000
+G1 X100.100 Y94.460 E14.6420 F3000
+G1 X100.000 Y94.398 E14.6458 F3000
+G1 X99.900 Y94.340 E14.6497 F3000
+G1 X99.800 Y94.286 E14.6534 F3000
+G1 X99.700 Y94.237 E14.6571 F3000
+G1 X99.600 Y94.192 E14.6607 F3000
+G1 X99.500 Y94.151 E14.6643 F3000
+G1 X99.400 Y94.116 E14.6678 F3000
+G1 X99.300 Y94.084 E14.6712 F3000
+G1 X99.200 Y94.058 E14.6746 F3000
+G1 X99.100 Y94.037 E14.6780 F3000
+G1 X99.000 Y94.020 E14.6814 F3000
+G1 X98.900 Y94.008 E14.6847 F3000
+G1 X98.800 Y94.002 E14.6880 F3000
+G1 X98.700 Y94.000 E14.6913 F3000
+G1 X98.600 Y94.003 E14.6946 F3000
+G1 X98.500 Y94.012 E14.6979 F3000
+G1 X98.400 Y94.025 E14.7012 F3000
+G1 X98.300 Y94.043 E14.7046 F3000
+G1 X98.200 Y94.066 E14.7080 F3000
+G1 X98.100 Y94.094 E14.7114 F3000
+G1 X98.000 Y94.127 E14.7149 F3000
+G1 X97.900 Y94.165 E14.7184 F3000
+G1 X97.800 Y94.206 E14.7220 F3000
+G1 X97.700 Y94.253 E14.7256 F3000
+G1 X97.600 Y94.304 E14.7293 F3000
+G1 X97.500 Y94.359 E14.7331 F3000
+G1 X97.400 Y94.418 E14.7369 F3000
+G1 X97.300 Y94.481 E14.7408 F3000
+G1 X97.200 Y94.548 E14.7448 F3000
+G1 X97.100 Y94.619 E14.7488 F3000
+G1 X97.000 Y94.693 E14.7529 F3000
+G1 X96.900 Y94.770 E14.7571 F3000
+G1 X96.800 Y94.850 E14.7613 F3000
+G1 X96.700 Y94.934 E14.7656 F3000
+G1 X96.600 Y95.020 E14.7700 F3000
+G1 X96.500 Y95.108 E14.7744 F3000
+G1 X96.400 Y95.198 E14.7788 F3000
+G1 X96.300 Y95.291 E14.7833 F3000
+G1 X96.200 Y95.385 E14.7879 F3000
+G1 X96.100 Y95.481 E14.7924 F3000
+G1 X96.000 Y95.578 E14.7970 F3000
+G1 X95.900 Y95.677 E14.8017 F3000
+G1 X95.800 Y95.776 E14.8063 F3000
+G1 X95.700 Y95.875 E14.8110 F3000
+G1 X95.600 Y95.975 E14.8156 F3000
+G1 X95.500 Y96.075 E14.8203 F3000
+G1 X95.400 Y96.175 E14.8250 F3000
+G1 X95.300 Y96.274 E14.8296 F3000
+G1 X95.200 Y96.373 E14.8343 F3000
+G1 X95.100 Y96.471 E14.8389 F3000
+G1 X95.000 Y96.567 E14.8435 F3000
+G1 X94.900 Y96.662 E14.8480 F3000
+G1 X94.800 Y96.756 E14.8525 F3000
+G1 X94.700 Y96.848 E14.8570 F3000
+G1 X94.600 Y96.937 E14.8614 F3000
+G1 X94.500 Y97.024 E14.8658 F3000
+G1 X94.400 Y97.109 E14.8701 F3000
+G1 X94.300 Y97.191 E14.8744 F3000
+G1 X94.200 Y97.269 E14.8786 F3000
+G1 X94.100 Y97.345 E14.8827 F3000
+G1 X94.000 Y97.417 E14.8868 F3000
+G1 X93.900 Y97.486 E14.8908 F3000
+G1 X93.800 Y97.551 E14.8948 F3000
+G1 X93.700 Y97.612 E14.8986 F3000
+G1 X93.600 Y97.669 E14.9024 F3000
+G1 X93.500 Y97.722 E14.9062 F3000
+G1 X93.400 Y97.771 E14.9098 F3000
+G1 X93.300 Y97.815 E14.9134 F3000
+G1 X93.200 Y97.855 E14.9170 F3000
+G1 X93.100 Y97.890 E14.9205 F3000
+G1 X93.000 Y97.920 E14.9239 F3000
+G1 X92.900 Y97.946 E14.9273 F3000
+G1 X92.800 Y97.967 E14.9307 F3000
+G1 X92.700 Y97.982 E14.9340 F3000
+G1 X92.600 Y97.993 E14.9374 F3000
+G1 X92.500 Y97.999 E14.9407 F3000
+G1 X92.400 Y98.000 E14.9440 F3000
+G1 X92.300 Y97.996 E14.9473 F3000
+G1 X92.200 Y97.986 E14.9506 F3000
+G1 X92.100 Y97.972 E14.9539 F3000
+G1 X92.000 Y97.953 E14.9573 F3000
+G1 X91.900 Y97.929 E14.9607 F3000
+G1 X91.800 Y97.900 E14.9641 F3000
+G1 X91.700 Y97.867 E14.9676 F3000
+G1 X91.600 Y97.829 E14.9711 F3000
+G1 X91.500 Y97.786 E14.9747 F3000
+G1 X91.400 Y97.739 E14.9784 F3000
+G1 X91.300 Y97.687 E14.9821 F3000
+G1 X91.200 Y97.631 E14.9858 F3000
+G1 X91.100 Y97.572 E14.9897 F3000
+G1 X91.000 Y97.508 E14.9936 F3000
+G1 X90.900 Y97.440 E14.9976 F3000
+G1 X90.800 Y97.369 E15.0016 F3000
+G1 X90.700 Y97.294 E15.0058 F3000
+G1 X90.600 Y97.217 E15.0099 F3000
+G1 X90.500 Y97.136 E15.0142 F3000
+G1 X90.400 Y97.052 E15.0185 F3000
+G1 X90.300 Y96.966 E15.0228 F3000
+G1 X90.200 Y96.877 E15.0273 F3000
+G1 X90.100 Y96.786 E15.0317 F3000
+G1 X90.000 Y96.693 E15.0362 F3000
+G1 X89.900 Y96.599 E15.0408 F3000
+G1 X89.800 Y96.502 E15.0453 F3000
+G1 X89.700 Y96.405 E15.0499 F3000
+G1 X89.600 Y96.307 E15.0546 F3000
+G1 X89.500 Y96.208 E15.0592 F3000
+G1 X89.400 Y96.108 E15.0639 F3000
+G1 X89.300 Y96.008 E15.0686 F3000
+G1 X89.200 Y95.908 E15.0732 F3000
+G1 X89.100 Y95.808 E15.0779 F3000
+G1 X89.000 Y95.709 E15.0825 F3000
+G1 X88.900 Y95.610 E15.0872 F3000
+G1 X88.800 Y95.513 E15.0918 F3000
+G1 X88.700 Y95.417 E15.0964 F3000
+G1 X88.600 Y95.322 E15.1009 F3000
+G1 X88.500 Y95.228 E15.1054 F3000
+G1 X88.400 Y95.137 E15.1099 F3000
+G1 X88.300 Y95.048 E15.1143 F3000
+G1 X88.200 Y94.961 E15.1187 F3000
+G1 X88.100 Y94.877 E15.1230 F3000
+G1 X88.000 Y94.796 E15.1272 F3000
+G1 X87.900 Y94.718 E15.1314 F3000
+G1 X87.800 Y94.643 E15.1356 F3000
+G1 X87.700 Y94.571 E15.1396 F3000
+G1 X87.600 Y94.503 E15.1436 F3000
+G1 X87.500 Y94.438 E15.1475 F3000
+G1 X87.400 Y94.378 E15.1514 F3000
+G1 X87.300 Y94.321 E15.1552 F3000
+G1 X87.200 Y94.269 E15.1589 F3000
+G1 X87.100 Y94.221 E15.1626 F3000
+G1 X87.000 Y94.178 E15.1662 F3000
+G1 X86.900 Y94.139 E15.1697 F3000
+G1 X86.800 Y94.105 E15.1732 F3000
+G1 X86.700 Y94.075 E15.1766 F3000
+G1 X86.600 Y94.050 E15.1800 F3000
+G1 X86.500 Y94.030 E15.1834 F3000
+G1 X86.400 Y94.016 E15.1867 F3000
+G1 X86.300 Y94.006 E15.1900 F3000
+G1 X86.200 Y94.001 E15.1933 F3000
+G1 X86.100 Y94.001 E15.1966 F3000
+G1 X86.000 Y94.006 E15.2000 F3000
+G1 X85.900 Y94.016 E15.2033 F3000
+G1 X85.800 Y94.031 E15.2066 F3000
+G1 X85.700 Y94.051 E15.2100 F3000
+G1 X85.600 Y94.075 E15.2134 F3000
+G1 X85.500 Y94.105 E15.2168 F3000
+G1 X85.400 Y94.139 E15.2203 F3000
+G1 X85.300 Y94.178 E15.2238 F3000
+G1 X85.200 Y94.222 E15.2274 F3000
+G1 X85.100 Y94.270 E15.2311 F3000
+G1 X85.000 Y94.322 E15.2348 F3000
+G1 X84.900 Y94.378 E15.2386 F3000
+G1 X84.800 Y94.439 E15.2425 F3000
+G1 X84.700 Y94.503 E15.2464 F3000
+G1 X84.600 Y94.571 E15.2504 F3000
+G1 X84.500 Y94.643 E15.2545 F3000
+G1 X84.400 Y94.718 E15.2586 F3000
+G1 X84.300 Y94.797 E15.2628 F3000
+G1 X84.200 Y94.878 E15.2670 F3000
+G1 X84.100 Y94.962 E15.2713 F3000
+G1 X84.000 Y95.049 E15.2757 F3000
+G1 X83.900 Y95.138 E15.2801 F3000
+G1 X83.800 Y95.229 E15.2846 F3000
+G1 X83.700 Y95.323 E15.2891 F3000
+G1 X83.600 Y95.417 E15.2937 F3000
+G1 X83.500 Y95.514 E15.2982 F3000
+G1 X83.400 Y95.611 E15.3029 F3000
+G1 X83.300 Y95.710 E15.3075 F3000
+G1 X83.200 Y95.809 E15.3121 F3000
+G1 X83.100 Y95.909 E15.3168 F3000
+G1 X83.000 Y96.009 E15.3215 F3000
+G1 X82.900 Y96.109 E15.3261 F3000
+G1 X82.800 Y96.209 E15.3308 F3000
+G1 X82.700 Y96.308 E15.3354 F3000
+G1 X82.600 Y96.406 E15.3401 F3000
+G1 X82.500 Y96.503 E15.3447 F3000
+G1 X82.400 Y96.600 E15.3492 F3000
+G1 X82.300 Y96.694 E15.3538 F3000
+G1 X82.200 Y96.787 E15.3583 F3000
+G1 X82.100 Y96.878 E15.3628 F3000
+G1 X82.000 Y96.967 E15.3672 F3000
+G1 X81.900 Y97.053 E15.3715 F3000
+G1 X81.800 Y97.137 E15.3758 F3000
+G1 X81.700 Y97.217 E15.3801 F3000
+G1 X81.600 Y97.295 E15.3842 F3000
+G1 X81.500 Y97.370 E15.3884 F3000
+G1 X81.400 Y97.441 E15.3924 F3000
+G1 X81.300 Y97.508 E15.3964 F3000
+G1 X81.200 Y97.572 E15.4003 F3000
+G1 X81.100 Y97.632 E15.4042 F3000
+G1 X81.000 Y97.688 E15.4079 F3000
+G1 X80.900 Y97.739 E15.4116 F3000
+G1 X80.800 Y97.786 E15.4153 F3000
+G1 X80.700 Y97.829 E15.4189 F3000
+G1 X80.600 Y97.867 E15.4224 F3000
+G1 X80.500 Y97.901 E15.4259 F3000
+G1 X80.400 Y97.929 E15.4293 F3000
+G1 X80.300 Y97.953 E15.4327 F3000
+G1 X80.200 Y97.972 E15.4361 F3000
+G1 X80.100 Y97.986 E15.4394 F3000
+G1 X80.000 Y97.996 E15.4427 F3000
+G1 X79.900 Y98.000 E15.4460 F3000
+G1 X79.800 Y97.999 E15.4493 F3000
+G1 X79.700 Y97.993 E15.4526 F3000
+G1 X79.600 Y97.982 E15.4560 F3000
+G1 X79.500 Y97.966 E15.4593 F3000
+G1 X79.400 Y97.946 E15.4627 F3000
+G1 X79.300 Y97.920 E15.4661 F3000
+G1 X79.200 Y97.890 E15.4695 F3000
+G1 X79.100 Y97.855 E15.4730 F3000
+G1 X79.000 Y97.815 E15.4766 F3000
+G1 X78.900 Y97.771 E15.4802 F3000
+G1 X78.800 Y97.722 E15.4838 F3000
+G1 X78.700 Y97.669 E15.4876 F3000
+G1 X78.600 Y97.612 E15.4914 F3000
+G1 X78.500 Y97.551 E15.4953 F3000
+G1 X78.400 Y97.485 E15.4992 F3000
+G1 X78.300 Y97.417 E15.5032 F3000
+G1 X78.200 Y97.344 E15.5073 F3000
+G1 X78.100 Y97.269 E15.5114 F3000
+G1 X78.000 Y97.190 E15.5156 F3000
+G1 X77.900 Y97.108 E15.5199 F3000
+G1 X77.800 Y97.023 E15.5242 F3000
+G1 X77.700 Y96.936 E15.5286 F3000
+G1 X77.600 Y96.847 E15.5330 F3000
+G1 X77.500 Y96.755 E15.5375 F3000
+G1 X77.400 Y96.662 E15.5420 F3000
+G1 X77.300 Y96.566 E15.5466 F3000
+G1 X77.200 Y96.470 E15.5511 F3000
+G1 X77.100 Y96.372 E15.5558 F3000
+G1 X77.000 Y96.273 E15.5604 F3000
+G1 X76.900 Y96.174 E15.5650 F3000
+G1 X76.800 Y96.074 E15.5697 F3000
+G1 X76.700 Y95.974 E15.5744 F3000
+G1 X76.600 Y95.874 E15.5790 F3000
+G1 X76.500 Y95.775 E15.5837 F3000
+G1 X76.400 Y95.676 E15.5883 F3000
+G1 X76.300 Y95.578 E15.5930 F3000
+G1 X76.200 Y95.480 E15.5976 F3000
+G1 X76.100 Y95.384 E15.6021 F3000
+G1 X76.000 Y95.290 E15.6067 F3000
+G1 X75.900 Y95.198 E15.6112 F3000
+G1 X75.800 Y95.107 E15.6156 F3000
+G1 X75.700 Y95.019 E15.6200 F3000
+G1 X75.600 Y94.933 E15.6244 F3000
+G1 X75.500 Y94.850 E15.6287 F3000
+G1 X75.400 Y94.769 E15.6329 F3000
+G1 X75.300 Y94.692 E15.6371 F3000
+G1 X75.200 Y94.618 E15.6412 F3000
+G1 X75.100 Y94.548 E15.6452 F3000
+G1 X75.000 Y94.481 E15.6492 F3000
+G1 X74.900 Y94.418 E15.6531 F3000
+G1 X74.800 Y94.358 E15.6569 F3000
+G1 X74.700 Y94.303 E15.6607 F3000
+G1 X74.600 Y94.253 E15.6644 F3000
+G1 X74.500 Y94.206 E15.6680 F3000
+G1 X74.400 Y94.164 E15.6716 F3000
+G1 X74.300 Y94.127 E15.6751 F3000
+G1 X74.200 Y94.094 E15.6786 F3000
+G1 X74.100 Y94.066 E15.6820 F3000
+G1 X74.000 Y94.043 E15.6854 F3000
+G1 X73.900 Y94.025 E15.6888 F3000
+G1 X73.800 Y94.012 E15.6921 F3000
+G1 X73.700 Y94.003 E15.6954 F3000
+G1 X73.600 Y94.000 E15.6987 F3000
+G1 X73.500 Y94.002 E15.7020 F3000
+G1 X73.400 Y94.008 E15.7053 F3000
+G1 X73.300 Y94.020 E15.7086 F3000
+G1 X73.200 Y94.037 E15.7120 F3000
+G1 X73.100 Y94.058 E15.7154 F3000
+G1 X73.000 Y94.085 E15.7188 F3000
+G1 X72.900 Y94.116 E15.7222 F3000
+G1 X72.800 Y94.152 E15.7257 F3000
+G1 X72.700 Y94.192 E15.7293 F3000
+G1 X72.600 Y94.237 E15.7329 F3000
+G1 X72.500 Y94.287 E15.7366 F3000
+G1 X72.400 Y94.340 E15.7403 F3000
+G1 X72.300 Y94.398 E15.7442 F3000
+G1 X72.200 Y94.460 E15.7480 F3000
+G1 X72.100 Y94.526 E15.7520 F3000
+G1 X72.000 Y94.595 E15.7560 F3000
+G1 X71.900 Y94.668 E15.7601 F3000
+G1 X71.800 Y94.744 E15.7642 F3000
+G1 X71.700 Y94.824 E15.7684 F3000
+G1 X71.600 Y94.906 E15.7727 F3000
+G1 X71.500 Y94.991 E15.7771 F3000
+G1 X71.400 Y95.079 E15.7814 F3000
+G1 X71.300 Y95.169 E15.7859 F3000
+G1 X71.200 Y95.260 E15.7904 F3000
+G1 X71.100 Y95.354 E15.7949 F3000
+G1 X71.000 Y95.450 E15.7994 F3000
+G1 X70.900 Y95.546 E15.8040 F3000
+G1 X70.800 Y95.644 E15.8087 F3000
+G1 X70.700 Y95.743 E15.8133 F3000
+G1 X70.600 Y95.843 E15.8179 F3000
+G1 X70.500 Y95.943 E15.8226 F3000
+G1 X70.400 Y96.043 E15.8273 F3000
+G1 X70.300 Y96.142 E15.8319 F3000
+G1 X70.200 Y96.242 E15.8366 F3000
+G1 X70.100 Y96.341 E15.8412 F3000
+G1 X70.000 Y96.439 E15.8459 F3000
+G1 X69.900 Y96.536 E15.8505 F3000
+G1 X69.800 Y96.632 E15.8550 F3000
+G1 X69.700 Y96.726 E15.8596 F3000
+G1 X69.600 Y96.818 E15.8640 F3000
+G1 X69.500 Y96.908 E15.8685 F3000
+G1 X69.400 Y96.996 E15.8729 F3000
+G1 X69.300 Y97.081 E15.8772 F3000
+G1 X69.200 Y97.164 E15.8815 F3000
+G1 X69.100 Y97.244 E15.8857 F3000
+G1 X69.000 Y97.321 E15.8899 F3000
+G1 X68.900 Y97.394 E15.8940 F3000
+G1 X68.800 Y97.464 E15.8980 F3000
+G1 X68.700 Y97.530 E15.9020 F3000
+G1 X68.600 Y97.593 E15.9059 F3000
+G1 X68.500 Y97.651 E15.9097 F3000
+G1 X68.400 Y97.706 E15.9134 F3000
+G1 X68.300 Y97.756 E15.9171 F3000
+G1 X68.200 Y97.801 E15.9208 F3000
+G1 X68.100 Y97.842 E15.9243 F3000
+G1 X68.000 Y97.879 E15.9278 F3000
+G1 X67.900 Y97.911 E15.9313 F3000
+G1 X67.800 Y97.938 E15.9347 F3000
+G1 X67.700 Y97.960 E15.9381 F3000
+G1 X67.600 Y97.978 E15.9415 F3000
+G1 X67.500 Y97.990 E15.9448 F3000
+G1 X67.400 Y97.998 E15.9481 F3000
+G1 X67.300 Y98.000 E15.9514 F3000
+G1 X67.200 Y97.997 E15.9547 F3000
+G1 X67.100 Y97.990 E15.9580 F3000
+G1 X67.000 Y97.977 E15.9613 F3000
+G1 X66.900 Y97.960 E15.9647 F3000
+G1 X66.800 Y97.938 E15.9681 F3000
+G1 X66.700 Y97.910 E15.9715 F3000
+G1 X66.600 Y97.878 E15.9749 F3000
+G1 X66.500 Y97.842 E15.9785 F3000
+G1 X66.400 Y97.800 E15.9820 F3000
+G1 X66.300 Y97.755 E15.9857 F3000
+G1 X66.200 Y97.705 E15.9893 F3000
+G1 X66.100 Y97.650 E15.9931 F3000
+G1 X66.000 Y97.592 E15.9969 F3000
+G1 X65.900 Y97.529 E16.0008 F3000
+G1 X65.800 Y97.463 E16.0048 F3000
+G1 X65.700 Y97.393 E16.0088 F3000
+G1 X65.600 Y97.319 E16.0129 F3000
+G1 X65.500 Y97.243 E16.0171 F3000
+G1 X65.400 Y97.163 E16.0213 F3000
+G1 X65.300 Y97.080 E16.0256 F3000
+G1 X65.200 Y96.994 E16.0299 F3000
+G1 X65.100 Y96.906 E16.0343 F3000
+G1 X65.000 Y96.816 E16.0388 F3000
+G1 X64.900 Y96.724 E16.0432 F3000
+G1 X64.800 Y96.630 E16.0478 F3000
+G1 X64.700 Y96.534 E16.0523 F3000
+G1 X64.600 Y96.437 E16.0569 F3000
+G1 X64.500 Y96.339 E16.0616 F3000
+G1 X64.400 Y96.240 E16.0662 F3000
+G1 X64.300 Y96.141 E16.0709 F3000
+G1 X64.200 Y96.041 E16.0755 F3000
+G1 X64.100 Y95.941 E16.0802 F3000
+G1 X64.000 Y95.841 E16.0849 F3000
+G1 X63.900 Y95.741 E16.0895 F3000
+G1 X63.800 Y95.643 E16.0941 F3000
+G1 X63.700 Y95.545 E16.0988 F3000
+G1 X63.600 Y95.448 E16.1034 F3000
+G1 X63.500 Y95.353 E16.1079 F3000
+G1 X63.400 Y95.259 E16.1124 F3000
+G1 X63.300 Y95.167 E16.1169 F3000
+G1 X63.200 Y95.077 E16.1214 F3000
+G1 X63.100 Y94.990 E16.1257 F3000
+G1 X63.000 Y94.905 E16.1301 F3000
+G1 X62.900 Y94.822 E16.1343 F3000
+G1 X62.800 Y94.743 E16.1386 F3000
+G1 X62.700 Y94.667 E16.1427 F3000
+G1 X62.600 Y94.594 E16.1468 F3000
+G1 X62.500 Y94.525 E16.1508 F3000
+G1 X62.400 Y94.459 E16.1548 F3000
+G1 X62.300 Y94.397 E16.1586 F3000
+G1 X62.200 Y94.339 E16.1624 F3000
+G1 X62.100 Y94.286 E16.1662 F3000
+G1 X62.000 Y94.236 E16.1699 F3000
+G1 X61.900 Y94.191 E16.1735 F3000
+G1 X61.800 Y94.151 E16.1770 F3000
+G1 X61.700 Y94.115 E16.1806 F3000
+G1 X61.600 Y94.084 E16.1840 F3000
+G1 X61.500 Y94.058 E16.1874 F3000
+G1 X61.400 Y94.036 E16.1908 F3000
+G1 X61.300 Y94.020 E16.1941 F3000
+G1 X61.200 Y94.008 E16.1975 F3000
+G1 X61.100 Y94.002 E16.2008 F3000
+G1 X61.000 Y94.000 E16.2041 F3000
+G1 X60.900 Y94.003 E16.2074 F3000
+G1 X60.800 Y94.012 E16.2107 F3000
+G1 X60.700 Y94.025 E16.2140 F3000
+G1 X60.600 Y94.043 E16.2174 F3000
+G1 X60.500 Y94.067 E16.2208 F3000
+G1 X60.400 Y94.095 E16.2242 F3000
+G1 X60.300 Y94.127 E16.2277 F3000
+G1 X60.200 Y94.165 E16.2312 F3000
+G1 X60.100 Y94.207 E16.2348 F3000
+G1 X60.000 Y96.253 E16.3024 F3000
+M400
+M3202
+M104 S0
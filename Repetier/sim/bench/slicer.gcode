@@ -0,0 +1,2696 @@
+; Parser benchmark: slicer output with line numbers and checksums, as a host sends it.
+N0 M110 N0*125
+N1 G21*27
+N2 G90*18
+N3 M82*26
+N4 G92 E0*67
+N5 G1 Z0.300 F7800.000*13
+;LAYER:0
+N6 G1 Z0.300 F7800.000*14
+N7 G1 E1.00000 F2400.00000*27
+N8 G1 X120.000 Y100.000 F7800.000*84
+N9 G1 X120.301 Y100.698 E1.03161 F1800.000*25
+N10 G1 X120.575 Y101.395 E1.06275*95
+N11 G1 X120.817 Y102.091 E1.09338*84
+N12 G1 X121.026 Y102.783 E1.12346*91
+N13 G1 X121.196 Y103.473 E1.15299*89
+N14 G1 X121.326 Y104.158 E1.18199*82
+N15 G1 X121.413 Y104.838 E1.21051*82
+N16 G1 X121.455 Y105.513 E1.23860*94
+N17 G1 X121.448 Y106.180 E1.26636*86
+N18 G1 X121.392 Y106.840 E1.29390*90
+N19 G1 X121.284 Y107.492 E1.32137*90
+N20 G1 X121.124 Y108.135 E1.34891*93
+N21 G1 X120.910 Y108.767 E1.37667*87
+N22 G1 X120.643 Y109.389 E1.40483*80
+N23 G1 X120.321 Y110.000 E1.43353*83
+N24 G1 X119.945 Y110.598 E1.46292*91
+N25 G1 X119.515 Y111.184 E1.49311*94
+N26 G1 X119.034 Y111.756 E1.52420*93
+N27 G1 X118.501 Y112.313 E1.55626*91
+N28 G1 X117.919 Y112.856 E1.58934*85
+N29 G1 X117.290 Y113.383 E1.62345*89
+N30 G1 X116.616 Y113.893 E1.65860*91
+N31 G1 X115.901 Y114.387 E1.69475*93
+N32 G1 X115.146 Y114.863 E1.73185*85
+N33 G1 X114.356 Y115.321 E1.76983*81
+N34 G1 X113.533 Y115.760 E1.80859*90
+N35 G1 X112.683 Y116.180 E1.84804*85
+N36 G1 X111.808 Y116.581 E1.88806*83
+N37 G1 X110.912 Y116.961 E1.92852*81
+N38 G1 X110.000 Y117.321 E1.96928*83
+N39 G1 X109.076 Y117.659 E2.01020*93
+N40 G1 X108.144 Y117.976 E2.05114*82
+N41 G1 X107.208 Y118.271 E2.09194*80
+N42 G1 X106.272 Y118.544 E2.13247*88
+N43 G1 X105.340 Y118.794 E2.17258*95
+N44 G1 X104.417 Y119.021 E2.21212*95
+N45 G1 X103.505 Y119.225 E2.25096*87
+N46 G1 X102.609 Y119.406 E2.28898*86
+N47 G1 X101.731 Y119.563 E2.32606*94
+N48 G1 X100.875 Y119.696 E2.36209*89
+N49 G1 X100.043 Y119.805 E2.39699*83
+N50 G1 X99.237 Y119.890 E2.43066*108
+N51 G1 X98.461 Y119.951 E2.46306*101
+N52 G1 X97.714 Y119.988 E2.49413*96
+N53 G1 X97.000 Y120.000 E2.52384*99
+N54 G1 X96.318 Y119.988 E2.55218*111
+N55 G1 X95.670 Y119.951 E2.57917*100
+N56 G1 X95.056 Y119.890 E2.60483*109
+N57 G1 X94.476 Y119.805 E2.62922*99
+N58 G1 X93.929 Y119.696 E2.65241*97
+N59 G1 X93.415 Y119.563 E2.67450*111
+N60 G1 X92.932 Y119.406 E2.69560*98
+N61 G1 X92.480 Y119.225 E2.71585*98
+N62 G1 X92.056 Y119.021 E2.73540*99
+N63 G1 X91.660 Y118.794 E2.75441*108
+N64 G1 X91.288 Y118.544 E2.77305*99
+N65 G1 X90.938 Y118.271 E2.79148*103
+N66 G1 X90.609 Y117.976 E2.80987*103
+N67 G1 X90.297 Y117.659 E2.82835*109
+N68 G1 X90.000 Y117.321 E2.84708*99
+N69 G1 X89.715 Y116.961 E2.86615*105
+N70 G1 X89.440 Y116.581 E2.88567*104
+N71 G1 X89.171 Y116.180 E2.90571*101
+N72 G1 X88.907 Y115.760 E2.92635*100
+N73 G1 X88.644 Y115.321 E2.94764*111
+N74 G1 X88.381 Y114.863 E2.96961*97
+N75 G1 X88.114 Y114.387 E2.99229*103
+N76 G1 X87.843 Y113.893 E3.01572*96
+N77 G1 X87.564 Y113.383 E3.03990*97
+N78 G1 X87.277 Y112.856 E3.06485*101
+N79 G1 X86.980 Y112.313 E3.09056*105
+N80 G1 X86.673 Y111.756 E3.11704*99
+N81 G1 X86.354 Y111.184 E3.14427*108
+N82 G1 X86.023 Y110.598 E3.17223*101
+N83 G1 X85.679 Y110.000 E3.20091*101
+N84 G1 X85.325 Y109.389 E3.23028*101
+N85 G1 X84.959 Y108.767 E3.26029*101
+N86 G1 X84.582 Y108.135 E3.29090*96
+N87 G1 X84.197 Y107.492 E3.32205*98
+N88 G1 X83.804 Y106.840 E3.35369*103
+N89 G1 X83.406 Y106.180 E3.38574*106
+N90 G1 X83.004 Y105.513 E3.41814*108
+N91 G1 X82.601 Y104.838 E3.45080*107
+N92 G1 X82.200 Y104.158 E3.48363*97
+N93 G1 X81.804 Y103.473 E3.51655*110
+N94 G1 X81.415 Y102.783 E3.54947*97
+N95 G1 X81.037 Y102.091 E3.58229*111
+N96 G1 X80.672 Y101.395 E3.61493*99
+N97 G1 X80.326 Y100.698 E3.64731*97
+N98 G1 X80.000 Y100.000 E3.67934*102
+N99 G1 X79.699 Y99.302 E3.71095*82
+N100 G1 X79.425 Y98.605 E3.74209*103
+N101 G1 X79.183 Y97.909 E3.77271*111
+N102 G1 X78.974 Y97.217 E3.80279*105
+N103 G1 X78.804 Y96.527 E3.83233*102
+N104 G1 X78.674 Y95.842 E3.86133*99
+N105 G1 X78.587 Y95.162 E3.88984*108
+N106 G1 X78.545 Y94.487 E3.91793*110
+N107 G1 X78.552 Y93.820 E3.94569*109
+N108 G1 X78.608 Y93.160 E3.97324*111
+N109 G1 X78.716 Y92.508 E4.00070*96
+N110 G1 X78.876 Y91.865 E4.02824*111
+N111 G1 X79.090 Y91.233 E4.05601*104
+N112 G1 X79.357 Y90.611 E4.08417*110
+N113 G1 X79.679 Y90.000 E4.11287*103
+N114 G1 X80.055 Y89.402 E4.14225*109
+N115 G1 X80.485 Y88.816 E4.17244*105
+N116 G1 X80.966 Y88.244 E4.20353*100
+N117 G1 X81.499 Y87.687 E4.23559*98
+N118 G1 X82.081 Y87.144 E4.26867*110
+N119 G1 X82.710 Y86.617 E4.30279*98
+N120 G1 X83.384 Y86.107 E4.33794*99
+N121 G1 X84.099 Y85.613 E4.37409*104
+N122 G1 X84.854 Y85.137 E4.41119*102
+N123 G1 X85.644 Y84.679 E4.44916*103
+N124 G1 X86.467 Y84.240 E4.48793*97
+N125 G1 X87.317 Y83.820 E4.52738*96
+N126 G1 X88.192 Y83.419 E4.56740*110
+N127 G1 X89.088 Y83.039 E4.60785*110
+N128 G1 X90.000 Y82.679 E4.64861*107
+N129 G1 X90.924 Y82.341 E4.68953*103
+N130 G1 X91.856 Y82.024 E4.73047*108
+N131 G1 X92.792 Y81.729 E4.77128*108
+N132 G1 X93.728 Y81.456 E4.81181*110
+N133 G1 X94.660 Y81.206 E4.85191*99
+N134 G1 X95.583 Y80.979 E4.89145*108
+N135 G1 X96.495 Y80.775 E4.93030*98
+N136 G1 X97.391 Y80.594 E4.96832*97
+N137 G1 X98.269 Y80.437 E5.00540*103
+N138 G1 X99.125 Y80.304 E5.04143*102
+N139 G1 X99.957 Y80.195 E5.07632*98
+N140 G1 X100.763 Y80.110 E5.11000*89
+N141 G1 X101.539 Y80.049 E5.14239*84
+N142 G1 X102.286 Y80.012 E5.17346*83
+N143 G1 X103.000 Y80.000 E5.20317*92
+N144 G1 X103.682 Y80.012 E5.23152*84
+N145 G1 X104.330 Y80.049 E5.25850*93
+N146 G1 X104.944 Y80.110 E5.28416*89
+N147 G1 X105.524 Y80.195 E5.30855*92
+N148 G1 X106.071 Y80.304 E5.33174*86
+N149 G1 X106.585 Y80.437 E5.35383*82
+N150 G1 X107.068 Y80.594 E5.37493*81
+N151 G1 X107.520 Y80.775 E5.39518*88
+N152 G1 X107.944 Y80.979 E5.41473*84
+N153 G1 X108.340 Y81.206 E5.43374*84
+N154 G1 X108.712 Y81.456 E5.45238*92
+N155 G1 X109.062 Y81.729 E5.47082*86
+N156 G1 X109.391 Y82.024 E5.48920*93
+N157 G1 X109.703 Y82.341 E5.50769*89
+N158 G1 X110.000 Y82.679 E5.52641*93
+N159 G1 X110.285 Y83.039 E5.54548*92
+N160 G1 X110.560 Y83.419 E5.56500*82
+N161 G1 X110.829 Y83.820 E5.58505*94
+N162 G1 X111.093 Y84.240 E5.60569*95
+N163 G1 X111.356 Y84.679 E5.62697*90
+N164 G1 X111.619 Y85.137 E5.64894*84
+N165 G1 X111.886 Y85.613 E5.67163*94
+N166 G1 X112.157 Y86.107 E5.69506*83
+N167 G1 X112.436 Y86.617 E5.71924*83
+N168 G1 X112.723 Y87.144 E5.74418*92
+N169 G1 X113.020 Y87.687 E5.76990*95
+N170 G1 X113.327 Y88.244 E5.79637*90
+N171 G1 X113.646 Y88.816 E5.82360*87
+N172 G1 X113.977 Y89.402 E5.85157*80
+N173 G1 X114.321 Y90.000 E5.88025*88
+N174 G1 X114.675 Y90.611 E5.90961*93
+N175 G1 X115.041 Y91.233 E5.93962*89
+N176 G1 X115.418 Y91.865 E5.97023*83
+N177 G1 X115.803 Y92.508 E6.00139*86
+N178 G1 X116.196 Y93.160 E6.03302*93
+N179 G1 X116.594 Y93.820 E6.06508*94
+N180 G1 X116.996 Y94.487 E6.09748*89
+N181 G1 X117.399 Y95.162 E6.13013*81
+N182 G1 X117.800 Y95.842 E6.16297*89
+N183 G1 X118.196 Y96.527 E6.19589*91
+N184 G1 X118.585 Y97.217 E6.22881*82
+N185 G1 X118.963 Y97.909 E6.26163*82
+N186 G1 X119.328 Y98.605 E6.29427*83
+N187 G1 X119.674 Y99.302 E6.32664*82
+N188 G1 X120.000 Y100.000 E6.35867*104
+N189 G1 E5.35867 F2400.00000*23
+N190 G1 E6.35867 F2400.00000*28
+N191 G1 X119.550 Y100.000 F7800.000*95
+N192 G1 X119.852 Y100.682 E6.38969 F1800.000*25
+N193 G1 X120.126 Y101.364 E6.42024*104
+N194 G1 X120.370 Y102.044 E6.45027*104
+N195 G1 X120.580 Y102.721 E6.47975*104
+N196 G1 X120.753 Y103.395 E6.50868*102
+N197 G1 X120.886 Y104.065 E6.53708*97
+N198 G1 X120.977 Y104.730 E6.56498*105
+N199 G1 X121.022 Y105.389 E6.59245*110
+N200 G1 X121.020 Y106.041 E6.61959*102
+N201 G1 X120.969 Y106.686 E6.64650*108
+N202 G1 X120.867 Y107.324 E6.67333*111
+N203 G1 X120.713 Y107.952 E6.70022*108
+N204 G1 X120.506 Y108.570 E6.72734*108
+N205 G1 X120.245 Y109.178 E6.75485*110
+N206 G1 X119.931 Y109.775 E6.78289*99
+N207 G1 X119.563 Y110.360 E6.81163*96
+N208 G1 X119.142 Y110.932 E6.84116*98
+N209 G1 X118.669 Y111.491 E6.87160*107
+N210 G1 X118.146 Y112.036 E6.90301*96
+N211 G1 X117.574 Y112.566 E6.93545*110
+N212 G1 X116.956 Y113.082 E6.96892*108
+N213 G1 X116.293 Y113.581 E7.00342*97
+N214 G1 X115.588 Y114.063 E7.03893*98
+N215 G1 X114.845 Y114.528 E7.07539*109
+N216 G1 X114.066 Y114.976 E7.11272*111
+N217 G1 X113.256 Y115.406 E7.15085*109
+N218 G1 X112.418 Y115.816 E7.18966*107
+N219 G1 X111.556 Y116.208 E7.22903*110
+N220 G1 X110.674 Y116.579 E7.26885*108
+N221 G1 X109.775 Y116.931 E7.30896*96
+N222 G1 X108.865 Y117.262 E7.34924*108
+N223 G1 X107.946 Y117.571 E7.38953*107
+N224 G1 X107.025 Y117.860 E7.42969*105
+N225 G1 X106.103 Y118.126 E7.46957*97
+N226 G1 X105.186 Y118.371 E7.50902*107
+N227 G1 X104.278 Y118.593 E7.54792*96
+N228 G1 X103.381 Y118.793 E7.58611*107
+N229 G1 X102.500 Y118.969 E7.62348*111
+N230 G1 X101.638 Y119.123 E7.65990*99
+N231 G1 X100.797 Y119.253 E7.69528*96
+N232 G1 X99.980 Y119.360 E7.72953*81
+N233 G1 X99.190 Y119.443 E7.76255*86
+N234 G1 X98.429 Y119.502 E7.79429*81
+N235 G1 X97.699 Y119.538 E7.82470*87
+N236 G1 X97.000 Y119.550 E7.85376*90
+N237 G1 X96.334 Y119.538 E7.88145*95
+N238 G1 X95.702 Y119.502 E7.90779*91
+N239 G1 X95.103 Y119.443 E7.93279*95
+N240 G1 X94.539 Y119.360 E7.95653*81
+N241 G1 X94.007 Y119.253 E7.97907*85
+N242 G1 X93.508 Y119.123 E8.00050*85
+N243 G1 X93.041 Y118.969 E8.02096*83
+N244 G1 X92.604 Y118.793 E8.04056*83
+N245 G1 X92.195 Y118.593 E8.05946*86
+N246 G1 X91.814 Y118.371 E8.07783*89
+N247 G1 X91.456 Y118.126 E8.09583*94
+N248 G1 X91.121 Y117.860 E8.11364*86
+N249 G1 X90.806 Y117.571 E8.13140*81
+N250 G1 X90.508 Y117.262 E8.14927*81
+N251 G1 X90.225 Y116.931 E8.16738*86
+N252 G1 X89.954 Y116.579 E8.18584*91
+N253 G1 X89.692 Y116.208 E8.20475*90
+N254 G1 X89.436 Y115.816 E8.22419*95
+N255 G1 X89.184 Y115.406 E8.24422*81
+N256 G1 X88.934 Y114.976 E8.26489*88
+N257 G1 X88.682 Y114.528 E8.28625*86
+N258 G1 X88.427 Y114.063 E8.30831*92
+N259 G1 X88.166 Y113.581 E8.33111*91
+N260 G1 X87.899 Y113.082 E8.35466*82
+N261 G1 X87.622 Y112.566 E8.37897*83
+N262 G1 X87.335 Y112.036 E8.40404*85
+N263 G1 X87.037 Y111.491 E8.42987*91
+N264 G1 X86.727 Y110.932 E8.45645*88
+N265 G1 X86.404 Y110.360 E8.48376*94
+N266 G1 X86.069 Y109.775 E8.51179*95
+N267 G1 X85.722 Y109.178 E8.54050*81
+N268 G1 X85.363 Y108.570 E8.56986*82
+N269 G1 X84.993 Y107.952 E8.59982*95
+N270 G1 X84.614 Y107.324 E8.63033*86
+N271 G1 X84.227 Y106.686 E8.66132*90
+N272 G1 X83.834 Y106.041 E8.69274*85
+N273 G1 X83.437 Y105.389 E8.72450*85
+N274 G1 X83.038 Y104.730 E8.75653*88
+N275 G1 X82.641 Y104.065 E8.78874*81
+N276 G1 X82.247 Y103.395 E8.82105*81
+N277 G1 X81.860 Y102.721 E8.85335*80
+N278 G1 X81.484 Y102.044 E8.88557*82
+N279 G1 X81.121 Y101.364 E8.91761*84
+N280 G1 X80.775 Y100.682 E8.94939*94
+N281 G1 X80.450 Y100.000 E8.98082*82
+N282 G1 X80.148 Y99.318 E9.01184*96
+N283 G1 X79.874 Y98.636 E9.04238*104
+N284 G1 X79.630 Y97.956 E9.07241*106
+N285 G1 X79.420 Y97.279 E9.10190*103
+N286 G1 X79.247 Y96.605 E9.13083*109
+N287 G1 X79.114 Y95.935 E9.15923*99
+N288 G1 X79.023 Y95.270 E9.18713*99
+N289 G1 X78.978 Y94.611 E9.21460*107
+N290 G1 X78.980 Y93.959 E9.24174*101
+N291 G1 X79.031 Y93.314 E9.26865*110
+N292 G1 X79.133 Y92.676 E9.29547*108
+N293 G1 X79.287 Y92.048 E9.32237*96
+N294 G1 X79.494 Y91.430 E9.34949*111
+N295 G1 X79.755 Y90.822 E9.37699*111
+N296 G1 X80.069 Y90.225 E9.40504*104
+N297 G1 X80.437 Y89.640 E9.43377*104
+N298 G1 X80.858 Y89.068 E9.46331*105
+N299 G1 X81.331 Y88.509 E9.49375*97
+N300 G1 X81.854 Y87.964 E9.52516*105
+N301 G1 X82.426 Y87.434 E9.55759*100
+N302 G1 X83.044 Y86.918 E9.59107*101
+N303 G1 X83.707 Y86.419 E9.62557*97
+N304 G1 X84.412 Y85.937 E9.66108*110
+N305 G1 X85.155 Y85.472 E9.69754*100
+N306 G1 X85.934 Y85.024 E9.73487*105
+N307 G1 X86.744 Y84.594 E9.77300*97
+N308 G1 X87.582 Y84.184 E9.81180*97
+N309 G1 X88.444 Y83.792 E9.85118*103
+N310 G1 X89.326 Y83.421 E9.89099*98
+N311 G1 X90.225 Y83.069 E9.93111*107
+N312 G1 X91.135 Y82.738 E9.97139*103
+N313 G1 X92.054 Y82.429 E10.01168*83
+N314 G1 X92.975 Y82.140 E10.05184*82
+N315 G1 X93.897 Y81.874 E10.09172*87
+N316 G1 X94.814 Y81.629 E10.13117*86
+N317 G1 X95.722 Y81.407 E10.17006*87
+N318 G1 X96.619 Y81.207 E10.20826*90
+N319 G1 X97.500 Y81.031 E10.24562*95
+N320 G1 X98.362 Y80.877 E10.28205*89
+N321 G1 X99.203 Y80.747 E10.31743*92
+N322 G1 X100.020 Y80.640 E10.35167*111
+N323 G1 X100.810 Y80.557 E10.38470*110
+N324 G1 X101.571 Y80.498 E10.41644*107
+N325 G1 X102.301 Y80.462 E10.44685*101
+N326 G1 X103.000 Y80.450 E10.47591*97
+N327 G1 X103.666 Y80.462 E10.50360*105
+N328 G1 X104.298 Y80.498 E10.52993*101
+N329 G1 X104.897 Y80.557 E10.55494*110
+N330 G1 X105.461 Y80.640 E10.57868*106
+N331 G1 X105.993 Y80.747 E10.60122*110
+N332 G1 X106.492 Y80.877 E10.62265*108
+N333 G1 X106.959 Y81.031 E10.64310*105
+N334 G1 X107.396 Y81.207 E10.66271*101
+N335 G1 X107.805 Y81.407 E10.68161*111
+N336 G1 X108.186 Y81.629 E10.69998*96
+N337 G1 X108.544 Y81.874 E10.71798*106
+N338 G1 X108.879 Y82.140 E10.73578*101
+N339 G1 X109.194 Y82.429 E10.75355*106
+N340 G1 X109.492 Y82.738 E10.77141*97
+N341 G1 X109.775 Y83.069 E10.78952*109
+N342 G1 X110.046 Y83.421 E10.80799*103
+N343 G1 X110.308 Y83.792 E10.82690*110
+N344 G1 X110.564 Y84.184 E10.84634*107
+N345 G1 X110.816 Y84.594 E10.86637*102
+N346 G1 X111.066 Y85.024 E10.88704*107
+N347 G1 X111.318 Y85.472 E10.90839*111
+N348 G1 X111.573 Y85.937 E10.93046*100
+N349 G1 X111.834 Y86.419 E10.95326*106
+N350 G1 X112.101 Y86.918 E10.97681*104
+N351 G1 X112.378 Y87.434 E11.00112*101
+N352 G1 X112.665 Y87.964 E11.02619*105
+N353 G1 X112.963 Y88.509 E11.05202*96
+N354 G1 X113.273 Y89.068 E11.07860*99
+N355 G1 X113.596 Y89.640 E11.10591*103
+N356 G1 X113.931 Y90.225 E11.13394*106
+N357 G1 X114.278 Y90.822 E11.16265*109
+N358 G1 X114.637 Y91.430 E11.19201*110
+N359 G1 X115.007 Y92.048 E11.22197*103
+N360 G1 X115.386 Y92.676 E11.25247*101
+N361 G1 X115.773 Y93.314 E11.28347*102
+N362 G1 X116.166 Y93.959 E11.31489*106
+N363 G1 X116.563 Y94.611 E11.34665*107
+N364 G1 X116.962 Y95.270 E11.37868*99
+N365 G1 X117.359 Y95.935 E11.41089*109
+N366 G1 X117.753 Y96.605 E11.44320*106
+N367 G1 X118.140 Y97.279 E11.47550*108
+N368 G1 X118.516 Y97.956 E11.50772*102
+N369 G1 X118.879 Y98.636 E11.53976*108
+N370 G1 X119.225 Y99.318 E11.57153*101
+N371 G1 X119.550 Y100.000 E11.60297*85
+N372 G1 E10.60297 F2400.00000*32
+N373 G1 E11.60297 F2400.00000*32
+N374 G1 X119.100 Y100.000 F7800.000*87
+N375 G1 X119.402 Y100.667 E11.63339 F1800.000*39
+N376 G1 X119.677 Y101.332 E11.66335*88
+N377 G1 X119.922 Y101.996 E11.69279*84
+N378 G1 X120.134 Y102.658 E11.72168*89
+N379 G1 X120.310 Y103.317 E11.75001*90
+N380 G1 X120.446 Y103.971 E11.77781*95
+N381 G1 X120.540 Y104.621 E11.80510*86
+N382 G1 X120.590 Y105.265 E11.83195*87
+N383 G1 X120.592 Y105.902 E11.85846*95
+N384 G1 X120.546 Y106.533 E11.88474*92
+N385 G1 X120.450 Y107.155 E11.91093*91
+N386 G1 X120.302 Y107.769 E11.93718*87
+N387 G1 X120.101 Y108.373 E11.96365*92
+N388 G1 X119.848 Y108.967 E11.99050*88
+N389 G1 X119.541 Y109.550 E12.01790*93
+N390 G1 X119.181 Y110.121 E12.04598*88
+N391 G1 X118.769 Y110.681 E12.07486*88
+N392 G1 X118.305 Y111.227 E12.10465*87
+N393 G1 X117.792 Y111.759 E12.13541*91
+N394 G1 X117.230 Y112.277 E12.16720*91
+N395 G1 X116.621 Y112.780 E12.20003*81
+N396 G1 X115.969 Y113.268 E12.23389*82
+N397 G1 X115.275 Y113.739 E12.26876*90
+N398 G1 X114.544 Y114.194 E12.30457*95
+N399 G1 X113.777 Y114.631 E12.34127*85
+N400 G1 X112.979 Y115.051 E12.37875*95
+N401 G1 X112.154 Y115.452 E12.41692*88
+N402 G1 X111.304 Y115.835 E12.45565*93
+N403 G1 X110.435 Y116.198 E12.49482*81
+N404 G1 X109.550 Y116.541 E12.53430*94
+N405 G1 X108.653 Y116.864 E12.57393*94
+N406 G1 X107.749 Y117.167 E12.61357*94
+N407 G1 X106.842 Y117.449 E12.65309*92
+N408 G1 X105.935 Y117.709 E12.69232*83
+N409 G1 X105.033 Y117.948 E12.73112*92
+N410 G1 X104.139 Y118.165 E12.76936*93
+N411 G1 X103.257 Y118.360 E12.80691*92
+N412 G1 X102.391 Y118.533 E12.84362*88
+N413 G1 X101.544 Y118.683 E12.87940*85
+N414 G1 X100.719 Y118.810 E12.91412*80
+N415 G1 X99.918 Y118.914 E12.94771*105
+N416 G1 X99.143 Y118.995 E12.98008*96
+N417 G1 X98.398 Y119.053 E13.01117*104
+N418 G1 X97.683 Y119.088 E13.04093*105
+N419 G1 X97.000 Y119.100 E13.06934*98
+N420 G1 X96.350 Y119.088 E13.09637*109
+N421 G1 X95.733 Y119.053 E13.12205*103
+N422 G1 X95.150 Y118.995 E13.14641*103
+N423 G1 X94.601 Y118.914 E13.16949*104
+N424 G1 X94.085 Y118.810 E13.19138*97
+N425 G1 X93.602 Y118.683 E13.21216*110
+N426 G1 X93.150 Y118.533 E13.23196*108
+N427 G1 X92.728 Y118.360 E13.25092*102
+N428 G1 X92.334 Y118.165 E13.26918*111
+N429 G1 X91.967 Y117.948 E13.28691*105
+N430 G1 X91.625 Y117.709 E13.30427*101
+N431 G1 X91.304 Y117.449 E13.32145*102
+N432 G1 X91.003 Y117.167 E13.33859*109
+N433 G1 X90.720 Y116.864 E13.35584*107
+N434 G1 X90.450 Y116.541 E13.37334*109
+N435 G1 X90.192 Y116.198 E13.39120*110
+N436 G1 X89.943 Y115.835 E13.40950*109
+N437 G1 X89.700 Y115.452 E13.42834*105
+N438 G1 X89.461 Y115.051 E13.44776*106
+N439 G1 X89.223 Y114.631 E13.46782*99
+N440 G1 X88.983 Y114.194 E13.48856*109
+N441 G1 X88.739 Y113.739 E13.51001*103
+N442 G1 X88.490 Y113.268 E13.53218*109
+N443 G1 X88.233 Y112.780 E13.55510*104
+N444 G1 X87.967 Y112.277 E13.57877*105
+N445 G1 X87.690 Y111.759 E13.60320*104
+N446 G1 X87.401 Y111.227 E13.62839*108
+N447 G1 X87.100 Y110.681 E13.65432*96
+N448 G1 X86.786 Y110.121 E13.68098*98
+N449 G1 X86.459 Y109.550 E13.70836*109
+N450 G1 X86.119 Y108.967 E13.73641*96
+N451 G1 X85.767 Y108.373 E13.76512*98
+N452 G1 X85.404 Y107.769 E13.79443*109
+N453 G1 X85.031 Y107.155 E13.82429*111
+N454 G1 X84.650 Y106.533 E13.85464*99
+N455 G1 X84.262 Y105.902 E13.88542*98
+N456 G1 X83.869 Y105.265 E13.91655*96
+N457 G1 X83.475 Y104.621 E13.94796*110
+N458 G1 X83.081 Y103.971 E13.97955*97
+N459 G1 X82.690 Y103.317 E14.01124*107
+N460 G1 X82.306 Y102.658 E14.04293*110
+N461 G1 X81.932 Y101.996 E14.07455*96
+N462 G1 X81.570 Y101.332 E14.10599*106
+N463 G1 X81.225 Y100.667 E14.13716*110
+N464 G1 X80.900 Y100.000 E14.16800*110
+N465 G1 X80.598 Y99.333 E14.19843*88
+N466 G1 X80.323 Y98.668 E14.22839*82
+N467 G1 X80.078 Y98.004 E14.25782*90
+N468 G1 X79.866 Y97.342 E14.28671*90
+N469 G1 X79.690 Y96.683 E14.31505*93
+N470 G1 X79.554 Y96.029 E14.34284*83
+N471 G1 X79.460 Y95.379 E14.37014*89
+N472 G1 X79.410 Y94.735 E14.39699*93
+N473 G1 X79.408 Y94.098 E14.42350*89
+N474 G1 X79.454 Y93.467 E14.44978*82
+N475 G1 X79.550 Y92.845 E14.47597*85
+N476 G1 X79.698 Y92.231 E14.50222*87
+N477 G1 X79.899 Y91.627 E14.52869*94
+N478 G1 X80.152 Y91.033 E14.55554*94
+N479 G1 X80.459 Y90.450 E14.58294*87
+N480 G1 X80.819 Y89.879 E14.61102*80
+N481 G1 X81.231 Y89.319 E14.63990*92
+N482 G1 X81.695 Y88.773 E14.66969*95
+N483 G1 X82.208 Y88.241 E14.70045*89
+N484 G1 X82.770 Y87.723 E14.73224*92
+N485 G1 X83.379 Y87.220 E14.76507*84
+N486 G1 X84.031 Y86.732 E14.79893*87
+N487 G1 X84.725 Y86.261 E14.83379*93
+N488 G1 X85.456 Y85.806 E14.86961*90
+N489 G1 X86.223 Y85.369 E14.90631*83
+N490 G1 X87.021 Y84.949 E14.94379*94
+N491 G1 X87.846 Y84.548 E14.98196*84
+N492 G1 X88.696 Y84.165 E15.02069*83
+N493 G1 X89.565 Y83.802 E15.05986*92
+N494 G1 X90.450 Y83.459 E15.09933*84
+N495 G1 X91.347 Y83.136 E15.13897*93
+N496 G1 X92.251 Y82.833 E15.17861*91
+N497 G1 X93.158 Y82.551 E15.21812*89
+N498 G1 X94.065 Y82.291 E15.25735*91
+N499 G1 X94.967 Y82.052 E15.29616*80
+N500 G1 X95.861 Y81.835 E15.33440*87
+N501 G1 X96.743 Y81.640 E15.37194*94
+N502 G1 X97.609 Y81.467 E15.40866*80
+N503 G1 X98.456 Y81.317 E15.44443*89
+N504 G1 X99.281 Y81.190 E15.47916*80
+N505 G1 X100.082 Y81.086 E15.51275*110
+N506 G1 X100.857 Y81.005 E15.54512*101
+N507 G1 X101.602 Y80.947 E15.57621*101
+N508 G1 X102.317 Y80.912 E15.60597*98
+N509 G1 X103.000 Y80.900 E15.63437*108
+N510 G1 X103.650 Y80.912 E15.66141*101
+N511 G1 X104.267 Y80.947 E15.68709*103
+N512 G1 X104.850 Y81.005 E15.71145*98
+N513 G1 X105.399 Y81.086 E15.73453*103
+N514 G1 X105.915 Y81.190 E15.75642*108
+N515 G1 X106.398 Y81.317 E15.77720*107
+N516 G1 X106.850 Y81.467 E15.79700*107
+N517 G1 X107.272 Y81.640 E15.81596*108
+N518 G1 X107.666 Y81.835 E15.83422*98
+N519 G1 X108.033 Y82.052 E15.85194*110
+N520 G1 X108.375 Y82.291 E15.86931*108
+N521 G1 X108.696 Y82.551 E15.88649*96
+N522 G1 X108.997 Y82.833 E15.90363*96
+N523 G1 X109.280 Y83.136 E15.92088*100
+N524 G1 X109.550 Y83.459 E15.93838*103
+N525 G1 X109.808 Y83.802 E15.95623*102
+N526 G1 X110.057 Y84.165 E15.97454*96
+N527 G1 X110.300 Y84.548 E15.99337*103
+N528 G1 X110.539 Y84.949 E16.01280*102
+N529 G1 X110.777 Y85.369 E16.03286*98
+N530 G1 X111.017 Y85.806 E16.05360*103
+N531 G1 X111.261 Y86.261 E16.07505*106
+N532 G1 X111.510 Y86.732 E16.09722*98
+N533 G1 X111.767 Y87.220 E16.12014*110
+N534 G1 X112.033 Y87.723 E16.14381*99
+N535 G1 X112.310 Y88.241 E16.16824*104
+N536 G1 X112.599 Y88.773 E16.19343*109
+N537 G1 X112.900 Y89.319 E16.21936*106
+N538 G1 X113.214 Y89.879 E16.24602*106
+N539 G1 X113.541 Y90.450 E16.27339*109
+N540 G1 X113.881 Y91.033 E16.30145*109
+N541 G1 X114.233 Y91.627 E16.33016*111
+N542 G1 X114.596 Y92.231 E16.35947*111
+N543 G1 X114.969 Y92.845 E16.38933*101
+N544 G1 X115.350 Y93.467 E16.41968*110
+N545 G1 X115.738 Y94.098 E16.45046*103
+N546 G1 X116.131 Y94.735 E16.48159*106
+N547 G1 X116.525 Y95.379 E16.51300*97
+N548 G1 X116.919 Y96.029 E16.54459*102
+N549 G1 X117.310 Y96.683 E16.57627*107
+N550 G1 X117.694 Y97.342 E16.60797*109
+N551 G1 X118.068 Y98.004 E16.63958*102
+N552 G1 X118.430 Y98.668 E16.67102*99
+N553 G1 X118.775 Y99.333 E16.70220*111
+N554 G1 X119.100 Y100.000 E16.73304*91
+N555 G1 E15.73304 F2400.00000*47
+N556 G0 X85.000 Y84.000 F7800*70
+N557 G1 X115.000 Y84.000 E16.98044 F3000*15
+N558 G0 X115.000 Y84.550 F7800*112
+N559 G1 X85.000 Y84.550 E18.22784 F3000*61
+N560 G0 X85.000 Y85.100 F7800*67
+N561 G1 X115.000 Y85.100 E19.47524 F3000*4
+N562 G0 X115.000 Y85.650 F7800*123
+N563 G1 X85.000 Y85.650 E20.72264 F3000*51
+N564 G0 X85.000 Y86.200 F7800*71
+N565 G1 X115.000 Y86.200 E21.97004 F3000*1
+N566 G0 X115.000 Y86.750 F7800*125
+N567 G1 X85.000 Y86.750 E23.21744 F3000*55
+N568 G0 X85.000 Y87.300 F7800*75
+N569 G1 X115.000 Y87.300 E24.46484 F3000*8
+N570 G0 X115.000 Y87.850 F7800*116
+N571 G1 X85.000 Y87.850 E25.71224 F3000*62
+N572 G0 X85.000 Y88.400 F7800*72
+N573 G1 X115.000 Y88.400 E26.95964 F3000*4
+N574 G0 X115.000 Y88.950 F7800*126
+N575 G1 X85.000 Y88.950 E28.20704 F3000*58
+N576 G0 X85.000 Y89.500 F7800*76
+N577 G1 X115.000 Y89.500 E29.45444 F3000*13
+N578 G0 X115.000 Y90.050 F7800*114
+N579 G1 X85.000 Y90.050 E30.70184 F3000*52
+N580 G0 X85.000 Y90.600 F7800*78
+N581 G1 X115.000 Y90.600 E31.94924 F3000*1
+N582 G0 X115.000 Y91.150 F7800*119
+N583 G1 X85.000 Y91.150 E33.19664 F3000*52
+N584 G0 X85.000 Y91.700 F7800*74
+N585 G1 X115.000 Y91.700 E34.44404 F3000*2
+N586 G0 X115.000 Y92.250 F7800*115
+N587 G1 X85.000 Y92.250 E35.69144 F3000*52
+N588 G0 X85.000 Y92.800 F7800*74
+N589 G1 X115.000 Y92.800 E36.93884 F3000*14
+N590 G0 X115.000 Y93.350 F7800*116
+N591 G1 X85.000 Y93.350 E38.18624 F3000*57
+N592 G0 X85.000 Y93.900 F7800*65
+N593 G1 X115.000 Y93.900 E39.43364 F3000*2
+N594 G0 X115.000 Y94.450 F7800*112
+N595 G1 X85.000 Y94.450 E40.68104 F3000*48
+N596 G0 X85.000 Y95.000 F7800*74
+N597 G1 X115.000 Y95.000 E41.92844 F3000*3
+N598 G0 X115.000 Y95.550 F7800*124
+N599 G1 X85.000 Y95.550 E43.17584 F3000*59
+N600 G0 X85.000 Y96.100 F7800*68
+N601 G1 X115.000 Y96.100 E44.42324 F3000*8
+N602 G0 X115.000 Y96.650 F7800*124
+N603 G1 X85.000 Y96.650 E45.67064 F3000*49
+N604 G0 X85.000 Y97.200 F7800*66
+N605 G1 X115.000 Y97.200 E46.91804 F3000*11
+N606 G0 X115.000 Y97.750 F7800*120
+N607 G1 X85.000 Y97.750 E48.16544 F3000*57
+N608 G0 X85.000 Y98.300 F7800*64
+N609 G1 X115.000 Y98.300 E49.41284 F3000*9
+N610 G0 X115.000 Y98.850 F7800*127
+N611 G1 X85.000 Y98.850 E50.66024 F3000*51
+N612 G0 X85.000 Y99.400 F7800*77
+N613 G1 X115.000 Y99.400 E51.90764 F3000*10
+N614 G0 X115.000 Y99.950 F7800*123
+N615 G1 X85.000 Y99.950 E53.15504 F3000*55
+N616 G0 X85.000 Y100.500 F7800*121
+N617 G1 X115.000 Y100.500 E54.40244 F3000*49
+N618 G0 X115.000 Y101.050 F7800*78
+N619 G1 X85.000 Y101.050 E55.64984 F3000*6
+N620 G0 X85.000 Y101.600 F7800*126
+N621 G1 X115.000 Y101.600 E56.89724 F3000*50
+N622 G0 X115.000 Y102.150 F7800*69
+N623 G1 X85.000 Y102.150 E58.14464 F3000*4
+N624 G0 X85.000 Y102.700 F7800*120
+N625 G1 X115.000 Y102.700 E59.39204 F3000*55
+N626 G0 X115.000 Y103.250 F7800*67
+N627 G1 X85.000 Y103.250 E60.63944 F3000*6
+N628 G0 X85.000 Y103.800 F7800*122
+N629 G1 X115.000 Y103.800 E61.88684 F3000*56
+N630 G0 X115.000 Y104.350 F7800*66
+N631 G1 X85.000 Y104.350 E63.13424 F3000*8
+N632 G0 X85.000 Y104.900 F7800*119
+N633 G1 X115.000 Y104.900 E64.38164 F3000*50
+N634 G0 X115.000 Y105.450 F7800*64
+N635 G1 X85.000 Y105.450 E65.62904 F3000*5
+N636 G0 X85.000 Y106.000 F7800*120
+N637 G1 X115.000 Y106.000 E66.87644 F3000*62
+N638 G0 X115.000 Y106.550 F7800*78
+N639 G1 X85.000 Y106.550 E68.12384 F3000*3
+N640 G0 X85.000 Y107.100 F7800*121
+N641 G1 X115.000 Y107.100 E69.37124 F3000*58
+N642 G0 X115.000 Y107.650 F7800*65
+N643 G1 X85.000 Y107.650 E70.61864 F3000*4
+N644 G0 X85.000 Y108.200 F7800*113
+N645 G1 X115.000 Y108.200 E71.86604 F3000*52
+N646 G0 X115.000 Y108.750 F7800*75
+N647 G1 X85.000 Y108.750 E73.11344 F3000*3
+N648 G0 X85.000 Y109.300 F7800*125
+N649 G1 X115.000 Y109.300 E74.36084 F3000*56
+N650 G0 X115.000 Y109.850 F7800*66
+N651 G1 X85.000 Y109.850 E75.60824 F3000*7
+N652 G0 X85.000 Y110.400 F7800*121
+N653 G1 X115.000 Y110.400 E76.85564 F3000*61
+N654 G0 X115.000 Y110.950 F7800*79
+N655 G1 X85.000 Y110.950 E78.10304 F3000*9
+N656 G0 X85.000 Y111.500 F7800*125
+N657 G1 X115.000 Y111.500 E79.35044 F3000*58
+N658 G0 X115.000 Y112.050 F7800*72
+N659 G1 X85.000 Y112.050 E80.59784 F3000*8
+N660 G0 X85.000 Y112.600 F7800*120
+N661 G1 X115.000 Y112.600 E81.84524 F3000*49
+N662 G0 X115.000 Y113.150 F7800*65
+N663 G1 X85.000 Y113.150 E83.09264 F3000*12
+N664 G0 X85.000 Y113.700 F7800*124
+N665 G1 X115.000 Y113.700 E84.34004 F3000*60
+N666 G0 X115.000 Y114.250 F7800*65
+N667 G1 X85.000 Y114.250 E85.58744 F3000*9
+N668 G0 X85.000 Y114.800 F7800*120
+N669 G1 X115.000 Y114.800 E86.83484 F3000*58
+N670 G0 X115.000 Y115.350 F7800*70
+N671 G1 X85.000 Y115.350 E88.08224 F3000*5
+N672 G0 X85.000 Y115.900 F7800*115
+N673 G1 X115.000 Y115.900 E89.32964 F3000*55
+N674 G0 X115.000 Y116.450 F7800*70
+N675 G1 X85.000 Y116.450 E90.57704 F3000*1
+N676 M106 S255*98
+;LAYER:1
+N677 G1 Z0.500 F7800.000*8
+N678 G1 E91.57704 F2400.00000*45
+N679 G1 X120.000 Y100.000 F7800.000*84
+N680 G1 X120.301 Y100.698 E91.60865 F1800.000*47
+N681 G1 X120.575 Y101.395 E91.63979*92
+N682 G1 X120.817 Y102.091 E91.67042*87
+N683 G1 X121.026 Y102.783 E91.70050*92
+N684 G1 X121.196 Y103.473 E91.73003*89
+N685 G1 X121.326 Y104.158 E91.75904*82
+N686 G1 X121.413 Y104.838 E91.78755*88
+N687 G1 X121.455 Y105.513 E91.81564*88
+N688 G1 X121.448 Y106.180 E91.84340*83
+N689 G1 X121.392 Y106.840 E91.87094*94
+N690 G1 X121.284 Y107.492 E91.89841*92
+N691 G1 X121.124 Y108.135 E91.92595*93
+N692 G1 X120.910 Y108.767 E91.95372*89
+N693 G1 X120.643 Y109.389 E91.98187*81
+N694 G1 X120.321 Y110.000 E92.01058*93
+N695 G1 X119.945 Y110.598 E92.03996*83
+N696 G1 X119.515 Y111.184 E92.07015*87
+N697 G1 X119.034 Y111.756 E92.10124*92
+N698 G1 X118.501 Y112.313 E92.13330*83
+N699 G1 X117.919 Y112.856 E92.16638*90
+N700 G1 X117.290 Y113.383 E92.20050*94
+N701 G1 X116.616 Y113.893 E92.23564*95
+N702 G1 X115.901 Y114.387 E92.27179*83
+N703 G1 X115.146 Y114.863 E92.30889*88
+N704 G1 X114.356 Y115.321 E92.34687*85
+N705 G1 X113.533 Y115.760 E92.38564*85
+N706 G1 X112.683 Y116.180 E92.42508*83
+N707 G1 X111.808 Y116.581 E92.46510*84
+N708 G1 X110.912 Y116.961 E92.50556*87
+N709 G1 X110.000 Y117.321 E92.54632*86
+N710 G1 X109.076 Y117.659 E92.58724*87
+N711 G1 X108.144 Y117.976 E92.62818*92
+N712 G1 X107.208 Y118.271 E92.66899*85
+N713 G1 X106.272 Y118.544 E92.70951*91
+N714 G1 X105.340 Y118.794 E92.74962*84
+N715 G1 X104.417 Y119.021 E92.78916*86
+N716 G1 X103.505 Y119.225 E92.82800*85
+N717 G1 X102.609 Y119.406 E92.86602*85
+N718 G1 X101.731 Y119.563 E92.90310*80
+N719 G1 X100.875 Y119.696 E92.93914*91
+N720 G1 X100.043 Y119.805 E92.97403*87
+N721 G1 X99.237 Y119.890 E93.00771*99
+N722 G1 X98.461 Y119.951 E93.04010*108
+N723 G1 X97.714 Y119.988 E93.07117*98
+N724 G1 X97.000 Y120.000 E93.10088*101
+N725 G1 X96.318 Y119.988 E93.12922*103
+N726 G1 X95.670 Y119.951 E93.15621*99
+N727 G1 X95.056 Y119.890 E93.18187*106
+N728 G1 X94.476 Y119.805 E93.20626*105
+N729 G1 X93.929 Y119.696 E93.22945*100
+N730 G1 X93.415 Y119.563 E93.25154*104
+N731 G1 X92.932 Y119.406 E93.27264*96
+N732 G1 X92.480 Y119.225 E93.29289*109
+N733 G1 X92.056 Y119.021 E93.31244*109
+N734 G1 X91.660 Y118.794 E93.33145*98
+N735 G1 X91.288 Y118.544 E93.35009*97
+N736 G1 X90.938 Y118.271 E93.36852*103
+N737 G1 X90.609 Y117.976 E93.38691*103
+N738 G1 X90.297 Y117.659 E93.40540*105
+N739 G1 X90.000 Y117.321 E93.42412*106
+N740 G1 X89.715 Y116.961 E93.44319*106
+N741 G1 X89.440 Y116.581 E93.46271*103
+N742 G1 X89.171 Y116.180 E93.48276*111
+N743 G1 X88.907 Y115.760 E93.50339*110
+N744 G1 X88.644 Y115.321 E93.52468*97
+N745 G1 X88.381 Y114.863 E93.54665*105
+N746 G1 X88.114 Y114.387 E93.56934*108
+N747 G1 X87.843 Y113.893 E93.59276*98
+N748 G1 X87.564 Y113.383 E93.61694*108
+N749 G1 X87.277 Y112.856 E93.64189*100
+N750 G1 X86.980 Y112.313 E93.66760*103
+N751 G1 X86.673 Y111.756 E93.69408*97
+N752 G1 X86.354 Y111.184 E93.72131*110
+N753 G1 X86.023 Y110.598 E93.74928*98
+N754 G1 X85.679 Y110.000 E93.77796*99
+N755 G1 X85.325 Y109.389 E93.80732*98
+N756 G1 X84.959 Y108.767 E93.83733*102
+N757 G1 X84.582 Y108.135 E93.86794*100
+N758 G1 X84.197 Y107.492 E93.89909*105
+N759 G1 X83.804 Y106.840 E93.93073*97
+N760 G1 X83.406 Y106.180 E93.96279*109
+N761 G1 X83.004 Y105.513 E93.99518*104
+N762 G1 X82.601 Y104.838 E94.02784*110
+N763 G1 X82.200 Y104.158 E94.06067*107
+N764 G1 X81.804 Y103.473 E94.09359*107
+N765 G1 X81.415 Y102.783 E94.12651*108
+N766 G1 X81.037 Y102.091 E94.15934*100
+N767 G1 X80.672 Y101.395 E94.19198*101
+N768 G1 X80.326 Y100.698 E94.22435*109
+N769 G1 X80.000 Y100.000 E94.25638*100
+N770 G1 X79.699 Y99.302 E94.28799*91
+N771 G1 X79.425 Y98.605 E94.31913*88
+N772 G1 X79.183 Y97.909 E94.34975*91
+N773 G1 X78.974 Y97.217 E94.37984*82
+N774 G1 X78.804 Y96.527 E94.40937*94
+N775 G1 X78.674 Y95.842 E94.43837*89
+N776 G1 X78.587 Y95.162 E94.46689*80
+N777 G1 X78.545 Y94.487 E94.49498*93
+N778 G1 X78.552 Y93.820 E94.52274*92
+N779 G1 X78.608 Y93.160 E94.55028*80
+N780 G1 X78.716 Y92.508 E94.57775*94
+N781 G1 X78.876 Y91.865 E94.60528*93
+N782 G1 X79.090 Y91.233 E94.63305*92
+N783 G1 X79.357 Y90.611 E94.66121*81
+N784 G1 X79.679 Y90.000 E94.68991*84
+N785 G1 X80.055 Y89.402 E94.71930*86
+N786 G1 X80.485 Y88.816 E94.74948*94
+N787 G1 X80.966 Y88.244 E94.78057*89
+N788 G1 X81.499 Y87.687 E94.81263*93
+N789 G1 X82.081 Y87.144 E94.84571*91
+N790 G1 X82.710 Y86.617 E94.87983*94
+N791 G1 X83.384 Y86.107 E94.91498*81
+N792 G1 X84.099 Y85.613 E94.95113*89
+N793 G1 X84.854 Y85.137 E94.98823*87
+N794 G1 X85.644 Y84.679 E95.02621*92
+N795 G1 X86.467 Y84.240 E95.06497*88
+N796 G1 X87.317 Y83.820 E95.10442*94
+N797 G1 X88.192 Y83.419 E95.14444*91
+N798 G1 X89.088 Y83.039 E95.18489*84
+N799 G1 X90.000 Y82.679 E95.22565*84
+N800 G1 X90.924 Y82.341 E95.26658*83
+N801 G1 X91.856 Y82.024 E95.30751*88
+N802 G1 X92.792 Y81.729 E95.34832*88
+N803 G1 X93.728 Y81.456 E95.38885*82
+N804 G1 X94.660 Y81.206 E95.42895*80
+N805 G1 X95.583 Y80.979 E95.46850*81
+N806 G1 X96.495 Y80.775 E95.50734*95
+N807 G1 X97.391 Y80.594 E95.54536*85
+N808 G1 X98.269 Y80.437 E95.58244*85
+N809 G1 X99.125 Y80.304 E95.61847*90
+N810 G1 X99.957 Y80.195 E95.65337*93
+N811 G1 X100.763 Y80.110 E95.68704*96
+N812 G1 X101.539 Y80.049 E95.71944*96
+N813 G1 X102.286 Y80.012 E95.75050*103
+N814 G1 X103.000 Y80.000 E95.78021*101
+N815 G1 X103.682 Y80.012 E95.80856*100
+N816 G1 X104.330 Y80.049 E95.83554*110
+N817 G1 X104.944 Y80.110 E95.86121*104
+N818 G1 X105.524 Y80.195 E95.88560*110
+N819 G1 X106.071 Y80.304 E95.90879*111
+N820 G1 X106.585 Y80.437 E95.93087*102
+N821 G1 X107.068 Y80.594 E95.95198*97
+N822 G1 X107.520 Y80.775 E95.97223*103
+N823 G1 X107.944 Y80.979 E95.99178*105
+N824 G1 X108.340 Y81.206 E96.01079*111
+N825 G1 X108.712 Y81.456 E96.02943*109
+N826 G1 X109.062 Y81.729 E96.04786*101
+N827 G1 X109.391 Y82.024 E96.06624*105
+N828 G1 X109.703 Y82.341 E96.08473*103
+N829 G1 X110.000 Y82.679 E96.10345*111
+N830 G1 X110.285 Y83.039 E96.12253*111
+N831 G1 X110.560 Y83.419 E96.14204*96
+N832 G1 X110.829 Y83.820 E96.16209*106
+N833 G1 X111.093 Y84.240 E96.18273*107
+N834 G1 X111.356 Y84.679 E96.20401*96
+N835 G1 X111.619 Y85.137 E96.22599*97
+N836 G1 X111.886 Y85.613 E96.24867*97
+N837 G1 X112.157 Y86.107 E96.27210*110
+N838 G1 X112.436 Y86.617 E96.29628*100
+N839 G1 X112.723 Y87.144 E96.32123*100
+N840 G1 X113.020 Y87.687 E96.34694*106
+N841 G1 X113.327 Y88.244 E96.37341*101
+N842 G1 X113.646 Y88.816 E96.40064*109
+N843 G1 X113.977 Y89.402 E96.42861*102
+N844 G1 X114.321 Y90.000 E96.45729*101
+N845 G1 X114.675 Y90.611 E96.48666*97
+N846 G1 X115.041 Y91.233 E96.51667*110
+N847 G1 X115.418 Y91.865 E96.54727*110
+N848 G1 X115.803 Y92.508 E96.57843*108
+N849 G1 X116.196 Y93.160 E96.61007*109
+N850 G1 X116.594 Y93.820 E96.64212*109
+N851 G1 X116.996 Y94.487 E96.67452*101
+N852 G1 X117.399 Y95.162 E96.70718*102
+N853 G1 X117.800 Y95.842 E96.74001*108
+N854 G1 X118.196 Y96.527 E96.77293*101
+N855 G1 X118.585 Y97.217 E96.80585*111
+N856 G1 X118.963 Y97.909 E96.83867*110
+N857 G1 X119.328 Y98.605 E96.87131*105
+N858 G1 X119.674 Y99.302 E96.90369*96
+N859 G1 X120.000 Y100.000 E96.93571*82
+N860 G1 E95.93571 F2400.00000*38
+N861 G1 E96.93571 F2400.00000*36
+N862 G1 X119.550 Y100.000 F7800.000*90
+N863 G1 X119.852 Y100.682 E96.96673 F1800.000*39
+N864 G1 X120.126 Y101.364 E96.99728*93
+N865 G1 X120.370 Y102.044 E97.02731*84
+N866 G1 X120.580 Y102.721 E97.05679*80
+N867 G1 X120.753 Y103.395 E97.08573*83
+N868 G1 X120.886 Y104.065 E97.11412*94
+N869 G1 X120.977 Y104.730 E97.14202*85
+N870 G1 X121.022 Y105.389 E97.16950*92
+N871 G1 X121.020 Y106.041 E97.19663*91
+N872 G1 X120.969 Y106.686 E97.22354*89
+N873 G1 X120.867 Y107.324 E97.25037*90
+N874 G1 X120.713 Y107.952 E97.27726*95
+N875 G1 X120.506 Y108.570 E97.30438*81
+N876 G1 X120.245 Y109.178 E97.33189*83
+N877 G1 X119.931 Y109.775 E97.35994*89
+N878 G1 X119.563 Y110.360 E97.38867*85
+N879 G1 X119.142 Y110.932 E97.41820*83
+N880 G1 X118.669 Y111.491 E97.44864*90
+N881 G1 X118.146 Y112.036 E97.48006*91
+N882 G1 X117.574 Y112.566 E97.51249*83
+N883 G1 X116.956 Y113.082 E97.54596*81
+N884 G1 X116.293 Y113.581 E97.58047*87
+N885 G1 X115.588 Y114.063 E97.61597*84
+N886 G1 X114.845 Y114.528 E97.65243*90
+N887 G1 X114.066 Y114.976 E97.68977*84
+N888 G1 X113.256 Y115.406 E97.72789*82
+N889 G1 X112.418 Y115.816 E97.76670*80
+N890 G1 X111.556 Y116.208 E97.80607*95
+N891 G1 X110.674 Y116.579 E97.84589*92
+N892 G1 X109.775 Y116.931 E97.88600*89
+N893 G1 X108.865 Y117.262 E97.92628*90
+N894 G1 X107.946 Y117.571 E97.96657*91
+N895 G1 X107.025 Y117.860 E98.00673*93
+N896 G1 X106.103 Y118.126 E98.04661*89
+N897 G1 X105.186 Y118.371 E98.08607*90
+N898 G1 X104.278 Y118.593 E98.12496*93
+N899 G1 X103.381 Y118.793 E98.16315*86
+N900 G1 X102.500 Y118.969 E98.20052*87
+N901 G1 X101.638 Y119.123 E98.23695*84
+N902 G1 X100.797 Y119.253 E98.27233*90
+N903 G1 X99.980 Y119.360 E98.30657*99
+N904 G1 X99.190 Y119.443 E98.33959*105
+N905 G1 X98.429 Y119.502 E98.37133*106
+N906 G1 X97.699 Y119.538 E98.40175*100
+N907 G1 X97.000 Y119.550 E98.43080*101
+N908 G1 X96.334 Y119.538 E98.45849*106
+N909 G1 X95.702 Y119.502 E98.48483*103
+N910 G1 X95.103 Y119.443 E98.50984*111
+N911 G1 X94.539 Y119.360 E98.53357*99
+N912 G1 X94.007 Y119.253 E98.55611*104
+N913 G1 X93.508 Y119.123 E98.57755*99
+N914 G1 X93.041 Y118.969 E98.59800*106
+N915 G1 X92.604 Y118.793 E98.61760*100
+N916 G1 X92.195 Y118.593 E98.63650*106
+N917 G1 X91.814 Y118.371 E98.65487*108
+N918 G1 X91.456 Y118.126 E98.67288*98
+N919 G1 X91.121 Y117.860 E98.69068*96
+N920 G1 X90.806 Y117.571 E98.70844*100
+N921 G1 X90.508 Y117.262 E98.72631*109
+N922 G1 X90.225 Y116.931 E98.74442*106
+N923 G1 X89.954 Y116.579 E98.76288*108
+N924 G1 X89.692 Y116.208 E98.78179*108
+N925 G1 X89.436 Y115.816 E98.80123*111
+N926 G1 X89.184 Y115.406 E98.82126*106
+N927 G1 X88.934 Y114.976 E98.84193*106
+N928 G1 X88.682 Y114.528 E98.86329*97
+N929 G1 X88.427 Y114.063 E98.88535*98
+N930 G1 X88.166 Y113.581 E98.90815*98
+N931 G1 X87.899 Y113.082 E98.93170*106
+N932 G1 X87.622 Y112.566 E98.95601*110
+N933 G1 X87.335 Y112.036 E98.98108*111
+N934 G1 X87.037 Y111.491 E99.00691*100
+N935 G1 X86.727 Y110.932 E99.03349*100
+N936 G1 X86.404 Y110.360 E99.06081*106
+N937 G1 X86.069 Y109.775 E99.08883*104
+N938 G1 X85.722 Y109.178 E99.11754*106
+N939 G1 X85.363 Y108.570 E99.14690*107
+N940 G1 X84.993 Y107.952 E99.17686*102
+N941 G1 X84.614 Y107.324 E99.20737*99
+N942 G1 X84.227 Y106.686 E99.23836*101
+N943 G1 X83.834 Y106.041 E99.26978*104
+N944 G1 X83.437 Y105.389 E99.30155*100
+N945 G1 X83.038 Y104.730 E99.33358*101
+N946 G1 X82.641 Y104.065 E99.36579*104
+N947 G1 X82.247 Y103.395 E99.39809*101
+N948 G1 X81.860 Y102.721 E99.43040*100
+N949 G1 X81.484 Y102.044 E99.46261*99
+N950 G1 X81.121 Y101.364 E99.49465*110
+N951 G1 X80.775 Y100.682 E99.52643*105
+N952 G1 X80.450 Y100.000 E99.55786*109
+N953 G1 X80.148 Y99.318 E99.58888*87
+N954 G1 X79.874 Y98.636 E99.61943*84
+N955 G1 X79.630 Y97.956 E99.64945*94
+N956 G1 X79.420 Y97.279 E99.67894*86
+N957 G1 X79.247 Y96.605 E99.70787*85
+N958 G1 X79.114 Y95.935 E99.73627*88
+N959 G1 X79.023 Y95.270 E99.76417*82
+N960 G1 X78.978 Y94.611 E99.79164*82
+N961 G1 X78.980 Y93.959 E99.81878*83
+N962 G1 X79.031 Y93.314 E99.84569*89
+N963 G1 X79.133 Y92.676 E99.87252*87
+N964 G1 X79.287 Y92.048 E99.89941*80
+N965 G1 X79.494 Y91.430 E99.92653*91
+N966 G1 X79.755 Y90.822 E99.95403*88
+N967 G1 X80.069 Y90.225 E99.98208*90
+N968 G1 X80.437 Y89.640 E100.01082*100
+N969 G1 X80.858 Y89.068 E100.04035*101
+N970 G1 X81.331 Y88.509 E100.07079*96
+N971 G1 X81.854 Y87.964 E100.10220*105
+N972 G1 X82.426 Y87.434 E100.13464*109
+N973 G1 X83.044 Y86.918 E100.16811*100
+N974 G1 X83.707 Y86.419 E100.20261*103
+N975 G1 X84.412 Y85.937 E100.23812*105
+N976 G1 X85.155 Y85.472 E100.27458*103
+N977 G1 X85.934 Y85.024 E100.31191*105
+N978 G1 X86.744 Y84.594 E100.35004*106
+N979 G1 X87.582 Y84.184 E100.38885*107
+N980 G1 X88.444 Y83.792 E100.42822*111
+N981 G1 X89.326 Y83.421 E100.46803*96
+N982 G1 X90.225 Y83.069 E100.50815*97
+N983 G1 X91.135 Y82.738 E100.54843*102
+N984 G1 X92.054 Y82.429 E100.58872*105
+N985 G1 X92.975 Y82.140 E100.62888*100
+N986 G1 X93.897 Y81.874 E100.66876*99
+N987 G1 X94.814 Y81.629 E100.70821*109
+N988 G1 X95.722 Y81.407 E100.74711*111
+N989 G1 X96.619 Y81.207 E100.78530*111
+N990 G1 X97.500 Y81.031 E100.82267*106
+N991 G1 X98.362 Y80.877 E100.85909*105
+N992 G1 X99.203 Y80.747 E100.89447*106
+N993 G1 X100.020 Y80.640 E100.92871*92
+N994 G1 X100.810 Y80.557 E100.96174*93
+N995 G1 X101.571 Y80.498 E100.99348*87
+N996 G1 X102.301 Y80.462 E101.02389*93
+N997 G1 X103.000 Y80.450 E101.05295*85
+N998 G1 X103.666 Y80.462 E101.08064*92
+N999 G1 X104.298 Y80.498 E101.10697*89
+N1000 G1 X104.897 Y80.557 E101.13198*109
+N1001 G1 X105.461 Y80.640 E101.15572*107
+N1002 G1 X105.993 Y80.747 E101.17826*96
+N1003 G1 X106.492 Y80.877 E101.19969*102
+N1004 G1 X106.959 Y81.031 E101.22015*106
+N1005 G1 X107.396 Y81.207 E101.23975*106
+N1006 G1 X107.805 Y81.407 E101.25865*104
+N1007 G1 X108.186 Y81.629 E101.27702*102
+N1008 G1 X108.544 Y81.874 E101.29502*105
+N1009 G1 X108.879 Y82.140 E101.31283*97
+N1010 G1 X109.194 Y82.429 E101.33059*111
+N1011 G1 X109.492 Y82.738 E101.34846*111
+N1012 G1 X109.775 Y83.069 E101.36657*104
+N1013 G1 X110.046 Y83.421 E101.38503*98
+N1014 G1 X110.308 Y83.792 E101.40394*96
+N1015 G1 X110.564 Y84.184 E101.42338*111
+N1016 G1 X110.816 Y84.594 E101.44341*105
+N1017 G1 X111.066 Y85.024 E101.46408*97
+N1018 G1 X111.318 Y85.472 E101.48543*99
+N1019 G1 X111.573 Y85.937 E101.50750*108
+N1020 G1 X111.834 Y86.419 E101.53030*104
+N1021 G1 X112.101 Y86.918 E101.55385*98
+N1022 G1 X112.378 Y87.434 E101.57816*108
+N1023 G1 X112.665 Y87.964 E101.60323*101
+N1024 G1 X112.963 Y88.509 E101.62906*108
+N1025 G1 X113.273 Y89.068 E101.65564*106
+N1026 G1 X113.596 Y89.640 E101.68295*109
+N1027 G1 X113.931 Y90.225 E101.71098*101
+N1028 G1 X114.278 Y90.822 E101.73969*99
+N1029 G1 X114.637 Y91.430 E101.76905*108
+N1030 G1 X115.007 Y92.048 E101.79901*99
+N1031 G1 X115.386 Y92.676 E101.82952*97
+N1032 G1 X115.773 Y93.314 E101.86051*98
+N1033 G1 X116.166 Y93.959 E101.89193*97
+N1034 G1 X116.563 Y94.611 E101.92369*110
+N1035 G1 X116.962 Y95.270 E101.95572*107
+N1036 G1 X117.359 Y95.935 E101.98793*97
+N1037 G1 X117.753 Y96.605 E102.02024*106
+N1038 G1 X118.140 Y97.279 E102.05254*98
+N1039 G1 X118.516 Y97.956 E102.08476*105
+N1040 G1 X118.879 Y98.636 E102.11680*102
+N1041 G1 X119.225 Y99.318 E102.14858*99
+N1042 G1 X119.550 Y100.000 E102.18001*86
+N1043 G1 E101.18001 F2400.00000*35
+N1044 G1 E102.18001 F2400.00000*39
+N1045 G1 X119.100 Y100.000 F7800.000*103
+N1046 G1 X119.402 Y100.667 E102.21044 F1800.000*41
+N1047 G1 X119.677 Y101.332 E102.24039*82
+N1048 G1 X119.922 Y101.996 E102.26983*92
+N1049 G1 X120.134 Y102.658 E102.29872*86
+N1050 G1 X120.310 Y103.317 E102.32705*80
+N1051 G1 X120.446 Y103.971 E102.35485*83
+N1052 G1 X120.540 Y104.621 E102.38214*89
+N1053 G1 X120.590 Y105.265 E102.40899*80
+N1054 G1 X120.592 Y105.902 E102.43550*84
+N1055 G1 X120.546 Y106.533 E102.46178*90
+N1056 G1 X120.450 Y107.155 E102.48797*83
+N1057 G1 X120.302 Y107.769 E102.51422*94
+N1058 G1 X120.101 Y108.373 E102.54069*94
+N1059 G1 X119.848 Y108.967 E102.56755*84
+N1060 G1 X119.541 Y109.550 E102.59494*82
+N1061 G1 X119.181 Y110.121 E102.62302*81
+N1062 G1 X118.769 Y110.681 E102.65190*80
+N1063 G1 X118.305 Y111.227 E102.68169*93
+N1064 G1 X117.792 Y111.759 E102.71246*85
+N1065 G1 X117.230 Y112.277 E102.74424*84
+N1066 G1 X116.621 Y112.780 E102.77707*94
+N1067 G1 X115.969 Y113.268 E102.81093*94
+N1068 G1 X115.275 Y113.739 E102.84580*84
+N1069 G1 X114.544 Y114.194 E102.88161*80
+N1070 G1 X113.777 Y114.631 E102.91831*81
+N1071 G1 X112.979 Y115.051 E102.95579*85
+N1072 G1 X112.154 Y115.452 E102.99396*93
+N1073 G1 X111.304 Y115.835 E103.03269*86
+N1074 G1 X110.435 Y116.198 E103.07186*94
+N1075 G1 X109.550 Y116.541 E103.11134*91
+N1076 G1 X108.653 Y116.864 E103.15097*95
+N1077 G1 X107.749 Y117.167 E103.19062*86
+N1078 G1 X106.842 Y117.449 E103.23013*90
+N1079 G1 X105.935 Y117.709 E103.26936*85
+N1080 G1 X105.033 Y117.948 E103.30816*83
+N1081 G1 X104.139 Y118.165 E103.34641*88
+N1082 G1 X103.257 Y118.360 E103.38395*80
+N1083 G1 X102.391 Y118.533 E103.42066*89
+N1084 G1 X101.544 Y118.683 E103.45644*90
+N1085 G1 X100.719 Y118.810 E103.49117*89
+N1086 G1 X99.918 Y118.914 E103.52475*106
+N1087 G1 X99.143 Y118.995 E103.55712*97
+N1088 G1 X98.398 Y119.053 E103.58821*107
+N1089 G1 X97.683 Y119.088 E103.61797*100
+N1090 G1 X97.000 Y119.100 E103.64638*97
+N1091 G1 X96.350 Y119.088 E103.67341*110
+N1092 G1 X95.733 Y119.053 E103.69910*105
+N1093 G1 X95.150 Y118.995 E103.72345*105
+N1094 G1 X94.601 Y118.914 E103.74654*102
+N1095 G1 X94.085 Y118.810 E103.76842*99
+N1096 G1 X93.602 Y118.683 E103.78921*96
+N1097 G1 X93.150 Y118.533 E103.80901*108
+N1098 G1 X92.728 Y118.360 E103.82796*105
+N1099 G1 X92.334 Y118.165 E103.84622*110
+N1100 G1 X91.967 Y117.948 E103.86395*99
+N1101 G1 X91.625 Y117.709 E103.88132*97
+N1102 G1 X91.304 Y117.449 E103.89849*103
+N1103 G1 X91.003 Y117.167 E103.91563*103
+N1104 G1 X90.720 Y116.864 E103.93288*108
+N1105 G1 X90.450 Y116.541 E103.95038*108
+N1106 G1 X90.192 Y116.198 E103.96824*98
+N1107 G1 X89.943 Y115.835 E103.98654*101
+N1108 G1 X89.700 Y115.452 E104.00538*97
+N1109 G1 X89.461 Y115.051 E104.02480*99
+N1110 G1 X89.223 Y114.631 E104.04486*106
+N1111 G1 X88.983 Y114.194 E104.06561*105
+N1112 G1 X88.739 Y113.739 E104.08705*109
+N1113 G1 X88.490 Y113.268 E104.10923*110
+N1114 G1 X88.233 Y112.780 E104.13215*105
+N1115 G1 X87.967 Y112.277 E104.15582*111
+N1116 G1 X87.690 Y111.759 E104.18025*100
+N1117 G1 X87.401 Y111.227 E104.20543*109
+N1118 G1 X87.100 Y110.681 E104.23136*106
+N1119 G1 X86.786 Y110.121 E104.25802*103
+N1120 G1 X86.459 Y109.550 E104.28540*96
+N1121 G1 X86.119 Y108.967 E104.31346*97
+N1122 G1 X85.767 Y108.373 E104.34216*96
+N1123 G1 X85.404 Y107.769 E104.37147*99
+N1124 G1 X85.031 Y107.155 E104.40133*108
+N1125 G1 X84.650 Y106.533 E104.43169*100
+N1126 G1 X84.262 Y105.902 E104.46247*101
+N1127 G1 X83.869 Y105.265 E104.49360*99
+N1128 G1 X83.475 Y104.621 E104.52500*98
+N1129 G1 X83.081 Y103.971 E104.55659*105
+N1130 G1 X82.690 Y103.317 E104.58828*105
+N1131 G1 X82.306 Y102.658 E104.61997*98
+N1132 G1 X81.932 Y101.996 E104.65159*111
+N1133 G1 X81.570 Y101.332 E104.68303*96
+N1134 G1 X81.225 Y100.667 E104.71421*107
+N1135 G1 X80.900 Y100.000 E104.74505*98
+N1136 G1 X80.598 Y99.333 E104.77547*91
+N1137 G1 X80.323 Y98.668 E104.80543*90
+N1138 G1 X80.078 Y98.004 E104.83487*94
+N1139 G1 X79.866 Y97.342 E104.86376*92
+N1140 G1 X79.690 Y96.683 E104.89209*90
+N1141 G1 X79.554 Y96.029 E104.91989*92
+N1142 G1 X79.460 Y95.379 E104.94718*95
+N1143 G1 X79.410 Y94.735 E104.97403*94
+N1144 G1 X79.408 Y94.098 E105.00054*89
+N1145 G1 X79.454 Y93.467 E105.02682*93
+N1146 G1 X79.550 Y92.845 E105.05301*95
+N1147 G1 X79.698 Y92.231 E105.07926*93
+N1148 G1 X79.899 Y91.627 E105.10573*87
+N1149 G1 X80.152 Y91.033 E105.13258*80
+N1150 G1 X80.459 Y90.450 E105.15998*87
+N1151 G1 X80.819 Y89.879 E105.18806*90
+N1152 G1 X81.231 Y89.319 E105.21694*90
+N1153 G1 X81.695 Y88.773 E105.24673*84
+N1154 G1 X82.208 Y88.241 E105.27749*95
+N1155 G1 X82.770 Y87.723 E105.30928*85
+N1156 G1 X83.379 Y87.220 E105.34211*89
+N1157 G1 X84.031 Y86.732 E105.37597*93
+N1158 G1 X84.725 Y86.261 E105.41084*85
+N1159 G1 X85.456 Y85.806 E105.44665*86
+N1160 G1 X86.223 Y85.369 E105.48335*85
+N1161 G1 X87.021 Y84.949 E105.52083*89
+N1162 G1 X87.846 Y84.548 E105.55900*91
+N1163 G1 X88.696 Y84.165 E105.59773*91
+N1164 G1 X89.565 Y83.802 E105.63690*88
+N1165 G1 X90.450 Y83.459 E105.67638*82
+N1166 G1 X91.347 Y83.136 E105.71601*80
+N1167 G1 X92.251 Y82.833 E105.75565*92
+N1168 G1 X93.158 Y82.551 E105.79517*88
+N1169 G1 X94.065 Y82.291 E105.83440*92
+N1170 G1 X94.967 Y82.052 E105.87320*87
+N1171 G1 X95.861 Y81.835 E105.91144*93
+N1172 G1 X96.743 Y81.640 E105.94899*82
+N1173 G1 X97.609 Y81.467 E105.98570*92
+N1174 G1 X98.456 Y81.317 E106.02148*83
+N1175 G1 X99.281 Y81.190 E106.05620*92
+N1176 G1 X100.082 Y81.086 E106.08979*103
+N1177 G1 X100.857 Y81.005 E106.12216*100
+N1178 G1 X101.602 Y80.947 E106.15325*108
+N1179 G1 X102.317 Y80.912 E106.18301*100
+N1180 G1 X103.000 Y80.900 E106.21142*106
+N1181 G1 X103.650 Y80.912 E106.23845*103
+N1182 G1 X104.267 Y80.947 E106.26413*105
+N1183 G1 X104.850 Y81.005 E106.28849*101
+N1184 G1 X105.399 Y81.086 E106.31157*104
+N1185 G1 X105.915 Y81.190 E106.33346*97
+N1186 G1 X106.398 Y81.317 E106.35424*102
+N1187 G1 X106.850 Y81.467 E106.37404*104
+N1188 G1 X107.272 Y81.640 E106.39300*102
+N1189 G1 X107.666 Y81.835 E106.41126*99
+N1190 G1 X108.033 Y82.052 E106.42899*102
+N1191 G1 X108.375 Y82.291 E106.44635*101
+N1192 G1 X108.696 Y82.551 E106.46353*98
+N1193 G1 X108.997 Y82.833 E106.48067*110
+N1194 G1 X109.280 Y83.136 E106.49792*100
+N1195 G1 X109.550 Y83.459 E106.51542*101
+N1196 G1 X109.808 Y83.802 E106.53328*108
+N1197 G1 X110.057 Y84.165 E106.55158*107
+N1198 G1 X110.300 Y84.548 E106.57042*102
+N1199 G1 X110.539 Y84.949 E106.58984*106
+N1200 G1 X110.777 Y85.369 E106.60990*102
+N1201 G1 X111.017 Y85.806 E106.63064*100
+N1202 G1 X111.261 Y86.261 E106.65209*99
+N1203 G1 X111.510 Y86.732 E106.67427*104
+N1204 G1 X111.767 Y87.220 E106.69718*107
+N1205 G1 X112.033 Y87.723 E106.72086*99
+N1206 G1 X112.310 Y88.241 E106.74528*107
+N1207 G1 X112.599 Y88.773 E106.77047*102
+N1208 G1 X112.900 Y89.319 E106.79640*99
+N1209 G1 X113.214 Y89.879 E106.82306*99
+N1210 G1 X113.541 Y90.450 E106.85044*97
+N1211 G1 X113.881 Y91.033 E106.87849*102
+N1212 G1 X114.233 Y91.627 E106.90720*100
+N1213 G1 X114.596 Y92.231 E106.93651*105
+N1214 G1 X114.969 Y92.845 E106.96637*110
+N1215 G1 X115.350 Y93.467 E106.99672*109
+N1216 G1 X115.738 Y94.098 E107.02750*101
+N1217 G1 X116.131 Y94.735 E107.05863*96
+N1218 G1 X116.525 Y95.379 E107.09004*102
+N1219 G1 X116.919 Y96.029 E107.12163*107
+N1220 G1 X117.310 Y96.683 E107.15332*100
+N1221 G1 X117.694 Y97.342 E107.18501*110
+N1222 G1 X118.068 Y98.004 E107.21663*100
+N1223 G1 X118.430 Y98.668 E107.24807*105
+N1224 G1 X118.775 Y99.333 E107.27925*100
+N1225 G1 X119.100 Y100.000 E107.31008*83
+N1226 G1 E106.31008 F2400.00000*39
+N1227 G0 X85.000 Y84.000 F7800*118
+N1228 G1 X115.000 Y84.000 E107.55748 F3000*10
+N1229 G0 X115.000 Y84.550 F7800*64
+N1230 G1 X85.000 Y84.550 E108.80488 F3000*51
+N1231 G0 X85.000 Y85.100 F7800*113
+N1232 G1 X115.000 Y85.100 E110.05228 F3000*1
+N1233 G0 X115.000 Y85.650 F7800*73
+N1234 G1 X85.000 Y85.650 E111.29968 F3000*61
+N1235 G0 X85.000 Y86.200 F7800*117
+N1236 G1 X115.000 Y86.200 E112.54708 F3000*4
+N1237 G0 X115.000 Y86.750 F7800*79
+N1238 G1 X85.000 Y86.750 E113.79448 F3000*59
+N1239 G0 X85.000 Y87.300 F7800*121
+N1240 G1 X115.000 Y87.300 E115.04188 F3000*9
+N1241 G0 X115.000 Y87.850 F7800*64
+N1242 G1 X85.000 Y87.850 E116.28928 F3000*50
+N1243 G0 X85.000 Y88.400 F7800*124
+N1244 G1 X115.000 Y88.400 E117.53668 F3000*12
+N1245 G0 X115.000 Y88.950 F7800*74
+N1246 G1 X85.000 Y88.950 E118.78408 F3000*60
+N1247 G0 X85.000 Y89.500 F7800*120
+N1248 G1 X115.000 Y89.500 E120.03148 F3000*4
+N1249 G0 X115.000 Y90.050 F7800*70
+N1250 G1 X85.000 Y90.050 E121.27888 F3000*63
+N1251 G0 X85.000 Y90.600 F7800*116
+N1252 G1 X115.000 Y90.600 E122.52628 F3000*3
+N1253 G0 X115.000 Y91.150 F7800*77
+N1254 G1 X85.000 Y91.150 E123.77368 F3000*57
+N1255 G0 X85.000 Y91.700 F7800*112
+N1256 G1 X115.000 Y91.700 E125.02108 F3000*0
+N1257 G0 X115.000 Y92.250 F7800*73
+N1258 G1 X85.000 Y92.250 E126.26848 F3000*61
+N1259 G0 X85.000 Y92.800 F7800*112
+N1260 G1 X115.000 Y92.800 E127.51588 F3000*1
+N1261 G0 X115.000 Y93.350 F7800*76
+N1262 G1 X85.000 Y93.350 E128.76328 F3000*50
+N1263 G0 X85.000 Y93.900 F7800*121
+N1264 G1 X115.000 Y93.900 E130.01068 F3000*13
+N1265 G0 X115.000 Y94.450 F7800*72
+N1266 G1 X85.000 Y94.450 E131.25808 F3000*49
+N1267 G0 X85.000 Y95.000 F7800*114
+N1268 G1 X115.000 Y95.000 E132.50548 F3000*15
+N1269 G0 X115.000 Y95.550 F7800*68
+N1270 G1 X85.000 Y95.550 E133.75288 F3000*51
+N1271 G0 X85.000 Y96.100 F7800*119
+N1272 G1 X115.000 Y96.100 E135.00028 F3000*7
+N1273 G0 X115.000 Y96.650 F7800*79
+N1274 G1 X85.000 Y96.650 E136.24768 F3000*61
+N1275 G0 X85.000 Y97.200 F7800*113
+N1276 G1 X115.000 Y97.200 E137.49508 F3000*9
+N1277 G0 X115.000 Y97.750 F7800*75
+N1278 G1 X85.000 Y97.750 E138.74248 F3000*61
+N1279 G0 X85.000 Y98.300 F7800*115
+N1280 G1 X115.000 Y98.300 E139.98988 F3000*8
+N1281 G0 X115.000 Y98.850 F7800*66
+N1282 G1 X85.000 Y98.850 E141.23728 F3000*55
+N1283 G0 X85.000 Y99.400 F7800*112
+N1284 G1 X115.000 Y99.400 E142.48468 F3000*8
+N1285 G0 X115.000 Y99.950 F7800*70
+N1286 G1 X85.000 Y99.950 E143.73208 F3000*51
+N1287 G0 X85.000 Y100.500 F7800*68
+N1288 G1 X115.000 Y100.500 E144.97948 F3000*63
+N1289 G0 X115.000 Y101.050 F7800*115
+N1290 G1 X85.000 Y101.050 E146.22688 F3000*0
+N1291 G0 X85.000 Y101.600 F7800*65
+N1292 G1 X115.000 Y101.600 E147.47428 F3000*51
+N1293 G0 X115.000 Y102.150 F7800*122
+N1294 G1 X85.000 Y102.150 E148.72168 F3000*4
+N1295 G0 X85.000 Y102.700 F7800*71
+N1296 G1 X115.000 Y102.700 E149.96908 F3000*56
+N1297 G0 X115.000 Y103.250 F7800*124
+N1298 G1 X85.000 Y103.250 E151.21648 F3000*1
+N1299 G0 X85.000 Y103.800 F7800*69
+N1300 G1 X115.000 Y103.800 E152.46388 F3000*61
+N1301 G0 X115.000 Y104.350 F7800*116
+N1302 G1 X85.000 Y104.350 E153.71128 F3000*3
+N1303 G0 X85.000 Y104.900 F7800*65
+N1304 G1 X115.000 Y104.900 E154.95868 F3000*50
+N1305 G0 X115.000 Y105.450 F7800*118
+N1306 G1 X85.000 Y105.450 E156.20608 F3000*5
+N1307 G0 X85.000 Y106.000 F7800*78
+N1308 G1 X115.000 Y106.000 E157.45348 F3000*50
+N1309 G0 X115.000 Y106.550 F7800*120
+N1310 G1 X85.000 Y106.550 E158.70088 F3000*5
+N1311 G0 X85.000 Y107.100 F7800*73
+N1312 G1 X115.000 Y107.100 E159.94828 F3000*54
+N1313 G0 X115.000 Y107.650 F7800*113
+N1314 G1 X85.000 Y107.650 E161.19568 F3000*13
+N1315 G0 X85.000 Y108.200 F7800*65
+N1316 G1 X115.000 Y108.200 E162.44308 F3000*50
+N1317 G0 X115.000 Y108.750 F7800*123
+N1318 G1 X85.000 Y108.750 E163.69048 F3000*13
+N1319 G0 X85.000 Y109.300 F7800*77
+N1320 G1 X115.000 Y109.300 E164.93788 F3000*55
+N1321 G0 X115.000 Y109.850 F7800*112
+N1322 G1 X85.000 Y109.850 E166.18528 F3000*10
+N1323 G0 X85.000 Y110.400 F7800*75
+N1324 G1 X115.000 Y110.400 E167.43268 F3000*57
+N1325 G0 X115.000 Y110.950 F7800*125
+N1326 G1 X85.000 Y110.950 E168.68008 F3000*9
+N1327 G0 X85.000 Y111.500 F7800*79
+N1328 G1 X115.000 Y111.500 E169.92748 F3000*48
+N1329 G0 X115.000 Y112.050 F7800*122
+N1330 G1 X85.000 Y112.050 E171.17488 F3000*9
+N1331 G0 X85.000 Y112.600 F7800*72
+N1332 G1 X115.000 Y112.600 E172.42228 F3000*63
+N1333 G0 X115.000 Y113.150 F7800*113
+N1334 G1 X85.000 Y113.150 E173.66968 F3000*10
+N1335 G0 X85.000 Y113.700 F7800*76
+N1336 G1 X115.000 Y113.700 E174.91708 F3000*52
+N1337 G0 X115.000 Y114.250 F7800*113
+N1338 G1 X85.000 Y114.250 E176.16448 F3000*15
+N1339 G0 X85.000 Y114.800 F7800*72
+N1340 G1 X115.000 Y114.800 E177.41188 F3000*61
+N1341 G0 X115.000 Y115.350 F7800*112
+N1342 G1 X85.000 Y115.350 E178.65928 F3000*3
+N1343 G0 X85.000 Y115.900 F7800*69
+N1344 G1 X115.000 Y115.900 E179.90668 F3000*50
+N1345 G0 X115.000 Y116.450 F7800*112
+N1346 G1 X85.000 Y116.450 E181.15408 F3000*13
+N1347 M106 S255*84
+;LAYER:2
+N1348 G1 Z0.700 F7800.000*50
+N1349 G1 E182.15408 F2400.00000*33
+N1350 G1 X120.000 Y100.000 F7800.000*107
+N1351 G1 X120.301 Y100.698 E182.18570 F1800.000*34
+N1352 G1 X120.575 Y101.395 E182.21684*94
+N1353 G1 X120.817 Y102.091 E182.24746*88
+N1354 G1 X121.026 Y102.783 E182.27754*80
+N1355 G1 X121.196 Y103.473 E182.30708*89
+N1356 G1 X121.326 Y104.158 E182.33608*90
+N1357 G1 X121.413 Y104.838 E182.36459*86
+N1358 G1 X121.455 Y105.513 E182.39268*85
+N1359 G1 X121.448 Y106.180 E182.42044*85
+N1360 G1 X121.392 Y106.840 E182.44799*91
+N1361 G1 X121.284 Y107.492 E182.47545*94
+N1362 G1 X121.124 Y108.135 E182.50299*83
+N1363 G1 X120.910 Y108.767 E182.53076*93
+N1364 G1 X120.643 Y109.389 E182.55892*82
+N1365 G1 X120.321 Y110.000 E182.58762*85
+N1366 G1 X119.945 Y110.598 E182.61700*94
+N1367 G1 X119.515 Y111.184 E182.64719*83
+N1368 G1 X119.034 Y111.756 E182.67828*93
+N1369 G1 X118.501 Y112.313 E182.71034*90
+N1370 G1 X117.919 Y112.856 E182.74342*85
+N1371 G1 X117.290 Y113.383 E182.77754*92
+N1372 G1 X116.616 Y113.893 E182.81269*92
+N1373 G1 X115.901 Y114.387 E182.84884*82
+N1374 G1 X115.146 Y114.863 E182.88593*88
+N1375 G1 X114.356 Y115.321 E182.92391*88
+N1376 G1 X113.533 Y115.760 E182.96268*91
+N1377 G1 X112.683 Y116.180 E183.00213*90
+N1378 G1 X111.808 Y116.581 E183.04214*93
+N1379 G1 X110.912 Y116.961 E183.08260*90
+N1380 G1 X110.000 Y117.321 E183.12336*80
+N1381 G1 X109.076 Y117.659 E183.16428*94
+N1382 G1 X108.144 Y117.976 E183.20522*80
+N1383 G1 X107.208 Y118.271 E183.24603*82
+N1384 G1 X106.272 Y118.544 E183.28656*84
+N1385 G1 X105.340 Y118.794 E183.32666*81
+N1386 G1 X104.417 Y119.021 E183.36620*88
+N1387 G1 X103.505 Y119.225 E183.40505*95
+N1388 G1 X102.609 Y119.406 E183.44307*89
+N1389 G1 X101.731 Y119.563 E183.48015*95
+N1390 G1 X100.875 Y119.696 E183.51618*83
+N1391 G1 X100.043 Y119.805 E183.55107*86
+N1392 G1 X99.237 Y119.890 E183.58475*100
+N1393 G1 X98.461 Y119.951 E183.61714*99
+N1394 G1 X97.714 Y119.988 E183.64821*98
+N1395 G1 X97.000 Y120.000 E183.67792*102
+N1396 G1 X96.318 Y119.988 E183.70626*101
+N1397 G1 X95.670 Y119.951 E183.73325*109
+N1398 G1 X95.056 Y119.890 E183.75891*110
+N1399 G1 X94.476 Y119.805 E183.78330*105
+N1400 G1 X93.929 Y119.696 E183.80649*102
+N1401 G1 X93.415 Y119.563 E183.82858*96
+N1402 G1 X92.932 Y119.406 E183.84968*108
+N1403 G1 X92.480 Y119.225 E183.86993*104
+N1404 G1 X92.056 Y119.021 E183.88948*110
+N1405 G1 X91.660 Y118.794 E183.90849*110
+N1406 G1 X91.288 Y118.544 E183.92713*98
+N1407 G1 X90.938 Y118.271 E183.94556*102
+N1408 G1 X90.609 Y117.976 E183.96395*108
+N1409 G1 X90.297 Y117.659 E183.98244*111
+N1410 G1 X90.000 Y117.321 E184.00116*99
+N1411 G1 X89.715 Y116.961 E184.02023*99
+N1412 G1 X89.440 Y116.581 E184.03975*106
+N1413 G1 X89.171 Y116.180 E184.05980*101
+N1414 G1 X88.907 Y115.760 E184.08044*109
+N1415 G1 X88.644 Y115.321 E184.10172*104
+N1416 G1 X88.381 Y114.863 E184.12369*97
+N1417 G1 X88.114 Y114.387 E184.14638*104
+N1418 G1 X87.843 Y113.893 E184.16981*101
+N1419 G1 X87.564 Y113.383 E184.19399*106
+N1420 G1 X87.277 Y112.856 E184.21893*109
+N1421 G1 X86.980 Y112.313 E184.24464*101
+N1422 G1 X86.673 Y111.756 E184.27112*100
+N1423 G1 X86.354 Y111.184 E184.29835*110
+N1424 G1 X86.023 Y110.598 E184.32632*97
+N1425 G1 X85.679 Y110.000 E184.35500*107
+N1426 G1 X85.325 Y109.389 E184.38436*103
+N1427 G1 X84.959 Y108.767 E184.41437*108
+N1428 G1 X84.582 Y108.135 E184.44498*104
+N1429 G1 X84.197 Y107.492 E184.47613*108
+N1430 G1 X83.804 Y106.840 E184.50777*103
+N1431 G1 X83.406 Y106.180 E184.53983*107
+N1432 G1 X83.004 Y105.513 E184.57223*102
+N1433 G1 X82.601 Y104.838 E184.60488*99
+N1434 G1 X82.200 Y104.158 E184.63772*107
+N1435 G1 X81.804 Y103.473 E184.67064*104
+N1436 G1 X81.415 Y102.783 E184.70355*109
+N1437 G1 X81.037 Y102.091 E184.73638*97
+N1438 G1 X80.672 Y101.395 E184.76902*111
+N1439 G1 X80.326 Y100.698 E184.80139*106
+N1440 G1 X80.000 Y100.000 E184.83342*105
+N1441 G1 X79.699 Y99.302 E184.86503*94
+N1442 G1 X79.425 Y98.605 E184.89617*82
+N1443 G1 X79.183 Y97.909 E184.92680*82
+N1444 G1 X78.974 Y97.217 E184.95688*95
+N1445 G1 X78.804 Y96.527 E184.98641*85
+N1446 G1 X78.674 Y95.842 E185.01541*80
+N1447 G1 X78.587 Y95.162 E185.04393*89
+N1448 G1 X78.545 Y94.487 E185.07202*93
+N1449 G1 X78.552 Y93.820 E185.09978*84
+N1450 G1 X78.608 Y93.160 E185.12732*87
+N1451 G1 X78.716 Y92.508 E185.15479*88
+N1452 G1 X78.876 Y91.865 E185.18233*82
+N1453 G1 X79.090 Y91.233 E185.21009*90
+N1454 G1 X79.357 Y90.611 E185.23825*84
+N1455 G1 X79.679 Y90.000 E185.26695*90
+N1456 G1 X80.055 Y89.402 E185.29634*93
+N1457 G1 X80.485 Y88.816 E185.32653*86
+N1458 G1 X80.966 Y88.244 E185.35762*80
+N1459 G1 X81.499 Y87.687 E185.38968*80
+N1460 G1 X82.081 Y87.144 E185.42276*85
+N1461 G1 X82.710 Y86.617 E185.45687*86
+N1462 G1 X83.384 Y86.107 E185.49202*94
+N1463 G1 X84.099 Y85.613 E185.52817*82
+N1464 G1 X84.854 Y85.137 E185.56527*87
+N1465 G1 X85.644 Y84.679 E185.60325*85
+N1466 G1 X86.467 Y84.240 E185.64201*91
+N1467 G1 X87.317 Y83.820 E185.68146*92
+N1468 G1 X88.192 Y83.419 E185.72148*80
+N1469 G1 X89.088 Y83.039 E185.76194*89
+N1470 G1 X90.000 Y82.679 E185.80270*90
+N1471 G1 X90.924 Y82.341 E185.84362*92
+N1472 G1 X91.856 Y82.024 E185.88456*86
+N1473 G1 X92.792 Y81.729 E185.92536*86
+N1474 G1 X93.728 Y81.456 E185.96589*90
+N1475 G1 X94.660 Y81.206 E186.00600*92
+N1476 G1 X95.583 Y80.979 E186.04554*84
+N1477 G1 X96.495 Y80.775 E186.08438*85
+N1478 G1 X97.391 Y80.594 E186.12240*87
+N1479 G1 X98.269 Y80.437 E186.15948*83
+N1480 G1 X99.125 Y80.304 E186.19551*80
+N1481 G1 X99.957 Y80.195 E186.23041*91
+N1482 G1 X100.763 Y80.110 E186.26408*97
+N1483 G1 X101.539 Y80.049 E186.29648*104
+N1484 G1 X102.286 Y80.012 E186.32755*102
+N1485 G1 X103.000 Y80.000 E186.35726*106
+N1486 G1 X103.682 Y80.012 E186.38560*107
+N1487 G1 X104.330 Y80.049 E186.41259*108
+N1488 G1 X104.944 Y80.110 E186.43825*100
+N1489 G1 X105.524 Y80.195 E186.46264*105
+N1490 G1 X106.071 Y80.304 E186.48583*109
+N1491 G1 X106.585 Y80.437 E186.50792*110
+N1492 G1 X107.068 Y80.594 E186.52902*103
+N1493 G1 X107.520 Y80.775 E186.54927*99
+N1494 G1 X107.944 Y80.979 E186.56882*100
+N1495 G1 X108.340 Y81.206 E186.58783*102
+N1496 G1 X108.712 Y81.456 E186.60647*103
+N1497 G1 X109.062 Y81.729 E186.62490*102
+N1498 G1 X109.391 Y82.024 E186.64329*108
+N1499 G1 X109.703 Y82.341 E186.66177*105
+N1500 G1 X110.000 Y82.679 E186.68050*96
+N1501 G1 X110.285 Y83.039 E186.69957*98
+N1502 G1 X110.560 Y83.419 E186.71909*105
+N1503 G1 X110.829 Y83.820 E186.73913*103
+N1504 G1 X111.093 Y84.240 E186.75977*103
+N1505 G1 X111.356 Y84.679 E186.78106*97
+N1506 G1 X111.619 Y85.137 E186.80303*96
+N1507 G1 X111.886 Y85.613 E186.82571*105
+N1508 G1 X112.157 Y86.107 E186.84914*104
+N1509 G1 X112.436 Y86.617 E186.87332*96
+N1510 G1 X112.723 Y87.144 E186.89827*110
+N1511 G1 X113.020 Y87.687 E186.92398*103
+N1512 G1 X113.327 Y88.244 E186.95046*99
+N1513 G1 X113.646 Y88.816 E186.97769*101
+N1514 G1 X113.977 Y89.402 E187.00565*102
+N1515 G1 X114.321 Y90.000 E187.03433*102
+N1516 G1 X114.675 Y90.611 E187.06370*98
+N1517 G1 X115.041 Y91.233 E187.09371*104
+N1518 G1 X115.418 Y91.865 E187.12432*108
+N1519 G1 X115.803 Y92.508 E187.15547*106
+N1520 G1 X116.196 Y93.160 E187.18711*97
+N1521 G1 X116.594 Y93.820 E187.21916*104
+N1522 G1 X116.996 Y94.487 E187.25156*107
+N1523 G1 X117.399 Y95.162 E187.28422*106
+N1524 G1 X117.800 Y95.842 E187.31705*99
+N1525 G1 X118.196 Y96.527 E187.34997*102
+N1526 G1 X118.585 Y97.217 E187.38289*110
+N1527 G1 X118.963 Y97.909 E187.41571*97
+N1528 G1 X119.328 Y98.605 E187.44835*110
+N1529 G1 X119.674 Y99.302 E187.48073*102
+N1530 G1 X120.000 Y100.000 E187.51276*94
+N1531 G1 E186.51276 F2400.00000*35
+N1532 G1 E187.51276 F2400.00000*33
+N1533 G1 X119.550 Y100.000 F7800.000*98
+N1534 G1 X119.852 Y100.682 E187.54377 F1800.000*39
+N1535 G1 X120.126 Y101.364 E187.57432*94
+N1536 G1 X120.370 Y102.044 E187.60435*93
+N1537 G1 X120.580 Y102.721 E187.63383*88
+N1538 G1 X120.753 Y103.395 E187.66277*94
+N1539 G1 X120.886 Y104.065 E187.69117*89
+N1540 G1 X120.977 Y104.730 E187.71907*95
+N1541 G1 X121.022 Y105.389 E187.74654*93
+N1542 G1 X121.020 Y106.041 E187.77367*94
+N1543 G1 X120.969 Y106.686 E187.80059*81
+N1544 G1 X120.867 Y107.324 E187.82741*89
+N1545 G1 X120.713 Y107.952 E187.85430*93
+N1546 G1 X120.506 Y108.570 E187.88142*86
+N1547 G1 X120.245 Y109.178 E187.90893*86
+N1548 G1 X119.931 Y109.775 E187.93698*86
+N1549 G1 X119.563 Y110.360 E187.96571*85
+N1550 G1 X119.142 Y110.932 E187.99525*89
+N1551 G1 X118.669 Y111.491 E188.02568*86
+N1552 G1 X118.146 Y112.036 E188.05710*95
+N1553 G1 X117.574 Y112.566 E188.08953*80
+N1554 G1 X116.956 Y113.082 E188.12300*83
+N1555 G1 X116.293 Y113.581 E188.15751*81
+N1556 G1 X115.588 Y114.063 E188.19301*95
+N1557 G1 X114.845 Y114.528 E188.22947*89
+N1558 G1 X114.066 Y114.976 E188.26681*89
+N1559 G1 X113.256 Y115.406 E188.30493*83
+N1560 G1 X112.418 Y115.816 E188.34374*83
+N1561 G1 X111.556 Y116.208 E188.38312*80
+N1562 G1 X110.674 Y116.579 E188.42293*85
+N1563 G1 X109.775 Y116.931 E188.46305*86
+N1564 G1 X108.865 Y117.262 E188.50332*81
+N1565 G1 X107.946 Y117.571 E188.54361*88
+N1566 G1 X107.025 Y117.860 E188.58377*81
+N1567 G1 X106.103 Y118.126 E188.62365*90
+N1568 G1 X105.186 Y118.371 E188.66311*92
+N1569 G1 X104.278 Y118.593 E188.70200*82
+N1570 G1 X103.381 Y118.793 E188.74019*86
+N1571 G1 X102.500 Y118.969 E188.77756*93
+N1572 G1 X101.638 Y119.123 E188.81399*92
+N1573 G1 X100.797 Y119.253 E188.84937*87
+N1574 G1 X99.980 Y119.360 E188.88361*109
+N1575 G1 X99.190 Y119.443 E188.91663*108
+N1576 G1 X98.429 Y119.502 E188.94837*103
+N1577 G1 X97.699 Y119.538 E188.97879*96
+N1578 G1 X97.000 Y119.550 E189.00784*101
+N1579 G1 X96.334 Y119.538 E189.03554*99
+N1580 G1 X95.702 Y119.502 E189.06187*97
+N1581 G1 X95.103 Y119.443 E189.08688*101
+N1582 G1 X94.539 Y119.360 E189.11061*101
+N1583 G1 X94.007 Y119.253 E189.13315*111
+N1584 G1 X93.508 Y119.123 E189.15459*104
+N1585 G1 X93.041 Y118.969 E189.17504*109
+N1586 G1 X92.604 Y118.793 E189.19464*106
+N1587 G1 X92.195 Y118.593 E189.21355*104
+N1588 G1 X91.814 Y118.371 E189.23192*101
+N1589 G1 X91.456 Y118.126 E189.24992*97
+N1590 G1 X91.121 Y117.860 E189.26772*106
+N1591 G1 X90.806 Y117.571 E189.28548*110
+N1592 G1 X90.508 Y117.262 E189.30335*110
+N1593 G1 X90.225 Y116.931 E189.32146*111
+N1594 G1 X89.954 Y116.579 E189.33992*109
+N1595 G1 X89.692 Y116.208 E189.35883*111
+N1596 G1 X89.436 Y115.816 E189.37827*106
+N1597 G1 X89.184 Y115.406 E189.39830*98
+N1598 G1 X88.934 Y114.976 E189.41898*105
+N1599 G1 X88.682 Y114.528 E189.44033*97
+N1600 G1 X88.427 Y114.063 E189.46240*97
+N1601 G1 X88.166 Y113.581 E189.48520*97
+N1602 G1 X87.899 Y113.082 E189.50874*103
+N1603 G1 X87.622 Y112.566 E189.53305*104
+N1604 G1 X87.335 Y112.036 E189.55812*103
+N1605 G1 X87.037 Y111.491 E189.58395*100
+N1606 G1 X86.727 Y110.932 E189.61053*102
+N1607 G1 X86.404 Y110.360 E189.63785*102
+N1608 G1 X86.069 Y109.775 E189.66588*100
+N1609 G1 X85.722 Y109.178 E189.69459*103
+N1610 G1 X85.363 Y108.570 E189.72394*111
+N1611 G1 X84.993 Y107.952 E189.75390*106
+N1612 G1 X84.614 Y107.324 E189.78441*100
+N1613 G1 X84.227 Y106.686 E189.81541*106
+N1614 G1 X83.834 Y106.041 E189.84682*102
+N1615 G1 X83.437 Y105.389 E189.87859*103
+N1616 G1 X83.038 Y104.730 E189.91062*111
+N1617 G1 X82.641 Y104.065 E189.94283*104
+N1618 G1 X82.247 Y103.395 E189.97513*99
+N1619 G1 X81.860 Y102.721 E190.00744*98
+N1620 G1 X81.484 Y102.044 E190.03966*103
+N1621 G1 X81.121 Y101.364 E190.07169*109
+N1622 G1 X80.775 Y100.682 E190.10347*108
+N1623 G1 X80.450 Y100.000 E190.13490*107
+N1624 G1 X80.148 Y99.318 E190.16592*93
+N1625 G1 X79.874 Y98.636 E190.19647*80
+N1626 G1 X79.630 Y97.956 E190.22650*85
+N1627 G1 X79.420 Y97.279 E190.25598*81
+N1628 G1 X79.247 Y96.605 E190.28492*81
+N1629 G1 X79.114 Y95.935 E190.31331*92
+N1630 G1 X79.023 Y95.270 E190.34121*93
+N1631 G1 X78.978 Y94.611 E190.36869*95
+N1632 G1 X78.980 Y93.959 E190.39582*88
+N1633 G1 X79.031 Y93.314 E190.42273*93
+N1634 G1 X79.133 Y92.676 E190.44956*83
+N1635 G1 X79.287 Y92.048 E190.47645*91
+N1636 G1 X79.494 Y91.430 E190.50357*84
+N1637 G1 X79.755 Y90.822 E190.53108*94
+N1638 G1 X80.069 Y90.225 E190.55913*86
+N1639 G1 X80.437 Y89.640 E190.58786*88
+N1640 G1 X80.858 Y89.068 E190.61739*81
+N1641 G1 X81.331 Y88.509 E190.64783*82
+N1642 G1 X81.854 Y87.964 E190.67924*81
+N1643 G1 X82.426 Y87.434 E190.71168*85
+N1644 G1 X83.044 Y86.918 E190.74515*90
+N1645 G1 X83.707 Y86.419 E190.77965*95
+N1646 G1 X84.412 Y85.937 E190.81516*95
+N1647 G1 X85.155 Y85.472 E190.85162*86
+N1648 G1 X85.934 Y85.024 E190.88896*94
+N1649 G1 X86.744 Y84.594 E190.92708*89
+N1650 G1 X87.582 Y84.184 E190.96589*82
+N1651 G1 X88.444 Y83.792 E191.00526*90
+N1652 G1 X89.326 Y83.421 E191.04508*88
+N1653 G1 X90.225 Y83.069 E191.08519*87
+N1654 G1 X91.135 Y82.738 E191.12547*81
+N1655 G1 X92.054 Y82.429 E191.16576*80
+N1656 G1 X92.975 Y82.140 E191.20592*92
+N1657 G1 X93.897 Y81.874 E191.24580*91
+N1658 G1 X94.814 Y81.629 E191.28526*94
+N1659 G1 X95.722 Y81.407 E191.32415*80
+N1660 G1 X96.619 Y81.207 E191.36234*87
+N1661 G1 X97.500 Y81.031 E191.39971*94
+N1662 G1 X98.362 Y80.877 E191.43614*90
+N1663 G1 X99.203 Y80.747 E191.47152*81
+N1664 G1 X100.020 Y80.640 E191.50576*102
+N1665 G1 X100.810 Y80.557 E191.53878*105
+N1666 G1 X101.571 Y80.498 E191.57052*103
+N1667 G1 X102.301 Y80.462 E191.60094*111
+N1668 G1 X103.000 Y80.450 E191.62999*100
+N1669 G1 X103.666 Y80.462 E191.65768*101
+N1670 G1 X104.298 Y80.498 E191.68402*104
+N1671 G1 X104.897 Y80.557 E191.70903*107
+N1672 G1 X105.461 Y80.640 E191.73276*99
+N1673 G1 X105.993 Y80.747 E191.75530*103
+N1674 G1 X106.492 Y80.877 E191.77674*98
+N1675 G1 X106.959 Y81.031 E191.79719*102
+N1676 G1 X107.396 Y81.207 E191.81679*106
+N1677 G1 X107.805 Y81.407 E191.83569*108
+N1678 G1 X108.186 Y81.629 E191.85406*110
+N1679 G1 X108.544 Y81.874 E191.87207*102
+N1680 G1 X108.879 Y82.140 E191.88987*98
+N1681 G1 X109.194 Y82.429 E191.90763*111
+N1682 G1 X109.492 Y82.738 E191.92550*108
+N1683 G1 X109.775 Y83.069 E191.94361*103
+N1684 G1 X110.046 Y83.421 E191.96207*100
+N1685 G1 X110.308 Y83.792 E191.98098*109
+N1686 G1 X110.564 Y84.184 E192.00042*97
+N1687 G1 X110.816 Y84.594 E192.02045*104
+N1688 G1 X111.066 Y85.024 E192.04112*99
+N1689 G1 X111.318 Y85.472 E192.06248*97
+N1690 G1 X111.573 Y85.937 E192.08454*107
+N1691 G1 X111.834 Y86.419 E192.10734*106
+N1692 G1 X112.101 Y86.918 E192.13089*107
+N1693 G1 X112.378 Y87.434 E192.15520*100
+N1694 G1 X112.665 Y87.964 E192.18027*109
+N1695 G1 X112.963 Y88.509 E192.20610*100
+N1696 G1 X113.273 Y89.068 E192.23268*103
+N1697 G1 X113.596 Y89.640 E192.26000*111
+N1698 G1 X113.931 Y90.225 E192.28802*106
+N1699 G1 X114.278 Y90.822 E192.31673*103
+N1700 G1 X114.637 Y91.430 E192.34609*111
+N1701 G1 X115.007 Y92.048 E192.37605*109
+N1702 G1 X115.386 Y92.676 E192.40656*105
+N1703 G1 X115.773 Y93.314 E192.43755*103
+N1704 G1 X116.166 Y93.959 E192.46897*102
+N1705 G1 X116.563 Y94.611 E192.50073*103
+N1706 G1 X116.962 Y95.270 E192.53276*111
+N1707 G1 X117.359 Y95.935 E192.56498*100
+N1708 G1 X117.753 Y96.605 E192.59728*109
+N1709 G1 X118.140 Y97.279 E192.62959*105
+N1710 G1 X118.516 Y97.956 E192.66180*104
+N1711 G1 X118.879 Y98.636 E192.69384*98
+N1712 G1 X119.225 Y99.318 E192.72562*111
+N1713 G1 X119.550 Y100.000 E192.75705*84
+N1714 G1 E191.75705 F2400.00000*39
+N1715 G1 E192.75705 F2400.00000*37
+N1716 G1 X119.100 Y100.000 F7800.000*102
+N1717 G1 X119.402 Y100.667 E192.78748 F1800.000*36
+N1718 G1 X119.677 Y101.332 E192.81743*83
+N1719 G1 X119.922 Y101.996 E192.84687*85
+N1720 G1 X120.134 Y102.658 E192.87576*90
+N1721 G1 X120.310 Y103.317 E192.90410*87
+N1722 G1 X120.446 Y103.971 E192.93189*92
+N1723 G1 X120.540 Y104.621 E192.95918*81
+N1724 G1 X120.590 Y105.265 E192.98604*81
+N1725 G1 X120.592 Y105.902 E193.01255*89
+N1726 G1 X120.546 Y106.533 E193.03883*93
+N1727 G1 X120.450 Y107.155 E193.06501*93
+N1728 G1 X120.302 Y107.769 E193.09126*85
+N1729 G1 X120.101 Y108.373 E193.11773*90
+N1730 G1 X119.848 Y108.967 E193.14459*93
+N1731 G1 X119.541 Y109.550 E193.17198*90
+N1732 G1 X119.181 Y110.121 E193.20006*89
+N1733 G1 X118.769 Y110.681 E193.22895*84
+N1734 G1 X118.305 Y111.227 E193.25873*91
+N1735 G1 X117.792 Y111.759 E193.28950*94
+N1736 G1 X117.230 Y112.277 E193.32128*86
+N1737 G1 X116.621 Y112.780 E193.35411*87
+N1738 G1 X115.969 Y113.268 E193.38797*90
+N1739 G1 X115.275 Y113.739 E193.42284*86
+N1740 G1 X114.544 Y114.194 E193.45866*91
+N1741 G1 X113.777 Y114.631 E193.49535*80
+N1742 G1 X112.979 Y115.051 E193.53284*85
+N1743 G1 X112.154 Y115.452 E193.57100*95
+N1744 G1 X111.304 Y115.835 E193.60974*94
+N1745 G1 X110.435 Y116.198 E193.64891*88
+N1746 G1 X109.550 Y116.541 E193.68838*94
+N1747 G1 X108.653 Y116.864 E193.72801*85
+N1748 G1 X107.749 Y117.167 E193.76766*94
+N1749 G1 X106.842 Y117.449 E193.80717*92
+N1750 G1 X105.935 Y117.709 E193.84640*86
+N1751 G1 X105.033 Y117.948 E193.88521*91
+N1752 G1 X104.139 Y118.165 E193.92345*85
+N1753 G1 X103.257 Y118.360 E193.96099*89
+N1754 G1 X102.391 Y118.533 E193.99771*90
+N1755 G1 X101.544 Y118.683 E194.03348*84
+N1756 G1 X100.719 Y118.810 E194.06821*89
+N1757 G1 X99.918 Y118.914 E194.10180*102
+N1758 G1 X99.143 Y118.995 E194.13417*110
+N1759 G1 X98.398 Y119.053 E194.16525*109
+N1760 G1 X97.683 Y119.088 E194.19502*107
+N1761 G1 X97.000 Y119.100 E194.22342*108
+N1762 G1 X96.350 Y119.088 E194.25046*105
+N1763 G1 X95.733 Y119.053 E194.27614*111
+N1764 G1 X95.150 Y118.995 E194.30049*97
+N1765 G1 X94.601 Y118.914 E194.32358*106
+N1766 G1 X94.085 Y118.810 E194.34546*105
+N1767 G1 X93.602 Y118.683 E194.36625*102
+N1768 G1 X93.150 Y118.533 E194.38605*109
+N1769 G1 X92.728 Y118.360 E194.40500*109
+N1770 G1 X92.334 Y118.165 E194.42326*107
+N1771 G1 X91.967 Y117.948 E194.44099*108
+N1772 G1 X91.625 Y117.709 E194.45836*97
+N1773 G1 X91.304 Y117.449 E194.47553*109
+N1774 G1 X91.003 Y117.167 E194.49267*105
+N1775 G1 X90.720 Y116.864 E194.50993*108
+N1776 G1 X90.450 Y116.541 E194.52742*97
+N1777 G1 X90.192 Y116.198 E194.54528*99
+N1778 G1 X89.943 Y115.835 E194.56359*111
+N1779 G1 X89.700 Y115.452 E194.58242*111
+N1780 G1 X89.461 Y115.051 E194.60184*104
+N1781 G1 X89.223 Y114.631 E194.62191*110
+N1782 G1 X88.983 Y114.194 E194.64265*107
+N1783 G1 X88.739 Y113.739 E194.66409*109
+N1784 G1 X88.490 Y113.268 E194.68627*107
+N1785 G1 X88.233 Y112.780 E194.70919*108
+N1786 G1 X87.967 Y112.277 E194.73286*105
+N1787 G1 X87.690 Y111.759 E194.75729*99
+N1788 G1 X87.401 Y111.227 E194.78247*106
+N1789 G1 X87.100 Y110.681 E194.80840*108
+N1790 G1 X86.786 Y110.121 E194.83507*109
+N1791 G1 X86.459 Y109.550 E194.86244*98
+N1792 G1 X86.119 Y108.967 E194.89050*97
+N1793 G1 X85.767 Y108.373 E194.91920*100
+N1794 G1 X85.404 Y107.769 E194.94851*103
+N1795 G1 X85.031 Y107.155 E194.97837*110
+N1796 G1 X84.650 Y106.533 E195.00873*103
+N1797 G1 X84.262 Y105.902 E195.03951*108
+N1798 G1 X83.869 Y105.265 E195.07064*100
+N1799 G1 X83.475 Y104.621 E195.10204*99
+N1800 G1 X83.081 Y103.971 E195.13363*109
+N1801 G1 X82.690 Y103.317 E195.16532*102
+N1802 G1 X82.306 Y102.658 E195.19702*110
+N1803 G1 X81.932 Y101.996 E195.22863*111
+N1804 G1 X81.570 Y101.332 E195.26007*104
+N1805 G1 X81.225 Y100.667 E195.29125*100
+N1806 G1 X80.900 Y100.000 E195.32209*106
+N1807 G1 X80.598 Y99.333 E195.35252*93
+N1808 G1 X80.323 Y98.668 E195.38247*87
+N1809 G1 X80.078 Y98.004 E195.41191*81
+N1810 G1 X79.866 Y97.342 E195.44080*82
+N1811 G1 X79.690 Y96.683 E195.46913*92
+N1812 G1 X79.554 Y96.029 E195.49693*90
+N1813 G1 X79.460 Y95.379 E195.52422*90
+N1814 G1 X79.410 Y94.735 E195.55107*82
+N1815 G1 X79.408 Y94.098 E195.57758*84
+N1816 G1 X79.454 Y93.467 E195.60386*94
+N1817 G1 X79.550 Y92.845 E195.63005*92
+N1818 G1 X79.698 Y92.231 E195.65630*91
+N1819 G1 X79.899 Y91.627 E195.68277*95
+N1820 G1 X80.152 Y91.033 E195.70963*89
+N1821 G1 X80.459 Y90.450 E195.73702*92
+N1822 G1 X80.819 Y89.879 E195.76510*92
+N1823 G1 X81.231 Y89.319 E195.79398*88
+N1824 G1 X81.695 Y88.773 E195.82377*89
+N1825 G1 X82.208 Y88.241 E195.85454*94
+N1826 G1 X82.770 Y87.723 E195.88632*86
+N1827 G1 X83.379 Y87.220 E195.91915*95
+N1828 G1 X84.031 Y86.732 E195.95301*84
+N1829 G1 X84.725 Y86.261 E195.98788*92
+N1830 G1 X85.456 Y85.806 E196.02370*89
+N1831 G1 X86.223 Y85.369 E196.06039*87
+N1832 G1 X87.021 Y84.949 E196.09787*81
+N1833 G1 X87.846 Y84.548 E196.13604*85
+N1834 G1 X88.696 Y84.165 E196.17477*87
+N1835 G1 X89.565 Y83.802 E196.21395*89
+N1836 G1 X90.450 Y83.459 E196.25342*89
+N1837 G1 X91.347 Y83.136 E196.29305*91
+N1838 G1 X92.251 Y82.833 E196.33270*84
+N1839 G1 X93.158 Y82.551 E196.37221*87
+N1840 G1 X94.065 Y82.291 E196.41144*91
+N1841 G1 X94.967 Y82.052 E196.45025*94
+N1842 G1 X95.861 Y81.835 E196.48849*94
+N1843 G1 X96.743 Y81.640 E196.52603*84
+N1844 G1 X97.609 Y81.467 E196.56274*90
+N1845 G1 X98.456 Y81.317 E196.59852*93
+N1846 G1 X99.281 Y81.190 E196.63325*92
+N1847 G1 X100.082 Y81.086 E196.66683*103
+N1848 G1 X100.857 Y81.005 E196.69920*106
+N1849 G1 X101.602 Y80.947 E196.73029*97
+N1850 G1 X102.317 Y80.912 E196.76005*96
+N1851 G1 X103.000 Y80.900 E196.78846*103
+N1852 G1 X103.650 Y80.912 E196.81550*104
+N1853 G1 X104.267 Y80.947 E196.84118*99
+N1854 G1 X104.850 Y81.005 E196.86553*109
+N1855 G1 X105.399 Y81.086 E196.88862*105
+N1856 G1 X105.915 Y81.190 E196.91050*99
+N1857 G1 X106.398 Y81.317 E196.93129*110
+N1858 G1 X106.850 Y81.467 E196.95109*106
+N1859 G1 X107.272 Y81.640 E196.97004*105
+N1860 G1 X107.666 Y81.835 E196.98830*110
+N1861 G1 X108.033 Y82.052 E197.00603*98
+N1862 G1 X108.375 Y82.291 E197.02340*109
+N1863 G1 X108.696 Y82.551 E197.04057*108
+N1864 G1 X108.997 Y82.833 E197.05771*110
+N1865 G1 X109.280 Y83.136 E197.07496*102
+N1866 G1 X109.550 Y83.459 E197.09246*102
+N1867 G1 X109.808 Y83.802 E197.11032*109
+N1868 G1 X110.057 Y84.165 E197.12862*105
+N1869 G1 X110.300 Y84.548 E197.14746*109
+N1870 G1 X110.539 Y84.949 E197.16688*101
+N1871 G1 X110.777 Y85.369 E197.18695*103
+N1872 G1 X111.017 Y85.806 E197.20769*111
+N1873 G1 X111.261 Y86.261 E197.22913*100
+N1874 G1 X111.510 Y86.732 E197.25131*110
+N1875 G1 X111.767 Y87.220 E197.27423*110
+N1876 G1 X112.033 Y87.723 E197.29790*107
+N1877 G1 X112.310 Y88.241 E197.32233*96
+N1878 G1 X112.599 Y88.773 E197.34751*107
+N1879 G1 X112.900 Y89.319 E197.37344*108
+N1880 G1 X113.214 Y89.879 E197.40010*106
+N1881 G1 X113.541 Y90.450 E197.42748*107
+N1882 G1 X113.881 Y91.033 E197.45554*97
+N1883 G1 X114.233 Y91.627 E197.48424*108
+N1884 G1 X114.596 Y92.231 E197.51355*106
+N1885 G1 X114.969 Y92.845 E197.54341*110
+N1886 G1 X115.350 Y93.467 E197.57377*103
+N1887 G1 X115.738 Y94.098 E197.60455*108
+N1888 G1 X116.131 Y94.735 E197.63568*99
+N1889 G1 X116.525 Y95.379 E197.66708*111
+N1890 G1 X116.919 Y96.029 E197.69867*104
+N1891 G1 X117.310 Y96.683 E197.73036*106
+N1892 G1 X117.694 Y97.342 E197.76206*109
+N1893 G1 X118.068 Y98.004 E197.79367*97
+N1894 G1 X118.430 Y98.668 E197.82511*96
+N1895 G1 X118.775 Y99.333 E197.85629*102
+N1896 G1 X119.100 Y100.000 E197.88713*87
+N1897 G1 E196.88713 F2400.00000*33
+N1898 G0 X85.000 Y84.000 F7800*120
+N1899 G1 X115.000 Y84.000 E198.13453 F3000*7
+N1900 G0 X115.000 Y84.550 F7800*64
+N1901 G1 X85.000 Y84.550 E199.38193 F3000*62
+N1902 G0 X85.000 Y85.100 F7800*122
+N1903 G1 X115.000 Y85.100 E200.62933 F3000*10
+N1904 G0 X115.000 Y85.650 F7800*70
+N1905 G1 X85.000 Y85.650 E201.87673 F3000*55
+N1906 G0 X85.000 Y86.200 F7800*126
+N1907 G1 X115.000 Y86.200 E203.12413 F3000*5
+N1908 G0 X115.000 Y86.750 F7800*72
+N1909 G1 X85.000 Y86.750 E204.37153 F3000*50
+N1910 G0 X85.000 Y87.300 F7800*121
+N1911 G1 X115.000 Y87.300 E205.61893 F3000*4
+N1912 G0 X115.000 Y87.850 F7800*77
+N1913 G1 X85.000 Y87.850 E206.86633 F3000*62
+N1914 G0 X85.000 Y88.400 F7800*117
+N1915 G1 X115.000 Y88.400 E208.11373 F3000*7
+N1916 G0 X115.000 Y88.950 F7800*71
+N1917 G1 X85.000 Y88.950 E209.36113 F3000*53
+N1918 G0 X85.000 Y89.500 F7800*121
+N1919 G1 X115.000 Y89.500 E210.60853 F3000*13
+N1920 G0 X115.000 Y90.050 F7800*66
+N1921 G1 X85.000 Y90.050 E211.85593 F3000*61
+N1922 G0 X85.000 Y90.600 F7800*123
+N1923 G1 X115.000 Y90.600 E213.10333 F3000*6
+N1924 G0 X115.000 Y91.150 F7800*70
+N1925 G1 X85.000 Y91.150 E214.35073 F3000*60
+N1926 G0 X85.000 Y91.700 F7800*127
+N1927 G1 X115.000 Y91.700 E215.59813 F3000*0
+N1928 G0 X115.000 Y92.250 F7800*74
+N1929 G1 X85.000 Y92.250 E216.84553 F3000*63
+N1930 G0 X85.000 Y92.800 F7800*116
+N1931 G1 X115.000 Y92.800 E218.09293 F3000*1
+N1932 G0 X115.000 Y93.350 F7800*65
+N1933 G1 X85.000 Y93.350 E219.34033 F3000*51
+N1934 G0 X85.000 Y93.900 F7800*112
+N1935 G1 X115.000 Y93.900 E220.58773 F3000*1
+N1936 G0 X115.000 Y94.450 F7800*69
+N1937 G1 X85.000 Y94.450 E221.83513 F3000*55
+N1938 G0 X85.000 Y95.000 F7800*115
+N1939 G1 X115.000 Y95.000 E223.08253 F3000*3
+N1940 G0 X115.000 Y95.550 F7800*68
+N1941 G1 X85.000 Y95.550 E224.32993 F3000*61
+N1942 G0 X85.000 Y96.100 F7800*124
+N1943 G1 X115.000 Y96.100 E225.57733 F3000*3
+N1944 G0 X115.000 Y96.650 F7800*64
+N1945 G1 X85.000 Y96.650 E226.82473 F3000*51
+N1946 G0 X85.000 Y97.200 F7800*122
+N1947 G1 X115.000 Y97.200 E228.07213 F3000*10
+N1948 G0 X115.000 Y97.750 F7800*76
+N1949 G1 X85.000 Y97.750 E229.31953 F3000*55
+N1950 G0 X85.000 Y98.300 F7800*115
+N1951 G1 X115.000 Y98.300 E230.56693 F3000*2
+N1952 G0 X115.000 Y98.850 F7800*71
+N1953 G1 X85.000 Y98.850 E231.81433 F3000*53
+N1954 G0 X85.000 Y99.400 F7800*113
+N1955 G1 X115.000 Y99.400 E233.06173 F3000*15
+N1956 G0 X115.000 Y99.950 F7800*67
+N1957 G1 X85.000 Y99.950 E234.30913 F3000*49
+N1958 G0 X85.000 Y100.500 F7800*77
+N1959 G1 X115.000 Y100.500 E235.55653 F3000*54
+N1960 G0 X115.000 Y101.050 F7800*127
+N1961 G1 X85.000 Y101.050 E236.80393 F3000*6
+N1962 G0 X85.000 Y101.600 F7800*70
+N1963 G1 X115.000 Y101.600 E238.05133 F3000*52
+N1964 G0 X115.000 Y102.150 F7800*121
+N1965 G1 X85.000 Y102.150 E239.29873 F3000*9
+N1966 G0 X85.000 Y102.700 F7800*64
+N1967 G1 X115.000 Y102.700 E240.54613 F3000*60
+N1968 G0 X115.000 Y103.250 F7800*119
+N1969 G1 X85.000 Y103.250 E241.79353 F3000*4
+N1970 G0 X85.000 Y103.800 F7800*73
+N1971 G1 X115.000 Y103.800 E243.04093 F3000*61
+N1972 G0 X115.000 Y104.350 F7800*122
+N1973 G1 X85.000 Y104.350 E244.28833 F3000*5
+N1974 G0 X85.000 Y104.900 F7800*75
+N1975 G1 X115.000 Y104.900 E245.53573 F3000*48
+N1976 G0 X115.000 Y105.450 F7800*120
+N1977 G1 X85.000 Y105.450 E246.78313 F3000*9
+N1978 G0 X85.000 Y106.000 F7800*76
+N1979 G1 X115.000 Y106.000 E248.03053 F3000*56
+N1980 G0 X115.000 Y106.550 F7800*115
+N1981 G1 X85.000 Y106.550 E249.27793 F3000*11
+N1982 G0 X85.000 Y107.100 F7800*73
+N1983 G1 X115.000 Y107.100 E250.52533 F3000*51
+N1984 G0 X115.000 Y107.650 F7800*117
+N1985 G1 X85.000 Y107.650 E251.77273 F3000*10
+N1986 G0 X85.000 Y108.200 F7800*65
+N1987 G1 X115.000 Y108.200 E253.02013 F3000*58
+N1988 G0 X115.000 Y108.750 F7800*119
+N1989 G1 X85.000 Y108.750 E254.26753 F3000*14
+N1990 G0 X85.000 Y109.300 F7800*70
+N1991 G1 X115.000 Y109.300 E255.51493 F3000*49
+N1992 G0 X115.000 Y109.850 F7800*114
+N1993 G1 X85.000 Y109.850 E256.76233 F3000*15
+N1994 G0 X85.000 Y110.400 F7800*77
+N1995 G1 X115.000 Y110.400 E258.00973 F3000*48
+N1996 G0 X115.000 Y110.950 F7800*127
+N1997 G1 X85.000 Y110.950 E259.25713 F3000*12
+N1998 G0 X85.000 Y111.500 F7800*65
+N1999 G1 X115.000 Y111.500 E260.50453 F3000*61
+N2000 G0 X115.000 Y112.050 F7800*113
+N2001 G1 X85.000 Y112.050 E261.75193 F3000*2
+N2002 G0 X85.000 Y112.600 F7800*72
+N2003 G1 X115.000 Y112.600 E262.99933 F3000*56
+N2004 G0 X115.000 Y113.150 F7800*117
+N2005 G1 X85.000 Y113.150 E264.24673 F3000*14
+N2006 G0 X85.000 Y113.700 F7800*76
+N2007 G1 X115.000 Y113.700 E265.49413 F3000*57
+N2008 G0 X115.000 Y114.250 F7800*125
+N2009 G1 X85.000 Y114.250 E266.74153 F3000*4
+N2010 G0 X85.000 Y114.800 F7800*67
+N2011 G1 X115.000 Y114.800 E267.98893 F3000*60
+N2012 G0 X115.000 Y115.350 F7800*118
+N2013 G1 X85.000 Y115.350 E269.23633 F3000*3
+N2014 G0 X85.000 Y115.900 F7800*71
+N2015 G1 X115.000 Y115.900 E270.48373 F3000*54
+N2016 G0 X115.000 Y116.450 F7800*118
+N2017 G1 X85.000 Y116.450 E271.73113 F3000*10
+N2018 M106 S255*94
+;LAYER:3
+N2019 G1 Z0.900 F7800.000*56
+N2020 G1 E272.73113 F2400.00000*45
+N2021 G1 X120.000 Y100.000 F7800.000*109
+N2022 G1 X120.301 Y100.698 E272.76274 F1800.000*33
+N2023 G1 X120.575 Y101.395 E272.79388*80
+N2024 G1 X120.817 Y102.091 E272.82450*92
+N2025 G1 X121.026 Y102.783 E272.85458*93
+N2026 G1 X121.196 Y103.473 E272.88412*90
+N2027 G1 X121.326 Y104.158 E272.91312*86
+N2028 G1 X121.413 Y104.838 E272.94163*86
+N2029 G1 X121.455 Y105.513 E272.96972*90
+N2030 G1 X121.448 Y106.180 E272.99748*91
+N2031 G1 X121.392 Y106.840 E273.02503*81
+N2032 G1 X121.284 Y107.492 E273.05250*80
+N2033 G1 X121.124 Y108.135 E273.08003*86
+N2034 G1 X120.910 Y108.767 E273.10780*91
+N2035 G1 X120.643 Y109.389 E273.13596*80
+N2036 G1 X120.321 Y110.000 E273.16466*83
+N2037 G1 X119.945 Y110.598 E273.19405*94
+N2038 G1 X119.515 Y111.184 E273.22423*92
+N2039 G1 X119.034 Y111.756 E273.25532*84
+N2040 G1 X118.501 Y112.313 E273.28738*91
+N2041 G1 X117.919 Y112.856 E273.32046*95
+N2042 G1 X117.290 Y113.383 E273.35458*88
+N2043 G1 X116.616 Y113.893 E273.38973*81
+N2044 G1 X115.901 Y114.387 E273.42588*80
+N2045 G1 X115.146 Y114.863 E273.46298*89
+N2046 G1 X114.356 Y115.321 E273.50095*92
+N2047 G1 X113.533 Y115.760 E273.53972*93
+N2048 G1 X112.683 Y116.180 E273.57917*87
+N2049 G1 X111.808 Y116.581 E273.61919*86
+N2050 G1 X110.912 Y116.961 E273.65964*89
+N2051 G1 X110.000 Y117.321 E273.70040*86
+N2052 G1 X109.076 Y117.659 E273.74133*87
+N2053 G1 X108.144 Y117.976 E273.78226*94
+N2054 G1 X107.208 Y118.271 E273.82307*89
+N2055 G1 X106.272 Y118.544 E273.86360*80
+N2056 G1 X105.340 Y118.794 E273.90370*89
+N2057 G1 X104.417 Y119.021 E273.94325*80
+N2058 G1 X103.505 Y119.225 E273.98209*95
+N2059 G1 X102.609 Y119.406 E274.02011*88
+N2060 G1 X101.731 Y119.563 E274.05719*81
+N2061 G1 X100.875 Y119.696 E274.09322*87
+N2062 G1 X100.043 Y119.805 E274.12812*95
+N2063 G1 X99.237 Y119.890 E274.16179*98
+N2064 G1 X98.461 Y119.951 E274.19419*97
+N2065 G1 X97.714 Y119.988 E274.22525*108
+N2066 G1 X97.000 Y120.000 E274.25496*96
+N2067 G1 X96.318 Y119.988 E274.28331*110
+N2068 G1 X95.670 Y119.951 E274.31029*111
+N2069 G1 X95.056 Y119.890 E274.33596*99
+N2070 G1 X94.476 Y119.805 E274.36034*104
+N2071 G1 X93.929 Y119.696 E274.38354*102
+N2072 G1 X93.415 Y119.563 E274.40562*98
+N2073 G1 X92.932 Y119.406 E274.42673*105
+N2074 G1 X92.480 Y119.225 E274.44698*110
+N2075 G1 X92.056 Y119.021 E274.46653*99
+N2076 G1 X91.660 Y118.794 E274.48554*98
+N2077 G1 X91.288 Y118.544 E274.50417*97
+N2078 G1 X90.938 Y118.271 E274.52261*107
+N2079 G1 X90.609 Y117.976 E274.54099*103
+N2080 G1 X90.297 Y117.659 E274.55948*100
+N2081 G1 X90.000 Y117.321 E274.57820*110
+N2082 G1 X89.715 Y116.961 E274.59727*111
+N2083 G1 X89.440 Y116.581 E274.61679*110
+N2084 G1 X89.171 Y116.180 E274.63684*107
+N2085 G1 X88.907 Y115.760 E274.65748*110
+N2086 G1 X88.644 Y115.321 E274.67876*100
+N2087 G1 X88.381 Y114.863 E274.70073*110
+N2088 G1 X88.114 Y114.387 E274.72342*109
+N2089 G1 X87.843 Y113.893 E274.74685*105
+N2090 G1 X87.564 Y113.383 E274.77103*105
+N2091 G1 X87.277 Y112.856 E274.79597*104
+N2092 G1 X86.980 Y112.313 E274.82169*98
+N2093 G1 X86.673 Y111.756 E274.84816*97
+N2094 G1 X86.354 Y111.184 E274.87539*108
+N2095 G1 X86.023 Y110.598 E274.90336*105
+N2096 G1 X85.679 Y110.000 E274.93204*103
+N2097 G1 X85.325 Y109.389 E274.96140*102
+N2098 G1 X84.959 Y108.767 E274.99141*98
+N2099 G1 X84.582 Y108.135 E275.02202*111
+N2100 G1 X84.197 Y107.492 E275.05318*100
+N2101 G1 X83.804 Y106.840 E275.08482*106
+N2102 G1 X83.406 Y106.180 E275.11687*109
+N2103 G1 X83.004 Y105.513 E275.14927*103
+N2104 G1 X82.601 Y104.838 E275.18192*109
+N2105 G1 X82.200 Y104.158 E275.21476*99
+N2106 G1 X81.804 Y103.473 E275.24768*111
+N2107 G1 X81.415 Y102.783 E275.28060*108
+N2108 G1 X81.037 Y102.091 E275.31342*104
+N2109 G1 X80.672 Y101.395 E275.34606*107
+N2110 G1 X80.326 Y100.698 E275.37843*98
+N2111 G1 X80.000 Y100.000 E275.41046*111
+N2112 G1 X79.699 Y99.302 E275.44207*94
+N2113 G1 X79.425 Y98.605 E275.47321*95
+N2114 G1 X79.183 Y97.909 E275.50384*84
+N2115 G1 X78.974 Y97.217 E275.53392*84
+N2116 G1 X78.804 Y96.527 E275.56345*91
+N2117 G1 X78.674 Y95.842 E275.59246*83
+N2118 G1 X78.587 Y95.162 E275.62097*94
+N2119 G1 X78.545 Y94.487 E275.64906*89
+N2120 G1 X78.552 Y93.820 E275.67682*83
+N2121 G1 X78.608 Y93.160 E275.70436*88
+N2122 G1 X78.716 Y92.508 E275.73183*86
+N2123 G1 X78.876 Y91.865 E275.75937*90
+N2124 G1 X79.090 Y91.233 E275.78714*87
+N2125 G1 X79.357 Y90.611 E275.81529*81
+N2126 G1 X79.679 Y90.000 E275.84400*82
+N2127 G1 X80.055 Y89.402 E275.87338*92
+N2128 G1 X80.485 Y88.816 E275.90357*93
+N2129 G1 X80.966 Y88.244 E275.93466*87
+N2130 G1 X81.499 Y87.687 E275.96672*85
+N2131 G1 X82.081 Y87.144 E275.99980*95
+N2132 G1 X82.710 Y86.617 E276.03392*90
+N2133 G1 X83.384 Y86.107 E276.06906*87
+N2134 G1 X84.099 Y85.613 E276.10521*87
+N2135 G1 X84.854 Y85.137 E276.14231*92
+N2136 G1 X85.644 Y84.679 E276.18029*90
+N2137 G1 X86.467 Y84.240 E276.21905*88
+N2138 G1 X87.317 Y83.820 E276.25850*88
+N2139 G1 X88.192 Y83.419 E276.29852*81
+N2140 G1 X89.088 Y83.039 E276.33898*95
+N2141 G1 X90.000 Y82.679 E276.37974*82
+N2142 G1 X90.924 Y82.341 E276.42066*88
+N2143 G1 X91.856 Y82.024 E276.46160*95
+N2144 G1 X92.792 Y81.729 E276.50241*82
+N2145 G1 X93.728 Y81.456 E276.54293*83
+N2146 G1 X94.660 Y81.206 E276.58304*90
+N2147 G1 X95.583 Y80.979 E276.62258*87
+N2148 G1 X96.495 Y80.775 E276.66142*83
+N2149 G1 X97.391 Y80.594 E276.69944*92
+N2150 G1 X98.269 Y80.437 E276.73652*86
+N2151 G1 X99.125 Y80.304 E276.77256*94
+N2152 G1 X99.957 Y80.195 E276.80745*85
+N2153 G1 X100.763 Y80.110 E276.84113*96
+N2154 G1 X101.539 Y80.049 E276.87352*98
+N2155 G1 X102.286 Y80.012 E276.90459*103
+N2156 G1 X103.000 Y80.000 E276.93430*102
+N2157 G1 X103.682 Y80.012 E276.96264*106
+N2158 G1 X104.330 Y80.049 E276.98963*98
+N2159 G1 X104.944 Y80.110 E277.01529*100
+N2160 G1 X105.524 Y80.195 E277.03968*99
+N2161 G1 X106.071 Y80.304 E277.06287*97
+N2162 G1 X106.585 Y80.437 E277.08496*99
+N2163 G1 X107.068 Y80.594 E277.10606*111
+N2164 G1 X107.520 Y80.775 E277.12631*106
+N2165 G1 X107.944 Y80.979 E277.14586*110
+N2166 G1 X108.340 Y81.206 E277.16487*108
+N2167 G1 X108.712 Y81.456 E277.18351*111
+N2168 G1 X109.062 Y81.729 E277.20194*106
+N2169 G1 X109.391 Y82.024 E277.22033*99
+N2170 G1 X109.703 Y82.341 E277.23882*103
+N2171 G1 X110.000 Y82.679 E277.25754*102
+N2172 G1 X110.285 Y83.039 E277.27661*108
+N2173 G1 X110.560 Y83.419 E277.29613*108
+N2174 G1 X110.829 Y83.820 E277.31618*111
+N2175 G1 X111.093 Y84.240 E277.33681*111
+N2176 G1 X111.356 Y84.679 E277.35810*104
+N2177 G1 X111.619 Y85.137 E277.38007*104
+N2178 G1 X111.886 Y85.613 E277.40276*101
+N2179 G1 X112.157 Y86.107 E277.42618*109
+N2180 G1 X112.436 Y86.617 E277.45036*98
+N2181 G1 X112.723 Y87.144 E277.47531*100
+N2182 G1 X113.020 Y87.687 E277.50102*104
+N2183 G1 X113.327 Y88.244 E277.52750*106
+N2184 G1 X113.646 Y88.816 E277.55473*103
+N2185 G1 X113.977 Y89.402 E277.58269*99
+N2186 G1 X114.321 Y90.000 E277.61138*109
+N2187 G1 X114.675 Y90.611 E277.64074*98
+N2188 G1 X115.041 Y91.233 E277.67075*106
+N2189 G1 X115.418 Y91.865 E277.70136*106
+N2190 G1 X115.803 Y92.508 E277.73251*96
+N2191 G1 X116.196 Y93.160 E277.76415*111
+N2192 G1 X116.594 Y93.820 E277.79621*109
+N2193 G1 X116.996 Y94.487 E277.82860*107
+N2194 G1 X117.399 Y95.162 E277.86126*104
+N2195 G1 X117.800 Y95.842 E277.89409*110
+N2196 G1 X118.196 Y96.527 E277.92701*104
+N2197 G1 X118.585 Y97.217 E277.95993*104
+N2198 G1 X118.963 Y97.909 E277.99276*107
+N2199 G1 X119.328 Y98.605 E278.02540*109
+N2200 G1 X119.674 Y99.302 E278.05777*96
+N2201 G1 X120.000 Y100.000 E278.08980*85
+N2202 G1 E277.08980 F2400.00000*36
+N2203 G1 E278.08980 F2400.00000*42
+N2204 G1 X119.550 Y100.000 F7800.000*98
+N2205 G1 X119.852 Y100.682 E278.12082 F1800.000*41
+N2206 G1 X120.126 Y101.364 E278.15136*94
+N2207 G1 X120.370 Y102.044 E278.18139*94
+N2208 G1 X120.580 Y102.721 E278.21088*93
+N2209 G1 X120.753 Y103.395 E278.23981*88
+N2210 G1 X120.886 Y104.065 E278.26821*82
+N2211 G1 X120.977 Y104.730 E278.29611*89
+N2212 G1 X121.022 Y105.389 E278.32358*87
+N2213 G1 X121.020 Y106.041 E278.35072*92
+N2214 G1 X120.969 Y106.686 E278.37763*86
+N2215 G1 X120.867 Y107.324 E278.40445*83
+N2216 G1 X120.713 Y107.952 E278.43135*86
+N2217 G1 X120.506 Y108.570 E278.45847*88
+N2218 G1 X120.245 Y109.178 E278.48597*87
+N2219 G1 X119.931 Y109.775 E278.51402*90
+N2220 G1 X119.563 Y110.360 E278.54275*80
+N2221 G1 X119.142 Y110.932 E278.57229*81
+N2222 G1 X118.669 Y111.491 E278.60273*83
+N2223 G1 X118.146 Y112.036 E278.63414*86
+N2224 G1 X117.574 Y112.566 E278.66657*91
+N2225 G1 X116.956 Y113.082 E278.70004*94
+N2226 G1 X116.293 Y113.581 E278.73455*90
+N2227 G1 X115.588 Y114.063 E278.77006*93
+N2228 G1 X114.845 Y114.528 E278.80651*89
+N2229 G1 X114.066 Y114.976 E278.84385*94
+N2230 G1 X113.256 Y115.406 E278.88197*86
+N2231 G1 X112.418 Y115.816 E278.92078*92
+N2232 G1 X111.556 Y116.208 E278.96016*93
+N2233 G1 X110.674 Y116.579 E278.99997*80
+N2234 G1 X109.775 Y116.931 E279.04009*84
+N2235 G1 X108.865 Y117.262 E279.08037*87
+N2236 G1 X107.946 Y117.571 E279.12066*81
+N2237 G1 X107.025 Y117.860 E279.16082*95
+N2238 G1 X106.103 Y118.126 E279.20070*88
+N2239 G1 X105.186 Y118.371 E279.24015*80
+N2240 G1 X104.278 Y118.593 E279.27904*93
+N2241 G1 X103.381 Y118.793 E279.31724*85
+N2242 G1 X102.500 Y118.969 E279.35460*84
+N2243 G1 X101.638 Y119.123 E279.39103*85
+N2244 G1 X100.797 Y119.253 E279.42641*94
+N2245 G1 X99.980 Y119.360 E279.46065*99
+N2246 G1 X99.190 Y119.443 E279.49367*97
+N2247 G1 X98.429 Y119.502 E279.52542*105
+N2248 G1 X97.699 Y119.538 E279.55583*99
+N2249 G1 X97.000 Y119.550 E279.58489*108
+N2250 G1 X96.334 Y119.538 E279.61258*111
+N2251 G1 X95.702 Y119.502 E279.63891*104
+N2252 G1 X95.103 Y119.443 E279.66392*101
+N2253 G1 X94.539 Y119.360 E279.68766*111
+N2254 G1 X94.007 Y119.253 E279.71020*108
+N2255 G1 X93.508 Y119.123 E279.73163*96
+N2256 G1 X93.041 Y118.969 E279.75208*100
+N2257 G1 X92.604 Y118.793 E279.77168*111
+N2258 G1 X92.195 Y118.593 E279.79059*96
+N2259 G1 X91.814 Y118.371 E279.80896*101
+N2260 G1 X91.456 Y118.126 E279.82696*105
+N2261 G1 X91.121 Y117.860 E279.84476*99
+N2262 G1 X90.806 Y117.571 E279.86252*98
+N2263 G1 X90.508 Y117.262 E279.88039*100
+N2264 G1 X90.225 Y116.931 E279.89850*97
+N2265 G1 X89.954 Y116.579 E279.91696*104
+N2266 G1 X89.692 Y116.208 E279.93588*97
+N2267 G1 X89.436 Y115.816 E279.95531*110
+N2268 G1 X89.184 Y115.406 E279.97535*102
+N2269 G1 X88.934 Y114.976 E279.99602*103
+N2270 G1 X88.682 Y114.528 E280.01737*106
+N2271 G1 X88.427 Y114.063 E280.03944*100
+N2272 G1 X88.166 Y113.581 E280.06224*97
+N2273 G1 X87.899 Y113.082 E280.08579*97
+N2274 G1 X87.622 Y112.566 E280.11010*100
+N2275 G1 X87.335 Y112.036 E280.13517*102
+N2276 G1 X87.037 Y111.491 E280.16100*105
+N2277 G1 X86.727 Y110.932 E280.18758*111
+N2278 G1 X86.404 Y110.360 E280.21489*106
+N2279 G1 X86.069 Y109.775 E280.24292*101
+N2280 G1 X85.722 Y109.178 E280.27163*109
+N2281 G1 X85.363 Y108.570 E280.30099*98
+N2282 G1 X84.993 Y107.952 E280.33095*105
+N2283 G1 X84.614 Y107.324 E280.36145*106
+N2284 G1 X84.227 Y106.686 E280.39245*105
+N2285 G1 X83.834 Y106.041 E280.42387*105
+N2286 G1 X83.437 Y105.389 E280.45563*106
+N2287 G1 X83.038 Y104.730 E280.48766*109
+N2288 G1 X82.641 Y104.065 E280.51987*101
+N2289 G1 X82.247 Y103.395 E280.55217*107
+N2290 G1 X81.860 Y102.721 E280.58448*100
+N2291 G1 X81.484 Y102.044 E280.61670*100
+N2292 G1 X81.121 Y101.364 E280.64874*96
+N2293 G1 X80.775 Y100.682 E280.68051*104
+N2294 G1 X80.450 Y100.000 E280.71194*103
+N2295 G1 X80.148 Y99.318 E280.74296*85
+N2296 G1 X79.874 Y98.636 E280.77351*87
+N2297 G1 X79.630 Y97.956 E280.80354*83
+N2298 G1 X79.420 Y97.279 E280.83302*89
+N2299 G1 X79.247 Y96.605 E280.86196*91
+N2300 G1 X79.114 Y95.935 E280.89035*87
+N2301 G1 X79.023 Y95.270 E280.91826*90
+N2302 G1 X78.978 Y94.611 E280.94573*85
+N2303 G1 X78.980 Y93.959 E280.97286*89
+N2304 G1 X79.031 Y93.314 E280.99977*84
+N2305 G1 X79.133 Y92.676 E281.02660*92
+N2306 G1 X79.287 Y92.048 E281.05349*81
+N2307 G1 X79.494 Y91.430 E281.08061*88
+N2308 G1 X79.755 Y90.822 E281.10812*82
+N2309 G1 X80.069 Y90.225 E281.13617*88
+N2310 G1 X80.437 Y89.640 E281.16490*88
+N2311 G1 X80.858 Y89.068 E281.19444*86
+N2312 G1 X81.331 Y88.509 E281.22487*84
+N2313 G1 X81.854 Y87.964 E281.25629*84
+N2314 G1 X82.426 Y87.434 E281.28872*92
+N2315 G1 X83.044 Y86.918 E281.32219*82
+N2316 G1 X83.707 Y86.419 E281.35670*81
+N2317 G1 X84.412 Y85.937 E281.39220*95
+N2318 G1 X85.155 Y85.472 E281.42866*95
+N2319 G1 X85.934 Y85.024 E281.46600*92
+N2320 G1 X86.744 Y84.594 E281.50412*85
+N2321 G1 X87.582 Y84.184 E281.54293*83
+N2322 G1 X88.444 Y83.792 E281.58231*86
+N2323 G1 X89.326 Y83.421 E281.62212*86
+N2324 G1 X90.225 Y83.069 E281.66224*82
+N2325 G1 X91.135 Y82.738 E281.70251*87
+N2326 G1 X92.054 Y82.429 E281.74280*90
+N2327 G1 X92.975 Y82.140 E281.78296*80
+N2328 G1 X93.897 Y81.874 E281.82284*88
+N2329 G1 X94.814 Y81.629 E281.86230*88
+N2330 G1 X95.722 Y81.407 E281.90119*90
+N2331 G1 X96.619 Y81.207 E281.93938*95
+N2332 G1 X97.500 Y81.031 E281.97675*83
+N2333 G1 X98.362 Y80.877 E282.01318*86
+N2334 G1 X99.203 Y80.747 E282.04856*94
+N2335 G1 X100.020 Y80.640 E282.08280*102
+N2336 G1 X100.810 Y80.557 E282.11582*102
+N2337 G1 X101.571 Y80.498 E282.14756*96
+N2338 G1 X102.301 Y80.462 E282.17798*105
+N2339 G1 X103.000 Y80.450 E282.20703*108
+N2340 G1 X103.666 Y80.462 E282.23472*99
+N2341 G1 X104.298 Y80.498 E282.26106*102
+N2342 G1 X104.897 Y80.557 E282.28607*106
+N2343 G1 X105.461 Y80.640 E282.30980*99
+N2344 G1 X105.993 Y80.747 E282.33234*101
+N2345 G1 X106.492 Y80.877 E282.35378*104
+N2346 G1 X106.959 Y81.031 E282.37423*97
+N2347 G1 X107.396 Y81.207 E282.39383*108
+N2348 G1 X107.805 Y81.407 E282.41274*98
+N2349 G1 X108.186 Y81.629 E282.43111*98
+N2350 G1 X108.544 Y81.874 E282.44911*105
+N2351 G1 X108.879 Y82.140 E282.46691*99
+N2352 G1 X109.194 Y82.429 E282.48467*100
+N2353 G1 X109.492 Y82.738 E282.50254*106
+N2354 G1 X109.775 Y83.069 E282.52065*103
+N2355 G1 X110.046 Y83.421 E282.53911*106
+N2356 G1 X110.308 Y83.792 E282.55802*110
+N2357 G1 X110.564 Y84.184 E282.57746*104
+N2358 G1 X110.816 Y84.594 E282.59749*107
+N2359 G1 X111.066 Y85.024 E282.61816*101
+N2360 G1 X111.318 Y85.472 E282.63952*97
+N2361 G1 X111.573 Y85.937 E282.66158*96
+N2362 G1 X111.834 Y86.419 E282.68438*98
+N2363 G1 X112.101 Y86.918 E282.70793*104
+N2364 G1 X112.378 Y87.434 E282.73224*107
+N2365 G1 X112.665 Y87.964 E282.75731*108
+N2366 G1 X112.963 Y88.509 E282.78314*96
+N2367 G1 X113.273 Y89.068 E282.80972*100
+N2368 G1 X113.596 Y89.640 E282.83704*103
+N2369 G1 X113.931 Y90.225 E282.86507*108
+N2370 G1 X114.278 Y90.822 E282.89378*105
+N2371 G1 X114.637 Y91.430 E282.92313*110
+N2372 G1 X115.007 Y92.048 E282.95309*109
+N2373 G1 X115.386 Y92.676 E282.98360*111
+N2374 G1 X115.773 Y93.314 E283.01460*96
+N2375 G1 X116.166 Y93.959 E283.04601*99
+N2376 G1 X116.563 Y94.611 E283.07778*105
+N2377 G1 X116.962 Y95.270 E283.10981*105
+N2378 G1 X117.359 Y95.935 E283.14202*107
+N2379 G1 X117.753 Y96.605 E283.17432*109
+N2380 G1 X118.140 Y97.279 E283.20663*108
+N2381 G1 X118.516 Y97.956 E283.23885*105
+N2382 G1 X118.879 Y98.636 E283.27088*105
+N2383 G1 X119.225 Y99.318 E283.30266*102
+N2384 G1 X119.550 Y100.000 E283.33409*83
+N2385 G1 E282.33409 F2400.00000*36
+N2386 G1 E283.33409 F2400.00000*38
+N2387 G1 X119.100 Y100.000 F7800.000*105
+N2388 G1 X119.402 Y100.667 E283.36452 F1800.000*36
+N2389 G1 X119.677 Y101.332 E283.39447*91
+N2390 G1 X119.922 Y101.996 E283.42391*88
+N2391 G1 X120.134 Y102.658 E283.45280*84
+N2392 G1 X120.310 Y103.317 E283.48114*95
+N2393 G1 X120.446 Y103.971 E283.50893*95
+N2394 G1 X120.540 Y104.621 E283.53622*85
+N2395 G1 X120.590 Y105.265 E283.56308*84
+N2396 G1 X120.592 Y105.902 E283.58959*95
+N2397 G1 X120.546 Y106.533 E283.61587*95
+N2398 G1 X120.450 Y107.155 E283.64206*88
+N2399 G1 X120.302 Y107.769 E283.66830*93
+N2400 G1 X120.101 Y108.373 E283.69477*91
+N2401 G1 X119.848 Y108.967 E283.72163*81
+N2402 G1 X119.541 Y109.550 E283.74903*87
+N2403 G1 X119.181 Y110.121 E283.77710*91
+N2404 G1 X118.769 Y110.681 E283.80599*91
+N2405 G1 X118.305 Y111.227 E283.83578*81
+N2406 G1 X117.792 Y111.759 E283.86654*83
+N2407 G1 X117.230 Y112.277 E283.89833*85
+N2408 G1 X116.621 Y112.780 E283.93115*84
+N2409 G1 X115.969 Y113.268 E283.96502*80
+N2410 G1 X115.275 Y113.739 E283.99988*94
+N2411 G1 X114.544 Y114.194 E284.03570*82
+N2412 G1 X113.777 Y114.631 E284.07239*82
+N2413 G1 X112.979 Y115.051 E284.10988*84
+N2414 G1 X112.154 Y115.452 E284.14804*82
+N2415 G1 X111.304 Y115.835 E284.18678*83
+N2416 G1 X110.435 Y116.198 E284.22595*80
+N2417 G1 X109.550 Y116.541 E284.26542*85
+N2418 G1 X108.653 Y116.864 E284.30505*85
+N2419 G1 X107.749 Y117.167 E284.34470*93
+N2420 G1 X106.842 Y117.449 E284.38421*83
+N2421 G1 X105.935 Y117.709 E284.42344*94
+N2422 G1 X105.033 Y117.948 E284.46225*91
+N2423 G1 X104.139 Y118.165 E284.50049*87
+N2424 G1 X103.257 Y118.360 E284.53803*94
+N2425 G1 X102.391 Y118.533 E284.57475*92
+N2426 G1 X101.544 Y118.683 E284.61052*94
+N2427 G1 X100.719 Y118.810 E284.64525*80
+N2428 G1 X99.918 Y118.914 E284.67884*97
+N2429 G1 X99.143 Y118.995 E284.71121*110
+N2430 G1 X98.398 Y119.053 E284.74230*103
+N2431 G1 X97.683 Y119.088 E284.77206*102
+N2432 G1 X97.000 Y119.100 E284.80046*103
+N2433 G1 X96.350 Y119.088 E284.82750*98
+N2434 G1 X95.733 Y119.053 E284.85318*110
+N2435 G1 X95.150 Y118.995 E284.87754*96
+N2436 G1 X94.601 Y118.914 E284.90062*108
+N2437 G1 X94.085 Y118.810 E284.92251*98
+N2438 G1 X93.602 Y118.683 E284.94329*111
+N2439 G1 X93.150 Y118.533 E284.96309*102
+N2440 G1 X92.728 Y118.360 E284.98204*98
+N2441 G1 X92.334 Y118.165 E285.00030*104
+N2442 G1 X91.967 Y117.948 E285.01803*101
+N2443 G1 X91.625 Y117.709 E285.03540*110
+N2444 G1 X91.304 Y117.449 E285.05257*111
+N2445 G1 X91.003 Y117.167 E285.06971*111
+N2446 G1 X90.720 Y116.864 E285.08697*105
+N2447 G1 X90.450 Y116.541 E285.10447*96
+N2448 G1 X90.192 Y116.198 E285.12232*98
+N2449 G1 X89.943 Y115.835 E285.14063*98
+N2450 G1 X89.700 Y115.452 E285.15946*97
+N2451 G1 X89.461 Y115.051 E285.17889*99
+N2452 G1 X89.223 Y114.631 E285.19895*98
+N2453 G1 X88.983 Y114.194 E285.21969*98
+N2454 G1 X88.739 Y113.739 E285.24114*107
+N2455 G1 X88.490 Y113.268 E285.26331*108
+N2456 G1 X88.233 Y112.780 E285.28623*106
+N2457 G1 X87.967 Y112.277 E285.30990*109
+N2458 G1 X87.690 Y111.759 E285.33433*104
+N2459 G1 X87.401 Y111.227 E285.35951*96
+N2460 G1 X87.100 Y110.681 E285.38544*98
+N2461 G1 X86.786 Y110.121 E285.41211*110
+N2462 G1 X86.459 Y109.550 E285.43948*99
+N2463 G1 X86.119 Y108.967 E285.46754*108
+N2464 G1 X85.767 Y108.373 E285.49625*96
+N2465 G1 X85.404 Y107.769 E285.52556*106
+N2466 G1 X85.031 Y107.155 E285.55542*96
+N2467 G1 X84.650 Y106.533 E285.58577*111
+N2468 G1 X84.262 Y105.902 E285.61655*97
+N2469 G1 X83.869 Y105.265 E285.64768*102
+N2470 G1 X83.475 Y104.621 E285.67908*97
+N2471 G1 X83.081 Y103.971 E285.71067*101
+N2472 G1 X82.690 Y103.317 E285.74236*104
+N2473 G1 X82.306 Y102.658 E285.77406*106
+N2474 G1 X81.932 Y101.996 E285.80567*99
+N2475 G1 X81.570 Y101.332 E285.83711*108
+N2476 G1 X81.225 Y100.667 E285.86829*109
+N2477 G1 X80.900 Y100.000 E285.89913*97
+N2478 G1 X80.598 Y99.333 E285.92956*90
+N2479 G1 X80.323 Y98.668 E285.95951*87
+N2480 G1 X80.078 Y98.004 E285.98895*84
+N2481 G1 X79.866 Y97.342 E286.01784*86
+N2482 G1 X79.690 Y96.683 E286.04618*90
+N2483 G1 X79.554 Y96.029 E286.07397*87
+N2484 G1 X79.460 Y95.379 E286.10126*93
+N2485 G1 X79.410 Y94.735 E286.12812*90
+N2486 G1 X79.408 Y94.098 E286.15463*93
+N2487 G1 X79.454 Y93.467 E286.18091*82
+N2488 G1 X79.550 Y92.845 E286.20709*88
+N2489 G1 X79.698 Y92.231 E286.23334*94
+N2490 G1 X79.899 Y91.627 E286.25981*91
+N2491 G1 X80.152 Y91.033 E286.28667*91
+N2492 G1 X80.459 Y90.450 E286.31406*91
+N2493 G1 X80.819 Y89.879 E286.34214*93
+N2494 G1 X81.231 Y89.319 E286.37103*80
+N2495 G1 X81.695 Y88.773 E286.40081*89
+N2496 G1 X82.208 Y88.241 E286.43158*91
+N2497 G1 X82.770 Y87.723 E286.46337*80
+N2498 G1 X83.379 Y87.220 E286.49619*83
+N2499 G1 X84.031 Y86.732 E286.53005*93
+N2500 G1 X84.725 Y86.261 E286.56492*82
+N2501 G1 X85.456 Y85.806 E286.60074*84
+N2502 G1 X86.223 Y85.369 E286.63743*82
+N2503 G1 X87.021 Y84.949 E286.67492*80
+N2504 G1 X87.846 Y84.548 E286.71308*80
+N2505 G1 X88.696 Y84.165 E286.75182*82
+N2506 G1 X89.565 Y83.802 E286.79099*87
+N2507 G1 X90.450 Y83.459 E286.83046*92
+N2508 G1 X91.347 Y83.136 E286.87009*80
+N2509 G1 X92.251 Y82.833 E286.90974*92
+N2510 G1 X93.158 Y82.551 E286.94925*86
+N2511 G1 X94.065 Y82.291 E286.98848*82
+N2512 G1 X94.967 Y82.052 E287.02729*93
+N2513 G1 X95.861 Y81.835 E287.06553*91
+N2514 G1 X96.743 Y81.640 E287.10307*92
+N2515 G1 X97.609 Y81.467 E287.13979*84
+N2516 G1 X98.456 Y81.317 E287.17556*85
+N2517 G1 X99.281 Y81.190 E287.21029*92
+N2518 G1 X100.082 Y81.086 E287.24388*104
+N2519 G1 X100.857 Y81.005 E287.27625*99
+N2520 G1 X101.602 Y80.947 E287.30734*111
+N2521 G1 X102.317 Y80.912 E287.33710*105
+N2522 G1 X103.000 Y80.900 E287.36550*110
+N2523 G1 X103.650 Y80.912 E287.39254*99
+N2524 G1 X104.267 Y80.947 E287.41822*103
+N2525 G1 X104.850 Y81.005 E287.44257*107
+N2526 G1 X105.399 Y81.086 E287.46566*107
+N2527 G1 X105.915 Y81.190 E287.48754*111
+N2528 G1 X106.398 Y81.317 E287.50833*102
+N2529 G1 X106.850 Y81.467 E287.52813*104
+N2530 G1 X107.272 Y81.640 E287.54708*111
+N2531 G1 X107.666 Y81.835 E287.56534*108
+N2532 G1 X108.033 Y82.052 E287.58307*100
+N2533 G1 X108.375 Y82.291 E287.60044*102
+N2534 G1 X108.696 Y82.551 E287.61761*99
+N2535 G1 X108.997 Y82.833 E287.63475*97
+N2536 G1 X109.280 Y83.136 E287.65201*96
+N2537 G1 X109.550 Y83.459 E287.66950*107
+N2538 G1 X109.808 Y83.802 E287.68736*102
+N2539 G1 X110.057 Y84.165 E287.70567*109
+N2540 G1 X110.300 Y84.548 E287.72450*110
+N2541 G1 X110.539 Y84.949 E287.74392*97
+N2542 G1 X110.777 Y85.369 E287.76399*106
+N2543 G1 X111.017 Y85.806 E287.78473*100
+N2544 G1 X111.261 Y86.261 E287.80617*111
+N2545 G1 X111.510 Y86.732 E287.82835*96
+N2546 G1 X111.767 Y87.220 E287.85127*107
+N2547 G1 X112.033 Y87.723 E287.87494*102
+N2548 G1 X112.310 Y88.241 E287.89937*111
+N2549 G1 X112.599 Y88.773 E287.92455*110
+N2550 G1 X112.900 Y89.319 E287.95048*108
+N2551 G1 X113.214 Y89.879 E287.97715*98
+N2552 G1 X113.541 Y90.450 E288.00452*104
+N2553 G1 X113.881 Y91.033 E288.03258*103
+N2554 G1 X114.233 Y91.627 E288.06128*102
+N2555 G1 X114.596 Y92.231 E288.09059*103
+N2556 G1 X114.969 Y92.845 E288.12045*102
+N2557 G1 X115.350 Y93.467 E288.15081*100
+N2558 G1 X115.738 Y94.098 E288.18159*107
+N2559 G1 X116.131 Y94.735 E288.21272*102
+N2560 G1 X116.525 Y95.379 E288.24412*101
+N2561 G1 X116.919 Y96.029 E288.27571*101
+N2562 G1 X117.310 Y96.683 E288.30740*100
+N2563 G1 X117.694 Y97.342 E288.33910*109
+N2564 G1 X118.068 Y98.004 E288.37071*100
+N2565 G1 X118.430 Y98.668 E288.40215*96
+N2566 G1 X118.775 Y99.333 E288.43333*109
+N2567 G1 X119.100 Y100.000 E288.46417*95
+N2568 G1 E287.46417 F2400.00000*41
+N2569 G0 X85.000 Y84.000 F7800*120
+N2570 G1 X115.000 Y84.000 E288.71157 F3000*9
+N2571 G0 X115.000 Y84.550 F7800*73
+N2572 G1 X85.000 Y84.550 E289.95897 F3000*61
+N2573 G0 X85.000 Y85.100 F7800*115
+N2574 G1 X115.000 Y85.100 E291.20637 F3000*0
+N2575 G0 X115.000 Y85.650 F7800*79
+N2576 G1 X85.000 Y85.650 E292.45377 F3000*57
+N2577 G0 X85.000 Y86.200 F7800*119
+N2578 G1 X115.000 Y86.200 E293.70117 F3000*14
+N2579 G0 X115.000 Y86.750 F7800*65
+N2580 G1 X85.000 Y86.750 E294.94857 F3000*49
+N2581 G0 X85.000 Y87.300 F7800*126
+N2582 G1 X115.000 Y87.300 E296.19597 F3000*13
+N2583 G0 X115.000 Y87.850 F7800*74
+N2584 G1 X85.000 Y87.850 E297.44337 F3000*56
+N2585 G0 X85.000 Y88.400 F7800*114
+N2586 G1 X115.000 Y88.400 E298.69077 F3000*3
+N2587 G0 X115.000 Y88.950 F7800*64
+N2588 G1 X85.000 Y88.950 E299.93817 F3000*55
+N2589 G0 X85.000 Y89.500 F7800*126
+N2590 G1 X115.000 Y89.500 E301.18557 F3000*4
+N2591 G0 X115.000 Y90.050 F7800*71
+N2592 G1 X85.000 Y90.050 E302.43297 F3000*48
+N2593 G0 X85.000 Y90.600 F7800*126
+N2594 G1 X115.000 Y90.600 E303.68037 F3000*13
+N2595 G0 X115.000 Y91.150 F7800*67
+N2596 G1 X85.000 Y91.150 E304.92777 F3000*53
+N2597 G0 X85.000 Y91.700 F7800*122
+N2598 G1 X115.000 Y91.700 E306.17517 F3000*11
+N2599 G0 X115.000 Y92.250 F7800*79
+N2600 G1 X85.000 Y92.250 E307.42257 F3000*48
+N2601 G0 X85.000 Y92.800 F7800*122
+N2602 G1 X115.000 Y92.800 E308.66997 F3000*11
+N2603 G0 X115.000 Y93.350 F7800*79
+N2604 G1 X85.000 Y93.350 E309.91737 F3000*55
+N2605 G0 X85.000 Y93.900 F7800*126
+N2606 G1 X115.000 Y93.900 E311.16477 F3000*3
+N2607 G0 X115.000 Y94.450 F7800*75
+N2608 G1 X85.000 Y94.450 E312.41217 F3000*59
+N2609 G0 X85.000 Y95.000 F7800*125
+N2610 G1 X115.000 Y95.000 E313.65957 F3000*2
+N2611 G0 X115.000 Y95.550 F7800*76
+N2612 G1 X85.000 Y95.550 E314.90697 F3000*54
+N2613 G0 X85.000 Y96.100 F7800*116
+N2614 G1 X115.000 Y96.100 E316.15437 F3000*13
+N2615 G0 X115.000 Y96.650 F7800*72
+N2616 G1 X85.000 Y96.650 E317.40177 F3000*53
+N2617 G0 X85.000 Y97.200 F7800*114
+N2618 G1 X115.000 Y97.200 E318.64917 F3000*4
+N2619 G0 X115.000 Y97.750 F7800*68
+N2620 G1 X85.000 Y97.750 E319.89657 F3000*62
+N2621 G0 X85.000 Y98.300 F7800*121
+N2622 G1 X115.000 Y98.300 E321.14397 F3000*12
+N2623 G0 X115.000 Y98.850 F7800*77
+N2624 G1 X85.000 Y98.850 E322.39137 F3000*56
+N2625 G0 X85.000 Y99.400 F7800*123
+N2626 G1 X115.000 Y99.400 E323.63877 F3000*9
+N2627 G0 X115.000 Y99.950 F7800*73
+N2628 G1 X85.000 Y99.950 E324.88617 F3000*61
+N2629 G0 X85.000 Y100.500 F7800*71
+N2630 G1 X115.000 Y100.500 E326.13357 F3000*53
+N2631 G0 X115.000 Y101.050 F7800*119
+N2632 G1 X85.000 Y101.050 E327.38097 F3000*9
+N2633 G0 X85.000 Y101.600 F7800*78
+N2634 G1 X115.000 Y101.600 E328.62837 F3000*54
+N2635 G0 X115.000 Y102.150 F7800*113
+N2636 G1 X85.000 Y102.150 E329.87577 F3000*14
+N2637 G0 X85.000 Y102.700 F7800*72
+N2638 G1 X115.000 Y102.700 E331.12317 F3000*62
+N2639 G0 X115.000 Y103.250 F7800*127
+N2640 G1 X85.000 Y103.250 E332.37057 F3000*11
+N2641 G0 X85.000 Y103.800 F7800*71
+N2642 G1 X115.000 Y103.800 E333.61797 F3000*55
+N2643 G0 X115.000 Y104.350 F7800*116
+N2644 G1 X85.000 Y104.350 E334.86537 F3000*6
+N2645 G0 X85.000 Y104.900 F7800*69
+N2646 G1 X115.000 Y104.900 E336.11277 F3000*60
+N2647 G0 X115.000 Y105.450 F7800*118
+N2648 G1 X85.000 Y105.450 E337.36017 F3000*3
+N2649 G0 X85.000 Y106.000 F7800*66
+N2650 G1 X115.000 Y106.000 E338.60757 F3000*63
+N2651 G0 X115.000 Y106.550 F7800*115
+N2652 G1 X85.000 Y106.550 E339.85497 F3000*0
+N2653 G0 X85.000 Y107.100 F7800*73
+N2654 G1 X115.000 Y107.100 E341.10237 F3000*49
+N2655 G0 X115.000 Y107.650 F7800*117
+N2656 G1 X85.000 Y107.650 E342.34977 F3000*3
+N2657 G0 X85.000 Y108.200 F7800*65
+N2658 G1 X115.000 Y108.200 E343.59717 F3000*57
+N2659 G0 X115.000 Y108.750 F7800*119
+N2660 G1 X85.000 Y108.750 E344.84457 F3000*10
+N2661 G0 X85.000 Y109.300 F7800*68
+N2662 G1 X115.000 Y109.300 E346.09197 F3000*62
+N2663 G0 X115.000 Y109.850 F7800*112
+N2664 G1 X85.000 Y109.850 E347.33937 F3000*4
+N2665 G0 X85.000 Y110.400 F7800*79
+N2666 G1 X115.000 Y110.400 E348.58677 F3000*54
+N2667 G0 X115.000 Y110.950 F7800*125
+N2668 G1 X85.000 Y110.950 E349.83417 F3000*11
+N2669 G0 X85.000 Y111.500 F7800*67
+N2670 G1 X115.000 Y111.500 E351.08157 F3000*57
+N2671 G0 X115.000 Y112.050 F7800*113
+N2672 G1 X85.000 Y112.050 E352.32897 F3000*15
+N2673 G0 X85.000 Y112.600 F7800*72
+N2674 G1 X115.000 Y112.600 E353.57637 F3000*52
+N2675 G0 X115.000 Y113.150 F7800*117
+N2676 G1 X85.000 Y113.150 E354.82377 F3000*3
+N2677 G0 X85.000 Y113.700 F7800*76
+N2678 G1 X115.000 Y113.700 E356.07117 F3000*61
+N2679 G0 X115.000 Y114.250 F7800*125
+N2680 G1 X85.000 Y114.250 E357.31857 F3000*12
+N2681 G0 X85.000 Y114.800 F7800*77
+N2682 G1 X115.000 Y114.800 E358.56597 F3000*54
+N2683 G0 X115.000 Y115.350 F7800*120
+N2684 G1 X85.000 Y115.350 E359.81337 F3000*0
+N2685 G0 X85.000 Y115.900 F7800*73
+N2686 G1 X115.000 Y115.900 E361.06077 F3000*54
+N2687 G0 X115.000 Y116.450 F7800*120
+N2688 G1 X85.000 Y116.450 E362.30817 F3000*3
+N2689 M106 S255*80
+N2690 M107*24
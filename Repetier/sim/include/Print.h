@@ -0,0 +1,54 @@
+/*
+    This file is part of the Repetier-Firmware for RF devices from Conrad Electronic SE.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SIM_PRINT_H
+#define SIM_PRINT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class Print {
+public:
+    virtual ~Print() { }
+    virtual size_t write(uint8_t) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+        size_t n = 0;
+        while (size--)
+            n += write(*buffer++);
+        return n;
+    }
+    size_t write(const char* str) {
+        return str ? write((const uint8_t*)str, strlen(str)) : 0;
+    }
+    size_t write(const char* buffer, size_t size) {
+        return write((const uint8_t*)buffer, size);
+    }
+    size_t print(const char* str) {
+        return write(str);
+    }
+    size_t println(const char* str = "") {
+        return write(str) + write("\r\n");
+    }
+};
+
+#endif // SIM_PRINT_H
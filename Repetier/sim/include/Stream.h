@@ -0,0 +1,54 @@
+/*
+    This file is part of the Repetier-Firmware for RF devices from Conrad Electronic SE.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SIM_STREAM_H
+#define SIM_STREAM_H
+
+#include "Print.h"
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    virtual void flush() = 0;
+};
+
+/** \brief Serial port of the simulation. Serial reads the G-code file and writes to the output file. The others are never connected. */
+class SimSerial : public Stream {
+    int port;
+
+public:
+    explicit SimSerial(int n)
+        : port(n) { }
+    void begin(unsigned long baud);
+    void end() { }
+    virtual int available();
+    virtual int read();
+    virtual int peek();
+    virtual void flush();
+    virtual size_t write(uint8_t c);
+    using Print::write;
+    operator bool() { return true; }
+};
+
+extern SimSerial Serial;
+extern SimSerial Serial1;
+extern SimSerial Serial2;
+extern SimSerial Serial3;
+
+#endif // SIM_STREAM_H
@@ -0,0 +1,59 @@
+/*
+    This file is part of the Repetier-Firmware for RF devices from Conrad Electronic SE.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SIM_WIRE_H
+#define SIM_WIRE_H
+
+/**
+  I2C library of the simulation. Every address answers. Addresses 0x50 to 0x57 are 24Cxx EEPROMs with a
+  16 bit memory address, the other devices return zeros.
+*/
+
+#include <stdint.h>
+#include "Stream.h"
+
+#define SIM_WIRE_BUFFER_SIZE 32
+
+class TwoWire : public Stream {
+    uint8_t address;
+    uint8_t txBuffer[SIM_WIRE_BUFFER_SIZE];
+    uint8_t txLength;
+    uint8_t rxBuffer[SIM_WIRE_BUFFER_SIZE];
+    uint8_t rxLength;
+    uint8_t rxPos;
+
+public:
+    TwoWire();
+    void begin() { }
+    void setClock(uint32_t) { }
+    void beginTransmission(uint8_t address);
+    void beginTransmission(int address) { beginTransmission((uint8_t)address); }
+    uint8_t endTransmission(uint8_t sendStop = true);
+    uint8_t requestFrom(uint8_t address, uint8_t quantity);
+    uint8_t requestFrom(int address, int quantity) { return requestFrom((uint8_t)address, (uint8_t)quantity); }
+    virtual size_t write(uint8_t data);
+    size_t write(int data) { return write((uint8_t)data); }
+    using Print::write;
+    virtual int available();
+    virtual int read();
+    virtual int peek();
+    virtual void flush() { }
+};
+
+extern TwoWire Wire;
+
+#endif // SIM_WIRE_H
@@ -0,0 +1,72 @@
+/*
+    This file is part of the Repetier-Firmware for RF devices from Conrad Electronic SE.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SIM_AVR_EEPROM_H
+#define SIM_AVR_EEPROM_H
+
+/** The EEPROM is kept in simEeprom[], which the simulator loads from and stores to a file. */
+
+#include <stdint.h>
+#include <string.h>
+#include "SimCore.h"
+
+inline uint8_t* simEepromAddress(const volatile void* p) {
+    return &simEeprom[(uintptr_t)p % SIM_EEPROM_SIZE];
+}
+
+inline uint8_t eeprom_read_byte(const uint8_t* p) {
+    return *simEepromAddress(p);
+}
+
+inline uint16_t eeprom_read_word(const void* p) {
+    uint16_t v;
+    memcpy(&v, simEepromAddress(p), 2);
+    return v;
+}
+
+inline uint32_t eeprom_read_dword(const void* p) {
+    uint32_t v;
+    memcpy(&v, simEepromAddress(p), 4);
+    return v;
+}
+
+inline void eeprom_read_block(void* dst, const void* src, size_t n) {
+    memcpy(dst, simEepromAddress(src), n);
+}
+
+inline void eeprom_write_byte(uint8_t* p, uint8_t v) {
+    *simEepromAddress(p) = v;
+}
+
+inline void eeprom_write_word(void* p, uint16_t v) {
+    memcpy(simEepromAddress(p), &v, 2);
+}
+
+inline void eeprom_write_dword(void* p, uint32_t v) {
+    memcpy(simEepromAddress(p), &v, 4);
+}
+
+inline void eeprom_write_block(const void* src, void* dst, size_t n) {
+    memcpy(simEepromAddress(dst), src, n);
+}
+
+#define eeprom_update_byte eeprom_write_byte
+#define eeprom_update_word eeprom_write_word
+#define eeprom_update_dword eeprom_write_dword
+#define eeprom_update_block eeprom_write_block
+
+#endif // SIM_AVR_EEPROM_H
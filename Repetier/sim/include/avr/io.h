@@ -0,0 +1,588 @@
+/*
+    This file is part of the Repetier-Firmware for RF devices from Conrad Electronic SE.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SIM_AVR_IO_H
+#define SIM_AVR_IO_H
+
+/**
+  Simulated ATmega2560 registers. Registers with side effects are objects of SimCore.h,
+  the others are plain variables. Bit numbers are the ones of the ATmega2560 datasheet.
+*/
+
+#include "SimCore.h"
+
+#define _BV(bit) (1 << (bit))
+#define _SFR_BYTE(sfr) (sfr)
+#define bit_is_set(sfr, bit) ((sfr) & _BV(bit))
+#define bit_is_clear(sfr, bit) (!((sfr) & _BV(bit)))
+
+// ---------------- I/O ports ----------------
+
+extern SimPortOut PORTA;
+extern SimPortIn PINA;
+#define DDRA (simPorts[SIM_PORT_A].ddr)
+extern SimPortOut PORTB;
+extern SimPortIn PINB;
+#define DDRB (simPorts[SIM_PORT_B].ddr)
+extern SimPortOut PORTC;
+extern SimPortIn PINC;
+#define DDRC (simPorts[SIM_PORT_C].ddr)
+extern SimPortOut PORTD;
+extern SimPortIn PIND;
+#define DDRD (simPorts[SIM_PORT_D].ddr)
+extern SimPortOut PORTE;
+extern SimPortIn PINE;
+#define DDRE (simPorts[SIM_PORT_E].ddr)
+extern SimPortOut PORTF;
+extern SimPortIn PINF;
+#define DDRF (simPorts[SIM_PORT_F].ddr)
+extern SimPortOut PORTG;
+extern SimPortIn PING;
+#define DDRG (simPorts[SIM_PORT_G].ddr)
+extern SimPortOut PORTH;
+extern SimPortIn PINH;
+#define DDRH (simPorts[SIM_PORT_H].ddr)
+extern SimPortOut PORTJ;
+extern SimPortIn PINJ;
+#define DDRJ (simPorts[SIM_PORT_J].ddr)
+extern SimPortOut PORTK;
+extern SimPortIn PINK;
+#define DDRK (simPorts[SIM_PORT_K].ddr)
+extern SimPortOut PORTL;
+extern SimPortIn PINL;
+#define DDRL (simPorts[SIM_PORT_L].ddr)
+
+#define PINA0 0
+#define PORTA0 0
+#define DDA0 0
+#define PINA1 1
+#define PORTA1 1
+#define DDA1 1
+#define PINA2 2
+#define PORTA2 2
+#define DDA2 2
+#define PINA3 3
+#define PORTA3 3
+#define DDA3 3
+#define PINA4 4
+#define PORTA4 4
+#define DDA4 4
+#define PINA5 5
+#define PORTA5 5
+#define DDA5 5
+#define PINA6 6
+#define PORTA6 6
+#define DDA6 6
+#define PINA7 7
+#define PORTA7 7
+#define DDA7 7
+#define PINB0 0
+#define PORTB0 0
+#define DDB0 0
+#define PINB1 1
+#define PORTB1 1
+#define DDB1 1
+#define PINB2 2
+#define PORTB2 2
+#define DDB2 2
+#define PINB3 3
+#define PORTB3 3
+#define DDB3 3
+#define PINB4 4
+#define PORTB4 4
+#define DDB4 4
+#define PINB5 5
+#define PORTB5 5
+#define DDB5 5
+#define PINB6 6
+#define PORTB6 6
+#define DDB6 6
+#define PINB7 7
+#define PORTB7 7
+#define DDB7 7
+#define PINC0 0
+#define PORTC0 0
+#define DDC0 0
+#define PINC1 1
+#define PORTC1 1
+#define DDC1 1
+#define PINC2 2
+#define PORTC2 2
+#define DDC2 2
+#define PINC3 3
+#define PORTC3 3
+#define DDC3 3
+#define PINC4 4
+#define PORTC4 4
+#define DDC4 4
+#define PINC5 5
+#define PORTC5 5
+#define DDC5 5
+#define PINC6 6
+#define PORTC6 6
+#define DDC6 6
+#define PINC7 7
+#define PORTC7 7
+#define DDC7 7
+#define PIND0 0
+#define PORTD0 0
+#define DDD0 0
+#define PIND1 1
+#define PORTD1 1
+#define DDD1 1
+#define PIND2 2
+#define PORTD2 2
+#define DDD2 2
+#define PIND3 3
+#define PORTD3 3
+#define DDD3 3
+#define PIND4 4
+#define PORTD4 4
+#define DDD4 4
+#define PIND5 5
+#define PORTD5 5
+#define DDD5 5
+#define PIND6 6
+#define PORTD6 6
+#define DDD6 6
+#define PIND7 7
+#define PORTD7 7
+#define DDD7 7
+#define PINE0 0
+#define PORTE0 0
+#define DDE0 0
+#define PINE1 1
+#define PORTE1 1
+#define DDE1 1
+#define PINE2 2
+#define PORTE2 2
+#define DDE2 2
+#define PINE3 3
+#define PORTE3 3
+#define DDE3 3
+#define PINE4 4
+#define PORTE4 4
+#define DDE4 4
+#define PINE5 5
+#define PORTE5 5
+#define DDE5 5
+#define PINE6 6
+#define PORTE6 6
+#define DDE6 6
+#define PINE7 7
+#define PORTE7 7
+#define DDE7 7
+#define PINF0 0
+#define PORTF0 0
+#define DDF0 0
+#define PINF1 1
+#define PORTF1 1
+#define DDF1 1
+#define PINF2 2
+#define PORTF2 2
+#define DDF2 2
+#define PINF3 3
+#define PORTF3 3
+#define DDF3 3
+#define PINF4 4
+#define PORTF4 4
+#define DDF4 4
+#define PINF5 5
+#define PORTF5 5
+#define DDF5 5
+#define PINF6 6
+#define PORTF6 6
+#define DDF6 6
+#define PINF7 7
+#define PORTF7 7
+#define DDF7 7
+#define PING0 0
+#define PORTG0 0
+#define DDG0 0
+#define PING1 1
+#define PORTG1 1
+#define DDG1 1
+#define PING2 2
+#define PORTG2 2
+#define DDG2 2
+#define PING3 3
+#define PORTG3 3
+#define DDG3 3
+#define PING4 4
+#define PORTG4 4
+#define DDG4 4
+#define PING5 5
+#define PORTG5 5
+#define DDG5 5
+#define PING6 6
+#define PORTG6 6
+#define DDG6 6
+#define PING7 7
+#define PORTG7 7
+#define DDG7 7
+#define PINH0 0
+#define PORTH0 0
+#define DDH0 0
+#define PINH1 1
+#define PORTH1 1
+#define DDH1 1
+#define PINH2 2
+#define PORTH2 2
+#define DDH2 2
+#define PINH3 3
+#define PORTH3 3
+#define DDH3 3
+#define PINH4 4
+#define PORTH4 4
+#define DDH4 4
+#define PINH5 5
+#define PORTH5 5
+#define DDH5 5
+#define PINH6 6
+#define PORTH6 6
+#define DDH6 6
+#define PINH7 7
+#define PORTH7 7
+#define DDH7 7
+#define PINJ0 0
+#define PORTJ0 0
+#define DDJ0 0
+#define PINJ1 1
+#define PORTJ1 1
+#define DDJ1 1
+#define PINJ2 2
+#define PORTJ2 2
+#define DDJ2 2
+#define PINJ3 3
+#define PORTJ3 3
+#define DDJ3 3
+#define PINJ4 4
+#define PORTJ4 4
+#define DDJ4 4
+#define PINJ5 5
+#define PORTJ5 5
+#define DDJ5 5
+#define PINJ6 6
+#define PORTJ6 6
+#define DDJ6 6
+#define PINJ7 7
+#define PORTJ7 7
+#define DDJ7 7
+#define PINK0 0
+#define PORTK0 0
+#define DDK0 0
+#define PINK1 1
+#define PORTK1 1
+#define DDK1 1
+#define PINK2 2
+#define PORTK2 2
+#define DDK2 2
+#define PINK3 3
+#define PORTK3 3
+#define DDK3 3
+#define PINK4 4
+#define PORTK4 4
+#define DDK4 4
+#define PINK5 5
+#define PORTK5 5
+#define DDK5 5
+#define PINK6 6
+#define PORTK6 6
+#define DDK6 6
+#define PINK7 7
+#define PORTK7 7
+#define DDK7 7
+#define PINL0 0
+#define PORTL0 0
+#define DDL0 0
+#define PINL1 1
+#define PORTL1 1
+#define DDL1 1
+#define PINL2 2
+#define PORTL2 2
+#define DDL2 2
+#define PINL3 3
+#define PORTL3 3
+#define DDL3 3
+#define PINL4 4
+#define PORTL4 4
+#define DDL4 4
+#define PINL5 5
+#define PORTL5 5
+#define DDL5 5
+#define PINL6 6
+#define PORTL6 6
+#define DDL6 6
+#define PINL7 7
+#define PORTL7 7
+#define DDL7 7
+
+// ---------------- status register ----------------
+
+extern SimStatusRegister SREG;
+
+// ---------------- timer 0 ----------------
+
+extern uint8_t TCCR0A;
+extern uint8_t TCCR0B;
+extern SimTimer0Counter TCNT0;
+extern uint8_t OCR0A;
+extern uint8_t OCR0B;
+extern uint8_t TIMSK0;
+extern uint8_t TIFR0;
+
+#define TOIE0 0
+#define OCIE0A 1
+#define OCIE0B 2
+#define TOV0 0
+#define OCF0A 1
+#define OCF0B 2
+#define WGM00 0
+#define WGM01 1
+#define WGM02 3
+#define CS00 0
+#define CS01 1
+#define CS02 2
+
+// ---------------- timer 1 ----------------
+
+extern uint8_t TCCR1A;
+extern uint8_t TCCR1B;
+extern uint8_t TCCR1C;
+extern SimTimer1Counter TCNT1;
+extern uint16_t OCR1A;
+extern uint16_t OCR1B;
+extern uint16_t OCR1C;
+extern uint16_t ICR1;
+extern uint8_t TIMSK1;
+extern uint8_t TIFR1;
+
+#define TOIE1 0
+#define OCIE1A 1
+#define OCIE1B 2
+#define OCIE1C 3
+#define ICIE1 5
+#define TOV1 0
+#define OCF1A 1
+#define OCF1B 2
+#define OCF1C 3
+#define ICF1 5
+#define WGM10 0
+#define WGM11 1
+#define WGM12 3
+#define WGM13 4
+#define CS10 0
+#define CS11 1
+#define CS12 2
+
+// ---------------- timer 2 ----------------
+
+extern uint8_t TCCR2A;
+extern uint8_t TCCR2B;
+extern uint8_t TCNT2;
+extern uint8_t OCR2A;
+extern uint8_t OCR2B;
+extern uint8_t TIMSK2;
+extern uint8_t TIFR2;
+
+// ---------------- timer 3, 4, 5 (servos and RGB light, not simulated) ----------------
+
+extern uint8_t TCCR3A;
+extern uint8_t TCCR3B;
+extern uint8_t TCCR3C;
+extern uint16_t TCNT3;
+extern uint16_t OCR3A;
+extern uint16_t OCR3B;
+extern uint16_t OCR3C;
+extern uint16_t ICR3;
+extern uint8_t TIMSK3;
+extern uint8_t TIFR3;
+
+#define OCIE3A 1
+#define OCIE3B 2
+#define OCIE3C 3
+#define OCF3A 1
+#define OCF3B 2
+#define OCF3C 3
+#define WGM30 0
+#define WGM31 1
+#define WGM32 3
+#define WGM33 4
+#define CS30 0
+#define CS31 1
+#define CS32 2
+#define COM3C0 2
+#define COM3C1 3
+#define COM3B0 4
+#define COM3B1 5
+#define COM3A0 6
+#define COM3A1 7
+
+extern uint8_t TCCR4A;
+extern uint8_t TCCR4B;
+extern uint8_t TCCR4C;
+extern uint16_t TCNT4;
+extern uint16_t OCR4A;
+extern uint16_t OCR4B;
+extern uint16_t OCR4C;
+extern uint16_t ICR4;
+extern uint8_t TIMSK4;
+extern uint8_t TIFR4;
+
+#define OCIE4A 1
+#define OCIE4B 2
+#define OCIE4C 3
+#define OCF4A 1
+#define OCF4B 2
+#define OCF4C 3
+#define WGM40 0
+#define WGM41 1
+#define WGM42 3
+#define WGM43 4
+#define CS40 0
+#define CS41 1
+#define CS42 2
+#define COM4C0 2
+#define COM4C1 3
+#define COM4B0 4
+#define COM4B1 5
+#define COM4A0 6
+#define COM4A1 7
+
+extern uint8_t TCCR5A;
+extern uint8_t TCCR5B;
+extern uint8_t TCCR5C;
+extern uint16_t TCNT5;
+extern uint16_t OCR5A;
+extern uint16_t OCR5B;
+extern uint16_t OCR5C;
+extern uint16_t ICR5;
+extern uint8_t TIMSK5;
+extern uint8_t TIFR5;
+
+#define OCIE5A 1
+#define OCIE5B 2
+#define OCIE5C 3
+#define OCF5A 1
+#define OCF5B 2
+#define OCF5C 3
+#define WGM50 0
+#define WGM51 1
+#define WGM52 3
+#define WGM53 4
+#define CS50 0
+#define CS51 1
+#define CS52 2
+#define COM5C0 2
+#define COM5C1 3
+#define COM5B0 4
+#define COM5B1 5
+#define COM5A0 6
+#define COM5A1 7
+
+// ---------------- ADC ----------------
+
+extern SimAdcControl ADCSRA;
+#define ADCSRB simAdcsrb
+#define ADMUX simAdmux
+#define ADCW simAdcw
+#define ADC simAdcw
+extern uint8_t DIDR0;
+extern uint8_t DIDR2;
+
+#define ADPS0 0
+#define ADPS1 1
+#define ADPS2 2
+#define ADIE 3
+#define ADIF 4
+#define ADATE 5
+#define ADSC 6
+#define ADEN 7
+#define MUX0 0
+#define MUX1 1
+#define MUX2 2
+#define MUX3 3
+#define MUX4 4
+#define ADLAR 5
+#define REFS0 6
+#define REFS1 7
+#define MUX5 3
+
+// ---------------- SPI ----------------
+
+extern uint8_t SPCR;
+extern SimSpiStatus SPSR;
+extern SimSpiData SPDR;
+
+#define SPR0 0
+#define SPR1 1
+#define CPHA 2
+#define CPOL 3
+#define MSTR 4
+#define DORD 5
+#define SPE 6
+#define SPIE 7
+#define SPI2X 0
+#define WCOL 6
+#define SPIF 7
+
+// ---------------- TWI ----------------
+
+extern SimTwiControl TWCR;
+#define TWSR simTwsr
+#define TWDR simTwdr
+extern uint8_t TWBR;
+extern uint8_t TWAR;
+
+#define TWIE 0
+#define TWEN 2
+#define TWWC 3
+#define TWSTO 4
+#define TWSTA 5
+#define TWEA 6
+#define TWINT 7
+#define TWPS0 0
+#define TWPS1 1
+
+// ---------------- reset and watchdog ----------------
+
+extern uint8_t MCUSR;
+extern uint8_t WDTCSR;
+
+#define PORF 0
+#define EXTRF 1
+#define BORF 2
+#define WDRF 3
+#define JTRF 4
+#define WDP0 0
+#define WDP1 1
+#define WDP2 2
+#define WDE 3
+#define WDCE 4
+#define WDP3 5
+#define WDIE 6
+#define WDIF 7
+
+// ---------------- interrupt vectors ----------------
+
+#define ISR(vector) extern "C" void vector(void)
+#define SIGNAL(vector) extern "C" void vector(void)
+
+#define RAMEND 0x21FF
+#define E2END 0x0FFF
+
+#endif // SIM_AVR_IO_H
@@ -0,0 +1,50 @@
+/*
+    This file is part of the Repetier-Firmware for RF devices from Conrad Electronic SE.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SIM_AVR_PGMSPACE_H
+#define SIM_AVR_PGMSPACE_H
+
+/** The host has one address space, so flash reads are plain reads with the type of the pointer. */
+
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+
+#define PROGMEM
+#define PGM_P const char*
+#define PSTR(s) (s)
+
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_byte_near(p) pgm_read_byte(p)
+#define pgm_read_word(p) (*(p))
+#define pgm_read_word_near(p) pgm_read_word(p)
+#define pgm_read_dword(p) (*(p))
+#define pgm_read_dword_near(p) pgm_read_dword(p)
+#define pgm_read_float(p) (*(const float*)(p))
+#define pgm_read_float_near(p) pgm_read_float(p)
+#define pgm_read_ptr(p) (*(p))
+
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strlen_P strlen
+#define memcpy_P memcpy
+#define sprintf_P sprintf
+#define snprintf_P snprintf
+
+#endif // SIM_AVR_PGMSPACE_H
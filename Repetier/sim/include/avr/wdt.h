@@ -0,0 +1,35 @@
+/*
+    This file is part of the Repetier-Firmware for RF devices from Conrad Electronic SE.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SIM_AVR_WDT_H
+#define SIM_AVR_WDT_H
+
+/** The watchdog only raises its 16 ms interrupt in the simulation, it never resets the CPU. */
+
+#include <avr/io.h>
+
+#define wdt_reset() \
+    do { \
+    } while (0)
+#define wdt_enable(timeout) \
+    do { \
+    } while (0)
+#define wdt_disable() \
+    do { \
+    } while (0)
+
+#endif // SIM_AVR_WDT_H
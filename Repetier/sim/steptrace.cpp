@@ -0,0 +1,485 @@
+/*
+    This file is part of the Repetier-Firmware for RF devices from Conrad Electronic SE.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+  Reads the binary step traces of rfsim.
+
+  steptrace dump file         lists every pin edge
+  steptrace stats file        steps, direction changes, shortest step interval and pulse per channel
+  steptrace histogram file    steps per stepper interrupt, intervals and their changes per channel
+  steptrace diff a b [cycles] compares the step times of two traces, exit code 1 if a step moved more than cycles
+  steptrace segments a b [steps] compares the segment traces (M3209) in two serial logs, exit code 1 if a ramp differs by more than steps
+  steptrace ringing file frequency damping [from]
+                              residual vibration of x and y in a mass-spring model, whenever an axis stops after from seconds
+  steptrace ringing a b ratio frequency damping [from]
+                              compares the residual vibration of two traces, exit code 1 if b is not below ratio times a
+  steptrace advance nominal advanced steps l k stepsPerMM
+                              compares the extruder of a trace with advance against the nominal extrusion plus the ideal advance,
+                              exit code 1 if it is more than steps away
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <vector>
+
+#include "SimTrace.h"
+
+static const char* const channelNames[SIM_CHANNELS] = { "x", "y", "z", "e0", "e1" };
+static const char* const eventNames[4] = { "step low", "step high", "dir low", "dir high" };
+
+struct TraceEvent {
+    uint64_t time;
+    uint8_t channel;
+    uint8_t event;
+};
+
+struct Trace {
+    uint32_t frequency;
+    std::vector<TraceEvent> events;
+};
+
+static bool readTrace(const char* name, Trace& trace) {
+    FILE* f = fopen(name, "rb");
+    if (!f) {
+        perror(name);
+        return false;
+    }
+    uint8_t header[SIM_TRACE_HEADER_SIZE];
+    if (fread(header, 1, sizeof(header), f) != sizeof(header) || memcmp(header, SIM_TRACE_MAGIC, 8) != 0) {
+        fprintf(stderr, "%s: not a step trace\n", name);
+        fclose(f);
+        return false;
+    }
+    trace.frequency = header[8] | (header[9] << 8) | (header[10] << 16) | ((uint32_t)header[11] << 24);
+    uint8_t bytes[8];
+    while (fread(bytes, 1, 8, f) == 8) {
+        uint64_t record = 0;
+        for (int i = 7; i >= 0; i--)
+            record = (record << 8) | bytes[i];
+        TraceEvent e;
+        e.time = record & SIM_TRACE_TIME_MASK;
+        e.channel = (record >> SIM_TRACE_CHANNEL_SHIFT) & 15;
+        e.event = (uint8_t)(record >> SIM_TRACE_EVENT_SHIFT);
+        if (e.channel < SIM_CHANNELS && e.event < 4)
+            trace.events.push_back(e);
+    }
+    fclose(f);
+    return true;
+} // readTrace
+
+/** \brief Times of the rising step edges of one channel. */
+static std::vector<uint64_t> stepTimes(const Trace& trace, uint8_t channel) {
+    std::vector<uint64_t> times;
+    for (size_t i = 0; i < trace.events.size(); i++)
+        if (trace.events[i].channel == channel && trace.events[i].event == SIM_EVENT_STEP_HIGH)
+            times.push_back(trace.events[i].time);
+    return times;
+} // stepTimes
+
+static int dump(const Trace& trace) {
+    for (size_t i = 0; i < trace.events.size(); i++) {
+        const TraceEvent& e = trace.events[i];
+        printf("%14.3f us  %-2s  %s\n", e.time * 1e6 / trace.frequency, channelNames[e.channel], eventNames[e.event]);
+    }
+    return 0;
+} // dump
+
+static int stats(const Trace& trace) {
+    printf("channel      steps  dir changes   first [s]    last [s]  min interval [cycles]  min pulse [cycles]\n");
+    for (uint8_t c = 0; c < SIM_CHANNELS; c++) {
+        uint64_t steps = 0, dirChanges = 0, first = 0, last = 0, minInterval = UINT64_MAX, minPulse = UINT64_MAX, rise = 0;
+        bool high = false;
+        for (size_t i = 0; i < trace.events.size(); i++) {
+            const TraceEvent& e = trace.events[i];
+            if (e.channel != c)
+                continue;
+            if (e.event == SIM_EVENT_DIR_LOW || e.event == SIM_EVENT_DIR_HIGH) {
+                dirChanges++;
+            } else if (e.event == SIM_EVENT_STEP_HIGH) {
+                if (steps && e.time - last < minInterval)
+                    minInterval = e.time - last;
+                if (!steps)
+                    first = e.time;
+                last = rise = e.time;
+                steps++;
+                high = true;
+            } else if (high) {
+                if (e.time - rise < minPulse)
+                    minPulse = e.time - rise;
+                high = false;
+            }
+        }
+        printf("%-7s %10llu %12llu %11.4f %11.4f %22llu %19llu\n", channelNames[c], (unsigned long long)steps, (unsigned long long)dirChanges,
+               (double)first / trace.frequency, (double)last / trace.frequency,
+               (unsigned long long)(minInterval == UINT64_MAX ? 0 : minInterval), (unsigned long long)(minPulse == UINT64_MAX ? 0 : minPulse));
+    }
+    return 0;
+} // stats
+
+/** \brief Steps at the same cycle come from one stepper interrupt, so the trace shows the step packing as bursts. The histogram counts the
+steps per burst, the intervals between the bursts and how much an interval differs from the one before, which shows the jumps of the
+step rate when the packing changes. */
+static int histogram(const Trace& trace) {
+    static const unsigned changeLimits[] = { 1, 5, 10, 25, 50 }; // [%]
+    const int changeSlots = sizeof(changeLimits) / sizeof(changeLimits[0]) + 1;
+    for (uint8_t c = 0; c < SIM_CHANNELS; c++) {
+        std::vector<uint64_t> times = stepTimes(trace, c);
+        if (times.empty())
+            continue;
+        uint64_t bursts[4] = { 0 }, intervals[64] = { 0 }, changes[changeSlots];
+        memset(changes, 0, sizeof(changes));
+        uint64_t burstCount = 0, previousInterval = 0;
+        for (size_t i = 0; i < times.size();) {
+            size_t n = 1;
+            while (i + n < times.size() && times[i + n] == times[i])
+                n++;
+            bursts[(n < 4 ? n : 4) - 1]++;
+            burstCount++;
+            if (i) {
+                uint64_t interval = times[i] - times[i - 1];
+                int slot = 0;
+                while ((interval >> (slot + 1)) != 0)
+                    slot++;
+                intervals[slot]++;
+                if (previousInterval) {
+                    uint64_t difference = interval > previousInterval ? interval - previousInterval : previousInterval - interval;
+                    int change = 0;
+                    while (change < changeSlots - 1 && difference * 100 >= changeLimits[change] * previousInterval)
+                        change++;
+                    changes[change]++;
+                }
+                previousInterval = interval;
+            }
+            i += n;
+        }
+
+        printf("%s: %zu steps in %llu stepper interrupts\n", channelNames[c], times.size(), (unsigned long long)burstCount);
+        printf("  steps per interrupt  ");
+        for (int k = 0; k < 4; k++)
+            printf("  %d%s: %llu (%.1f %%)", k + 1, k == 3 ? "+" : "", (unsigned long long)bursts[k], 100.0 * bursts[k] / burstCount);
+        printf("\n  interval [cycles]         count      share\n");
+        for (int slot = 0; slot < 64; slot++)
+            if (intervals[slot])
+                printf("  %8llu-%-10llu %10llu %9.2f %%\n", 1ULL << slot, (2ULL << slot) - 1, (unsigned long long)intervals[slot], 100.0 * intervals[slot] / (burstCount - 1));
+        uint64_t changeCount = 0;
+        for (int k = 0; k < changeSlots; k++)
+            changeCount += changes[k];
+        printf("  change of the interval");
+        for (int k = 0; k < changeSlots; k++) {
+            if (k < changeSlots - 1)
+                printf("  <%u %%: %.2f %%", changeLimits[k], changeCount ? 100.0 * changes[k] / changeCount : 0.0);
+            else
+                printf("  >=%u %%: %.2f %%", changeLimits[k - 1], changeCount ? 100.0 * changes[k] / changeCount : 0.0);
+        }
+        printf("\n");
+    }
+    return 0;
+} // histogram
+
+static int diff(const Trace& a, const Trace& b, uint64_t tolerance) {
+    int result = 0;
+    printf("channel    steps a    steps b  max shift [cycles]  mean shift [cycles]  first step beyond tolerance\n");
+    for (uint8_t c = 0; c < SIM_CHANNELS; c++) {
+        std::vector<uint64_t> ta = stepTimes(a, c), tb = stepTimes(b, c);
+        size_t n = ta.size() < tb.size() ? ta.size() : tb.size();
+        int64_t maxShift = 0;
+        double sum = 0;
+        long long firstBad = -1;
+        for (size_t i = 0; i < n; i++) {
+            int64_t shift = (int64_t)tb[i] - (int64_t)ta[i];
+            uint64_t magnitude = shift < 0 ? -shift : shift;
+            if (magnitude > (uint64_t)(maxShift < 0 ? -maxShift : maxShift))
+                maxShift = shift;
+            sum += shift;
+            if (magnitude > tolerance && firstBad < 0)
+                firstBad = (long long)i;
+        }
+        if (ta.size() != tb.size() || firstBad >= 0)
+            result = 1;
+        printf("%-7s %10zu %10zu %19lld %20.1f  ", channelNames[c], ta.size(), tb.size(), (long long)maxShift, n ? sum / n : 0.0);
+        if (firstBad >= 0)
+            printf("step %lld at %.6f s\n", firstBad, (double)ta[firstBad] / a.frequency);
+        else
+            printf("%s\n", ta.size() != tb.size() ? "step count differs" : "-");
+    }
+    return result;
+} // diff
+
+/** \brief One "ST:" line of the segment trace, see PrintLine::flushSegmentTrace(). */
+struct SegmentRecord {
+    long values[10]; // sequence, steps, vStart, vMax, vEnd, vReached, accelSteps, decelSteps, stepsLeft, calls
+};
+
+enum { SEGMENT_SEQUENCE, SEGMENT_STEPS, SEGMENT_V_START, SEGMENT_V_MAX, SEGMENT_V_END, SEGMENT_V_REACHED, SEGMENT_ACCEL_STEPS, SEGMENT_DECEL_STEPS, SEGMENT_STEPS_LEFT, SEGMENT_CALLS, SEGMENT_VALUES };
+
+static bool readSegments(const char* name, std::vector<SegmentRecord>& records) {
+    FILE* f = fopen(name, "r");
+    if (!f) {
+        perror(name);
+        return false;
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        SegmentRecord r;
+        long* v = r.values;
+        if (sscanf(line, "ST:%ld,%ld,%ld,%ld,%ld,%ld,%ld,%ld,%ld,%ld", &v[0], &v[1], &v[2], &v[3], &v[4], &v[5], &v[6], &v[7], &v[8], &v[9]) == SEGMENT_VALUES)
+            records.push_back(r);
+    }
+    fclose(f);
+    return true;
+} // readSegments
+
+static int segments(const std::vector<SegmentRecord>& a, const std::vector<SegmentRecord>& b, long tolerance) {
+    static const char* const names[SEGMENT_VALUES] = { "sequence", "steps", "vStart", "vMax", "vEnd", "vReached", "accelSteps", "decelSteps", "stepsLeft", "calls" };
+    int result = 0;
+    size_t n = a.size() < b.size() ? a.size() : b.size();
+    printf("segments a = %zu, b = %zu\n", a.size(), b.size());
+    if (a.size() != b.size()) {
+        printf("segment count differs\n");
+        result = 1;
+    }
+    for (size_t i = 0; i < n; i++) {
+        // a gap in the sequence numbers means the stepper interrupt dropped records, then the segments do not belong together anymore
+        if ((a[i].values[SEGMENT_SEQUENCE] & 255) != (long)(i & 255) || (b[i].values[SEGMENT_SEQUENCE] & 255) != (long)(i & 255)) {
+            printf("records were dropped before segment %zu\n", i);
+            return 1;
+        }
+        if (a[i].values[SEGMENT_STEPS] != b[i].values[SEGMENT_STEPS]) {
+            printf("segment %zu has %ld and %ld steps\n", i, a[i].values[SEGMENT_STEPS], b[i].values[SEGMENT_STEPS]);
+            return 1;
+        }
+    }
+    printf("value       max difference  segment  mean difference\n");
+    for (int k = SEGMENT_V_START; k < SEGMENT_VALUES; k++) {
+        long maxDifference = 0;
+        size_t maxSegment = 0;
+        double sum = 0;
+        for (size_t i = 0; i < n; i++) {
+            long difference = b[i].values[k] - a[i].values[k];
+            if (labs(difference) > labs(maxDifference)) {
+                maxDifference = difference;
+                maxSegment = i;
+            }
+            sum += difference;
+        }
+        bool ramp = (k == SEGMENT_ACCEL_STEPS || k == SEGMENT_DECEL_STEPS);
+        if (ramp && labs(maxDifference) > tolerance)
+            result = 1;
+        printf("%-10s %15ld %8zu %16.3f%s\n", names[k], maxDifference, maxSegment, n ? sum / n : 0.0, ramp && labs(maxDifference) > tolerance ? "  beyond tolerance" : "");
+    }
+    return result;
+} // segments
+
+/** \brief Residual vibration of one axis in a mass-spring model. */
+struct Ringing {
+    unsigned long stops;  ///< Number of times the axis stopped for at least one period
+    double maxAmplitude;  ///< Largest amplitude of the vibration after a stop in steps
+    double meanAmplitude; ///< Mean amplitude of the vibration after a stop in steps
+};
+
+/** \brief Feeds the steps of one channel into a carriage which is coupled to the motor by a damped spring: x'' = w² (u - x) + 2 d w (u' - x').
+The motor position u is the step count, every step moves it at once. Between two steps the deflection y = x - u swings freely, so it is
+propagated exactly. Whenever the next step is more than one period away, the axis stands still and the amplitude of the swing at the last step
+is the residual vibration, which input shaping should remove. Stops before from, e.g. of the homing, which is never shaped, are not counted. */
+static Ringing ringing(const Trace& trace, uint8_t channel, double frequency, double damping, uint64_t from) {
+    const double w = 2 * M_PI * frequency;
+    const double wd = w * sqrt(1 - damping * damping);
+    const double decay = damping * w;
+    const uint64_t period = (uint64_t)(trace.frequency / frequency);
+    Ringing result = { 0, 0, 0 };
+    double y = 0, v = 0; // deflection in steps and its speed in steps/s, the carriage rests before the first step
+    int dir = 1;
+    uint64_t last = 0;
+    bool moving = false;
+    for (size_t i = 0; i <= trace.events.size(); i++) {
+        bool end = (i == trace.events.size());
+        if (!end && trace.events[i].channel != channel)
+            continue;
+        if (!end && trace.events[i].event == SIM_EVENT_DIR_LOW) {
+            dir = -1;
+            continue;
+        }
+        if (!end && trace.events[i].event == SIM_EVENT_DIR_HIGH) {
+            dir = 1;
+            continue;
+        }
+        if (!end && trace.events[i].event != SIM_EVENT_STEP_HIGH)
+            continue;
+        uint64_t now = end ? last + period : trace.events[i].time;
+        if (moving && now - last >= period && last >= from) {
+            double amplitude = sqrt(y * y + (v + decay * y) * (v + decay * y) / (wd * wd));
+            result.stops++;
+            result.meanAmplitude += amplitude;
+            if (amplitude > result.maxAmplitude)
+                result.maxAmplitude = amplitude;
+        }
+        if (end)
+            break;
+        if (moving) {
+            double t = (double)(now - last) / trace.frequency;
+            double e = exp(-decay * t), c = cos(wd * t), s = sin(wd * t), b = (v + decay * y) / wd;
+            double swing = y * c + b * s;
+            v = e * (-decay * swing + wd * (b * c - y * s));
+            y = e * swing;
+        }
+        y -= dir;
+        v += 2 * decay * dir;
+        last = now;
+        moving = true;
+    }
+    if (result.stops)
+        result.meanAmplitude /= result.stops;
+    return result;
+} // ringing
+
+static int ringing(const Trace& a, const Trace* b, double ratio, double frequency, double damping, double from) {
+    int result = 0;
+    printf("mass-spring model: %.1f Hz, damping %.3f, stops after %.3f s\n", frequency, damping, from);
+    printf("channel   stops a  max [steps]  mean [steps]%s\n", b ? "   stops b  max [steps]  mean [steps]" : "");
+    for (uint8_t c = SIM_CHANNEL_X; c <= SIM_CHANNEL_Y; c++) {
+        Ringing ra = ringing(a, c, frequency, damping, (uint64_t)(from * a.frequency));
+        printf("%-7s %9lu %12.3f %13.3f", channelNames[c], ra.stops, ra.maxAmplitude, ra.meanAmplitude);
+        if (b) {
+            Ringing rb = ringing(*b, c, frequency, damping, (uint64_t)(from * b->frequency));
+            bool worse = (rb.stops != ra.stops || rb.meanAmplitude > ratio * ra.meanAmplitude);
+            if (worse)
+                result = 1;
+            printf(" %9lu %12.3f %13.3f%s", rb.stops, rb.maxAmplitude, rb.meanAmplitude, worse ? "  not reduced" : "");
+        }
+        printf("\n");
+    }
+    return result;
+} // ringing
+
+/** \brief Extruder position of a trace in steps at the times t0 + i * dt, counted with the direction pin. */
+static std::vector<long> extruderPositions(const Trace& trace, uint64_t t0, uint64_t dt, size_t n, unsigned long& dirChanges) {
+    std::vector<long> positions(n);
+    long position = 0;
+    int dir = 1;
+    size_t k = 0;
+    dirChanges = 0;
+    for (size_t i = 0; i < trace.events.size() && k < n; i++) {
+        const TraceEvent& e = trace.events[i];
+        if (e.channel != SIM_CHANNEL_E0)
+            continue;
+        while (k < n && t0 + k * dt < e.time)
+            positions[k++] = position;
+        if (e.event == SIM_EVENT_DIR_LOW || e.event == SIM_EVENT_DIR_HIGH) {
+            int newDir = (e.event == SIM_EVENT_DIR_HIGH ? 1 : -1);
+            if (newDir != dir)
+                dirChanges++;
+            dir = newDir;
+        } else if (e.event == SIM_EVENT_STEP_HIGH) {
+            position += dir;
+        }
+    }
+    while (k < n)
+        positions[k++] = position;
+    return positions;
+} // extruderPositions
+
+/** \brief Compares the extruder of a trace with advance against the ideal advance of the firmware: the nominal extrusion of a trace
+without advance plus (l * vE + k * vE²) * 0.001 * stepsPerMM, with vE in mm/s. The nominal position and its speed at every millisecond come
+from a straight line fitted through the nominal steps of the 20 ms around it, so the single steps do not show up as jumps of the speed.
+Only milliseconds with nominal steps before and after them in this window are counted, otherwise the fit would see the start or the end of
+the extrusion too early. Both traces must move x and y at the same times, which is the case as the advance only adds extruder steps. */
+static int advance(const Trace& nominal, const Trace& advanced, double tolerance, double l, double k, double stepsPerMM) {
+    const uint64_t dt = nominal.frequency / 1000;
+    const uint64_t window = 10 * dt; // on each side of the fit
+    uint64_t end = 0;
+    for (size_t i = 0; i < nominal.events.size(); i++)
+        end = nominal.events[i].time > end ? nominal.events[i].time : end;
+    size_t n = end / dt + 1;
+    unsigned long nominalChanges, advancedChanges;
+    std::vector<long> p = extruderPositions(nominal, 0, dt, n, nominalChanges);
+    std::vector<long> q = extruderPositions(advanced, 0, dt, n, advancedChanges);
+    std::vector<uint64_t> steps = stepTimes(nominal, SIM_CHANNEL_E0); // the nominal extruder only moves forward here
+
+    double maxError = 0, sumSquares = 0, maxAdvance = 0, maxErrorTime = 0;
+    size_t samples = 0, first = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t t = i * dt;
+        while (first < steps.size() && steps[first] + window < t)
+            first++;
+        size_t last = first, before = 0;
+        while (last < steps.size() && steps[last] <= t + window) {
+            if (steps[last] <= t)
+                before++;
+            last++;
+        }
+        if (!before || before == last - first || last - first < 3)
+            continue; // no extrusion on both sides of t
+        double sumX = 0, sumY = 0, sumXX = 0, sumXY = 0, count = last - first;
+        for (size_t j = first; j < last; j++) {
+            double x = ((double)steps[j] - (double)t) / nominal.frequency; // s
+            double y = (double)j + 1;                                      // position after the step
+            sumX += x;
+            sumY += y;
+            sumXX += x * x;
+            sumXY += x * y;
+        }
+        double slope = (count * sumXY - sumX * sumY) / (count * sumXX - sumX * sumX); // steps/s
+        double position = (sumY - slope * sumX) / count;
+        double speed = slope / stepsPerMM; // mm/s
+        double ideal = (speed > 0 ? (l * speed + k * speed * speed) * 0.001 * stepsPerMM : 0);
+        double error = q[i] - position - ideal;
+        if (ideal > maxAdvance)
+            maxAdvance = ideal;
+        if (fabs(error) > fabs(maxError)) {
+            maxError = error;
+            maxErrorTime = (double)t / nominal.frequency;
+        }
+        sumSquares += error * error;
+        samples++;
+    }
+    printf("ideal advance: l = %.3f, k = %.3f, %.2f steps/mm, largest advance %.1f steps\n", l, k, stepsPerMM, maxAdvance);
+    printf("samples of 1 ms while extruding: %zu\n", samples);
+    printf("max deviation %.2f steps at %.3f s, rms deviation %.2f steps\n", maxError, maxErrorTime, samples ? sqrt(sumSquares / samples) : 0.0);
+    printf("extruder direction changes: nominal %lu, advanced %lu\n", nominalChanges, advancedChanges);
+    // a move ends at the jerk speed of the planner, so the advance of that speed is still extruded at the end
+    printf("the extruder ends %ld steps away from the nominal one\n", q[n - 1] - p[n - 1]);
+    return (nominalChanges || fabs(maxError) > tolerance || labs(q[n - 1] - p[n - 1]) > tolerance) ? 1 : 0;
+} // advance
+
+int main(int argc, char** argv) {
+    Trace a, b;
+    if (argc == 3 && !strcmp(argv[1], "dump"))
+        return readTrace(argv[2], a) ? dump(a) : 2;
+    if (argc == 3 && !strcmp(argv[1], "stats"))
+        return readTrace(argv[2], a) ? stats(a) : 2;
+    if (argc == 3 && !strcmp(argv[1], "histogram"))
+        return readTrace(argv[2], a) ? histogram(a) : 2;
+    if ((argc == 4 || argc == 5) && !strcmp(argv[1], "diff"))
+        return readTrace(argv[2], a) && readTrace(argv[3], b) ? diff(a, b, argc == 5 ? strtoull(argv[4], NULL, 10) : 0) : 2;
+    if ((argc == 4 || argc == 5) && !strcmp(argv[1], "segments")) {
+        std::vector<SegmentRecord> sa, sb;
+        return readSegments(argv[2], sa) && readSegments(argv[3], sb) ? segments(sa, sb, argc == 5 ? strtol(argv[4], NULL, 10) : 0) : 2;
+    }
+    if ((argc == 5 || argc == 6) && !strcmp(argv[1], "ringing"))
+        return readTrace(argv[2], a) ? ringing(a, NULL, 0, atof(argv[3]), atof(argv[4]), argc == 6 ? atof(argv[5]) : 0) : 2;
+    if ((argc == 7 || argc == 8) && !strcmp(argv[1], "ringing"))
+        return readTrace(argv[2], a) && readTrace(argv[3], b) ? ringing(a, &b, atof(argv[4]), atof(argv[5]), atof(argv[6]), argc == 8 ? atof(argv[7]) : 0) : 2;
+    if (argc == 8 && !strcmp(argv[1], "advance"))
+        return readTrace(argv[2], a) && readTrace(argv[3], b) ? advance(a, b, atof(argv[4]), atof(argv[5]), atof(argv[6]), atof(argv[7])) : 2;
+    fprintf(stderr, "usage: %s dump file | stats file | histogram file | diff a b [cycles] | segments a b [steps]\n"
+                    "       | ringing file frequency damping [from] | ringing a b ratio frequency damping [from]\n"
+                    "       | advance nominal advanced steps l k stepsPerMM\n", argv[0]);
+    return 2;
+} // main
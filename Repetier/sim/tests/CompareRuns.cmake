@@ -0,0 +1,32 @@
+# Runs one G-code file on two variants of the simulation and compares their output with steptrace.
+#
+#   cmake -DSIM_A=rfsim-a -DSIM_B=rfsim-b -DSTEPTRACE=steptrace -DCOMPARE=segments -DTOLERANCE=1 -DGCODE=file.gcode -DOUTPUT=name [-DARGS=a,b] -P CompareRuns.cmake
+#
+# COMPARE is the steptrace command: "diff" and "ringing" compare the step traces, "segments" the segment traces (M3209) in the serial output.
+# ARGS are further arguments of the command, separated by commas.
+# The traces and logs are written to OUTPUT-a.bin, OUTPUT-a.log, OUTPUT-b.bin and OUTPUT-b.log.
+
+foreach(variable SIM_A SIM_B STEPTRACE COMPARE TOLERANCE GCODE OUTPUT)
+  if(NOT DEFINED ${variable})
+    message(FATAL_ERROR "CompareRuns.cmake: ${variable} is not set")
+  endif()
+endforeach()
+
+foreach(run a b)
+  string(TOUPPER ${run} variant)
+  execute_process(COMMAND ${SIM_${variant}} -t ${OUTPUT}-${run}.bin -l ${OUTPUT}-${run}.log ${GCODE} RESULT_VARIABLE result)
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${SIM_${variant}} failed with ${result}")
+  endif()
+endforeach()
+
+if(COMPARE STREQUAL "segments")
+  set(files ${OUTPUT}-a.log ${OUTPUT}-b.log)
+else()
+  set(files ${OUTPUT}-a.bin ${OUTPUT}-b.bin)
+endif()
+string(REPLACE "," ";" args "${ARGS}")
+execute_process(COMMAND ${STEPTRACE} ${COMPARE} ${files} ${TOLERANCE} ${args} RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "${COMPARE} differ by more than ${TOLERANCE}")
+endif()
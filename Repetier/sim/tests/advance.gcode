@@ -0,0 +1,31 @@
+; Extruding moves for the advance test: squares at two speeds, short segments and stops, so the advance rises and falls often.
+G28
+M109 S200
+G92 E0
+G1 Z0.3 F600
+G1 X60 Y60 F6000
+M400
+G1 X100 Y60 E1.32 F3600
+G1 X100 Y100 E2.64 F3600
+G1 X60 Y100 E3.96 F3600
+G1 X60 Y60 E5.28 F3600
+G1 X100 Y60 E6.60 F1200
+G1 X100 Y100 E7.92 F1200
+G1 X60 Y100 E9.24 F1200
+G1 X60 Y60 E10.56 F1200
+G4 P200
+G1 X62 Y60 E10.63 F3600
+G1 X62 Y62 E10.69 F3600
+G1 X64 Y62 E10.76 F3600
+G1 X64 Y64 E10.83 F3600
+G1 X66 Y64 E10.89 F3600
+G1 X66 Y66 E10.96 F3600
+G1 X68 Y66 E11.03 F3600
+G1 X68 Y68 E11.09 F3600
+G1 X90 Y68 E11.82 F4800
+G4 P200
+G1 X90 Y90 E12.55 F4800
+G1 X70 Y90 E13.21 F2400
+G1 X70 Y70 E13.87 F4800
+M400
+M104 S0
@@ -0,0 +1,292 @@
+; Moves for the planner tests: corners of all angles, a circle of short segments, a fine zigzag and slow moves.
+G28
+G1 Z2 F600
+G1 X60 Y60 F6000
+M400
+M3209 S1
+G1 X80.000 Y60.000 F6000
+G1 X95.000 Y60.000 F6000
+G1 X60.000 Y60.000 F9000
+G1 X80.000 Y60.000 F6000
+G1 X94.489 Y63.882 F6000
+G1 X60.000 Y60.000 F9000
+G1 X80.000 Y60.000 F6000
+G1 X92.990 Y67.500 F6000
+G1 X60.000 Y60.000 F9000
+G1 X80.000 Y60.000 F6000
+G1 X90.607 Y70.607 F6000
+G1 X60.000 Y60.000 F9000
+G1 X80.000 Y60.000 F6000
+G1 X87.500 Y72.990 F6000
+G1 X60.000 Y60.000 F9000
+G1 X80.000 Y60.000 F6000
+G1 X83.882 Y74.489 F6000
+G1 X60.000 Y60.000 F9000
+G1 X80.000 Y60.000 F6000
+G1 X80.000 Y75.000 F6000
+G1 X60.000 Y60.000 F9000
+G1 X80.000 Y60.000 F6000
+G1 X76.118 Y74.489 F6000
+G1 X60.000 Y60.000 F9000
+G1 X80.000 Y60.000 F6000
+G1 X72.500 Y72.990 F6000
+G1 X60.000 Y60.000 F9000
+G1 X80.000 Y60.000 F6000
+G1 X69.393 Y70.607 F6000
+G1 X60.000 Y60.000 F9000
+G1 X80.000 Y60.000 F6000
+G1 X67.010 Y67.500 F6000
+G1 X60.000 Y60.000 F9000
+G1 X80.000 Y60.000 F6000
+G1 X65.511 Y63.882 F6000
+G1 X60.000 Y60.000 F9000
+G1 X110.000 Y90.000 F6000
+G1 X109.988 Y90.698 F3000
+G1 X109.951 Y91.395 F3000
+G1 X109.890 Y92.091 F3000
+G1 X109.805 Y92.783 F3000
+G1 X109.696 Y93.473 F3000
+G1 X109.563 Y94.158 F3000
+G1 X109.406 Y94.838 F3000
+G1 X109.225 Y95.513 F3000
+G1 X109.021 Y96.180 F3000
+G1 X108.794 Y96.840 F3000
+G1 X108.544 Y97.492 F3000
+G1 X108.271 Y98.135 F3000
+G1 X107.976 Y98.767 F3000
+G1 X107.659 Y99.389 F3000
+G1 X107.321 Y100.000 F3000
+G1 X106.961 Y100.598 F3000
+G1 X106.581 Y101.184 F3000
+G1 X106.180 Y101.756 F3000
+G1 X105.760 Y102.313 F3000
+G1 X105.321 Y102.856 F3000
+G1 X104.863 Y103.383 F3000
+G1 X104.387 Y103.893 F3000
+G1 X103.893 Y104.387 F3000
+G1 X103.383 Y104.863 F3000
+G1 X102.856 Y105.321 F3000
+G1 X102.313 Y105.760 F3000
+G1 X101.756 Y106.180 F3000
+G1 X101.184 Y106.581 F3000
+G1 X100.598 Y106.961 F3000
+G1 X100.000 Y107.321 F3000
+G1 X99.389 Y107.659 F3000
+G1 X98.767 Y107.976 F3000
+G1 X98.135 Y108.271 F3000
+G1 X97.492 Y108.544 F3000
+G1 X96.840 Y108.794 F3000
+G1 X96.180 Y109.021 F3000
+G1 X95.513 Y109.225 F3000
+G1 X94.838 Y109.406 F3000
+G1 X94.158 Y109.563 F3000
+G1 X93.473 Y109.696 F3000
+G1 X92.783 Y109.805 F3000
+G1 X92.091 Y109.890 F3000
+G1 X91.395 Y109.951 F3000
+G1 X90.698 Y109.988 F3000
+G1 X90.000 Y110.000 F3000
+G1 X89.302 Y109.988 F3000
+G1 X88.605 Y109.951 F3000
+G1 X87.909 Y109.890 F3000
+G1 X87.217 Y109.805 F3000
+G1 X86.527 Y109.696 F3000
+G1 X85.842 Y109.563 F3000
+G1 X85.162 Y109.406 F3000
+G1 X84.487 Y109.225 F3000
+G1 X83.820 Y109.021 F3000
+G1 X83.160 Y108.794 F3000
+G1 X82.508 Y108.544 F3000
+G1 X81.865 Y108.271 F3000
+G1 X81.233 Y107.976 F3000
+G1 X80.611 Y107.659 F3000
+G1 X80.000 Y107.321 F3000
+G1 X79.402 Y106.961 F3000
+G1 X78.816 Y106.581 F3000
+G1 X78.244 Y106.180 F3000
+G1 X77.687 Y105.760 F3000
+G1 X77.144 Y105.321 F3000
+G1 X76.617 Y104.863 F3000
+G1 X76.107 Y104.387 F3000
+G1 X75.613 Y103.893 F3000
+G1 X75.137 Y103.383 F3000
+G1 X74.679 Y102.856 F3000
+G1 X74.240 Y102.313 F3000
+G1 X73.820 Y101.756 F3000
+G1 X73.419 Y101.184 F3000
+G1 X73.039 Y100.598 F3000
+G1 X72.679 Y100.000 F3000
+G1 X72.341 Y99.389 F3000
+G1 X72.024 Y98.767 F3000
+G1 X71.729 Y98.135 F3000
+G1 X71.456 Y97.492 F3000
+G1 X71.206 Y96.840 F3000
+G1 X70.979 Y96.180 F3000
+G1 X70.775 Y95.513 F3000
+G1 X70.594 Y94.838 F3000
+G1 X70.437 Y94.158 F3000
+G1 X70.304 Y93.473 F3000
+G1 X70.195 Y92.783 F3000
+G1 X70.110 Y92.091 F3000
+G1 X70.049 Y91.395 F3000
+G1 X70.012 Y90.698 F3000
+G1 X70.000 Y90.000 F3000
+G1 X70.012 Y89.302 F3000
+G1 X70.049 Y88.605 F3000
+G1 X70.110 Y87.909 F3000
+G1 X70.195 Y87.217 F3000
+G1 X70.304 Y86.527 F3000
+G1 X70.437 Y85.842 F3000
+G1 X70.594 Y85.162 F3000
+G1 X70.775 Y84.487 F3000
+G1 X70.979 Y83.820 F3000
+G1 X71.206 Y83.160 F3000
+G1 X71.456 Y82.508 F3000
+G1 X71.729 Y81.865 F3000
+G1 X72.024 Y81.233 F3000
+G1 X72.341 Y80.611 F3000
+G1 X72.679 Y80.000 F3000
+G1 X73.039 Y79.402 F3000
+G1 X73.419 Y78.816 F3000
+G1 X73.820 Y78.244 F3000
+G1 X74.240 Y77.687 F3000
+G1 X74.679 Y77.144 F3000
+G1 X75.137 Y76.617 F3000
+G1 X75.613 Y76.107 F3000
+G1 X76.107 Y75.613 F3000
+G1 X76.617 Y75.137 F3000
+G1 X77.144 Y74.679 F3000
+G1 X77.687 Y74.240 F3000
+G1 X78.244 Y73.820 F3000
+G1 X78.816 Y73.419 F3000
+G1 X79.402 Y73.039 F3000
+G1 X80.000 Y72.679 F3000
+G1 X80.611 Y72.341 F3000
+G1 X81.233 Y72.024 F3000
+G1 X81.865 Y71.729 F3000
+G1 X82.508 Y71.456 F3000
+G1 X83.160 Y71.206 F3000
+G1 X83.820 Y70.979 F3000
+G1 X84.487 Y70.775 F3000
+G1 X85.162 Y70.594 F3000
+G1 X85.842 Y70.437 F3000
+G1 X86.527 Y70.304 F3000
+G1 X87.217 Y70.195 F3000
+G1 X87.909 Y70.110 F3000
+G1 X88.605 Y70.049 F3000
+G1 X89.302 Y70.012 F3000
+G1 X90.000 Y70.000 F3000
+G1 X90.698 Y70.012 F3000
+G1 X91.395 Y70.049 F3000
+G1 X92.091 Y70.110 F3000
+G1 X92.783 Y70.195 F3000
+G1 X93.473 Y70.304 F3000
+G1 X94.158 Y70.437 F3000
+G1 X94.838 Y70.594 F3000
+G1 X95.513 Y70.775 F3000
+G1 X96.180 Y70.979 F3000
+G1 X96.840 Y71.206 F3000
+G1 X97.492 Y71.456 F3000
+G1 X98.135 Y71.729 F3000
+G1 X98.767 Y72.024 F3000
+G1 X99.389 Y72.341 F3000
+G1 X100.000 Y72.679 F3000
+G1 X100.598 Y73.039 F3000
+G1 X101.184 Y73.419 F3000
+G1 X101.756 Y73.820 F3000
+G1 X102.313 Y74.240 F3000
+G1 X102.856 Y74.679 F3000
+G1 X103.383 Y75.137 F3000
+G1 X103.893 Y75.613 F3000
+G1 X104.387 Y76.107 F3000
+G1 X104.863 Y76.617 F3000
+G1 X105.321 Y77.144 F3000
+G1 X105.760 Y77.687 F3000
+G1 X106.180 Y78.244 F3000
+G1 X106.581 Y78.816 F3000
+G1 X106.961 Y79.402 F3000
+G1 X107.321 Y80.000 F3000
+G1 X107.659 Y80.611 F3000
+G1 X107.976 Y81.233 F3000
+G1 X108.271 Y81.865 F3000
+G1 X108.544 Y82.508 F3000
+G1 X108.794 Y83.160 F3000
+G1 X109.021 Y83.820 F3000
+G1 X109.225 Y84.487 F3000
+G1 X109.406 Y85.162 F3000
+G1 X109.563 Y85.842 F3000
+G1 X109.696 Y86.527 F3000
+G1 X109.805 Y87.217 F3000
+G1 X109.890 Y87.909 F3000
+G1 X109.951 Y88.605 F3000
+G1 X109.988 Y89.302 F3000
+G1 X110.000 Y90.000 F3000
+G1 X40 Y40 F6000
+G1 X40.000 Y40.200 F4800
+G1 X70.000 Y40.400 F4800
+G1 X40.000 Y40.600 F4800
+G1 X70.000 Y40.800 F4800
+G1 X40.000 Y41.000 F4800
+G1 X70.000 Y41.200 F4800
+G1 X40.000 Y41.400 F4800
+G1 X70.000 Y41.600 F4800
+G1 X40.000 Y41.800 F4800
+G1 X70.000 Y42.000 F4800
+G1 X40.000 Y42.200 F4800
+G1 X70.000 Y42.400 F4800
+G1 X40.000 Y42.600 F4800
+G1 X70.000 Y42.800 F4800
+G1 X40.000 Y43.000 F4800
+G1 X70.000 Y43.200 F4800
+G1 X40.000 Y43.400 F4800
+G1 X70.000 Y43.600 F4800
+G1 X40.000 Y43.800 F4800
+G1 X70.000 Y44.000 F4800
+G1 X40.000 Y44.200 F4800
+G1 X70.000 Y44.400 F4800
+G1 X40.000 Y44.600 F4800
+G1 X70.000 Y44.800 F4800
+G1 X40.000 Y45.000 F4800
+G1 X70.000 Y45.200 F4800
+G1 X40.000 Y45.400 F4800
+G1 X70.000 Y45.600 F4800
+G1 X40.000 Y45.800 F4800
+G1 X70.000 Y46.000 F4800
+G1 X40.000 Y46.200 F4800
+G1 X70.000 Y46.400 F4800
+G1 X40.000 Y46.600 F4800
+G1 X70.000 Y46.800 F4800
+G1 X40.000 Y47.000 F4800
+G1 X70.000 Y47.200 F4800
+G1 X40.000 Y47.400 F4800
+G1 X70.000 Y47.600 F4800
+G1 X40.000 Y47.800 F4800
+G1 X70.000 Y48.000 F4800
+G1 X40.000 Y48.200 F4800
+G1 X70.000 Y48.400 F4800
+G1 X40.000 Y48.600 F4800
+G1 X70.000 Y48.800 F4800
+G1 X40.000 Y49.000 F4800
+G1 X70.000 Y49.200 F4800
+G1 X40.000 Y49.400 F4800
+G1 X70.000 Y49.600 F4800
+G1 X40.000 Y49.800 F4800
+G1 X70.000 Y50.000 F4800
+G1 X40.000 Y50.200 F4800
+G1 X70.000 Y50.400 F4800
+G1 X40.000 Y50.600 F4800
+G1 X70.000 Y50.800 F4800
+G1 X40.000 Y51.000 F4800
+G1 X70.000 Y51.200 F4800
+G1 X40.000 Y51.400 F4800
+G1 X70.000 Y51.600 F4800
+G1 X40.000 Y51.800 F4800
+G1 X70.000 Y52.000 F4800
+G1 X50 Y50 F300
+G1 X52 Y50 F120
+G1 Z3 F300
+G1 X100 Y100 F12000
+G1 Z2 F600
+M400
+M3209
+M3209 S0
@@ -0,0 +1,38 @@
+; Moves for the input shaping test: short and long moves of x and y with a pause after each, so the carriage rings out after every stop.
+G28
+G1 Z2 F600
+G1 X60 Y60 F6000
+M400
+G4 P300
+G1 X65 F9000
+G4 P300
+G1 X60 F9000
+G4 P300
+G1 X80 F9000
+G4 P300
+G1 X60 F9000
+G4 P300
+G1 X110 F9000
+G4 P300
+G1 X60 F9000
+G4 P300
+G1 Y65 F9000
+G4 P300
+G1 Y60 F9000
+G4 P300
+G1 Y80 F9000
+G4 P300
+G1 Y60 F9000
+G4 P300
+G1 Y110 F9000
+G4 P300
+G1 Y60 F9000
+G4 P300
+G1 X80 Y80 F9000
+G4 P300
+G1 X60 Y60 F9000
+G4 P300
+G1 X62 Y61 F3000
+G4 P300
+G1 X60 Y60 F3000
+G4 P300
@@ -3488,6 +3488,14 @@ void UIDisplay::changeSwitchCase(int action, int8_t increment) {
         rate = pgm_read_dword(&(baudrates[p]));
         if (rate == 0 && p >= 1)
             p--;
+
+        // skip the rates which the serial port can not reach, 9600 always works
+        signed char direction = (increment < 0 ? -1 : 1);
+        while (!HAL::serialBaudrateUsable(pgm_read_dword(&(baudrates[p])))) {
+            if (direction > 0 && pgm_read_dword(&(baudrates[p + 1])) == 0)
+                direction = -1; // there is no usable rate above
+            p += direction;
+        }
         baudrate = pgm_read_dword(&(baudrates[p]));
 
         HAL::eprSetInt32(EPR_BAUDRATE, baudrate);
@@ -5195,7 +5203,7 @@ void UIDisplay::fastAction() {
     if ((flags & (UI_FLAG_KEY_TEST_RUNNING + UI_FLAG_SLOW_KEY_ACTION)) == 0) {
         flags |= UI_FLAG_KEY_TEST_RUNNING;
 
-        int16_t nextAction = 0;
+        int nextAction = 0;
         uid.ui_check_keys(nextAction);
 
         if (lastButtonAction != nextAction) {
@@ -284,6 +284,13 @@ typedef struct
 
 } const UIMenuEntry;
 
+#ifdef SIMULATOR
+// The host simulation has no display. Its addresses do not fit into action, the menus can not be entered there.
+#define UI_MENU_ADDRESS(entries) ((unsigned int)(uintptr_t)&entries)
+#else
+#define UI_MENU_ADDRESS(entries) ((unsigned int)&entries)
+#endif // SIMULATOR
+
 typedef struct
 {
     // 0 = info page
@@ -555,17 +562,17 @@ extern char g_nServiceRequest;
 #define UI_MENU_ACTIONCOMMAND(name, row, action) UI_STRING(name##_txt, row) \
                                                  UIMenuEntry name PROGMEM = { name##_txt, 3, action, 0, 0 };
 #define UI_MENU_ACTIONSELECTOR(name, row, entries) UI_STRING(name##_txt, row) \
-                                                   UIMenuEntry name PROGMEM = { name##_txt, 2, (unsigned int)&entries, 0, 0 };
+                                                   UIMenuEntry name PROGMEM = { name##_txt, 2, UI_MENU_ADDRESS(entries), 0, 0 };
 #define UI_MENU_SUBMENU(name, row, entries) UI_STRING(name##_txt, row) \
-                                            UIMenuEntry name PROGMEM = { name##_txt, 2, (unsigned int)&entries, 0, 0 };
+                                            UIMenuEntry name PROGMEM = { name##_txt, 2, UI_MENU_ADDRESS(entries), 0, 0 };
 #define UI_MENU_CHANGEACTION_FILTER(name, row, action, filter, nofilter) UI_STRING(name##_txt, row) \
                                                                          UIMenuEntry name PROGMEM = { name##_txt, 4, action, filter, nofilter };
 #define UI_MENU_ACTIONCOMMAND_FILTER(name, row, action, filter, nofilter) UI_STRING(name##_txt, row) \
                                                                           UIMenuEntry name PROGMEM = { name##_txt, 3, action, filter, nofilter };
 #define UI_MENU_ACTIONSELECTOR_FILTER(name, row, entries, filter, nofilter) UI_STRING(name##_txt, row) \
-                                                                            UIMenuEntry name PROGMEM = { name##_txt, 2, (unsigned int)&entries, filter, nofilter };
+                                                                            UIMenuEntry name PROGMEM = { name##_txt, 2, UI_MENU_ADDRESS(entries), filter, nofilter };
 #define UI_MENU_SUBMENU_FILTER(name, row, entries, filter, nofilter) UI_STRING(name##_txt, row) \
-                                                                     UIMenuEntry name PROGMEM = { name##_txt, 2, (unsigned int)&entries, filter, nofilter };
+                                                                     UIMenuEntry name PROGMEM = { name##_txt, 2, UI_MENU_ADDRESS(entries), filter, nofilter };
 #define UI_MENU(name, items, itemsCnt) \
     const UIMenuEntry* const name##_entries[] PROGMEM = items; \
     const UIMenu name PROGMEM = { 2, 0, itemsCnt, name##_entries };